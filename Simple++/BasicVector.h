@@ -76,6 +76,23 @@ protected:
 	using Table<T>::protectedCtor;
 
 	BasicVector(BasicVector<T>::protectedCtor);
+
+	///@brief	Allocate a table, the inline table being used instead of the heap when big enough.
+	///			The inline table may be the current one, the callers copying the old data have to check it.
+	///@param	newSize	Number of elements of the table.
+	///@return	Allocated table.
+	T* _newTable(const Size newSize);
+
+	///@brief	Free a table allocated with _newTable().
+	///@param	table	Table to be freed (may be NULL or the inline table).
+	void _deleteTable(T* table);
+
+	///@brief	Get the number of elements of the inline table a derived class may provide (24 bytes).
+	///@return	Number of elements.
+	static constexpr Size _getInlineMaxSize();
+
+	///@brief	Table stored inside the derived object (BasicString small strings), NULL if none.
+	T* inlineTable{ NULL };
 };
 
 template<typename T>
@@ -91,21 +108,31 @@ inline BasicVector<T>::BasicVector(const Size size) :
 template<typename T>
 inline BasicVector<T>::BasicVector(BasicVector<T> && v) :
 	Table<T>(Utility::toRValue(v))
-{}
+{
+	// The inline table of v can't be taken.
+	if ( this->dataTable && this->dataTable == v.inlineTable ) {
+		this->dataTable = new T[ this->size ];
+		Utility::copy(this->dataTable, v.inlineTable, this->size);
+	}
+}
 
 template<typename T>
 inline BasicVector<T>::~BasicVector() {
-	if ( this->dataTable ) {
-		delete[] this->dataTable;
-	}
+	_deleteTable(this->dataTable);
 }
 
 template<typename T>
 inline BasicVector<T>& BasicVector<T>::operator=(BasicVector<T>&& v) {
-	if ( this->dataTable ) {
-		delete[] this->dataTable;
+	// The inline table of v can't be taken.
+	if ( v.dataTable && v.dataTable == v.inlineTable ) {
+		resizeNoCopy(v.size);
+		Utility::copy(this->dataTable, v.dataTable, this->size);
+
+		return *this;
 	}
 
+	_deleteTable(this->dataTable);
+
 	Table<T>::operator=(Utility::toRValue(v));
 
 	return *this;
@@ -214,14 +241,14 @@ inline void BasicVector<T>::resize(const Size newSize) {
 	}
 
 	if ( newSize == Size(0) ) {
-		delete[] this->dataTable;
+		_deleteTable(this->dataTable);
 		this->dataTable = NULL;
 	} else {
-		T* newDataTable(new T[ newSize ]);
+		T* newDataTable(_newTable(newSize));
 
-		if ( this->size > Size(0) ) {
+		if ( this->size > Size(0) && newDataTable != this->dataTable ) {
 			Utility::copy(newDataTable, this->dataTable, Math::min(this->size, newSize));
-			delete[] this->dataTable;
+			_deleteTable(this->dataTable);
 		}
 
 		this->dataTable = newDataTable;
@@ -237,13 +264,13 @@ inline void BasicVector<T>::resizeNoCopy(const Size newSize) {
 	}
 
 	if ( newSize == Size(0) ) {
-		delete[] this->dataTable;
+		_deleteTable(this->dataTable);
 		this->dataTable = NULL;
 	} else {
-		T* newDataTable(new T[ newSize ]);
+		T* newDataTable(_newTable(newSize));
 
-		if ( this->size > Size(0) ) {
-			delete[] this->dataTable;
+		if ( this->size > Size(0) && newDataTable != this->dataTable ) {
+			_deleteTable(this->dataTable);
 		}
 
 		this->dataTable = newDataTable;
@@ -251,3 +278,23 @@ inline void BasicVector<T>::resizeNoCopy(const Size newSize) {
 
 	this->size = newSize;
 }
+
+template<typename T>
+inline T* BasicVector<T>::_newTable(const Size newSize) {
+	if ( this->inlineTable && newSize <= _getInlineMaxSize() ) {
+		return this->inlineTable;
+	}
+	return new T[ newSize ];
+}
+
+template<typename T>
+inline void BasicVector<T>::_deleteTable(T* table) {
+	if ( table != this->inlineTable ) {
+		delete[] table;
+	}
+}
+
+template<typename T>
+inline constexpr Size BasicVector<T>::_getInlineMaxSize() {
+	return ( sizeof(T) < Size(24) ) ? Size(24) / sizeof(T) : Size(1);
+}
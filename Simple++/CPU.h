@@ -0,0 +1,64 @@
+///@file		CPU.h.
+///@brief		Declares the detection of the instruction sets of the running CPU, shared by every vectorized module.
+#pragma once
+
+#if defined _M_X64 || defined _M_IX86 || defined __x86_64__ || defined __i386__
+#define CPU_X86
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined _MSC_VER
+#include <intrin.h>
+#define CPU_TARGET_SSE2
+#define CPU_TARGET_AVX
+#define CPU_TARGET_AVX2
+#else
+// The vectorized functions are compiled for their own instruction set, whatever the flags of the whole build.
+#define CPU_TARGET_SSE2 __attribute__( ( target( "sse2" ) ) )
+#define CPU_TARGET_AVX __attribute__( ( target( "avx" ) ) )
+#define CPU_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+#endif
+#elif defined __aarch64__ || defined _M_ARM64
+#define CPU_NEON
+#include <arm_neon.h>
+#endif
+
+namespace CPU {
+
+	///@brief Instruction set used by the vectorized code (Math::Gemm kernels, JSON::StructuralIndex, Graphic::BlendingFunc spans...).
+	///			The x86 ones are ordered, each one including the previous ones. A module without any code for an instruction set uses the best one it has below it (AVX2 for Math::Gemm uses its AVX kernels).
+	enum class Isa : unsigned char {
+		Scalar,
+		SSE2,
+		AVX,
+		AVX2,
+		NEON,
+		Auto
+	};
+
+	///@brief Force the instruction set used by every module (ignored if not supported), Isa::Auto select the best supported one.
+	///@param isa Instruction set.
+	inline void setIsa( const Isa isa );
+
+	///@brief Get the instruction set used by every module.
+	///@return Instruction set (never Isa::Auto).
+	inline Isa getIsa();
+
+	///@brief Get the best instruction set supported by the running CPU (detected once).
+	///@return Instruction set (never Isa::Auto).
+	inline Isa getSupportedIsa();
+
+	///@brief Get if an instruction set can be used on the running CPU.
+	///@param isa Instruction set.
+	///@return True if supported, False otherwise.
+	inline bool isSupported( const Isa isa );
+
+
+
+	/** @brief	Private, do not use it */
+	inline Isa & _getForcedIsa();
+	/** @brief	Private, do not use it */
+	inline Isa _detectIsa();
+
+}
+
+#include "CPU.hpp"
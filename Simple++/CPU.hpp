@@ -0,0 +1,77 @@
+namespace CPU {
+
+	void setIsa( const Isa isa ) {
+		_getForcedIsa() = isa;
+	}
+
+	Isa getIsa() {
+		const Isa forcedIsa( _getForcedIsa() );
+		if ( forcedIsa == Isa::Auto || !isSupported( forcedIsa ) ) {
+			return getSupportedIsa();
+		}
+		return forcedIsa;
+	}
+
+	Isa getSupportedIsa() {
+		static const Isa supportedIsa( _detectIsa() );
+		return supportedIsa;
+	}
+
+	bool isSupported( const Isa isa ) {
+		const Isa supportedIsa( getSupportedIsa() );
+		switch ( isa ) {
+			case Isa::Scalar:
+				return true;
+			case Isa::SSE2:
+			case Isa::AVX:
+			case Isa::AVX2:
+				return supportedIsa != Isa::NEON && static_cast< unsigned char >( isa ) <= static_cast< unsigned char >( supportedIsa );
+			case Isa::NEON:
+				return supportedIsa == Isa::NEON;
+			default:
+				return false;
+		}
+	}
+
+	Isa & _getForcedIsa() {
+		static Isa forcedIsa( Isa::Auto );
+		return forcedIsa;
+	}
+
+	Isa _detectIsa() {
+#if defined CPU_X86
+#if defined _MSC_VER
+		int cpuInfo[ 4 ];
+		__cpuid( cpuInfo, 1 );
+		const bool bSSE2( cpuInfo[ 3 ] & ( 1 << 26 ) );
+		// AVX needs the CPU support (ECX bit 28) and the OS saving the YMM registers (OSXSAVE, ECX bit 27, then XCR0 bits 1 and 2), AVX2 the leaf 7 EBX bit 5 too.
+		if ( ( cpuInfo[ 2 ] & ( 1 << 28 ) ) && ( cpuInfo[ 2 ] & ( 1 << 27 ) ) && ( _xgetbv( 0 ) & 0x6 ) == 0x6 ) {
+			__cpuidex( cpuInfo, 7, 0 );
+			if ( cpuInfo[ 1 ] & ( 1 << 5 ) ) {
+				return Isa::AVX2;
+			}
+			return Isa::AVX;
+		}
+		if ( bSSE2 ) {
+			return Isa::SSE2;
+		}
+#else
+		__builtin_cpu_init();
+		if ( __builtin_cpu_supports( "avx2" ) ) {
+			return Isa::AVX2;
+		}
+		if ( __builtin_cpu_supports( "avx" ) ) {
+			return Isa::AVX;
+		}
+		if ( __builtin_cpu_supports( "sse2" ) ) {
+			return Isa::SSE2;
+		}
+#endif
+#elif defined CPU_NEON
+		// NEON is mandatory on AArch64.
+		return Isa::NEON;
+#endif
+		return Isa::Scalar;
+	}
+
+}
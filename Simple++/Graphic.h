@@ -398,6 +398,21 @@ namespace Graphic {
 	 */
 	template<typename T, typename LoadingFunc, typename Func>
 	void _drawText( const FontT<T, LoadingFunc> & font, const Rectangle & rectangle, const UTF8String & text, const Math::Vec2<bool> & centered, Func & func );
+
+	/**
+	 * @brief	private function do not touch this. Call func for each glyph of a text run, with the atlas image and the rectangle of the glyph inside.
+	 *
+	 * @tparam	T		   	Generic type parameter.
+	 * @tparam	LoadingFunc	Type of the loading function.
+	 * @tparam	Func	   	Type of the function, with operator() overloaded with : void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle );
+	 * @param 		  	font	 	The font.
+	 * @param 		  	textRun  	The text run laid out with the font.
+	 * @param 		  	initPoint	The point of the first line.
+	 * @param 		  	centeredX	If the lines are horizontally centered on the point.
+	 * @param [in,out]	func	 	The function.
+	 */
+	template<typename T, typename LoadingFunc, typename Func>
+	void _drawTextRun( const FontT<T, LoadingFunc> & font, const typename FontT<T, LoadingFunc>::TextRun & textRun, const Math::Vec2<float> & initPoint, bool centeredX, Func & func );
 }
 
 
@@ -57,11 +57,11 @@ namespace Graphic {
 				this -> colorFunc.init( rectangle );
 			}
 
-			void operator()( float x, float y, const ImageT<T> & c ) {
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) {
 				this -> colorFunctor.offset.x = x - rectangle.getLeft();
 				this -> colorFunctor.offset.y = y - rectangle.getBottom();
 
-				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, Rectangle( c.getSize() ), c, this -> blendFunc );
+				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, glyphRectangle, atlas, this -> blendFunc );
 			}
 
 		private:
@@ -95,11 +95,11 @@ namespace Graphic {
 			};
 			Functor( ImageT<T> * image, ColorFunc & colorFunc, BlendFunc & blendFunc) : colorFunctor( colorFunc ), image( image ), colorFunc( colorFunc ), blendFunc( blendFunc ) {
 			}
-			void operator()( float x, float y, const ImageT<T> & c ) {
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) {
 				this -> colorFunctor.offset.x = x - rectangle.getLeft();
 				this -> colorFunctor.offset.y = y - rectangle.getBottom();
 
-				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, Rectangle( c.getSize() ), c, this -> blendFunc );
+				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, glyphRectangle, atlas, this -> blendFunc );
 			}
 			void onBegin( const Rectangle & rectangle ) {
 				this -> rectangle = this -> image -> clampRectangle( rectangle );
@@ -139,9 +139,9 @@ namespace Graphic {
 			void onBegin( const Rectangle & rectangle ) {
 				this -> image -> computeInterpolation( gradient, &this -> colorFunctor.interpolationDatas, rectangle, &this -> clampedRectangle );
 			}
-			void operator()( float x, float y, const ImageT<T> & c ) {
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) {
 				this -> colorFunctor.offset = x - this -> clampedRectangle.getLeft();
-				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc>( Point( x, y ), this -> colorFunctor, Rectangle( c.getSize() ), c, this -> blendFunc );
+				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc>( Point( x, y ), this -> colorFunctor, glyphRectangle, atlas, this -> blendFunc );
 			}
 			~Functor() { delete[] this -> colorFunctor.interpolationDatas; }
 		private:
@@ -171,9 +171,9 @@ namespace Graphic {
 			Functor( ImageT<T> * image, const Gradient::Horizontal<C, InterFunc> & gradient, const Rectangle & rectangle, BlendFunc & blendFunc ) : colorFunctor(), image( image ), blendFunc( blendFunc ) {
 				this -> image -> computeInterpolation( gradient, &this -> colorFunctor.interpolationDatas, rectangle, &this -> clampedRectangle );
 			}
-			void operator()( float x, float y, const ImageT<T> & c ) {
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) {
 				this -> colorFunctor.offset = x - this -> clampedRectangle.getLeft();
-				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, Rectangle( c.getSize() ), c, this -> blendFunc );
+				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, glyphRectangle, atlas, this -> blendFunc );
 			}
 			~Functor() { delete[] this -> colorFunctor.interpolationDatas; }
 		private:
@@ -212,9 +212,9 @@ namespace Graphic {
 			void onBegin( const Rectangle & rectangle ) {
 				this -> image -> computeInterpolation( gradient, &this -> colorFunctor.interpolationDatas, rectangle, &this -> clampedRectangle );
 			}
-			void operator()( float x, float y, const ImageT<T> & c ) {
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) {
 				this -> colorFunctor.offset = y - this -> clampedRectangle.getBottom();
-				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc>( Point( x, y ), this -> colorFunctor, Rectangle( c.getSize() ), c, this -> blendFunc );
+				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc>( Point( x, y ), this -> colorFunctor, glyphRectangle, atlas, this -> blendFunc );
 			}
 
 			~Functor() { delete[] this -> colorFunctor.interpolationDatas; }
@@ -244,9 +244,9 @@ namespace Graphic {
 			Functor( ImageT<T> * image, const Gradient::Vertical<C, InterFunc> & gradient, const Rectangle & rectangle, BlendFunc & blendFunc ) : colorFunctor(), image( image ), blendFunc( blendFunc ) {
 				this -> image -> computeInterpolation( gradient, &this -> colorFunctor.interpolationDatas, rectangle, &this -> clampedRectangle );
 			}
-			void operator()( float x, float y, const ImageT<T> & c ) {
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) {
 				this -> colorFunctor.offset = y - this -> clampedRectangle.getBottom();
-				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, Rectangle( c.getSize() ), c, this -> blendFunc );
+				return this -> image -> drawImageFunctor<ColorFunctor, BlendFunc, false>( Point( x, y ), this -> colorFunctor, glyphRectangle, atlas, this -> blendFunc );
 			}
 
 			~Functor() { delete[] this -> colorFunctor.interpolationDatas; }
@@ -272,7 +272,7 @@ namespace Graphic {
 		struct Functor {
 			Functor( ImageT<T> * image, const C & color, BlendFunc & blendFunc ) : image( image ), color( color ), blendFunc( blendFunc ) {}
 			void onBegin( const Rectangle & size ) {}
-			void operator()( float x, float y, const ImageT<T> & c ) { this -> image -> drawImage<BlendFunc, false>( Point( x, y ), this -> color, c, this -> blendFunc ); }
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) { this -> image -> drawImage<BlendFunc, false>( Point( x, y ), this -> color, glyphRectangle, atlas, this -> blendFunc ); }
 		private:
 			ImageT<T> * image;
 			const C & color;
@@ -289,7 +289,7 @@ namespace Graphic {
 		struct Functor {
 			Functor( ImageT<T> * image, const C & color, BlendFunc & blendFunc ) : image( image ), color( color ), blendFunc( blendFunc ) {}
 			void onBegin( const Math::Vec2<float> & size ) {}
-			void operator()( float x, float y, const ImageT<T> & c ) { this -> image -> drawImage( Point( x, y ), this -> color, c, this -> blendFunc ); }
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) { this -> image -> drawImage( Point( x, y ), this -> color, glyphRectangle, atlas, this -> blendFunc ); }
 		private:
 			ImageT<T> * image;
 			const C & color;
@@ -306,7 +306,7 @@ namespace Graphic {
 		struct Functor {
 			Functor( ImageT<T> * image, BlendFunc & blendFunc ) : image( image ), blendFunc(blendFunc) {}
 			void onBegin( const Rectangle & size ) {}
-			void operator()( float x, float y, const ImageT<T> & c ) { this -> image ->  drawImage( Point( x, y ), c, Rectangle( c.getSize() ), this -> blendFunc ); }
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) { this -> image ->  drawImage( Point( x, y ), atlas, glyphRectangle, this -> blendFunc ); }
 		private:
 			ImageT<T> * image;
 			BlendFunc & blendFunc;
@@ -320,7 +320,7 @@ namespace Graphic {
 		struct Functor {
 			Functor( ImageT<T> * image, BlendFunc & blendFunc ) : image( image ), blendFunc( blendFunc ) {}
 			void onBegin( const Rectangle & size ) {}
-			void operator()( float x, float y, const ImageT<T> & c ) { this -> image -> drawImage<BlendFunc, false>( Point( x, y ), c, Rectangle( c.getSize() ), this -> blendFunc ); }
+			void operator()( float x, float y, const ImageT<T> & atlas, const Rectangle & glyphRectangle ) { this -> image -> drawImage<BlendFunc, false>( Point( x, y ), atlas, glyphRectangle, this -> blendFunc ); }
 		private:
 			ImageT<T> * image;
 			BlendFunc & blendFunc;
@@ -336,37 +336,11 @@ namespace Graphic {
 	template<typename T, typename LoadingFunc, typename Func>
 	void _drawTextWBB( const FontT<T, LoadingFunc> & font, const Point & point, const UTF8String & text, const Math::Vec2<bool> & centered, Func & func ) {
 		Math::Vec2<float> initPoint( point );
-		UCodePoint codePoint;
-
-		Vector<float> lineWidth;
-		lineWidth.reserve( 10 );
-		float currentPosX = 0.0f;
-		float rectangleHeight = font.getLineHeight();
-		float maxLineWidth = 0.0f;
 		Rectangle rectangle( 0, 0, 0, 0 );
 
-
-		for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
-			if ( codePoint == UCodePoint(UCodePoint('\n')) ) {
-				rectangleHeight += font.getLineHeight();
-				lineWidth.push( currentPosX * 0.5f );
-
-				//
-				maxLineWidth = Math::max<float>( maxLineWidth, currentPosX );
-				//
-
-				currentPosX = 0;
-			} else if ( codePoint == UCodePoint(' ') ) {
-				currentPosX += font.getWordSpace();
-			} else {
-				const FreeTypeChar<T> * c = font[codePoint];
-				if ( c ) currentPosX += c -> getHoriAdvance();
-			}
-		}
-		lineWidth.push( currentPosX * 0.5f );
-		maxLineWidth = Math::max<float>( maxLineWidth, currentPosX );
-
-
+		const typename FontT<T, LoadingFunc>::TextRun * textRun( font.acquireTextRun( text ) );
+		float rectangleHeight = font.getLineHeight() * float( textRun -> lineWidthVector.getSize() );
+		float maxLineWidth = textRun -> maxLineWidth;
 
 		float marginY( font.getLineHeight() * 0.7f );
 		if ( centered.y ) {
@@ -380,341 +354,74 @@ namespace Graphic {
 			rectangle.setBottom( initPoint.y + marginY - rectangleHeight - font.getMargins().getBottom() );					//update BB
 		}
 
-
-
 		if ( centered.x ) {
 			rectangle.setLeft( initPoint.x - maxLineWidth * 0.5f - font.getMargins().getLeft() );
 			rectangle.setRight( initPoint.x + maxLineWidth * 0.5f + font.getMargins().getRight() );
-
-			func.onBegin( rectangle );
-
-			Math::Vec2<float> currentPos( initPoint.x - lineWidth[0], initPoint.y );
-			currentPos += font.getDrawingBias();
-			unsigned int currentLine = 1;
-
-			for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
-				if ( codePoint == UCodePoint('\n') ) {
-					currentPos.y -= font.getLineHeight();
-					currentPos.x = initPoint.x - lineWidth[currentLine];
-					currentLine++;
-				} else if ( codePoint == UCodePoint(' ') ) {
-					currentPos.x += font.getWordSpace();
-				} else {
-					const FreeTypeChar<T> * c = font[codePoint];
-					if ( c ) {
-						func( currentPos.x, currentPos.y + c -> getHoriOffsetY(), *c );
-						currentPos.x += c -> getHoriAdvance();
-					}
-				}
-			}
 		} else {
 			rectangle.setLeft( initPoint.x - font.getMargins().getLeft() );
 			rectangle.setRight( initPoint.x + maxLineWidth + font.getMargins().getRight() );
-
-			func.onBegin( rectangle );
-
-			Math::Vec2<float> currentPos( initPoint + font.getDrawingBias() );
-			for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
-				if ( codePoint == UCodePoint('\n') ) {
-					currentPos.y -= font.getLineHeight();
-					currentPos.x = initPoint.x;
-				} else if ( codePoint == UCodePoint(' ') ) {
-					currentPos.x += font.getWordSpace();
-				} else {
-					const FreeTypeChar<T> * c = font[codePoint];
-					if ( c ) {
-						func( currentPos.x, currentPos.y + c -> getHoriOffsetY(), *c );
-						currentPos.x += c -> getHoriAdvance();
-					}
-				}
-			}
 		}
-	}
-
 
+		func.onBegin( rectangle );
+		_drawTextRun( font, *textRun, initPoint, centered.x, func );
+		font.releaseTextRun( textRun );
+	}
 
 
 
 	template<typename T, typename LoadingFunc, typename Func>
 	void _drawText( const FontT<T, LoadingFunc> & font, const Point & point, const UTF8String & text, const Math::Vec2<bool> & centered, Func & func ) {
 		Math::Vec2<float> initPoint( point );
-		UCodePoint codePoint;
 
-		if ( centered.x ) {
-			Vector<float> lineWidth;
-			lineWidth.reserve( 10 );
-			float currentPosX = 0.0f;
-			float rectangleTop = font.getLineHeight();
-			float maxLineWidth = 0.0f;
-
-
-			for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
-				if ( codePoint == UCodePoint('\n') ) {
-					rectangleTop += font.getLineHeight();
-					lineWidth.push( currentPosX / 2.0f );
-
-					//
-					maxLineWidth = Math::max<float>( maxLineWidth, currentPosX );
-					//
-
-					currentPosX = 0;
-				} else if ( codePoint == UCodePoint(' ') ) {
-					currentPosX += font.getWordSpace();
-				} else {
-					const FreeTypeChar<T> * c = font[codePoint];
-					if ( c ) {
-						currentPosX += c -> getHoriAdvance();
-					}
-				}
-			}
-			lineWidth.push( currentPosX / 2.0f );
-			maxLineWidth = Math::max<float>( maxLineWidth, currentPosX );
-
-
-			if ( centered.y ) {
-				float rectangleTopHalfed = rectangleTop * 0.5f;
-				initPoint.y = initPoint.y - font.getLineHeight() * 0.7f + rectangleTopHalfed;
-
-			}
-
-
-
-
-
-
-			Math::Vec2<float> currentPos( initPoint.x - lineWidth[0] + font.getDrawingBias().x, initPoint.y + font.getDrawingBias().y );
-			unsigned int currentLine = 1;
-
-			for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
-				if ( codePoint == UCodePoint('\n') ) {
-					currentPos.y -= font.getLineHeight();
-					currentPos.x = initPoint.x - lineWidth[currentLine];
-					currentLine++;
-
-
-				} else if ( codePoint == UCodePoint(' ') ) {
-					currentPos.x += font.getWordSpace();
-				} else {
-					const FreeTypeChar<T> * c = font[codePoint];
-					if ( c ) {
-						func( currentPos.x, currentPos.y + c -> getHoriOffsetY(), *c );
-						currentPos.x += c -> getHoriAdvance();
-					}
-				}
-			}
-		} else {
-			if ( centered.y ) {
-				float rectangleTop = font.getLineHeight();
-				for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
-					if ( codePoint == UCodePoint('\n') ) rectangleTop += font.getLineHeight();
-				}
-
-				initPoint.y = initPoint.y - font.getLineHeight() * 0.7f + rectangleTop * 0.5f;
-			}
-
-			Math::Vec2<float> currentPos( initPoint + font.getDrawingBias() );
-			for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
-				if ( codePoint == UCodePoint('\n') ) {
-					currentPos.y -= font.getLineHeight();
-					currentPos.x = initPoint.x;
-				} else if ( codePoint == UCodePoint(' ') ) {
-					currentPos.x += font.getWordSpace();
-				} else {
-					const FreeTypeChar<T> * c = font[codePoint];
-					if ( c ) {
-						func( currentPos.x, currentPos.y + c -> getHoriOffsetY(), *c );
-						currentPos.x += c -> getHoriAdvance();
-					}
-				}
-
-			}
+		const typename FontT<T, LoadingFunc>::TextRun * textRun( font.acquireTextRun( text ) );
+		if ( centered.y ) {
+			float rectangleTop = font.getLineHeight() * float( textRun -> lineWidthVector.getSize() );
+			initPoint.y = initPoint.y - font.getLineHeight() * 0.7f + rectangleTop * 0.5f;
 		}
 
+		_drawTextRun( font, *textRun, initPoint, centered.x, func );
+		font.releaseTextRun( textRun );
 	}
 
 
 
-
 	template<typename T, typename LoadingFunc, typename Func>
 	void _drawText( const FontT<T, LoadingFunc> & font, const Rectangle & rectangle, const UTF8String & text, const Math::Vec2<bool> & centered, Func & func ) {
-		UCodePoint codePoint;
 		Math::Vec2<int> rectangleSize( rectangle.getRight() - rectangle.getLeft(), rectangle.getTop() - rectangle.getBottom() );
-		UTF8String textCopy( text );
 		Math::Vec2<float> initPoint;
 
+		// The words overflowing the rectangle are wrapped on the next line, the lines overflowing it are cut.
+		const typename FontT<T, LoadingFunc>::TextRun * textRun( font.acquireTextRun( text, rectangleSize ) );
+		float rectangleTop = font.getLineHeight() * float( textRun -> lineWidthVector.getSize() );
 
-
+		if ( centered.y ) {
+			initPoint.y = rectangle.getTop() - font.getLineHeight() * 0.7f - ( rectangleSize.y - rectangleTop ) * 0.5f;
+		} else {
+			initPoint.y = rectangle.getTop() - font.getLineHeight();
+		}
 		if ( centered.x ) {
-			Vector<float> lineWidth;
-			lineWidth.reserve( 10 );
-			float currentPosX = 0.0f;
-			float rectangleTop = font.getLineHeight();
-
-
-			auto it = textCopy.getBegin();
-			auto lastIt = it;
-			while ( true ) {
-
-				//check if the next word will enter in the square.
-				float tmpPosX = currentPosX;
-				auto it2 = it;
-				for ( ; textCopy.iterate( &it2, &codePoint ); ) {
-					if ( codePoint == UCodePoint('\n') ) {
-						goto drawText_afterIterate;	//if we reached the end of the word
-					} else if ( codePoint == UCodePoint(' ') ) {
-						tmpPosX += font.getWordSpace();
-						goto drawText_afterIterate;	//if we reached the end of the word
-					} else {
-						const FreeTypeChar<T> * c = font[codePoint];
-						if ( c ) tmpPosX += c -> getHoriAdvance();
-					}
-				}
-
-				currentPosX = tmpPosX;
-
-
-				break;
-drawText_afterIterate:
-
-				if ( tmpPosX > rectangleSize.x ) {
-					//problem, the word is too big to enter in this line. replace the space with a new line.
-
-					float newSize = tmpPosX - currentPosX - font.getWordSpace();
-					lineWidth.push( currentPosX / 2.0f );
-					if ( rectangleTop + font.getLineHeight() > rectangleSize.y ) {
-						*( lastIt ) = '\0';
-						//rectangle to small
-						break;
-					}
-					currentPosX = newSize;
-					*( lastIt ) = UCodePoint('\n');
-					rectangleTop += font.getLineHeight();
-					lastIt = it2 - 1;
-				} else {
-					currentPosX = tmpPosX;
-					lastIt = it2 - 1;
-					if ( *lastIt == UCodePoint('\n') ) {
-						lineWidth.push( currentPosX / 2.0f );
-						currentPosX = 0.0f;
-						rectangleTop += font.getLineHeight();
-					}
-				}
-				it = it2;
-			}
-			lineWidth.push( currentPosX / 2.0f );
-
-
-
-
-
-			if ( centered.y ) {
-				initPoint.y = rectangle.getTop() - font.getLineHeight() * 0.7f - ( rectangleSize.y - rectangleTop ) * 0.5f;
-			} else {
-				initPoint.y = rectangle.getTop() - font.getLineHeight();
-			}
 			initPoint.x = rectangle.getLeft() + rectangleSize.x / 2;
-
-
-			Math::Vec2<float> currentPos( initPoint.x - lineWidth[0] + font.getDrawingBias().x, initPoint.y + font.getDrawingBias().y );
-			unsigned int currentLine = 1;
-
-			for ( auto it = textCopy.getBegin(); textCopy.iterate( &it, &codePoint ); ) {
-				if ( codePoint == UCodePoint('\n') ) {
-					currentPos.y -= font.getLineHeight();
-					currentPos.x = initPoint.x - lineWidth[currentLine];
-					currentLine++;
-				} else if ( codePoint == UCodePoint(' ') ) {
-					currentPos.x += font.getWordSpace();
-				} else {
-					const FreeTypeChar<T> * c = font[codePoint];
-					if ( c ) {
-						func( currentPos.x, currentPos.y + c -> getHoriOffsetY(), *c );
-						currentPos.x += c -> getHoriAdvance();
-					}
-				}
-			}
 		} else {
-
-
-			float currentPosX = 0.0f;
-			float rectangleTop = font.getLineHeight();
-
-			auto it = textCopy.getBegin();
-			auto lastIt = it;
-			while ( true ) {
-
-				//check if the next word will enter in the square.
-				float tmpPosX = currentPosX;
-				auto it2 = it;
-				for ( ; textCopy.iterate( &it2, &codePoint ); ) {
-					if ( codePoint == UCodePoint('\n') ) {
-						goto drawText_afterIterate2;	//if we reached the end of the word
-					} else if ( codePoint == UCodePoint(' ') ) {
-						tmpPosX += font.getWordSpace();
-						goto drawText_afterIterate2;	//if we reached the end of the word
-					} else {
-						const FreeTypeChar<T> * c = font[codePoint];
-						if ( c ) tmpPosX += c -> getHoriAdvance();
-					}
-				}
-				break;
-drawText_afterIterate2:
-
-				if ( tmpPosX > rectangleSize.x ) {
-					//problem, the word is too big to enter in this line. replace the space with a new line.
-
-
-					if ( rectangleTop + font.getLineHeight() > rectangleSize.y ) {
-						*( lastIt ) = '\0';
-						//rectangle to small
-						break;
-					}
-					currentPosX = tmpPosX - currentPosX - font.getWordSpace();
-
-					*( lastIt ) = UCodePoint('\n');
-					rectangleTop += font.getLineHeight();
-					lastIt = it2 - 1;
-
-				} else {
-					currentPosX = tmpPosX;
-					lastIt = it2 - 1;
-					if ( *lastIt == UCodePoint('\n') ) {
-						currentPosX = 0.0f;
-						rectangleTop += font.getLineHeight();
-					}
-				}
-				it = it2;
-			}
-
-
-
-			if ( centered.y ) {
-				initPoint.y = rectangle.getTop() - ( rectangleSize.y - rectangleTop ) * 0.5f - font.getLineHeight() * 0.7f;
-			} else {
-				initPoint.y = rectangle.getTop() - font.getLineHeight();
-			}
 			initPoint.x = rectangle.getLeft();
+		}
+
+		_drawTextRun( font, *textRun, initPoint, centered.x, func );
+		font.releaseTextRun( textRun );
+	}
 
 
-			Math::Vec2<float> currentPos( initPoint + font.getDrawingBias() );
-
-			for ( auto it = textCopy.getBegin(); textCopy.iterate( &it, &codePoint ); ) {
-				if ( codePoint == UCodePoint('\n') ) {
-					currentPos.y -= font.getLineHeight();
-					currentPos.x = initPoint.x;
-				} else if ( codePoint == UCodePoint(' ') ) {
-					currentPos.x += font.getWordSpace();
-				} else {
-					const FreeTypeChar<T> * c = font[codePoint];
-					if ( c ) {
-						func( currentPos.x, currentPos.y + c -> getHoriOffsetY(), *c );
-						currentPos.x += c -> getHoriAdvance();
-					}
-				}
 
-			}
+	template<typename T, typename LoadingFunc, typename Func>
+	void _drawTextRun( const FontT<T, LoadingFunc> & font, const typename FontT<T, LoadingFunc>::TextRun & textRun, const Math::Vec2<float> & initPoint, bool centeredX, Func & func ) {
+		const ImageT<T> & atlasImage( font.getGlyphAtlas().getImage() );
+		const Math::Vec2<float> origin( initPoint + font.getDrawingBias() );
+
+		for ( Size i( 0 ); i < textRun.glyphVector.getSize(); i++ ) {
+			const typename FontT<T, LoadingFunc>::TextRun::Glyph & glyph( textRun.glyphVector[i] );
+			float x( origin.x + glyph.position.x );
+			if ( centeredX ) x -= textRun.lineWidthVector[glyph.line] * 0.5f;
+			func( x, origin.y + glyph.position.y, atlasImage, glyph.rectangle );
 		}
 	}
 
-
 }
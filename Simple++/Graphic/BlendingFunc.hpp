@@ -4,6 +4,18 @@
 ///@date 30/09/2016 (DMY) 
 #pragma once
 
+#include "../CPU.h"
+
+#if defined CPU_X86
+// The operations shared by the Composite functors are templates, only compiled for the instruction sets enabled for the whole build (always under MSVC).
+#if defined _MSC_VER || defined __SSE2__
+#define GRAPHIC_OPS_SSE2
+#endif
+#if defined _MSC_VER || defined __AVX2__
+#define GRAPHIC_OPS_AVX2
+#endif
+#endif
+
 #include "../BuildConfig.h"
 #include "BasicGraphic.h"
 
@@ -1101,9 +1113,398 @@ namespace Graphic {
 				blendColor( colorDest, c );
 			}
 
+			/************************************************************************/
+			/* SPANS                                                                */
+			/************************************************************************/
+			///@brief Blend a span of contiguous pixels, the result being the same as blendColor() on each of them.
+			///			The RGBA -> RGBA spans of unsigned char (with GRAPHIC_FAST_BLENDING) and of float are vectorized with the instruction set of CPU::getIsa(), the others are blended one pixel at a time.
+			///@param colorDest Destination pixels.
+			///@param colorSrc Source pixels.
+			///@param nbPixels Number of pixels.
+			template<typename C1, typename C2>
+			inline static void blendSpan( C1 * colorDest, const C2 * colorSrc, Size nbPixels ) {
+				for ( Size i( 0 ); i < nbPixels; i++ ) {
+					blendColor( colorDest[ i ], colorSrc[ i ] );
+				}
+			}
+			inline static void blendSpan( ColorRGBA<unsigned char> * colorDest, const ColorRGBA<unsigned char> * colorSrc, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, ( const unsigned char * ) NULL, Size( 0 ), nbPixels );
+			}
+			inline static void blendSpan( ColorRGBA<float> * colorDest, const ColorRGBA<float> * colorSrc, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, ( const float * ) NULL, Size( 0 ), nbPixels );
+			}
+
+			///@brief Blend a span of contiguous pixels using a mask, the result being the same as blendColor() on each of them.
+			///@param colorDest Destination pixels.
+			///@param colorSrc Source pixels.
+			///@param mask Alpha of the first pixel, the one of the pixel i being mask[ i * maskStride ] (a component of a mask image).
+			///@param maskStride Number of elements between the alphas of two consecutive pixels.
+			///@param nbPixels Number of pixels.
+			template<typename C1, typename C2, typename A>
+			inline static void blendSpan( C1 * colorDest, const C2 * colorSrc, const A * mask, Size maskStride, Size nbPixels ) {
+				for ( Size i( 0 ); i < nbPixels; i++ ) {
+					blendColor( colorDest[ i ], colorSrc[ i ], mask[ i * maskStride ] );
+				}
+			}
+			inline static void blendSpan( ColorRGBA<unsigned char> * colorDest, const ColorRGBA<unsigned char> * colorSrc, const unsigned char * mask, Size maskStride, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, mask, maskStride, nbPixels );
+			}
+			inline static void blendSpan( ColorRGBA<float> * colorDest, const ColorRGBA<float> * colorSrc, const float * mask, Size maskStride, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, mask, maskStride, nbPixels );
+			}
+
+		private:
+			///@brief Blend a RGBA span, vectorized by blocks, the remaining pixels being blended one at a time (mask can be NULL).
+			template<typename T>
+			inline static void _blendSpanRGBA( ColorRGBA<T> * colorDest, const ColorRGBA<T> * colorSrc, const T * mask, Size maskStride, Size nbPixels ) {
+				Size nbBlended( 0 );
+				switch ( CPU::getIsa() ) {
+#if defined CPU_X86
+					case CPU::Isa::AVX2:
+						nbBlended = _blendSpanAVX2( colorDest, colorSrc, mask, maskStride, nbPixels );
+						break;
+					case CPU::Isa::AVX:
+					case CPU::Isa::SSE2:
+						nbBlended = _blendSpanSSE2( colorDest, colorSrc, mask, maskStride, nbPixels );
+						break;
+#endif
+#if defined CPU_NEON
+					case CPU::Isa::NEON:
+						nbBlended = _blendSpanNEON( colorDest, colorSrc, mask, maskStride, nbPixels );
+						break;
+#endif
+					default:
+						break;
+				}
+				_blendSpanScalar( colorDest + nbBlended, colorSrc + nbBlended, mask ? mask + nbBlended * maskStride : mask, maskStride, nbPixels - nbBlended );
+			}
+
+			template<typename T>
+			inline static void _blendSpanScalar( ColorRGBA<T> * colorDest, const ColorRGBA<T> * colorSrc, const T * mask, Size maskStride, Size nbPixels ) {
+				if ( mask ) {
+					for ( Size i( 0 ); i < nbPixels; i++ ) {
+						blendColor( colorDest[ i ], colorSrc[ i ], mask[ i * maskStride ] );
+					}
+				} else {
+					for ( Size i( 0 ); i < nbPixels; i++ ) {
+						blendColor( colorDest[ i ], colorSrc[ i ] );
+					}
+				}
+			}
+
+			// The vectorized kernels only handle the blocks of opaque destinations (the common case of drawing over an image), the other ones need a division and are blended by _blendSpanScalar().
+			// They return the number of pixels blended (a multiple of the block size), every operation being the same as the scalar one for the results to be bit exact.
+#if defined CPU_X86
+			///@brief ( colorDest * ( 255 - alpha ) + colorSrc * alpha ) >> 8 on 16 bits components, as the GRAPHIC_FAST_BLENDING of an opaque destination.
+			CPU_TARGET_SSE2 inline static __m128i _blendOpaqueSSE2( const __m128i & colorDest, const __m128i & colorSrc, const __m128i & alpha ) {
+				const __m128i max( _mm_set1_epi16( 255 ) );
+				__m128i result( _mm_srli_epi16( _mm_add_epi16( _mm_mullo_epi16( colorDest, _mm_sub_epi16( max, alpha ) ), _mm_mullo_epi16( colorSrc, alpha ) ), 8 ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+				// Same early outs as blendColor(), a transparent source keep the destination and an opaque one replace it.
+				const __m128i bTransparent( _mm_cmpeq_epi16( alpha, _mm_setzero_si128() ) );
+				const __m128i bOpaque( _mm_cmpeq_epi16( alpha, max ) );
+				result = _mm_or_si128( _mm_andnot_si128( _mm_or_si128( bTransparent, bOpaque ), result ), _mm_or_si128( _mm_and_si128( bTransparent, colorDest ), _mm_and_si128( bOpaque, colorSrc ) ) );
+#endif
+				return result;
+			}
+			CPU_TARGET_SSE2 inline static __m128 _blendOpaqueSSE2( const __m128 & colorDest, const __m128 & colorSrc, const __m128 & alpha, const __m128 & oneMinusAlpha ) {
+				__m128 result( _mm_add_ps( _mm_mul_ps( colorDest, oneMinusAlpha ), _mm_mul_ps( colorSrc, alpha ) ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+				const __m128 bTransparent( _mm_cmpeq_ps( alpha, _mm_setzero_ps() ) );
+				const __m128 bOpaque( _mm_cmpeq_ps( alpha, _mm_set1_ps( 1.0f ) ) );
+				result = _mm_or_ps( _mm_andnot_ps( _mm_or_ps( bTransparent, bOpaque ), result ), _mm_or_ps( _mm_and_ps( bTransparent, colorDest ), _mm_and_ps( bOpaque, colorSrc ) ) );
+#endif
+				return result;
+			}
+
+			CPU_TARGET_SSE2 inline static Size _blendSpanSSE2( ColorRGBA<unsigned char> * colorDest, const ColorRGBA<unsigned char> * colorSrc, const unsigned char * mask, Size maskStride, Size nbPixels ) {
+#ifdef GRAPHIC_FAST_BLENDING
+				const __m128i zero( _mm_setzero_si128() );
+				const __m128i alphaMask( _mm_set1_epi32( int( 0xFF000000 ) ) );
+				const Size nbBlocks( nbPixels & ~Size( 3 ) );
+				for ( Size i( 0 ); i < nbBlocks; i += Size( 4 ) ) {
+					const __m128i dst( _mm_loadu_si128( reinterpret_cast< const __m128i * >( colorDest + i ) ) );
+					if ( _mm_movemask_epi8( _mm_cmpeq_epi32( _mm_and_si128( dst, alphaMask ), alphaMask ) ) != 0xFFFF ) {
+						_blendSpanScalar( colorDest + i, colorSrc + i, mask ? mask + i * maskStride : mask, maskStride, Size( 4 ) );
+						continue;
+					}
+					const __m128i src( _mm_loadu_si128( reinterpret_cast< const __m128i * >( colorSrc + i ) ) );
+
+					__m128i alpha( _mm_srli_epi32( src, 24 ) );
+					if ( mask ) {
+						// alpha * mask / 255, exact for a product up to 255 * 255 : ( x + 1 + ( x >> 8 ) ) >> 8.
+						const __m128i maskAlpha( _mm_set_epi32( mask[ ( i + 3 ) * maskStride ], mask[ ( i + 2 ) * maskStride ], mask[ ( i + 1 ) * maskStride ], mask[ i * maskStride ] ) );
+						const __m128i product( _mm_mullo_epi16( alpha, maskAlpha ) );
+						alpha = _mm_srli_epi32( _mm_add_epi32( _mm_add_epi32( product, _mm_set1_epi32( 1 ) ), _mm_srli_epi32( product, 8 ) ), 8 );
+					}
+					// Alpha of each pixel copied into it's four components.
+					alpha = _mm_or_si128( alpha, _mm_slli_epi32( alpha, 8 ) );
+					alpha = _mm_or_si128( alpha, _mm_slli_epi32( alpha, 16 ) );
+
+					const __m128i resultLo( _blendOpaqueSSE2( _mm_unpacklo_epi8( dst, zero ), _mm_unpacklo_epi8( src, zero ), _mm_unpacklo_epi8( alpha, zero ) ) );
+					const __m128i resultHi( _blendOpaqueSSE2( _mm_unpackhi_epi8( dst, zero ), _mm_unpackhi_epi8( src, zero ), _mm_unpackhi_epi8( alpha, zero ) ) );
+
+					// The destination stay opaque.
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( colorDest + i ), _mm_or_si128( _mm_packus_epi16( resultLo, resultHi ), alphaMask ) );
+				}
+				return nbBlocks;
+#else
+				return Size( 0 );
+#endif
+			}
+			CPU_TARGET_SSE2 inline static Size _blendSpanSSE2( ColorRGBA<float> * colorDest, const ColorRGBA<float> * colorSrc, const float * mask, Size maskStride, Size nbPixels ) {
+				const __m128 one( _mm_set1_ps( 1.0f ) );
+				const Size nbBlocks( nbPixels & ~Size( 3 ) );
+				for ( Size i( 0 ); i < nbBlocks; i += Size( 4 ) ) {
+					float * dstData( reinterpret_cast< float * >( colorDest + i ) );
+					const float * srcData( reinterpret_cast< const float * >( colorSrc + i ) );
+
+					// Transposed to one register per component.
+					__m128 dstR( _mm_loadu_ps( dstData ) ), dstG( _mm_loadu_ps( dstData + 4 ) ), dstB( _mm_loadu_ps( dstData + 8 ) ), dstA( _mm_loadu_ps( dstData + 12 ) );
+					_MM_TRANSPOSE4_PS( dstR, dstG, dstB, dstA );
+					if ( _mm_movemask_ps( _mm_cmpeq_ps( dstA, one ) ) != 0xF ) {
+						_blendSpanScalar( colorDest + i, colorSrc + i, mask ? mask + i * maskStride : mask, maskStride, Size( 4 ) );
+						continue;
+					}
+					__m128 srcR( _mm_loadu_ps( srcData ) ), srcG( _mm_loadu_ps( srcData + 4 ) ), srcB( _mm_loadu_ps( srcData + 8 ) ), srcA( _mm_loadu_ps( srcData + 12 ) );
+					_MM_TRANSPOSE4_PS( srcR, srcG, srcB, srcA );
+
+					if ( mask ) {
+						srcA = _mm_mul_ps( srcA, _mm_set_ps( mask[ ( i + 3 ) * maskStride ], mask[ ( i + 2 ) * maskStride ], mask[ ( i + 1 ) * maskStride ], mask[ i * maskStride ] ) );
+					}
+					const __m128 oneMinusAlpha( _mm_sub_ps( one, srcA ) );
+					dstR = _blendOpaqueSSE2( dstR, srcR, srcA, oneMinusAlpha );
+					dstG = _blendOpaqueSSE2( dstG, srcG, srcA, oneMinusAlpha );
+					dstB = _blendOpaqueSSE2( dstB, srcB, srcA, oneMinusAlpha );
+
+					_MM_TRANSPOSE4_PS( dstR, dstG, dstB, dstA );
+					_mm_storeu_ps( dstData, dstR );
+					_mm_storeu_ps( dstData + 4, dstG );
+					_mm_storeu_ps( dstData + 8, dstB );
+					_mm_storeu_ps( dstData + 12, dstA );
+				}
+				return nbBlocks;
+			}
+
+			CPU_TARGET_AVX2 inline static __m256i _blendOpaqueAVX2( const __m256i & colorDest, const __m256i & colorSrc, const __m256i & alpha ) {
+				const __m256i max( _mm256_set1_epi16( 255 ) );
+				__m256i result( _mm256_srli_epi16( _mm256_add_epi16( _mm256_mullo_epi16( colorDest, _mm256_sub_epi16( max, alpha ) ), _mm256_mullo_epi16( colorSrc, alpha ) ), 8 ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+				const __m256i bTransparent( _mm256_cmpeq_epi16( alpha, _mm256_setzero_si256() ) );
+				const __m256i bOpaque( _mm256_cmpeq_epi16( alpha, max ) );
+				result = _mm256_blendv_epi8( _mm256_blendv_epi8( result, colorDest, bTransparent ), colorSrc, bOpaque );
+#endif
+				return result;
+			}
+			CPU_TARGET_AVX2 inline static __m256 _blendOpaqueAVX2( const __m256 & colorDest, const __m256 & colorSrc, const __m256 & alpha, const __m256 & oneMinusAlpha ) {
+				__m256 result( _mm256_add_ps( _mm256_mul_ps( colorDest, oneMinusAlpha ), _mm256_mul_ps( colorSrc, alpha ) ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+				const __m256 bTransparent( _mm256_cmp_ps( alpha, _mm256_setzero_ps(), _CMP_EQ_OQ ) );
+				const __m256 bOpaque( _mm256_cmp_ps( alpha, _mm256_set1_ps( 1.0f ), _CMP_EQ_OQ ) );
+				result = _mm256_blendv_ps( _mm256_blendv_ps( result, colorDest, bTransparent ), colorSrc, bOpaque );
+#endif
+				return result;
+			}
+			///@brief Transpose the 4x4 floats of each 128 bits lane.
+			CPU_TARGET_AVX2 inline static void _transposeAVX2( __m256 & v0, __m256 & v1, __m256 & v2, __m256 & v3 ) {
+				const __m256 t0( _mm256_unpacklo_ps( v0, v1 ) );
+				const __m256 t1( _mm256_unpacklo_ps( v2, v3 ) );
+				const __m256 t2( _mm256_unpackhi_ps( v0, v1 ) );
+				const __m256 t3( _mm256_unpackhi_ps( v2, v3 ) );
+				v0 = _mm256_shuffle_ps( t0, t1, 0x44 );
+				v1 = _mm256_shuffle_ps( t0, t1, 0xEE );
+				v2 = _mm256_shuffle_ps( t2, t3, 0x44 );
+				v3 = _mm256_shuffle_ps( t2, t3, 0xEE );
+			}
+
+			CPU_TARGET_AVX2 inline static Size _blendSpanAVX2( ColorRGBA<unsigned char> * colorDest, const ColorRGBA<unsigned char> * colorSrc, const unsigned char * mask, Size maskStride, Size nbPixels ) {
+#ifdef GRAPHIC_FAST_BLENDING
+				const __m256i zero( _mm256_setzero_si256() );
+				const __m256i alphaMask( _mm256_set1_epi32( int( 0xFF000000 ) ) );
+				const Size nbBlocks( nbPixels & ~Size( 7 ) );
+				for ( Size i( 0 ); i < nbBlocks; i += Size( 8 ) ) {
+					const __m256i dst( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( colorDest + i ) ) );
+					if ( _mm256_movemask_epi8( _mm256_cmpeq_epi32( _mm256_and_si256( dst, alphaMask ), alphaMask ) ) != -1 ) {
+						_blendSpanScalar( colorDest + i, colorSrc + i, mask ? mask + i * maskStride : mask, maskStride, Size( 8 ) );
+						continue;
+					}
+					const __m256i src( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( colorSrc + i ) ) );
+
+					__m256i alpha( _mm256_srli_epi32( src, 24 ) );
+					if ( mask ) {
+						const __m256i maskAlpha( _mm256_set_epi32( mask[ ( i + 7 ) * maskStride ], mask[ ( i + 6 ) * maskStride ], mask[ ( i + 5 ) * maskStride ], mask[ ( i + 4 ) * maskStride ],
+																   mask[ ( i + 3 ) * maskStride ], mask[ ( i + 2 ) * maskStride ], mask[ ( i + 1 ) * maskStride ], mask[ i * maskStride ] ) );
+						const __m256i product( _mm256_mullo_epi16( alpha, maskAlpha ) );
+						alpha = _mm256_srli_epi32( _mm256_add_epi32( _mm256_add_epi32( product, _mm256_set1_epi32( 1 ) ), _mm256_srli_epi32( product, 8 ) ), 8 );
+					}
+					alpha = _mm256_or_si256( alpha, _mm256_slli_epi32( alpha, 8 ) );
+					alpha = _mm256_or_si256( alpha, _mm256_slli_epi32( alpha, 16 ) );
+
+					// Unpack and pack both work inside the 128 bits lanes, the pixels stay in place.
+					const __m256i resultLo( _blendOpaqueAVX2( _mm256_unpacklo_epi8( dst, zero ), _mm256_unpacklo_epi8( src, zero ), _mm256_unpacklo_epi8( alpha, zero ) ) );
+					const __m256i resultHi( _blendOpaqueAVX2( _mm256_unpackhi_epi8( dst, zero ), _mm256_unpackhi_epi8( src, zero ), _mm256_unpackhi_epi8( alpha, zero ) ) );
+
+					_mm256_storeu_si256( reinterpret_cast< __m256i * >( colorDest + i ), _mm256_or_si256( _mm256_packus_epi16( resultLo, resultHi ), alphaMask ) );
+				}
+				return nbBlocks;
+#else
+				return Size( 0 );
+#endif
+			}
+			CPU_TARGET_AVX2 inline static Size _blendSpanAVX2( ColorRGBA<float> * colorDest, const ColorRGBA<float> * colorSrc, const float * mask, Size maskStride, Size nbPixels ) {
+				const __m256 one( _mm256_set1_ps( 1.0f ) );
+				const Size nbBlocks( nbPixels & ~Size( 7 ) );
+				for ( Size i( 0 ); i < nbBlocks; i += Size( 8 ) ) {
+					float * dstData( reinterpret_cast< float * >( colorDest + i ) );
+					const float * srcData( reinterpret_cast< const float * >( colorSrc + i ) );
+
+					// Pixels 0 and 1 in the first register, 2 and 3 in the second..., the lanes are then holding the pixels ( 0, 2, 4, 6 ) and ( 1, 3, 5, 7 ).
+					__m256 dstR( _mm256_loadu_ps( dstData ) ), dstG( _mm256_loadu_ps( dstData + 8 ) ), dstB( _mm256_loadu_ps( dstData + 16 ) ), dstA( _mm256_loadu_ps( dstData + 24 ) );
+					_transposeAVX2( dstR, dstG, dstB, dstA );
+					if ( _mm256_movemask_ps( _mm256_cmp_ps( dstA, one, _CMP_EQ_OQ ) ) != 0xFF ) {
+						_blendSpanScalar( colorDest + i, colorSrc + i, mask ? mask + i * maskStride : mask, maskStride, Size( 8 ) );
+						continue;
+					}
+					__m256 srcR( _mm256_loadu_ps( srcData ) ), srcG( _mm256_loadu_ps( srcData + 8 ) ), srcB( _mm256_loadu_ps( srcData + 16 ) ), srcA( _mm256_loadu_ps( srcData + 24 ) );
+					_transposeAVX2( srcR, srcG, srcB, srcA );
+
+					if ( mask ) {
+						srcA = _mm256_mul_ps( srcA, _mm256_set_ps( mask[ ( i + 7 ) * maskStride ], mask[ ( i + 5 ) * maskStride ], mask[ ( i + 3 ) * maskStride ], mask[ ( i + 1 ) * maskStride ],
+																   mask[ ( i + 6 ) * maskStride ], mask[ ( i + 4 ) * maskStride ], mask[ ( i + 2 ) * maskStride ], mask[ i * maskStride ] ) );
+					}
+					const __m256 oneMinusAlpha( _mm256_sub_ps( one, srcA ) );
+					dstR = _blendOpaqueAVX2( dstR, srcR, srcA, oneMinusAlpha );
+					dstG = _blendOpaqueAVX2( dstG, srcG, srcA, oneMinusAlpha );
+					dstB = _blendOpaqueAVX2( dstB, srcB, srcA, oneMinusAlpha );
+
+					_transposeAVX2( dstR, dstG, dstB, dstA );
+					_mm256_storeu_ps( dstData, dstR );
+					_mm256_storeu_ps( dstData + 8, dstG );
+					_mm256_storeu_ps( dstData + 16, dstB );
+					_mm256_storeu_ps( dstData + 24, dstA );
+				}
+				return nbBlocks;
+			}
+#endif
+#if defined CPU_NEON
+			inline static Size _blendSpanNEON( ColorRGBA<unsigned char> * colorDest, const ColorRGBA<unsigned char> * colorSrc, const unsigned char * mask, Size maskStride, Size nbPixels ) {
+#ifdef GRAPHIC_FAST_BLENDING
+				const Size nbBlocks( nbPixels & ~Size( 15 ) );
+				for ( Size i( 0 ); i < nbBlocks; i += Size( 16 ) ) {
+					// Loaded deinterleaved, one register per component.
+					uint8x16x4_t dst( vld4q_u8( reinterpret_cast< const uint8_t * >( colorDest + i ) ) );
+					if ( vminvq_u8( dst.val[ 3 ] ) != 255 ) {
+						_blendSpanScalar( colorDest + i, colorSrc + i, mask ? mask + i * maskStride : mask, maskStride, Size( 16 ) );
+						continue;
+					}
+					const uint8x16x4_t src( vld4q_u8( reinterpret_cast< const uint8_t * >( colorSrc + i ) ) );
+
+					uint8x16_t alpha( src.val[ 3 ] );
+					if ( mask ) {
+						uint8_t maskAlpha[ 16 ];
+						for ( Size j( 0 ); j < Size( 16 ); j++ ) {
+							maskAlpha[ j ] = mask[ ( i + j ) * maskStride ];
+						}
+						const uint8x16_t maskAlphaV( vld1q_u8( maskAlpha ) );
+						const uint16x8_t productLo( vmull_u8( vget_low_u8( alpha ), vget_low_u8( maskAlphaV ) ) );
+						const uint16x8_t productHi( vmull_high_u8( alpha, maskAlphaV ) );
+						alpha = vcombine_u8( vshrn_n_u16( vaddq_u16( vaddq_u16( productLo, vdupq_n_u16( 1 ) ), vshrq_n_u16( productLo, 8 ) ), 8 ),
+											 vshrn_n_u16( vaddq_u16( vaddq_u16( productHi, vdupq_n_u16( 1 ) ), vshrq_n_u16( productHi, 8 ) ), 8 ) );
+					}
+					const uint8x16_t oneMinusAlpha( vsubq_u8( vdupq_n_u8( 255 ), alpha ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+					const uint8x16_t bTransparent( vceqq_u8( alpha, vdupq_n_u8( 0 ) ) );
+					const uint8x16_t bOpaque( vceqq_u8( alpha, vdupq_n_u8( 255 ) ) );
+#endif
+					for ( int c( 0 ); c < 3; c++ ) {
+						const uint16x8_t resultLo( vmlal_u8( vmull_u8( vget_low_u8( dst.val[ c ] ), vget_low_u8( oneMinusAlpha ) ), vget_low_u8( src.val[ c ] ), vget_low_u8( alpha ) ) );
+						const uint16x8_t resultHi( vmlal_high_u8( vmull_high_u8( dst.val[ c ], oneMinusAlpha ), src.val[ c ], alpha ) );
+						uint8x16_t result( vcombine_u8( vshrn_n_u16( resultLo, 8 ), vshrn_n_u16( resultHi, 8 ) ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+						result = vbslq_u8( bOpaque, src.val[ c ], vbslq_u8( bTransparent, dst.val[ c ], result ) );
+#endif
+						dst.val[ c ] = result;
+					}
+					// The destination alpha stay opaque.
+					vst4q_u8( reinterpret_cast< uint8_t * >( colorDest + i ), dst );
+				}
+				return nbBlocks;
+#else
+				return Size( 0 );
+#endif
+			}
+			inline static Size _blendSpanNEON( ColorRGBA<float> * colorDest, const ColorRGBA<float> * colorSrc, const float * mask, Size maskStride, Size nbPixels ) {
+				const float32x4_t one( vdupq_n_f32( 1.0f ) );
+				const Size nbBlocks( nbPixels & ~Size( 3 ) );
+				for ( Size i( 0 ); i < nbBlocks; i += Size( 4 ) ) {
+					float32x4x4_t dst( vld4q_f32( reinterpret_cast< const float * >( colorDest + i ) ) );
+					if ( vminvq_u32( vceqq_f32( dst.val[ 3 ], one ) ) == 0 ) {
+						_blendSpanScalar( colorDest + i, colorSrc + i, mask ? mask + i * maskStride : mask, maskStride, Size( 4 ) );
+						continue;
+					}
+					const float32x4x4_t src( vld4q_f32( reinterpret_cast< const float * >( colorSrc + i ) ) );
+
+					float32x4_t alpha( src.val[ 3 ] );
+					if ( mask ) {
+						const float maskAlpha[ 4 ] = { mask[ i * maskStride ], mask[ ( i + 1 ) * maskStride ], mask[ ( i + 2 ) * maskStride ], mask[ ( i + 3 ) * maskStride ] };
+						alpha = vmulq_f32( alpha, vld1q_f32( maskAlpha ) );
+					}
+					const float32x4_t oneMinusAlpha( vsubq_f32( one, alpha ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+					const uint32x4_t bTransparent( vceqq_f32( alpha, vdupq_n_f32( 0.0f ) ) );
+					const uint32x4_t bOpaque( vceqq_f32( alpha, one ) );
+#endif
+					for ( int c( 0 ); c < 3; c++ ) {
+						// Not fused, as the scalar code.
+						float32x4_t result( vaddq_f32( vmulq_f32( dst.val[ c ], oneMinusAlpha ), vmulq_f32( src.val[ c ], alpha ) ) );
+#ifdef GRAPHIC_BRANCHING_BLENDING
+						result = vbslq_f32( bOpaque, src.val[ c ], vbslq_f32( bTransparent, dst.val[ c ], result ) );
+#endif
+						dst.val[ c ] = result;
+					}
+					vst4q_f32( reinterpret_cast< float * >( colorDest + i ), dst );
+				}
+				return nbBlocks;
+			}
+#endif
+
 		};
 
 
+		///@brief Blend a span of contiguous pixels with any blending functor, one pixel at a time.
+		///@param blendFunc Blending functor.
+		///@param colorDest Destination pixels.
+		///@param colorSrc Source pixels.
+		///@param nbPixels Number of pixels.
+		template<typename BlendFunc, typename C1, typename C2>
+		inline void blendSpan( const BlendFunc & blendFunc, C1 * colorDest, const C2 * colorSrc, Size nbPixels ) {
+			for ( Size i( 0 ); i < nbPixels; i++ ) {
+				blendFunc( colorDest[ i ], colorSrc[ i ] );
+			}
+		}
+		template<typename C1, typename C2>
+		inline void blendSpan( const Normal & blendFunc, C1 * colorDest, const C2 * colorSrc, Size nbPixels ) {
+			Normal::blendSpan( colorDest, colorSrc, nbPixels );
+		}
+
+		///@brief Blend a span of contiguous pixels using a mask with any blending functor, one pixel at a time.
+		///@param blendFunc Blending functor.
+		///@param colorDest Destination pixels.
+		///@param colorSrc Source pixels.
+		///@param mask Alpha of the first pixel, the one of the pixel i being mask[ i * maskStride ].
+		///@param maskStride Number of elements between the alphas of two consecutive pixels.
+		///@param nbPixels Number of pixels.
+		template<typename BlendFunc, typename C1, typename C2, typename A>
+		inline void blendSpan( const BlendFunc & blendFunc, C1 * colorDest, const C2 * colorSrc, const A * mask, Size maskStride, Size nbPixels ) {
+			for ( Size i( 0 ); i < nbPixels; i++ ) {
+				blendFunc( colorDest[ i ], colorSrc[ i ], mask[ i * maskStride ] );
+			}
+		}
+		template<typename C1, typename C2, typename A>
+		inline void blendSpan( const Normal & blendFunc, C1 * colorDest, const C2 * colorSrc, const A * mask, Size maskStride, Size nbPixels ) {
+			Normal::blendSpan( colorDest, colorSrc, mask, maskStride, nbPixels );
+		}
+
 
 
 
@@ -1692,7 +2093,624 @@ namespace Graphic {
 
 
 
-	
+		///@brief Operations on the normalized components used by the Composite functors, one value at a time.
+		///			The vectorized ones (_OpsSSE2, _OpsAVX2, _OpsNEON) do exactly the same operations on nbLanes pixels at a time, the results being bit exact.
+		template<typename F>
+		struct _OpsScalar {
+			typedef F Type;
+			typedef bool Mask;
+
+			inline static F zero() { return F( 0 ); }
+			inline static F one() { return F( 1 ); }
+			inline static F set( const F & v ) { return v; }
+			inline static F add( const F & a, const F & b ) { return a + b; }
+			inline static F sub( const F & a, const F & b ) { return a - b; }
+			inline static F mul( const F & a, const F & b ) { return a * b; }
+			inline static F div( const F & a, const F & b ) { return a / b; }
+			inline static F min( const F & a, const F & b ) { return ( a < b ) ? a : b; }
+			inline static F max( const F & a, const F & b ) { return ( a > b ) ? a : b; }
+			inline static bool cmpEq( const F & a, const F & b ) { return a == b; }
+			inline static bool cmpLe( const F & a, const F & b ) { return a <= b; }
+			inline static F select( const bool & mask, const F & a, const F & b ) { return mask ? a : b; }
+		};
+
+#if defined GRAPHIC_OPS_SSE2
+		struct _OpsSSE2 {
+			typedef __m128 Type;
+			typedef __m128 Mask;
+			static const Size nbLanes = 4;
+
+			inline static __m128 zero() { return _mm_setzero_ps(); }
+			inline static __m128 one() { return _mm_set1_ps( 1.0f ); }
+			inline static __m128 set( const float & v ) { return _mm_set1_ps( v ); }
+			inline static __m128 add( const __m128 & a, const __m128 & b ) { return _mm_add_ps( a, b ); }
+			inline static __m128 sub( const __m128 & a, const __m128 & b ) { return _mm_sub_ps( a, b ); }
+			inline static __m128 mul( const __m128 & a, const __m128 & b ) { return _mm_mul_ps( a, b ); }
+			inline static __m128 div( const __m128 & a, const __m128 & b ) { return _mm_div_ps( a, b ); }
+			inline static __m128 min( const __m128 & a, const __m128 & b ) { return _mm_min_ps( a, b ); }
+			inline static __m128 max( const __m128 & a, const __m128 & b ) { return _mm_max_ps( a, b ); }
+			inline static __m128 cmpEq( const __m128 & a, const __m128 & b ) { return _mm_cmpeq_ps( a, b ); }
+			inline static __m128 cmpLe( const __m128 & a, const __m128 & b ) { return _mm_cmple_ps( a, b ); }
+			inline static __m128 select( const __m128 & mask, const __m128 & a, const __m128 & b ) { return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) ); }
+
+			///@brief Load nbLanes pixels, one register per component, normalized.
+			inline static void load( const ColorRGBA<unsigned char> * color, __m128 * components ) {
+				const __m128i data( _mm_loadu_si128( reinterpret_cast< const __m128i * >( color ) ) );
+				const __m128i byteMask( _mm_set1_epi32( 0xFF ) );
+				const __m128 normalize( _mm_set1_ps( 1.0f / 255.0f ) );
+				components[ 0 ] = _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( data, byteMask ) ), normalize );
+				components[ 1 ] = _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( _mm_srli_epi32( data, 8 ), byteMask ) ), normalize );
+				components[ 2 ] = _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( _mm_srli_epi32( data, 16 ), byteMask ) ), normalize );
+				components[ 3 ] = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( data, 24 ) ), normalize );
+			}
+			inline static void load( const ColorRGBA<float> * color, __m128 * components ) {
+				const float * data( reinterpret_cast< const float * >( color ) );
+				components[ 0 ] = _mm_loadu_ps( data );
+				components[ 1 ] = _mm_loadu_ps( data + 4 );
+				components[ 2 ] = _mm_loadu_ps( data + 8 );
+				components[ 3 ] = _mm_loadu_ps( data + 12 );
+				_MM_TRANSPOSE4_PS( components[ 0 ], components[ 1 ], components[ 2 ], components[ 3 ] );
+			}
+
+			///@brief Store nbLanes pixels loaded by load().
+			inline static void store( ColorRGBA<unsigned char> * color, const __m128 * components ) {
+				const __m128 scale( _mm_set1_ps( 255.0f ) );
+				const __m128 half( _mm_set1_ps( 0.5f ) );
+				__m128i data( _mm_setzero_si128() );
+				for ( int c( 0 ); c < 4; c++ ) {
+					const __m128i component( _mm_cvttps_epi32( _mm_add_ps( _mm_mul_ps( min( max( components[ c ], zero() ), one() ), scale ), half ) ) );
+					data = _mm_or_si128( data, _mm_sll_epi32( component, _mm_cvtsi32_si128( c * 8 ) ) );
+				}
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( color ), data );
+			}
+			inline static void store( ColorRGBA<float> * color, const __m128 * components ) {
+				__m128 r( components[ 0 ] ), g( components[ 1 ] ), b( components[ 2 ] ), a( components[ 3 ] );
+				_MM_TRANSPOSE4_PS( r, g, b, a );
+				float * data( reinterpret_cast< float * >( color ) );
+				_mm_storeu_ps( data, r );
+				_mm_storeu_ps( data + 4, g );
+				_mm_storeu_ps( data + 8, b );
+				_mm_storeu_ps( data + 12, a );
+			}
+
+			///@brief Load the mask alphas of nbLanes pixels, normalized, in the order of the lanes of load().
+			inline static __m128 loadMask( const unsigned char * mask, Size maskStride ) {
+				return _mm_mul_ps( _mm_set_ps( float( mask[ 3 * maskStride ] ), float( mask[ 2 * maskStride ] ), float( mask[ maskStride ] ), float( mask[ 0 ] ) ), _mm_set1_ps( 1.0f / 255.0f ) );
+			}
+			inline static __m128 loadMask( const float * mask, Size maskStride ) {
+				return _mm_set_ps( mask[ 3 * maskStride ], mask[ 2 * maskStride ], mask[ maskStride ], mask[ 0 ] );
+			}
+		};
+#endif
+
+#if defined GRAPHIC_OPS_AVX2
+		struct _OpsAVX2 {
+			typedef __m256 Type;
+			typedef __m256 Mask;
+			static const Size nbLanes = 8;
+
+			inline static __m256 zero() { return _mm256_setzero_ps(); }
+			inline static __m256 one() { return _mm256_set1_ps( 1.0f ); }
+			inline static __m256 set( const float & v ) { return _mm256_set1_ps( v ); }
+			inline static __m256 add( const __m256 & a, const __m256 & b ) { return _mm256_add_ps( a, b ); }
+			inline static __m256 sub( const __m256 & a, const __m256 & b ) { return _mm256_sub_ps( a, b ); }
+			inline static __m256 mul( const __m256 & a, const __m256 & b ) { return _mm256_mul_ps( a, b ); }
+			inline static __m256 div( const __m256 & a, const __m256 & b ) { return _mm256_div_ps( a, b ); }
+			inline static __m256 min( const __m256 & a, const __m256 & b ) { return _mm256_min_ps( a, b ); }
+			inline static __m256 max( const __m256 & a, const __m256 & b ) { return _mm256_max_ps( a, b ); }
+			inline static __m256 cmpEq( const __m256 & a, const __m256 & b ) { return _mm256_cmp_ps( a, b, _CMP_EQ_OQ ); }
+			inline static __m256 cmpLe( const __m256 & a, const __m256 & b ) { return _mm256_cmp_ps( a, b, _CMP_LE_OQ ); }
+			inline static __m256 select( const __m256 & mask, const __m256 & a, const __m256 & b ) { return _mm256_blendv_ps( b, a, mask ); }
+
+			inline static void load( const ColorRGBA<unsigned char> * color, __m256 * components ) {
+				const __m256i data( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( color ) ) );
+				const __m256i byteMask( _mm256_set1_epi32( 0xFF ) );
+				const __m256 normalize( _mm256_set1_ps( 1.0f / 255.0f ) );
+				components[ 0 ] = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_and_si256( data, byteMask ) ), normalize );
+				components[ 1 ] = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_and_si256( _mm256_srli_epi32( data, 8 ), byteMask ) ), normalize );
+				components[ 2 ] = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_and_si256( _mm256_srli_epi32( data, 16 ), byteMask ) ), normalize );
+				components[ 3 ] = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_srli_epi32( data, 24 ) ), normalize );
+			}
+			///@brief The lanes are holding the pixels ( 0, 2, 4, 6 ) and ( 1, 3, 5, 7 ), see loadMask().
+			inline static void load( const ColorRGBA<float> * color, __m256 * components ) {
+				const float * data( reinterpret_cast< const float * >( color ) );
+				components[ 0 ] = _mm256_loadu_ps( data );
+				components[ 1 ] = _mm256_loadu_ps( data + 8 );
+				components[ 2 ] = _mm256_loadu_ps( data + 16 );
+				components[ 3 ] = _mm256_loadu_ps( data + 24 );
+				_transpose( components[ 0 ], components[ 1 ], components[ 2 ], components[ 3 ] );
+			}
+
+			inline static void store( ColorRGBA<unsigned char> * color, const __m256 * components ) {
+				const __m256 scale( _mm256_set1_ps( 255.0f ) );
+				const __m256 half( _mm256_set1_ps( 0.5f ) );
+				__m256i data( _mm256_setzero_si256() );
+				for ( int c( 0 ); c < 4; c++ ) {
+					const __m256i component( _mm256_cvttps_epi32( _mm256_add_ps( _mm256_mul_ps( min( max( components[ c ], zero() ), one() ), scale ), half ) ) );
+					data = _mm256_or_si256( data, _mm256_sll_epi32( component, _mm_cvtsi32_si128( c * 8 ) ) );
+				}
+				_mm256_storeu_si256( reinterpret_cast< __m256i * >( color ), data );
+			}
+			inline static void store( ColorRGBA<float> * color, const __m256 * components ) {
+				__m256 r( components[ 0 ] ), g( components[ 1 ] ), b( components[ 2 ] ), a( components[ 3 ] );
+				_transpose( r, g, b, a );
+				float * data( reinterpret_cast< float * >( color ) );
+				_mm256_storeu_ps( data, r );
+				_mm256_storeu_ps( data + 8, g );
+				_mm256_storeu_ps( data + 16, b );
+				_mm256_storeu_ps( data + 24, a );
+			}
+
+			inline static __m256 loadMask( const unsigned char * mask, Size maskStride ) {
+				return _mm256_mul_ps( _mm256_set_ps( float( mask[ 7 * maskStride ] ), float( mask[ 6 * maskStride ] ), float( mask[ 5 * maskStride ] ), float( mask[ 4 * maskStride ] ),
+													 float( mask[ 3 * maskStride ] ), float( mask[ 2 * maskStride ] ), float( mask[ maskStride ] ), float( mask[ 0 ] ) ), _mm256_set1_ps( 1.0f / 255.0f ) );
+			}
+			inline static __m256 loadMask( const float * mask, Size maskStride ) {
+				return _mm256_set_ps( mask[ 7 * maskStride ], mask[ 5 * maskStride ], mask[ 3 * maskStride ], mask[ maskStride ],
+									  mask[ 6 * maskStride ], mask[ 4 * maskStride ], mask[ 2 * maskStride ], mask[ 0 ] );
+			}
+
+			///@brief Transpose the 4x4 floats of each 128 bits lane.
+			inline static void _transpose( __m256 & v0, __m256 & v1, __m256 & v2, __m256 & v3 ) {
+				const __m256 t0( _mm256_unpacklo_ps( v0, v1 ) );
+				const __m256 t1( _mm256_unpacklo_ps( v2, v3 ) );
+				const __m256 t2( _mm256_unpackhi_ps( v0, v1 ) );
+				const __m256 t3( _mm256_unpackhi_ps( v2, v3 ) );
+				v0 = _mm256_shuffle_ps( t0, t1, 0x44 );
+				v1 = _mm256_shuffle_ps( t0, t1, 0xEE );
+				v2 = _mm256_shuffle_ps( t2, t3, 0x44 );
+				v3 = _mm256_shuffle_ps( t2, t3, 0xEE );
+			}
+		};
+#endif
+
+#if defined CPU_NEON
+		struct _OpsNEON {
+			typedef float32x4_t Type;
+			typedef uint32x4_t Mask;
+			static const Size nbLanes = 4;
+
+			inline static float32x4_t zero() { return vdupq_n_f32( 0.0f ); }
+			inline static float32x4_t one() { return vdupq_n_f32( 1.0f ); }
+			inline static float32x4_t set( const float & v ) { return vdupq_n_f32( v ); }
+			inline static float32x4_t add( const float32x4_t & a, const float32x4_t & b ) { return vaddq_f32( a, b ); }
+			inline static float32x4_t sub( const float32x4_t & a, const float32x4_t & b ) { return vsubq_f32( a, b ); }
+			inline static float32x4_t mul( const float32x4_t & a, const float32x4_t & b ) { return vmulq_f32( a, b ); }
+			inline static float32x4_t div( const float32x4_t & a, const float32x4_t & b ) { return vdivq_f32( a, b ); }
+			// Same as the scalar ( a < b ) ? a : b, vminq_f32 being different for the signed zeros.
+			inline static float32x4_t min( const float32x4_t & a, const float32x4_t & b ) { return vbslq_f32( vcltq_f32( a, b ), a, b ); }
+			inline static float32x4_t max( const float32x4_t & a, const float32x4_t & b ) { return vbslq_f32( vcgtq_f32( a, b ), a, b ); }
+			inline static uint32x4_t cmpEq( const float32x4_t & a, const float32x4_t & b ) { return vceqq_f32( a, b ); }
+			inline static uint32x4_t cmpLe( const float32x4_t & a, const float32x4_t & b ) { return vcleq_f32( a, b ); }
+			inline static float32x4_t select( const uint32x4_t & mask, const float32x4_t & a, const float32x4_t & b ) { return vbslq_f32( mask, a, b ); }
+
+			inline static void load( const ColorRGBA<unsigned char> * color, float32x4_t * components ) {
+				const uint32x4_t data( vld1q_u32( reinterpret_cast< const uint32_t * >( color ) ) );
+				const uint32x4_t byteMask( vdupq_n_u32( 0xFF ) );
+				const float32x4_t normalize( vdupq_n_f32( 1.0f / 255.0f ) );
+				components[ 0 ] = vmulq_f32( vcvtq_f32_u32( vandq_u32( data, byteMask ) ), normalize );
+				components[ 1 ] = vmulq_f32( vcvtq_f32_u32( vandq_u32( vshrq_n_u32( data, 8 ), byteMask ) ), normalize );
+				components[ 2 ] = vmulq_f32( vcvtq_f32_u32( vandq_u32( vshrq_n_u32( data, 16 ), byteMask ) ), normalize );
+				components[ 3 ] = vmulq_f32( vcvtq_f32_u32( vshrq_n_u32( data, 24 ) ), normalize );
+			}
+			inline static void load( const ColorRGBA<float> * color, float32x4_t * components ) {
+				const float32x4x4_t data( vld4q_f32( reinterpret_cast< const float * >( color ) ) );
+				for ( int c( 0 ); c < 4; c++ ) {
+					components[ c ] = data.val[ c ];
+				}
+			}
+
+			inline static void store( ColorRGBA<unsigned char> * color, const float32x4_t * components ) {
+				const float32x4_t scale( vdupq_n_f32( 255.0f ) );
+				const float32x4_t half( vdupq_n_f32( 0.5f ) );
+				uint32x4_t c[ 4 ];
+				for ( int i( 0 ); i < 4; i++ ) {
+					c[ i ] = vcvtq_u32_f32( vaddq_f32( vmulq_f32( min( max( components[ i ], zero() ), one() ), scale ), half ) );
+				}
+				const uint32x4_t data( vorrq_u32( vorrq_u32( c[ 0 ], vshlq_n_u32( c[ 1 ], 8 ) ), vorrq_u32( vshlq_n_u32( c[ 2 ], 16 ), vshlq_n_u32( c[ 3 ], 24 ) ) ) );
+				vst1q_u32( reinterpret_cast< uint32_t * >( color ), data );
+			}
+			inline static void store( ColorRGBA<float> * color, const float32x4_t * components ) {
+				float32x4x4_t data;
+				for ( int c( 0 ); c < 4; c++ ) {
+					data.val[ c ] = components[ c ];
+				}
+				vst4q_f32( reinterpret_cast< float * >( color ), data );
+			}
+
+			inline static float32x4_t loadMask( const unsigned char * mask, Size maskStride ) {
+				const float maskAlpha[ 4 ] = { float( mask[ 0 ] ), float( mask[ maskStride ] ), float( mask[ 2 * maskStride ] ), float( mask[ 3 * maskStride ] ) };
+				return vmulq_f32( vld1q_f32( maskAlpha ), vdupq_n_f32( 1.0f / 255.0f ) );
+			}
+			inline static float32x4_t loadMask( const float * mask, Size maskStride ) {
+				const float maskAlpha[ 4 ] = { mask[ 0 ], mask[ maskStride ], mask[ 2 * maskStride ], mask[ 3 * maskStride ] };
+				return vld1q_f32( maskAlpha );
+			}
+		};
+#endif
+
+		///@brief Operators of the Composite functors, each giving the Porter-Duff factors fa( alphaSrc, alphaDest ) and fb( alphaSrc, alphaDest ) and the mixing mix( colorDest, colorSrc ) of the separable blending modes.
+		namespace CompositeMode {
+
+			///@brief Porter-Duff operators, the source color being kept as is.
+			struct PorterDuff {
+				static const bool bSeparable = false;
+				template<typename Ops>
+				inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) { return colorSrc; }
+			};
+
+			///@brief Source over the destination.
+			struct Over : public PorterDuff {
+				template<typename Ops> inline static typename Ops::Type fa( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::one(); }
+				template<typename Ops> inline static typename Ops::Type fb( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::sub( Ops::one(), alphaSrc ); }
+			};
+			///@brief Source inside the destination, the destination being discarded.
+			struct In : public PorterDuff {
+				template<typename Ops> inline static typename Ops::Type fa( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return alphaDest; }
+				template<typename Ops> inline static typename Ops::Type fb( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::zero(); }
+			};
+			///@brief Source outside the destination, the destination being discarded.
+			struct Out : public PorterDuff {
+				template<typename Ops> inline static typename Ops::Type fa( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::sub( Ops::one(), alphaDest ); }
+				template<typename Ops> inline static typename Ops::Type fb( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::zero(); }
+			};
+			///@brief Source inside the destination over the destination, the destination alpha being kept.
+			struct Atop : public PorterDuff {
+				template<typename Ops> inline static typename Ops::Type fa( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return alphaDest; }
+				template<typename Ops> inline static typename Ops::Type fb( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::sub( Ops::one(), alphaSrc ); }
+			};
+			///@brief Source outside the destination and destination outside the source.
+			struct Xor : public PorterDuff {
+				template<typename Ops> inline static typename Ops::Type fa( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::sub( Ops::one(), alphaDest ); }
+				template<typename Ops> inline static typename Ops::Type fb( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::sub( Ops::one(), alphaSrc ); }
+			};
+
+			///@brief Separable blending modes, the mixed color being composed over the destination.
+			struct Separable {
+				static const bool bSeparable = true;
+				template<typename Ops> inline static typename Ops::Type fa( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::one(); }
+				template<typename Ops> inline static typename Ops::Type fb( const typename Ops::Type & alphaSrc, const typename Ops::Type & alphaDest ) { return Ops::sub( Ops::one(), alphaSrc ); }
+			};
+
+			///@brief colorDest * colorSrc
+			struct Multiply : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					return Ops::mul( colorDest, colorSrc );
+				}
+			};
+			///@brief colorDest + colorSrc - colorDest * colorSrc
+			struct Screen : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					return Ops::sub( Ops::add( colorDest, colorSrc ), Ops::mul( colorDest, colorSrc ) );
+				}
+			};
+			///@brief Multiply of the doubled destination if colorDest <= 0.5, Screen otherwise.
+			struct Overlay : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					const typename Ops::Type colorDest2( Ops::add( colorDest, colorDest ) );
+					const typename Ops::Type colorDestScreen( Ops::sub( colorDest2, Ops::one() ) );
+					return Ops::select( Ops::cmpLe( colorDest, Ops::set( 0.5f ) ), Ops::mul( colorSrc, colorDest2 ),
+										Ops::sub( Ops::add( colorSrc, colorDestScreen ), Ops::mul( colorSrc, colorDestScreen ) ) );
+				}
+			};
+			///@brief min( colorDest + colorSrc, 1 )
+			struct Add : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					return Ops::min( Ops::add( colorDest, colorSrc ), Ops::one() );
+				}
+			};
+			///@brief max( colorDest - colorSrc, 0 )
+			struct Subtract : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					return Ops::max( Ops::sub( colorDest, colorSrc ), Ops::zero() );
+				}
+			};
+			///@brief min( colorDest, colorSrc )
+			struct Darken : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					return Ops::min( colorDest, colorSrc );
+				}
+			};
+			///@brief max( colorDest, colorSrc )
+			struct Lighten : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					return Ops::max( colorDest, colorSrc );
+				}
+			};
+			///@brief | colorDest - colorSrc |
+			struct Difference : public Separable {
+				template<typename Ops> inline static typename Ops::Type mix( const typename Ops::Type & colorDest, const typename Ops::Type & colorSrc ) {
+					return Ops::sub( Ops::max( colorDest, colorSrc ), Ops::min( colorDest, colorSrc ) );
+				}
+			};
+
+		}
+
+
+		///@brief Compositing Functor, a Porter-Duff operator or a separable blending mode (as defined by the W3C Compositing and Blending) given by Mode (see CompositeMode).
+		///			Computed on the normalized components :
+		///				alphaOut = alphaSrc * fa + alphaDest * fb
+		///				colorOut = ( alphaSrc * fa * mixed + alphaDest * fb * colorDest ) / alphaOut		(0 if alphaOut is 0)
+		///			with mixed = colorSrc for a Porter-Duff operator, ( 1 - alphaDest ) * colorSrc + alphaDest * mix( colorDest, colorSrc ) for a blending mode.
+		///			The colors without alpha (R and RGB) are opaque, the alpha computed for them being dropped. A R destination is computed from the lightness of the source.
+		///			The RGBA -> RGBA spans of unsigned char and float (blendSpan()) are vectorized with the instruction set of CPU::getIsa(), with the same results as blendColor().
+		/// Some Examples of Blending ( Multiply ) :
+		///			[ colorDst ]	[ colorSrc ]		[ alpha ]	-> [ colorDst ]
+		///			[ 0.5 ]			[ 0.5 0.5 0.5 ]					-> [ 0.25 ]
+		///			[ 1 0 0 1 ]		[ 0.5 0.5 0.5 1 ]				-> [ 0.5 0 0 1 ]
+		///			[ 1 0 0 1 ]		[ 0.5 0.5 0.5 1 ]	[ 0.5 ]		-> [ 0.75 0 0 1 ]
+		template<typename Mode>
+		class Composite : public Template {
+		public:
+			//WITHOUT MASK
+			template<typename T> void operator()( ColorR<T> & colorDest, const ColorR<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+			template<typename T> void operator()( ColorR<T> & colorDest, const ColorRGB<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+			template<typename T> void operator()( ColorR<T> & colorDest, const ColorRGBA<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+
+			template<typename T> void operator()( ColorRGB<T> & colorDest, const ColorR<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+			template<typename T> void operator()( ColorRGB<T> & colorDest, const ColorRGB<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+			template<typename T> void operator()( ColorRGB<T> & colorDest, const ColorRGBA<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+
+			template<typename T> void operator()( ColorRGBA<T> & colorDest, const ColorR<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+			template<typename T> void operator()( ColorRGBA<T> & colorDest, const ColorRGB<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+			template<typename T> void operator()( ColorRGBA<T> & colorDest, const ColorRGBA<T> & colorSrc ) const { blendColor( colorDest, colorSrc ); }
+
+			//WITH MASK
+			template<typename T, typename A> void operator()( ColorR<T> & colorDest, const ColorR<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+			template<typename T, typename A> void operator()( ColorR<T> & colorDest, const ColorRGB<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+			template<typename T, typename A> void operator()( ColorR<T> & colorDest, const ColorRGBA<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+
+			template<typename T, typename A> void operator()( ColorRGB<T> & colorDest, const ColorR<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+			template<typename T, typename A> void operator()( ColorRGB<T> & colorDest, const ColorRGB<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+			template<typename T, typename A> void operator()( ColorRGB<T> & colorDest, const ColorRGBA<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+
+			template<typename T, typename A> void operator()( ColorRGBA<T> & colorDest, const ColorR<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+			template<typename T, typename A> void operator()( ColorRGBA<T> & colorDest, const ColorRGB<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+			template<typename T, typename A> void operator()( ColorRGBA<T> & colorDest, const ColorRGBA<T> & colorSrc, A alpha ) const { blendColor( colorDest, colorSrc, alpha ); }
+
+			///@brief Blend one pixel.
+			///@param colorDest Destination color (ColorR, ColorRGB or ColorRGBA).
+			///@param colorSrc Source color (ColorR, ColorRGB or ColorRGBA).
+			template<template<typename> class C1, template<typename> class C2, typename T>
+			inline static void blendColor( C1<T> & colorDest, const C2<T> & colorSrc ) {
+				_blendColor( colorDest, colorSrc, typename Color<T>::Float( 1 ) );
+			}
+
+			///@brief Blend one pixel using a mask alpha, multiplied to the source alpha.
+			///@param colorDest Destination color (ColorR, ColorRGB or ColorRGBA).
+			///@param colorSrc Source color (ColorR, ColorRGB or ColorRGBA).
+			///@param alpha Alpha of the mask.
+			template<template<typename> class C1, template<typename> class C2, typename T, typename A>
+			inline static void blendColor( C1<T> & colorDest, const C2<T> & colorSrc, A alpha ) {
+				_blendColor( colorDest, colorSrc, _toFloat<typename Color<T>::Float>( alpha ) );
+			}
+
+			///@brief Blend a span of contiguous pixels, the result being the same as blendColor() on each of them.
+			///@param colorDest Destination pixels.
+			///@param colorSrc Source pixels.
+			///@param nbPixels Number of pixels.
+			template<typename C1, typename C2>
+			inline static void blendSpan( C1 * colorDest, const C2 * colorSrc, Size nbPixels ) {
+				for ( Size i( 0 ); i < nbPixels; i++ ) {
+					blendColor( colorDest[ i ], colorSrc[ i ] );
+				}
+			}
+			inline static void blendSpan( ColorRGBA<unsigned char> * colorDest, const ColorRGBA<unsigned char> * colorSrc, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, ( const unsigned char * ) NULL, Size( 0 ), nbPixels );
+			}
+			inline static void blendSpan( ColorRGBA<float> * colorDest, const ColorRGBA<float> * colorSrc, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, ( const float * ) NULL, Size( 0 ), nbPixels );
+			}
+
+			///@brief Blend a span of contiguous pixels using a mask, the result being the same as blendColor() on each of them.
+			///@param colorDest Destination pixels.
+			///@param colorSrc Source pixels.
+			///@param mask Alpha of the first pixel, the one of the pixel i being mask[ i * maskStride ].
+			///@param maskStride Number of elements between the alphas of two consecutive pixels.
+			///@param nbPixels Number of pixels.
+			template<typename C1, typename C2, typename A>
+			inline static void blendSpan( C1 * colorDest, const C2 * colorSrc, const A * mask, Size maskStride, Size nbPixels ) {
+				for ( Size i( 0 ); i < nbPixels; i++ ) {
+					blendColor( colorDest[ i ], colorSrc[ i ], mask[ i * maskStride ] );
+				}
+			}
+			inline static void blendSpan( ColorRGBA<unsigned char> * colorDest, const ColorRGBA<unsigned char> * colorSrc, const unsigned char * mask, Size maskStride, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, mask, maskStride, nbPixels );
+			}
+			inline static void blendSpan( ColorRGBA<float> * colorDest, const ColorRGBA<float> * colorSrc, const float * mask, Size maskStride, Size nbPixels ) {
+				_blendSpanRGBA( colorDest, colorSrc, mask, maskStride, nbPixels );
+			}
+
+		private:
+			///@brief Composite the normalized components of nbComponents colors (and the alphas), the same code being used for one pixel (_OpsScalar) and for a block of pixels.
+			template<typename Ops>
+			inline static void _composite( typename Ops::Type * colorDest, typename Ops::Type & alphaDest, const typename Ops::Type * colorSrc, const typename Ops::Type & alphaSrc, int nbComponents ) {
+				typedef typename Ops::Type V;
+
+				const V alphaSrcFa( Ops::mul( alphaSrc, Mode::template fa<Ops>( alphaSrc, alphaDest ) ) );
+				const V alphaDestFb( Ops::mul( alphaDest, Mode::template fb<Ops>( alphaSrc, alphaDest ) ) );
+				const V alphaOut( Ops::add( alphaSrcFa, alphaDestFb ) );
+				const typename Ops::Mask bTransparent( Ops::cmpEq( alphaOut, Ops::zero() ) );
+
+				for ( int c( 0 ); c < nbComponents; c++ ) {
+					V mixed( colorSrc[ c ] );
+					if ( Mode::bSeparable ) {
+						mixed = Ops::add( Ops::mul( Ops::sub( Ops::one(), alphaDest ), colorSrc[ c ] ), Ops::mul( alphaDest, Mode::template mix<Ops>( colorDest[ c ], colorSrc[ c ] ) ) );
+					}
+					colorDest[ c ] = Ops::select( bTransparent, Ops::zero(), Ops::div( Ops::add( Ops::mul( alphaSrcFa, mixed ), Ops::mul( alphaDestFb, colorDest[ c ] ) ), alphaOut ) );
+				}
+				alphaDest = alphaOut;
+			}
+
+			template<template<typename> class C1, template<typename> class C2, typename T>
+			inline static void _blendColor( C1<T> & colorDest, const C2<T> & colorSrc, const typename Color<T>::Float & alphaMask ) {
+				typedef typename Color<T>::Float F;
+				constexpr int nbComponents( ( sizeof( C1<T> ) / sizeof( T ) == 1 ) ? 1 : 3 );
+
+				F dest[ 4 ];
+				F src[ 4 ];
+				_load( colorDest, dest );
+				_load( colorSrc, src );
+				if ( nbComponents == 1 ) {
+					src[ 0 ] = _toFloat<F>( _getLightness( colorSrc ) );
+				}
+				src[ 3 ] = src[ 3 ] * alphaMask;
+
+				_composite<_OpsScalar<F>>( dest, dest[ 3 ], src, src[ 3 ], nbComponents );
+				_store( colorDest, dest );
+			}
+
+			///@brief Blend a RGBA span, vectorized by blocks, the remaining pixels being blended one at a time (mask can be NULL).
+			template<typename T>
+			inline static void _blendSpanRGBA( ColorRGBA<T> * colorDest, const ColorRGBA<T> * colorSrc, const T * mask, Size maskStride, Size nbPixels ) {
+				Size nbBlended( 0 );
+				switch ( CPU::getIsa() ) {
+#if defined GRAPHIC_OPS_AVX2
+					case CPU::Isa::AVX2:
+						nbBlended = _blendBlocks<_OpsAVX2>( colorDest, colorSrc, mask, maskStride, nbPixels );
+						break;
+#elif defined GRAPHIC_OPS_SSE2
+					case CPU::Isa::AVX2:
+#endif
+#if defined GRAPHIC_OPS_SSE2
+					case CPU::Isa::AVX:
+					case CPU::Isa::SSE2:
+						nbBlended = _blendBlocks<_OpsSSE2>( colorDest, colorSrc, mask, maskStride, nbPixels );
+						break;
+#endif
+#if defined CPU_NEON
+					case CPU::Isa::NEON:
+						nbBlended = _blendBlocks<_OpsNEON>( colorDest, colorSrc, mask, maskStride, nbPixels );
+						break;
+#endif
+					default:
+						break;
+				}
+				if ( mask ) {
+					for ( Size i( nbBlended ); i < nbPixels; i++ ) {
+						blendColor( colorDest[ i ], colorSrc[ i ], mask[ i * maskStride ] );
+					}
+				} else {
+					for ( Size i( nbBlended ); i < nbPixels; i++ ) {
+						blendColor( colorDest[ i ], colorSrc[ i ] );
+					}
+				}
+			}
+
+			///@brief Blend the blocks of Ops::nbLanes pixels of a RGBA span.
+			///@return Number of pixels blended.
+			template<typename Ops, typename T>
+			inline static Size _blendBlocks( ColorRGBA<T> * colorDest, const ColorRGBA<T> * colorSrc, const T * mask, Size maskStride, Size nbPixels ) {
+				typedef typename Ops::Type V;
+
+				const Size nbBlocks( nbPixels - nbPixels % Ops::nbLanes );
+				V dest[ 4 ];
+				V src[ 4 ];
+				for ( Size i( 0 ); i < nbBlocks; i += Ops::nbLanes ) {
+					Ops::load( colorDest + i, dest );
+					Ops::load( colorSrc + i, src );
+					if ( mask ) {
+						src[ 3 ] = Ops::mul( src[ 3 ], Ops::loadMask( mask + i * maskStride, maskStride ) );
+					}
+					_composite<Ops>( dest, dest[ 3 ], src, src[ 3 ], 3 );
+					Ops::store( colorDest + i, dest );
+				}
+				return nbBlocks;
+			}
+
+			template<typename F, typename I>
+			inline static F _toFloat( const I & v ) {
+				return F( v ) * ( F( 1 ) / F( Color<I>::getMax() ) );
+			}
+			template<typename I, typename F>
+			inline static void _fromFloat( const F & v, I & out ) {
+				typedef _OpsScalar<F> Ops;
+				out = I( Ops::add( Ops::mul( Ops::min( Ops::max( v, Ops::zero() ), Ops::one() ), F( Color<I>::getMax() ) ), F( 0.5 ) ) );
+			}
+			inline static void _fromFloat( const float & v, float & out ) {
+				out = v;
+			}
+			inline static void _fromFloat( const double & v, double & out ) {
+				out = v;
+			}
+
+			template<typename T, typename F>
+			inline static void _load( const ColorR<T> & color, F * components ) {
+				components[ 0 ] = _toFloat<F>( color.r );
+				components[ 1 ] = components[ 0 ];
+				components[ 2 ] = components[ 0 ];
+				components[ 3 ] = F( 1 );
+			}
+			template<typename T, typename F>
+			inline static void _load( const ColorRGB<T> & color, F * components ) {
+				components[ 0 ] = _toFloat<F>( color.r );
+				components[ 1 ] = _toFloat<F>( color.g );
+				components[ 2 ] = _toFloat<F>( color.b );
+				components[ 3 ] = F( 1 );
+			}
+			template<typename T, typename F>
+			inline static void _load( const ColorRGBA<T> & color, F * components ) {
+				components[ 0 ] = _toFloat<F>( color.r );
+				components[ 1 ] = _toFloat<F>( color.g );
+				components[ 2 ] = _toFloat<F>( color.b );
+				components[ 3 ] = _toFloat<F>( color.a );
+			}
+
+			template<typename T, typename F>
+			inline static void _store( ColorR<T> & color, const F * components ) {
+				_fromFloat( components[ 0 ], color.r );
+			}
+			template<typename T, typename F>
+			inline static void _store( ColorRGB<T> & color, const F * components ) {
+				_fromFloat( components[ 0 ], color.r );
+				_fromFloat( components[ 1 ], color.g );
+				_fromFloat( components[ 2 ], color.b );
+			}
+			template<typename T, typename F>
+			inline static void _store( ColorRGBA<T> & color, const F * components ) {
+				_fromFloat( components[ 0 ], color.r );
+				_fromFloat( components[ 1 ], color.g );
+				_fromFloat( components[ 2 ], color.b );
+				_fromFloat( components[ 3 ], color.a );
+			}
+
+			template<typename T>
+			inline static T _getLightness( const ColorR<T> & color ) {
+				return color.r;
+			}
+			template<typename T>
+			inline static T _getLightness( const ColorRGB<T> & color ) {
+				return color.getLightness();
+			}
+			template<typename T>
+			inline static T _getLightness( const ColorRGBA<T> & color ) {
+				return color.getLightness();
+			}
+		};
+
+		using Over = Composite<CompositeMode::Over>;
+		using In = Composite<CompositeMode::In>;
+		using Out = Composite<CompositeMode::Out>;
+		using Atop = Composite<CompositeMode::Atop>;
+		using Xor = Composite<CompositeMode::Xor>;
+		using Multiply = Composite<CompositeMode::Multiply>;
+		using Screen = Composite<CompositeMode::Screen>;
+		using Overlay = Composite<CompositeMode::Overlay>;
+		using Add = Composite<CompositeMode::Add>;
+		using Subtract = Composite<CompositeMode::Subtract>;
+		using Darken = Composite<CompositeMode::Darken>;
+		using Lighten = Composite<CompositeMode::Lighten>;
+		using Difference = Composite<CompositeMode::Difference>;
+
+		template<typename Mode, typename C1, typename C2>
+		inline void blendSpan( const Composite<Mode> & blendFunc, C1 * colorDest, const C2 * colorSrc, Size nbPixels ) {
+			Composite<Mode>::blendSpan( colorDest, colorSrc, nbPixels );
+		}
+		template<typename Mode, typename C1, typename C2, typename A>
+		inline void blendSpan( const Composite<Mode> & blendFunc, C1 * colorDest, const C2 * colorSrc, const A * mask, Size maskStride, Size nbPixels ) {
+			Composite<Mode>::blendSpan( colorDest, colorSrc, mask, maskStride, nbPixels );
+		}
+
 
 	}
 }
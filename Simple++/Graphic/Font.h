@@ -3,15 +3,18 @@
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include <mutex>
 
 #include "../String.h"
 #include "../Map.h"
 #include "../UTF8String.h"
 #include "../Log.h"
 #include "../IO/IO.h"
+#include "../Math/Hash.h"
 
 
 #include "FreeTypeChar.h"
+#include "GlyphAtlas.h"
 
 namespace Graphic {
 
@@ -25,6 +28,23 @@ namespace Graphic {
 			static const UTF8String Latin1;
 		};
 
+		///@brief Text laid out with this font, ready to be drawn glyph by glyph from the glyph atlas.
+		struct TextRun {
+			struct Glyph {
+				///@brief Position of the glyph, relative to the beginning of its line for x and to the baseline of the first line for y.
+				Math::Vec2<float> position;
+				///@brief Rectangle of the glyph inside the atlas image.
+				Rectangle rectangle;
+				///@brief Index of the line of the glyph.
+				Size line;
+			};
+
+			Vector<Glyph> glyphVector;
+			///@brief Width of each line.
+			Vector<float> lineWidthVector;
+			float maxLineWidth;
+		};
+
 
 		///@brief Empty constructor
 		///@param createImageFunctor Functor to be used to load the glyphs
@@ -87,6 +107,31 @@ namespace Graphic {
 		///@return Map of (Unicode codePoint => POINTERS to char )
 		const Map<UCodePoint, FreeTypeChar<T> *> & getCharMap() const;
 
+		///@brief Retrieve a glyph packed inside the glyph atlas in O(1) using its Unicode codePoint
+		///@param codePoint Unicode codePoint
+		///@return POINTER to the glyph (can be NULL if none has been founded)
+		const typename GlyphAtlasT<T>::Glyph * getGlyph( UCodePoint codePoint ) const;
+
+		///@brief Get the atlas where every loaded glyph is packed
+		///@return Glyph atlas
+		const GlyphAtlasT<T> & getGlyphAtlas() const;
+
+		///@brief Get a text laid out with this font from the cache of text runs, laying it out if not there yet.
+		///@param text Text to be laid out.
+		///@param wrapSize (Optional) If not zero, the lines are wrapped by words at this width and the text cut at this height.
+		///@return Text run to be given back with releaseTextRun().
+		const TextRun * acquireTextRun( const UTF8String & text, const Math::Vec2<int> & wrapSize = Math::Vec2<int>( 0 ) ) const;
+
+		///@brief Give back a text run borrowed with acquireTextRun().
+		///@param textRun Text run to give back.
+		void releaseTextRun( const TextRun * textRun ) const;
+
+		///@brief Delete every cached text run not borrowed (the borrowed ones won't be reused anymore).
+		void clearTextRunCache() const;
+
+		///@brief Maximum number of text runs kept by the cache (the least recently used unborrowed one being deleted first).
+		static constexpr Size maxTextRunCacheSize = Size( 64 );
+
 		///@brief load a glyph on this 
 		///@return const pointer of the character just created (NULL if nothing was loaded)
 		const FreeTypeChar<T> * loadGlyph( UCodePoint codePoint );
@@ -156,10 +201,37 @@ namespace Graphic {
 		void _unload();
 		void _copy( const FontT<T, LoadingFunc> & font );
 		void _move( FontT<T, LoadingFunc> && font );
+		void _addToAtlas( const FreeTypeChar<T> * c );
+		void _layoutTextRun( TextRun * textRun, const UTF8String & text, const Math::Vec2<int> & wrapSize ) const;
+
+		struct TextRunCacheEntry {
+			TextRun * textRun;
+			Math::Hash::Value hash;
+			UTF8String text;
+			Math::Vec2<int> wrapSize;
+			///@brief Number of acquireTextRun() not released yet.
+			Size nbReferences;
+			///@brief Value of the cache clock when last acquired.
+			Size lastUsed;
+			///@brief If the glyphs changed since laid out, the run is deleted when released.
+			bool isStale;
+		};
+
+		struct TextRunCache {
+			TextRunCache();
+			~TextRunCache();
+
+			std::mutex mutex;
+			Vector<TextRunCacheEntry> entryVector;
+			Size clock;
+		};
 
 		Map<UCodePoint, FreeTypeChar<T> *> charsMap;
 		FreeTypeChar<T> * asciiMap[256];
 
+		GlyphAtlasT<T> glyphAtlas;
+		mutable TextRunCache textRunCache;
+
 		FT_Library ftLib;
 		FT_Face ftFace;
 
@@ -116,6 +116,8 @@ namespace Graphic {
 			delete this -> charsMap.getValueIt(it);
 		
 		this -> charsMap.clear();
+		this -> glyphAtlas.clear();
+		clearTextRunCache();
 	}
 
 	template<typename T, typename LoadingFunc>
@@ -165,7 +167,7 @@ namespace Graphic {
 
 	template<typename T, typename LoadingFunc>
 	const FreeTypeChar<T> * FontT<T, LoadingFunc>::loadGlyph( UCodePoint codePoint ) {
-		FreeTypeChar<T> ** c = this -> charsMap.getValueI( codePoint );
+		FreeTypeChar<T> * c = ( *this )[codePoint];
 
 		if ( !c ) {
 			if ( this -> ftFace ) {
@@ -174,12 +176,15 @@ namespace Graphic {
 					this -> asciiMap[codePoint] = newChar;
 				else
 					this -> charsMap.insert( codePoint, newChar );
+				_addToAtlas( newChar );
+				// The text runs laid out before may have skipped this glyph.
+				clearTextRunCache();
 				return newChar;
 			} else {
 				return NULL;
 			}
 		} else {
-			return *c;
+			return c;
 		}
 	}
 
@@ -206,6 +211,185 @@ namespace Graphic {
 			else this -> charsMap.setValueIt( it, NULL );
 		}
 		this -> charsMap.eraseValueAll( NULL );
+
+		this -> glyphAtlas.clear();
+		for ( size_t i( 0 ); i < 256; i++ ) {
+			if ( this -> asciiMap[i] )
+				_addToAtlas( this -> asciiMap[i] );
+		}
+		for ( auto it = this -> charsMap.getBegin(); it != this -> charsMap.getEnd(); this -> charsMap.iterate( &it ) ) {
+			_addToAtlas( this -> charsMap.getValueIt( it ) );
+		}
+		clearTextRunCache();
+	}
+
+	template<typename T, typename LoadingFunc>
+	inline const typename GlyphAtlasT<T>::Glyph * FontT<T, LoadingFunc>::getGlyph( UCodePoint codePoint ) const {
+		return this -> glyphAtlas.getGlyph( codePoint );
+	}
+
+	template<typename T, typename LoadingFunc>
+	inline const GlyphAtlasT<T> & FontT<T, LoadingFunc>::getGlyphAtlas() const {
+		return this -> glyphAtlas;
+	}
+
+	template<typename T, typename LoadingFunc>
+	void FontT<T, LoadingFunc>::_addToAtlas( const FreeTypeChar<T> * c ) {
+		this -> glyphAtlas.addGlyph( c -> getCodePoint(), *c, c -> getHoriOffsetY(), c -> getHoriAdvance() );
+	}
+
+	template<typename T, typename LoadingFunc>
+	const typename FontT<T, LoadingFunc>::TextRun * FontT<T, LoadingFunc>::acquireTextRun( const UTF8String & text, const Math::Vec2<int> & wrapSize ) const {
+		const Math::Hash::Value hash( Math::Hash::hash( text ) );
+		{
+			std::unique_lock<std::mutex> lock( this -> textRunCache.mutex );
+			this -> textRunCache.clock++;
+			for ( Size i( 0 ); i < this -> textRunCache.entryVector.getSize(); i++ ) {
+				TextRunCacheEntry & entry( this -> textRunCache.entryVector[i] );
+				if ( entry.hash == hash && !entry.isStale && entry.wrapSize == wrapSize && entry.text == text ) {
+					entry.nbReferences++;
+					entry.lastUsed = this -> textRunCache.clock;
+					return entry.textRun;
+				}
+			}
+		}
+
+		// Laid out outside of the lock, the other texts don't have to wait for it.
+		TextRun * textRun( new TextRun() );
+		_layoutTextRun( textRun, text, wrapSize );
+
+		std::unique_lock<std::mutex> lock( this -> textRunCache.mutex );
+		// Make room by deleting the least recently used unborrowed text run.
+		while ( this -> textRunCache.entryVector.getSize() >= maxTextRunCacheSize ) {
+			Size oldestI( this -> textRunCache.entryVector.getSize() );
+			for ( Size i( 0 ); i < this -> textRunCache.entryVector.getSize(); i++ ) {
+				const TextRunCacheEntry & entry( this -> textRunCache.entryVector[i] );
+				if ( entry.nbReferences == Size( 0 ) && ( oldestI == this -> textRunCache.entryVector.getSize() || entry.lastUsed < this -> textRunCache.entryVector[oldestI].lastUsed ) ) {
+					oldestI = i;
+				}
+			}
+			if ( oldestI == this -> textRunCache.entryVector.getSize() ) break;
+			delete this -> textRunCache.entryVector[oldestI].textRun;
+			this -> textRunCache.entryVector[oldestI] = this -> textRunCache.entryVector.getLast();
+			this -> textRunCache.entryVector.resize( this -> textRunCache.entryVector.getSize() - Size( 1 ) );
+		}
+
+		// Another thread may have laid out the same text meanwhile, the newest one is simply added too.
+		TextRunCacheEntry entry;
+		entry.textRun = textRun;
+		entry.hash = hash;
+		entry.text = text;
+		entry.wrapSize = wrapSize;
+		entry.nbReferences = Size( 1 );
+		entry.lastUsed = this -> textRunCache.clock;
+		entry.isStale = false;
+		this -> textRunCache.entryVector.push( entry );
+		return textRun;
+	}
+
+	template<typename T, typename LoadingFunc>
+	void FontT<T, LoadingFunc>::releaseTextRun( const TextRun * textRun ) const {
+		std::unique_lock<std::mutex> lock( this -> textRunCache.mutex );
+		for ( Size i( 0 ); i < this -> textRunCache.entryVector.getSize(); i++ ) {
+			TextRunCacheEntry & entry( this -> textRunCache.entryVector[i] );
+			if ( entry.textRun == textRun ) {
+				entry.nbReferences--;
+				if ( entry.isStale && entry.nbReferences == Size( 0 ) ) {
+					delete entry.textRun;
+					entry = this -> textRunCache.entryVector.getLast();
+					this -> textRunCache.entryVector.resize( this -> textRunCache.entryVector.getSize() - Size( 1 ) );
+				}
+				return;
+			}
+		}
+	}
+
+	template<typename T, typename LoadingFunc>
+	void FontT<T, LoadingFunc>::clearTextRunCache() const {
+		std::unique_lock<std::mutex> lock( this -> textRunCache.mutex );
+		Size nbKept( 0 );
+		for ( Size i( 0 ); i < this -> textRunCache.entryVector.getSize(); i++ ) {
+			TextRunCacheEntry & entry( this -> textRunCache.entryVector[i] );
+			if ( entry.nbReferences == Size( 0 ) ) {
+				delete entry.textRun;
+			} else {
+				entry.isStale = true;
+				this -> textRunCache.entryVector[nbKept++] = entry;
+			}
+		}
+		this -> textRunCache.entryVector.resize( nbKept );
+	}
+
+	template<typename T, typename LoadingFunc>
+	void FontT<T, LoadingFunc>::_layoutTextRun( TextRun * textRun, const UTF8String & text, const Math::Vec2<int> & wrapSize ) const {
+		const Size maxNbLines( ( wrapSize.y > 0 ) ? Math::max( Size( float( wrapSize.y ) / getLineHeight() ), Size( 1 ) ) : Size( -1 ) );
+		UCodePoint codePoint;
+		float currentPosX( 0.0f );
+		// Beginning of the current word, moved on the next line if it overflows the wrapping width.
+		Size wordBeginI( 0 );
+		float wordBeginX( 0.0f );
+		Size line( 0 );
+
+		textRun -> maxLineWidth = 0.0f;
+		for ( auto it = text.getBegin(); text.iterate( &it, &codePoint ); ) {
+			if ( codePoint == UCodePoint( '\n' ) ) {
+				if ( line + Size( 1 ) >= maxNbLines ) break;
+				textRun -> lineWidthVector.push( currentPosX );
+				line++;
+				currentPosX = 0.0f;
+				wordBeginI = textRun -> glyphVector.getSize();
+				wordBeginX = 0.0f;
+			} else if ( codePoint == UCodePoint( ' ' ) ) {
+				currentPosX += getWordSpace();
+				wordBeginI = textRun -> glyphVector.getSize();
+				wordBeginX = currentPosX;
+			} else {
+				const typename GlyphAtlasT<T>::Glyph * glyph( getGlyph( codePoint ) );
+				if ( !glyph ) continue;
+
+				if ( wrapSize.x > 0 && currentPosX + glyph -> horiAdvance > float( wrapSize.x ) && wordBeginX > 0.0f ) {
+					// The word doesn't fit, the space before it becomes a new line.
+					if ( line + Size( 1 ) >= maxNbLines ) {
+						textRun -> glyphVector.resize( wordBeginI );
+						currentPosX = wordBeginX;
+						break;
+					}
+					textRun -> lineWidthVector.push( wordBeginX - getWordSpace() );
+					line++;
+					for ( Size i( wordBeginI ); i < textRun -> glyphVector.getSize(); i++ ) {
+						typename TextRun::Glyph & glyphMoved( textRun -> glyphVector[i] );
+						glyphMoved.position.x -= wordBeginX;
+						glyphMoved.position.y -= getLineHeight();
+						glyphMoved.line = line;
+					}
+					currentPosX -= wordBeginX;
+					wordBeginX = 0.0f;
+				}
+
+				typename TextRun::Glyph runGlyph;
+				runGlyph.position.x = currentPosX;
+				runGlyph.position.y = glyph -> horiOffsetY - float( line ) * getLineHeight();
+				runGlyph.rectangle = glyph -> rectangle;
+				runGlyph.line = line;
+				textRun -> glyphVector.push( runGlyph );
+				currentPosX += glyph -> horiAdvance;
+			}
+		}
+		textRun -> lineWidthVector.push( currentPosX );
+
+		for ( Size i( 0 ); i < textRun -> lineWidthVector.getSize(); i++ )
+			textRun -> maxLineWidth = Math::max( textRun -> maxLineWidth, textRun -> lineWidthVector[i] );
+	}
+
+	template<typename T, typename LoadingFunc>
+	FontT<T, LoadingFunc>::TextRunCache::TextRunCache() :
+		clock( 0 ) { }
+
+	template<typename T, typename LoadingFunc>
+	FontT<T, LoadingFunc>::TextRunCache::~TextRunCache() {
+		for ( Size i( 0 ); i < this -> entryVector.getSize(); i++ ) {
+			delete this -> entryVector[i].textRun;
+		}
 	}
 
 	template<typename T, typename LoadingFunc>
@@ -330,6 +514,7 @@ namespace Graphic {
 					this -> asciiMap[newChar -> getCodePoint()] = newChar;
 				else
 					this -> charsMap.insert( newChar -> getCodePoint(), newChar );
+				_addToAtlas( newChar );
 			} else {
 				delete newChar;
 				return false;
@@ -444,6 +629,7 @@ namespace Graphic {
 		this -> memoryFontObject = Utility::toRValue( font.memoryFontObject );
 		this -> memorySize = Utility::toRValue( font.memorySize );
 		this -> loadingFunctor = Utility::toRValue( font.loadingFunctor );
+		this -> glyphAtlas = Utility::toRValue( font.glyphAtlas );
 	}
 
 	template<typename T, typename LoadingFunc>
@@ -452,6 +638,7 @@ namespace Graphic {
 		this -> lineHeight = font.lineHeight;
 		this -> wordSpace = font.wordSpace;
 		this -> loadingFunctor = font.loadingFunctor;
+		this -> glyphAtlas = font.glyphAtlas;
 		
 		if ( font.memoryFontObject ) {
 			this -> memoryFontObject = new char[font.memorySize];
@@ -0,0 +1,98 @@
+///@file GlyphAtlas.h
+///@brief Declares an atlas packing the glyphs of a font inside a single image.
+#pragma once
+
+#include "../Vector.h"
+#include "../UTF8String.h"
+#include "BasicGraphic.h"
+#include "Image.h"
+
+namespace Graphic {
+
+	///@brief Single image where the glyphs of a font are packed (skyline bottom-left packing), a glyph being found in O(1) from its code point.
+	///			The atlas grows by doubling its height when full, the glyphs already packed keeping their rectangle.
+	///@template T Type of the components of the image.
+	template<typename T = unsigned char>
+	class GlyphAtlasT {
+	public:
+		///@brief Glyph packed inside the atlas.
+		struct Glyph {
+			///@brief Rectangle of the glyph inside the atlas image (empty for the glyphs without any pixel).
+			Rectangle rectangle;
+			///@brief Y coordinate of the Horizontal offset.
+			float horiOffsetY;
+			///@brief Advance of the glyph when used horizontally.
+			float horiAdvance;
+		};
+
+		///@brief Create an empty atlas.
+		///@param width Width of the atlas image, its height growing with the glyphs.
+		GlyphAtlasT( GSize width = GSize( 512 ) );
+
+		///@brief Pack a glyph, replacing the previous one with the same code point (its pixels are not reclaimed).
+		///@param codePoint Unicode code point of the glyph.
+		///@param image Pixels of the glyph, every glyph of an atlas should have the same format.
+		///@param horiOffsetY Y coordinate of the Horizontal offset.
+		///@param horiAdvance Advance of the glyph when used horizontally.
+		///@return Pointer to the packed glyph, valid until the next addGlyph() or clear().
+		const Glyph * addGlyph( UCodePoint codePoint, const ImageT<T> & image, float horiOffsetY, float horiAdvance );
+
+		///@brief Get a glyph from its code point.
+		///@param codePoint Unicode code point.
+		///@return Pointer to the glyph (NULL if not packed).
+		const Glyph * getGlyph( UCodePoint codePoint ) const;
+
+		///@brief Get the image where the glyphs are packed.
+		///@return Atlas image.
+		const ImageT<T> & getImage() const;
+
+		///@brief Get the number of glyphs packed.
+		///@return Number of glyphs.
+		Size getNbGlyphs() const;
+
+		///@brief Remove every glyph.
+		void clear();
+
+		///@brief Number of code points by page of the lookup table.
+		static constexpr Size pageSize = Size( 256 );
+
+	private:
+		///@brief Top of the packed glyphs over a range of columns.
+		struct SkylineNode {
+			GSize x;
+			GSize y;
+			GSize width;
+		};
+
+		///@brief Find the lowest position where a rectangle can be packed.
+		///@param size Size of the rectangle.
+		///@param position [out] Position found.
+		///@return Index of the skyline node where the rectangle begins (skylineVector.getSize() if none).
+		Size _findPosition( const Math::Vec2<GSize> & size, Math::Vec2<GSize> * position ) const;
+
+		///@brief Update the skyline with a rectangle packed at the beginning of a node.
+		void _addSkyline( Size nodeI, const Math::Vec2<GSize> & position, const Math::Vec2<GSize> & size );
+
+		///@brief Double the height of the atlas image, keeping its pixels.
+		void _grow();
+
+		///@brief Set the index of a code point in the lookup table.
+		void _setIndex( UCodePoint codePoint, Size glyphI );
+
+		///@brief Space let between two glyphs (the filters on the atlas image must not bleed from one to another).
+		static constexpr GSize padding = GSize( 1 );
+
+		ImageT<T> image;
+		GSize width;
+		Vector<SkylineNode> skylineVector;
+		Vector<Glyph> glyphVector;
+
+		///@brief For each page of code points, index + 1 of its range in indexVector (0 if none of its glyph were packed).
+		Vector<Size> pageVector;
+		///@brief Ranges of pageSize indexes + 1 in glyphVector (0 if not packed).
+		Vector<Size> indexVector;
+	};
+
+}
+
+#include "GlyphAtlas.hpp"
@@ -0,0 +1,177 @@
+namespace Graphic {
+
+	template<typename T>
+	GlyphAtlasT<T>::GlyphAtlasT( GSize width ) :
+		image( Format::R ),
+		width( width ) {
+		SkylineNode node;
+		node.x = GSize( 0 );
+		node.y = GSize( 0 );
+		node.width = width;
+		this -> skylineVector.push( node );
+	}
+
+	template<typename T>
+	const typename GlyphAtlasT<T>::Glyph * GlyphAtlasT<T>::addGlyph( UCodePoint codePoint, const ImageT<T> & image, float horiOffsetY, float horiAdvance ) {
+		Glyph glyph;
+		glyph.horiOffsetY = horiOffsetY;
+		glyph.horiAdvance = horiAdvance;
+
+		const Math::Vec2<GSize> & size( image.getSize() );
+		if ( size.x > GSize( 0 ) && size.y > GSize( 0 ) ) {
+			const Math::Vec2<GSize> sizePadded( Math::min( size.x + padding, this -> width ), size.y + padding );
+
+			// The format of the atlas is the one of the first glyph with pixels.
+			if ( this -> image.getSize().y == GSize( 0 ) ) {
+				this -> image.clear( Math::Vec2<GSize>( this -> width, Math::max( GSize( 64 ), sizePadded.y ) ), image.getFormat() );
+				T * dataIt( this -> image.getDatas() );
+				const Size nbData( Size( this -> image.getSize().x ) * Size( this -> image.getSize().y ) * Size( this -> image.getNbComponents() ) );
+				for ( Size i( 0 ); i < nbData; i++ )
+					dataIt[ i ] = T( 0 );
+			}
+
+			Math::Vec2<GSize> position;
+			Size nodeI( _findPosition( sizePadded, &position ) );
+			while ( position.y + sizePadded.y > this -> image.getSize().y ) {
+				_grow();
+			}
+			_addSkyline( nodeI, position, sizePadded );
+
+			glyph.rectangle = Rectangle( position.x, position.y, position.x + Math::min( size.x, this -> width ), position.y + size.y );
+			this -> image.drawImage( Point( position.x, position.y ), image, Rectangle( size ), BlendingFunc::None() );
+		} else {
+			glyph.rectangle = Rectangle( 0, 0, 0, 0 );
+		}
+
+		const Glyph * glyphFound( getGlyph( codePoint ) );
+		if ( glyphFound ) {
+			this -> glyphVector[ Size( glyphFound - this -> glyphVector.getData() ) ] = glyph;
+			return glyphFound;
+		}
+		this -> glyphVector.push( glyph );
+		_setIndex( codePoint, this -> glyphVector.getSize() );
+		return &this -> glyphVector.getLast();
+	}
+
+	template<typename T>
+	inline const typename GlyphAtlasT<T>::Glyph * GlyphAtlasT<T>::getGlyph( UCodePoint codePoint ) const {
+		const Size pageI( Size( codePoint ) / pageSize );
+		if ( pageI >= this -> pageVector.getSize() ) return NULL;
+		const Size pageIndex( this -> pageVector[ pageI ] );
+		if ( pageIndex == Size( 0 ) ) return NULL;
+		const Size glyphIndex( this -> indexVector[ ( pageIndex - Size( 1 ) ) * pageSize + Size( codePoint ) % pageSize ] );
+		if ( glyphIndex == Size( 0 ) ) return NULL;
+		return this -> glyphVector.getData() + ( glyphIndex - Size( 1 ) );
+	}
+
+	template<typename T>
+	inline const ImageT<T> & GlyphAtlasT<T>::getImage() const {
+		return this -> image;
+	}
+
+	template<typename T>
+	inline Size GlyphAtlasT<T>::getNbGlyphs() const {
+		return this -> glyphVector.getSize();
+	}
+
+	template<typename T>
+	void GlyphAtlasT<T>::clear() {
+		this -> image.clear( Math::Vec2<GSize>( 0 ), Format::R );
+		this -> skylineVector.resize( 1 );
+		this -> skylineVector[ 0 ].x = GSize( 0 );
+		this -> skylineVector[ 0 ].y = GSize( 0 );
+		this -> skylineVector[ 0 ].width = this -> width;
+		this -> glyphVector.clear();
+		this -> pageVector.clear();
+		this -> indexVector.clear();
+	}
+
+	template<typename T>
+	Size GlyphAtlasT<T>::_findPosition( const Math::Vec2<GSize> & size, Math::Vec2<GSize> * position ) const {
+		Size bestI( this -> skylineVector.getSize() );
+		GSize bestTop( 0 );
+		GSize bestWidth( 0 );
+		for ( Size i( 0 ); i < this -> skylineVector.getSize(); i++ ) {
+			const SkylineNode & node( this -> skylineVector[ i ] );
+			if ( node.x + size.x > this -> width ) break;
+
+			// The rectangle lies on the highest of the nodes under it.
+			GSize y( node.y );
+			GSize widthLeft( size.x );
+			for ( Size j( i ); widthLeft > GSize( 0 ); j++ ) {
+				y = Math::max( y, this -> skylineVector[ j ].y );
+				widthLeft -= Math::min( widthLeft, this -> skylineVector[ j ].width );
+			}
+
+			if ( bestI == this -> skylineVector.getSize() || y + size.y < bestTop || ( y + size.y == bestTop && node.width < bestWidth ) ) {
+				bestI = i;
+				bestTop = y + size.y;
+				bestWidth = node.width;
+				position -> x = node.x;
+				position -> y = y;
+			}
+		}
+		return bestI;
+	}
+
+	template<typename T>
+	void GlyphAtlasT<T>::_addSkyline( Size nodeI, const Math::Vec2<GSize> & position, const Math::Vec2<GSize> & size ) {
+		SkylineNode newNode;
+		newNode.x = position.x;
+		newNode.y = position.y + size.y;
+		newNode.width = size.x;
+		this -> skylineVector.inserti( nodeI, newNode );
+
+		// Shrink or remove the nodes now under the new one.
+		const GSize right( newNode.x + newNode.width );
+		for ( Size i( nodeI + Size( 1 ) ); i < this -> skylineVector.getSize(); ) {
+			SkylineNode & node( this -> skylineVector[ i ] );
+			if ( node.x >= right ) break;
+			const GSize shrink( right - node.x );
+			if ( shrink >= node.width ) {
+				this -> skylineVector.eraseI( i );
+			} else {
+				node.x += shrink;
+				node.width -= shrink;
+				break;
+			}
+		}
+
+		// Merge the neighbours at the same height.
+		for ( Size i( 0 ); i + Size( 1 ) < this -> skylineVector.getSize(); ) {
+			if ( this -> skylineVector[ i ].y == this -> skylineVector[ i + Size( 1 ) ].y ) {
+				this -> skylineVector[ i ].width += this -> skylineVector[ i + Size( 1 ) ].width;
+				this -> skylineVector.eraseI( i + Size( 1 ) );
+			} else {
+				i++;
+			}
+		}
+	}
+
+	template<typename T>
+	void GlyphAtlasT<T>::_grow() {
+		const Math::Vec2<GSize> oldSize( this -> image.getSize() );
+		ImageT<T> newImage( Math::Vec2<GSize>( oldSize.x, oldSize.y * GSize( 2 ) ), this -> image.getFormat() );
+		T * dataIt( newImage.getDatas() );
+		const Size nbData( Size( newImage.getSize().x ) * Size( newImage.getSize().y ) * Size( newImage.getNbComponents() ) );
+		// The rows are contiguous, the old pixels are at the beginning and keep their coordinates.
+		const Size nbDataOld( Size( oldSize.x ) * Size( oldSize.y ) * Size( this -> image.getNbComponents() ) );
+		Vector<T>::copy( dataIt, this -> image.getDatas(), nbDataOld );
+		for ( Size i( nbDataOld ); i < nbData; i++ )
+			dataIt[ i ] = T( 0 );
+		this -> image = Utility::toRValue( newImage );
+	}
+
+	template<typename T>
+	void GlyphAtlasT<T>::_setIndex( UCodePoint codePoint, Size glyphIndex ) {
+		const Size pageI( Size( codePoint ) / pageSize );
+		if ( pageI >= this -> pageVector.getSize() )
+			this -> pageVector.resize( pageI + Size( 1 ), Size( 0 ) );
+		if ( this -> pageVector[ pageI ] == Size( 0 ) ) {
+			this -> indexVector.resize( this -> indexVector.getSize() + pageSize, Size( 0 ) );
+			this -> pageVector[ pageI ] = this -> indexVector.getSize() / pageSize;
+		}
+		this -> indexVector[ ( this -> pageVector[ pageI ] - Size( 1 ) ) * pageSize + Size( codePoint ) % pageSize ] = glyphIndex;
+	}
+
+}
@@ -14,7 +14,10 @@
 #include "../String.h"
 #include "../Utility.h"
 #include "../IO/BasicIO.h"
+#include "../ThreadPool.h"
 #include "Gradient.h"
+#include "ResamplingWeights.h"
+#include "Rasterizer.h"
 #include "BlendingFunc.hpp"
 #include "ColorFunc.h"
 #include "KernelFunc.hpp"
@@ -31,6 +34,20 @@
 namespace Graphic {
 
 
+	/**
+	 * @brief	Set the thread pool shared by every ImageT to split the filters and the resampling into bands of rows.
+	 * 			Each band computes it's rows exactly as the calling thread would, the result is bit-identical with or without it.
+	 *
+	 * @param [in]	threadPool	Thread pool to be used (has to outlive its use), NULL to run on the calling thread (default).
+	 */
+	inline void setThreadPool( ThreadPool * threadPool );
+
+	/**
+	 * @brief	Get the thread pool shared by every ImageT.
+	 *
+	 * @returns	Thread pool used, NULL if the images are processed on the calling thread.
+	 */
+	inline ThreadPool * getThreadPool();
 
 
 
@@ -45,7 +62,7 @@ namespace Graphic {
 		/** @brief	Values that represent resampling modes */
 		/** @brief	Values that represent resampling modes */
 		enum class ResamplingMode {
-			Nearest, Bilinear, Lanczos
+			Nearest, Bilinear, Lanczos, Bicubic, Area
 		};
 		/** @brief	Values that represent convolution modes */
 		enum class ConvolutionMode {
@@ -55,6 +72,12 @@ namespace Graphic {
 		enum class ConvolutionOrder {
 			HorizontalVertical, VerticalHorizontal
 		};
+		/** @brief	Values that represent the algorithms of the Gaussian blur */
+		enum class BlurMode {
+			Kernel,	///< Exact separable convolution with the Gaussian kernel, O(radius) per pixel.
+			Box,	///< Three successive box filters computed with running sums, O(1) per pixel whatever the radius.
+			Auto	///< Kernel for the small radii, Box from the radius 10.
+		};
 		/** @brief	Values that represent stroke types */
 		enum class StrokeType {
 			Outside, Inside, Middle
@@ -1190,9 +1213,10 @@ namespace Graphic {
 		 * @param	blendFunc	(Optional) Functor with operator() overloaded with "template<typename T> void operator()(Graphic::ColorR<T> & colorDest, const ColorR<T> & colorSrc,
 		 * 						const T & alpha)const;" "template<typename T> void operator()(Graphic::ColorRGB<T> & colorDest, const ColorR<T> & colorSrc, const T & alpha)const;"
 		 * 						"template<typename T> void operator()(Graphic::ColorRGBA<T> & colorDest, const ColorR<T> & colorSrc, const T & alpha)const;".
+		 * @param	blurMode 	(Optional) Algorithm of the blur (BlurMode::Box for the large thickness).
 		 */
 		template<typename BlendFunc = BlendingFunc::Normal>
-		void drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorR<T> & color, const BlendFunc & blendFunc = BlendFunc() );
+		void drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorR<T> & color, const BlendFunc & blendFunc = BlendFunc(), BlurMode blurMode = BlurMode::Kernel );
 
 		/**
 		 * @brief	Draw the shadow of an image into this one
@@ -1206,9 +1230,10 @@ namespace Graphic {
 		 * 						colorSrc, const T & alpha)const;
 		 * 						" "template<typename T> void operator()(Graphic::ColorRGB<T> & colorDest, const ColorRGB<T> & colorSrc, const T & alpha)const;"
 		 * 						"template<typename T> void operator()(Graphic::ColorRGBA<T> & colorDest, const ColorRGB<T> & colorSrc, const T & alpha)const;".
+		 * @param	blurMode 	(Optional) Algorithm of the blur (BlurMode::Box for the large thickness).
 		 */
 		template<typename BlendFunc = BlendingFunc::Normal>
-		void drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGB<T> & color, const BlendFunc & blendFunc = BlendFunc() );
+		void drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGB<T> & color, const BlendFunc & blendFunc = BlendFunc(), BlurMode blurMode = BlurMode::Kernel );
 
 		/**
 		 * @brief	Draw the shadow of an image into this one
@@ -1222,9 +1247,10 @@ namespace Graphic {
 		 * 						colorSrc, const T & alpha)const;
 		 * 						" "template<typename T> void operator()(Graphic::ColorRGB<T> & colorDest, const ColorRGBA<T> & colorSrc, const T & alpha)const;"
 		 * 						"template<typename T> void operator()(Graphic::ColorRGBA<T> & colorDest, const ColorRGBA<T> & colorSrc, const T & alpha)const;".
+		 * @param	blurMode 	(Optional) Algorithm of the blur (BlurMode::Box for the large thickness).
 		 */
 		template<typename BlendFunc = BlendingFunc::Normal>
-		void drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGBA<T> & color, const BlendFunc & blendFunc = BlendFunc() );
+		void drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGBA<T> & color, const BlendFunc & blendFunc = BlendFunc(), BlurMode blurMode = BlurMode::Kernel );
 
 
 		/**
@@ -1240,9 +1266,10 @@ namespace Graphic {
 		 * @param 		  	blendFunc	(Optional) Functor with operator() overloaded with "template<typename T> void operator()(Graphic::ColorR<T> & colorDest, const C & colorSrc,
 		 * 								const T & alpha)const;" "template<typename T> void operator()(Graphic::ColorRGB<T> & colorDest, const C & colorSrc, const T & alpha)const;"
 		 * 								"template<typename T> void operator()(Graphic::ColorRGBA<T> & colorDest, const C & colorSrc, const T & alpha)const;".
+		 * @param 		  	blurMode 	(Optional) Algorithm of the blur (BlurMode::Box for the large thickness).
 		 */
 		template<typename ColorFunc, typename BlendFunc = BlendingFunc::Normal>
-		void drawImageShadowFunctor( const Point & point, unsigned int thickness, const ImageT<T> & image, ColorFunc & colorFunc, const BlendFunc & blendFunc = BlendFunc() );
+		void drawImageShadowFunctor( const Point & point, unsigned int thickness, const ImageT<T> & image, ColorFunc & colorFunc, const BlendFunc & blendFunc = BlendFunc(), BlurMode blurMode = BlurMode::Kernel );
 
 
 		/**
@@ -1379,10 +1406,14 @@ namespace Graphic {
 		 * @param	radius		   	Radius of the blur.
 		 * @param	convolutionMode	(Optional) Mode of the convolution (if the convolution will create a bigger image or crop it to keep the original size.)
 		 * @param	color		   	(Optional) Color of the background.
+		 * @param	blurMode	   	(Optional) Algorithm of the blur. The Box mode approximates the Gaussian (sigma = (2 * radius + 1) / 4) by three box filters,
+		 * 							each pixel costing the same whatever the radius (about 10x faster than the kernel for a radius of 50). The result is smoother than
+		 * 							the kernel (which is truncated at 2 sigma) and differs from it by at most 2.5% of the maximum value on a sharp edge for a radius
+		 * 							of 10 or more (4% for the smallest radii).
 		 *
 		 * @returns	Image with the filter applied.
 		 */
-		ImageT<T> applyGaussianBlur( GSize radius, ConvolutionMode convolutionMode = ConvolutionMode::ExtendedSize, const ColorRGBA<T> & color = ColorRGBA<T>::black ) const;
+		ImageT<T> applyGaussianBlur( GSize radius, ConvolutionMode convolutionMode = ConvolutionMode::ExtendedSize, const ColorRGBA<T> & color = ColorRGBA<T>::black, BlurMode blurMode = BlurMode::Kernel ) const;
 
 		/**
 		 * @brief	apply a Sobel filter and return the resulting image (note the final pixels components will be "min(sqrt(x*x + y*y) / 2, MAX)" where x is the sobel filter
@@ -1487,8 +1518,9 @@ namespace Graphic {
 		 *
 		 * @param	newSize		  	size of the resulting image.
 		 * @param	resamplingMode	(Optional) Mode used to compute the resulting pixels Nearest : Faster algorithm available, use the nearest pixel without any transformation.
-		 * 							Linear : Do a linear interpolation to compute the resulting pixels. Lanczos : Use the Lanczos algorithm with a constant of 3 (Note : only
-		 * 							available for strict reduction, linear will be used instead)
+		 * 							Linear : Do a linear interpolation to compute the resulting pixels. Lanczos : Use the Lanczos algorithm with a constant of 3.
+		 * 							Bicubic : Use the Keys cubic convolution (a = -0.5). Area : Mean of the pixels covered by each resulting one, the best for the large reductions.
+		 * 							Lanczos, Bicubic and Area are computed horizontally then vertically with weights precomputed for the sizes and cached (see ResamplingWeightsT).
 		 *
 		 * @returns	An ImageT<T>
 		 *
@@ -1519,6 +1551,24 @@ namespace Graphic {
 		template<typename ColorFunc, typename BlendFunc = BlendingFunc::Normal>
 		void drawPolygonFunctor( const Math::Vec2<float> * vertices, Size nbVertices, const Rectangle & rectangle, ColorFunc & colorFunc, BlendFunc & blendFunc = BlendFunc() );
 
+		/**
+		 * @brief	Draw every polygon added to a rasterizer in a single pass (a whole chart, the stroke of a curve...).
+		 * 			Each pixel is blended once with it's exact covered area as opacity, the fully covered spans being blended without any.
+		 *
+		 * @tparam	ColorFunc	Type of the color function.
+		 * @tparam	BlendFunc	Type of the blend function.
+		 * @param 		  	rasterizer	Rasterizer with the polygons to be drawn, in pixels coordinates of this image.
+		 * @param 		  	rectangle 	Rectangle of the image where to draw (the polygons are clipped to it and the color functor is relative to it).
+		 * @param [in,out]	colorFunc 	Color Functor to be used (@see Graphic::ColorFunc::Template for making your own)
+		 * @param 		  	fillRule  	(Optional) Rule deciding the inside of the overlapping or self intersecting polygons. With NonZero, the pixels crossed
+		 * 								by the edges of several overlapping polygons may be a bit more opaque than their exact union.
+		 * @param 		  	blendFunc 	(Optional) Blending Functor to be used, called by spans (@see Graphic::BlendingFunc::blendSpan()).
+		 *
+		 * @sa	Graphic::RasterizerT
+		 */
+		template<typename ColorFunc, typename BlendFunc = BlendingFunc::Normal>
+		void drawRasterizerFunctor( const Rasterizer & rasterizer, const Rectangle & rectangle, ColorFunc & colorFunc, FillRule fillRule = FillRule::NonZero, const BlendFunc & blendFunc = BlendFunc() );
+
 
 
 		/**
@@ -1809,19 +1859,19 @@ namespace Graphic {
 		void _drawDiskFunctor( const Point & p, float radius, ColorFunc & colorFunc, BlendFunc & blendFunc = BlendFunc() );
 
 		/**
-		 * @brief	Draw polygon functor
+		 * @brief	Draw the polygons of a rasterizer
 		 *
 		 * @tparam	ColorFunc	Type of the color function.
 		 * @tparam	BlendFunc	Type of the blend function.
-		 * @tparam	C1		 	Type of the c 1.
-		 * @param 		  	vertices  	The vertices.
-		 * @param 		  	nbVertices	The nb vertices.
+		 * @tparam	C1		 	Type of one pixel.
+		 * @param 		  	rasterizer	The rasterizer.
 		 * @param 		  	rectangle 	The rectangle.
 		 * @param [in,out]	colorFunc 	The color function.
-		 * @param [in,out]	blendFunc 	(Optional) The blend function.
+		 * @param 		  	fillRule  	The fill rule.
+		 * @param 		  	blendFunc 	The blend function.
 		 */
 		template<typename ColorFunc, typename BlendFunc, typename C1>
-		void _drawPolygonFunctor( const Math::Vec2<float> * vertices, Size nbVertices, const Rectangle & rectangle, ColorFunc & colorFunc, BlendFunc & blendFunc = BlendFunc() );
+		void _drawRasterizerFunctor( const Rasterizer & rasterizer, const Rectangle & rectangle, ColorFunc & colorFunc, FillRule fillRule, const BlendFunc & blendFunc );
 
 		/**
 		 * @brief	Resamples
@@ -1838,6 +1888,81 @@ namespace Graphic {
 		template<typename C1, typename Sum, typename SumF, typename K >
 		ImageT<T> _resample( const Math::Vec2<GSize> & newSize, ResamplingMode resamplingMode = ResamplingMode::Nearest ) const;
 
+		/**
+		 * @brief	Resample with a separable filter, horizontally then vertically, using the weights cached for the sizes.
+		 *
+		 * @tparam	C	Type of one pixel.
+		 * @param	newSize	Size of the new image.
+		 * @param	filter 	Filter to be used.
+		 *
+		 * @returns	Image resampled.
+		 */
+		template<typename C>
+		ImageT<T> _resampleWeighted( const Math::Vec2<GSize> & newSize, typename ResamplingWeightsT<Float>::Filter filter ) const;
+
+		/**
+		 * @brief	Add a row multiplied by a weight to a row of sums (sumIt[ i ] += rowIt[ i ] * weight), vectorized for float.
+		 *
+		 * @param [in,out]	sumIt   	Row of sums.
+		 * @param 		  	rowIt   	Row to be added.
+		 * @param 		  	weight  	Weight of the row.
+		 * @param 		  	nbValues	Number of values of the rows.
+		 */
+		template<typename F>
+		static void _accumulateRow( F * sumIt, const F * rowIt, const F & weight, Size nbValues );
+		static void _accumulateRow( float * sumIt, const float * rowIt, const float & weight, Size nbValues );
+
+		/**
+		 * @brief	Call a functor on bands of rows, split across the threads of the image thread pool (if any and if the work is big enough).
+		 *
+		 * @tparam	Func	Functor with operator() overloaded with : void operator()( const Math::Interval<Size> & rowInterval );
+		 * @param 		  	nbRows	Number of rows.
+		 * @param [in,out]	func  	The functor.
+		 * @param 		  	work  	Approximated number of operations, the small images stay on the calling thread.
+		 *
+		 * @sa	Graphic::setThreadPool()
+		 */
+		template<typename Func>
+		static void _runRows( GSize nbRows, Func & func, Size work );
+
+		/**
+		 * @brief	Approximate a Gaussian blur with three box filters (horizontally then vertically), using running sums.
+		 * 			The borders and the size of the result are the same as the separable convolution with a kernel of size radius * 2 + 1.
+		 *
+		 * @tparam	C	Type of one pixel, only used to convert the background color.
+		 * @param 	radius		   	Radius of the blur.
+		 * @param 	convolutionMode	Mode of the convolution.
+		 * @param 	color		   	Color of the background.
+		 *
+		 * @returns	Image with the blur applied.
+		 */
+		template<typename C>
+		ImageT<T> _applyBoxBlur( GSize radius, ConvolutionMode convolutionMode, const ColorRGBA<T> & color ) const;
+
+		/**
+		 * @brief	Compute the radii of the three box filters approximating a Gaussian blur (sigma = (2 * radius + 1) / 4).
+		 *
+		 * @param 		  	radius	  	Radius of the Gaussian blur.
+		 * @param [out]	boxRadius	Radii of the box filters.
+		 */
+		static void _computeBoxBlurRadius( GSize radius, GSize( &boxRadius )[ 3 ] );
+
+		/**
+		 * @brief	Apply a box filter on interleaved lines, the values outside of the lines being the background ones.
+		 *
+		 * @tparam	F	Type of the values.
+		 * @param 		  	inIt	  	First value of the input lines.
+		 * @param [out]	outIt	  	First value of the output lines (has to be different of the input).
+		 * @param 		  	nbLines   	Number of lines, stored one after the other (the components of a row or the columns of a band).
+		 * @param 		  	stride	  	Number of values between two elements of a line.
+		 * @param 		  	length	  	Number of elements of each line.
+		 * @param 		  	radius	  	Radius of the box.
+		 * @param 		  	background	Background value of each line.
+		 * @param [in,out]	sums	  	Buffer of nbLines running sums.
+		 */
+		template<typename F>
+		static void _applyBoxFilterLines( const F * inIt, F * outIt, Size nbLines, Size stride, GSize length, GSize radius, const F * background, double * sums );
+
 		/**
 		 * @brief	Draw rectangle rounded functor
 		 *
@@ -1852,20 +1977,6 @@ namespace Graphic {
 		template<typename ColorFunc, typename BlendFunc, typename C1>
 		void _drawRectangleRoundedFunctor( const Rectangle & rectangle, unsigned int radius, ColorFunc & colorFunc, BlendFunc & blendFunc = BlendFunc() );
 
-		/**
-		 * @brief	Draw line functor filled bottom
-		 *
-		 * @tparam	ColorFunc	Type of the color function.
-		 * @tparam	BlendFunc	Type of the blend function.
-		 * @tparam	C1		 	Type of the c 1.
-		 * @param 		  	l		 	A LineF to process.
-		 * @param [in,out]	colorFunc	The color function.
-		 * @param 		  	rectangle	The rectangle.
-		 * @param 		  	blendFunc	The blend function.
-		 */
-		template<typename ColorFunc, typename BlendFunc, typename C1>
-		void _drawLineFunctorFilledBottom( const LineF & l, ColorFunc & colorFunc, const Rectangle & rectangle, const BlendFunc & blendFunc );
-
 		/**
 		 * @brief	Draw graph values functor
 		 *
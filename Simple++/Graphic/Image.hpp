@@ -2,6 +2,19 @@
 
 namespace Graphic {
 
+	inline ThreadPool *& _getThreadPool() {
+		static ThreadPool * threadPool( NULL );
+		return threadPool;
+	}
+
+	inline void setThreadPool( ThreadPool * threadPool ) {
+		_getThreadPool() = threadPool;
+	}
+
+	inline ThreadPool * getThreadPool() {
+		return _getThreadPool();
+	}
+
 	template<typename T>
 	ImageT<T>::ImageT( Format format ) :
 		format( format ),
@@ -1276,13 +1289,7 @@ namespace Graphic {
 			} else {
 				Point i;
 				for ( i.y = 0; i.y < size.y; i.y++ ) {
-					auto thisIt2 = thisIt;
-					auto otherIt2 = otherIt;
-					for ( i.x = 0; i.x < size.x; i.x++ ) {
-						BlendingFunc::Normal::blendColor( *( thisIt2 ), *( otherIt2 ) );
-						thisIt2++;
-						otherIt2++;
-					}
+					BlendingFunc::Normal::blendSpan( thisIt, otherIt, Size( size.x ) );
 					thisIt += thisImageOffset;
 					otherIt += otherImageOffset;
 				}
@@ -1334,13 +1341,7 @@ namespace Graphic {
 			} else {
 				Point i;
 				for ( i.y = 0; i.y < size.y; i.y++ ) {
-					auto thisIt2 = thisIt;
-					auto otherIt2 = otherIt;
-					for ( i.x = 0; i.x < size.x; i.x++ ) {
-						BlendingFunc::Normal::blendColor( *( thisIt2 ), *( otherIt2 ) );
-						thisIt2++;
-						otherIt2++;
-					}
+					BlendingFunc::Normal::blendSpan( thisIt, otherIt, Size( size.x ) );
 					thisIt += thisImageOffset;
 					otherIt += otherImageOffset;
 				}
@@ -1413,13 +1414,7 @@ namespace Graphic {
 
 			Point i;
 			for ( i.y = 0; i.y < size.y; i.y++ ) {
-				auto thisIt2 = thisIt;
-				auto otherIt2 = otherIt;
-				for ( i.x = 0; i.x < size.x; i.x++ ) {
-					blendFunc( *( thisIt2 ), *( otherIt2 ) );
-					otherIt2++;
-					thisIt2++;
-				}
+				BlendingFunc::blendSpan( blendFunc, thisIt, otherIt, Size( size.x ) );
 				thisIt += thisImageOffset;
 				otherIt += otherImageOffset;
 			}
@@ -1457,20 +1452,13 @@ namespace Graphic {
 
 			auto thisIt = getDatas<C1>( begin.x, begin.y );
 			unsigned int thisImageOffset = this -> size.x;
-			unsigned int sizeOffset = size.x;
 
 			auto otherIt = image.getDatas<C2>( otherImageBegin.x, otherImageBegin.y );
 			unsigned int otherImageOffset = image.getSize().x;
 
 			Point i;
 			for ( i.y = 0; i.y < size.y; i.y++ ) {
-				auto thisIt2 = thisIt;
-				auto otherIt2 = otherIt;
-				auto maxIt = thisIt + sizeOffset;
-				for ( ; thisIt2 < maxIt; thisIt2++ ) {
-					blendFunc( *( thisIt2 ), *( otherIt2 ) );
-					otherIt2++;
-				}
+				BlendingFunc::blendSpan( blendFunc, thisIt, otherIt, Size( size.x ) );
 				thisIt += thisImageOffset;
 				otherIt += otherImageOffset;
 			}
@@ -1621,6 +1609,8 @@ namespace Graphic {
 		};
 
 		static GetMaskComponentFunctor getMaskComponentFunctor;
+		// Number of elements between the mask components of two consecutive pixels.
+		constexpr Size maskStride = sizeof( C3 ) / sizeof( T );
 
 		if ( Fast ) {
 			auto maskIt = maskImage.getDatas<C3>( maskPoint.x, maskPoint.y );
@@ -1636,15 +1626,7 @@ namespace Graphic {
 
 			Point i;
 			for ( i.y = 0; i.y < size.y; i.y++ ) {
-				auto thisIt2 = thisIt;
-				auto otherIt2 = otherIt;
-				auto maskIt2 = maskIt;
-				for ( i.x = 0; i.x < size.x; i.x++ ) {
-					blendFunc( *( thisIt2 ), *( otherIt2 ), getMaskComponentFunctor( *( maskIt2 ) ) );
-					thisIt2++;
-					otherIt2++;
-					maskIt2++;
-				}
+				BlendingFunc::blendSpan( blendFunc, thisIt, otherIt, &getMaskComponentFunctor( *( maskIt ) ), maskStride, Size( size.x ) );
 				thisIt += thisImageOffset;
 				otherIt += otherImageOffset;
 				maskIt += maskImageOffset;
@@ -1701,7 +1683,6 @@ namespace Graphic {
 
 			auto maskIt = maskImage.getDatas<C3>( maskBegin.x, maskBegin.y );
 			unsigned int maskImageOffset = maskImage.getSize().x;
-			unsigned int sizeOffset = size.x;
 
 			auto thisIt = getDatas<C1>( begin.x, begin.y );
 			unsigned int thisImageOffset = this -> size.x;
@@ -1712,16 +1693,7 @@ namespace Graphic {
 
 			Point i;
 			for ( i.y = 0; i.y < size.y; i.y++ ) {
-				auto thisIt2 = thisIt;
-				auto otherIt2 = otherIt;
-				auto maskIt2 = maskIt;
-				auto maxIt = thisIt + sizeOffset;
-				for ( i.x = 0; i.x < size.x; i.x++ ) {
-					blendFunc( *( thisIt2 ), *( otherIt2 ), getMaskComponentFunctor( *( maskIt2 ) ) );
-					thisIt2++;
-					otherIt2++;
-					maskIt2++
-				}
+				BlendingFunc::blendSpan( blendFunc, thisIt, otherIt, &getMaskComponentFunctor( *( maskIt ) ), maskStride, Size( size.x ) );
 				thisIt += thisImageOffset;
 				otherIt += otherImageOffset;
 				maskIt += maskImageOffset;
@@ -1906,27 +1878,38 @@ namespace Graphic {
 
 
 	template<typename T>
-	ImageT<T> ImageT<T>::applyGaussianBlur( GSize radius, ConvolutionMode convolutionMode, const ColorRGBA<T> & color ) const {
+	ImageT<T> ImageT<T>::applyGaussianBlur( GSize radius, ConvolutionMode convolutionMode, const ColorRGBA<T> & color, BlurMode blurMode ) const {
+		if ( blurMode == BlurMode::Auto )
+			blurMode = ( radius < 10 ) ? BlurMode::Kernel : BlurMode::Box;
+		if ( blurMode == BlurMode::Box ) {
+			if ( getDatas() == NULL || radius <= GSize( 0 ) ) return *this;
+			switch ( getFormat() ) {
+				case Format::R: return _applyBoxBlur<ColorR<T>>( radius, convolutionMode, color );
+				case Format::RGB: return _applyBoxBlur<ColorRGB<T>>( radius, convolutionMode, color );
+				case Format::RGBA: return _applyBoxBlur<ColorRGBA<T>>( radius, convolutionMode, color );
+			}
+		}
 
 		typedef KernelType F;
+		// Only the kernels are cached, the image is given at each call (the pool threads may blur several images at once).
 		struct ApplyGaussian {
-			ApplyGaussian( const ImageT<T> & image ) : image( image ) {
+			ApplyGaussian() {
 				for ( GSize i = 0; i < 10; i++ ) {
 					Size diameter = i * 2 + 1;
 					kernels[i] = new F[diameter];
 					computeGaussianKernel( kernels[i], diameter );
 				}
 			}
-			inline ImageT<T> operator()( GSize radius, ConvolutionMode convolutionMode, const ColorRGBA<T> & color ) {
+			inline ImageT<T> operator()( const ImageT<T> & image, GSize radius, ConvolutionMode convolutionMode, const ColorRGBA<T> & color ) {
 				Size diameter = radius * 2 + 1;
-				if ( radius < 10 ) return this -> image.applyFilter<F>( this -> kernels[radius], this -> kernels[radius], diameter, ConvolutionOrder::HorizontalVertical, convolutionMode, color );
+				if ( radius < 10 ) return image.applyFilter<F>( this -> kernels[radius], this -> kernels[radius], diameter, ConvolutionOrder::HorizontalVertical, convolutionMode, color );
 				else {
 					Size diameter = radius * 2 + 1;
 					F * kernelTmp = new F[diameter];
 					computeGaussianKernel( kernelTmp, diameter );
-					ImageT<T> image( this -> image.applyFilter<F>( kernelTmp, kernelTmp, diameter, ConvolutionOrder::HorizontalVertical, convolutionMode, color ) );
+					ImageT<T> imageFiltered( image.applyFilter<F>( kernelTmp, kernelTmp, diameter, ConvolutionOrder::HorizontalVertical, convolutionMode, color ) );
 					delete[] kernelTmp;
-					return image;
+					return imageFiltered;
 				}
 			}
 
@@ -1936,10 +1919,162 @@ namespace Graphic {
 			}
 
 			F * kernels[10];
-			const ImageT<T> & image;
 		};
-		static ApplyGaussian applyGaussian( *this );
-		return applyGaussian( radius, convolutionMode, color );
+		static ApplyGaussian applyGaussian;
+		return applyGaussian( *this, radius, convolutionMode, color );
+	}
+
+	template<typename T>
+	template<typename C>
+	ImageT<T> ImageT<T>::_applyBoxBlur( GSize radius, ConvolutionMode convolutionMode, const ColorRGBA<T> & color ) const {
+		typedef Float F;
+		constexpr Size nbComponents( sizeof( C ) / sizeof( T ) );
+
+		GSize boxRadius[ 3 ];
+		_computeBoxBlurRadius( radius, boxRadius );
+
+		// Same borders as the separable convolution with a kernel of size radius * 2 + 1.
+		const GSize borderSize( ( convolutionMode == ConvolutionMode::ExtendedSize ) ? radius - 1 : 0 );
+		// A value of the result only depends on the ones closer than the sum of the radii, the work buffers are extended by this margin
+		// and what is beyond is never read by the pixels kept.
+		const GSize margin( boxRadius[ 0 ] + boxRadius[ 1 ] + boxRadius[ 2 ] );
+		const GSize offset( borderSize + margin );
+
+		const Math::Vec2<GSize> sizeExtended( this -> size.x + borderSize * 2, this -> size.y + borderSize * 2 );
+		const Math::Vec2<GSize> sizeWork( sizeExtended.x + margin * 2, sizeExtended.y + margin * 2 );
+
+		C backgroundColor;
+		BlendingFunc::None::blendColor( backgroundColor, color );
+		F background[ nbComponents ];
+		for ( Size k( 0 ); k < nbComponents; k++ )
+			background[ k ] = F( reinterpret_cast< const T * >( &backgroundColor )[ k ] );
+
+		ImageT<T> imageBlured( sizeExtended, getFormat() );
+
+		F * workBuffer( new F[ Size( sizeWork.x ) * Size( sizeWork.y ) * nbComponents ] );
+		F * workBuffer2( new F[ Size( sizeWork.x ) * Size( sizeWork.y ) * nbComponents ] );
+
+		// Horizontal passes, one row at a time, the source being copied in the middle of the background.
+		struct HorizontalFunc {
+			const T * thisIt;
+			F * workIt;
+			const F * background;
+			const GSize * boxRadius;
+			GSize offset;
+			Math::Vec2<GSize> size;
+			Math::Vec2<GSize> sizeWork;
+
+			void operator()( const Math::Interval<Size> & rowInterval ) {
+				const Size nbComponentsPerRowWork( Size( this -> sizeWork.x ) * nbComponents );
+				F * rowBuffer1( new F[ nbComponentsPerRowWork ] );
+				F * rowBuffer2( new F[ nbComponentsPerRowWork ] );
+				double sums[ nbComponents ];
+
+				for ( Size y( rowInterval.getBegin() ); y < rowInterval.getEnd(); y++ ) {
+					F * workIt( this -> workIt + y * nbComponentsPerRowWork );
+					const GSize ySource( GSize( y ) - this -> offset );
+
+					if ( ySource < GSize( 0 ) || ySource >= this -> size.y ) {
+						for ( Size i( 0 ); i < nbComponentsPerRowWork; i += nbComponents )
+							for ( Size k( 0 ); k < nbComponents; k++ )
+								workIt[ i + k ] = this -> background[ k ];
+						continue;
+					}
+
+					F * rowIt( rowBuffer1 );
+					const Size nbComponentsBorder( Size( this -> offset ) * nbComponents );
+					const Size nbComponentsPerRow( Size( this -> size.x ) * nbComponents );
+					for ( Size i( 0 ); i < nbComponentsBorder; i += nbComponents )
+						for ( Size k( 0 ); k < nbComponents; k++ )
+							*( rowIt++ ) = this -> background[ k ];
+					const T * thisIt( this -> thisIt + Size( ySource ) * nbComponentsPerRow );
+					for ( Size i( 0 ); i < nbComponentsPerRow; i++ )
+						*( rowIt++ ) = F( thisIt[ i ] );
+					for ( Size i( nbComponentsBorder + nbComponentsPerRow ); i < nbComponentsPerRowWork; i += nbComponents )
+						for ( Size k( 0 ); k < nbComponents; k++ )
+							*( rowIt++ ) = this -> background[ k ];
+
+					_applyBoxFilterLines( rowBuffer1, rowBuffer2, nbComponents, nbComponents, this -> sizeWork.x, this -> boxRadius[ 0 ], this -> background, sums );
+					_applyBoxFilterLines( rowBuffer2, rowBuffer1, nbComponents, nbComponents, this -> sizeWork.x, this -> boxRadius[ 1 ], this -> background, sums );
+					_applyBoxFilterLines( rowBuffer1, workIt, nbComponents, nbComponents, this -> sizeWork.x, this -> boxRadius[ 2 ], this -> background, sums );
+				}
+
+				delete[] rowBuffer1;
+				delete[] rowBuffer2;
+			}
+		};
+
+		// Vertical passes, on bands of columns processed together to read the rows contiguously, then conversion of the pixels kept.
+		struct VerticalFunc {
+			F * workIt;
+			F * workIt2;
+			T * imageBluredIt;
+			const F * background;
+			const GSize * boxRadius;
+			GSize margin;
+			Math::Vec2<GSize> sizeExtended;
+			Math::Vec2<GSize> sizeWork;
+
+			void operator()( const Math::Interval<Size> & columnInterval ) {
+				const Size nbLines( ( columnInterval.getEnd() - columnInterval.getBegin() ) * nbComponents );
+				const Size nbComponentsPerRowWork( Size( this -> sizeWork.x ) * nbComponents );
+				F * workIt( this -> workIt + columnInterval.getBegin() * nbComponents );
+				F * workIt2( this -> workIt2 + columnInterval.getBegin() * nbComponents );
+
+				F * background( new F[ nbLines ] );
+				double * sums( new double[ nbLines ] );
+				for ( Size i( 0 ); i < nbLines; i += nbComponents )
+					for ( Size k( 0 ); k < nbComponents; k++ )
+						background[ i + k ] = this -> background[ k ];
+
+				_applyBoxFilterLines( workIt, workIt2, nbLines, nbComponentsPerRowWork, this -> sizeWork.y, this -> boxRadius[ 0 ], background, sums );
+				_applyBoxFilterLines( workIt2, workIt, nbLines, nbComponentsPerRowWork, this -> sizeWork.y, this -> boxRadius[ 1 ], background, sums );
+				_applyBoxFilterLines( workIt, workIt2, nbLines, nbComponentsPerRowWork, this -> sizeWork.y, this -> boxRadius[ 2 ], background, sums );
+
+				// Columns of the band inside the result.
+				const GSize xBegin( Math::max( GSize( columnInterval.getBegin() ), this -> margin ) );
+				const GSize xEnd( Math::min( GSize( columnInterval.getEnd() ), this -> margin + this -> sizeExtended.x ) );
+				const F rounding( Utility::TypesInfos<T>::isInteger() ? F( 0.5 ) : F( 0 ) );
+				for ( GSize y( 0 ); y < this -> sizeExtended.y; y++ ) {
+					const F * workIt2( this -> workIt2 + ( Size( y + this -> margin ) * Size( this -> sizeWork.x ) + Size( xBegin ) ) * nbComponents );
+					T * imageBluredIt( this -> imageBluredIt + ( Size( y ) * Size( this -> sizeExtended.x ) + Size( xBegin - this -> margin ) ) * nbComponents );
+					for ( Size i( 0 ); i < Size( xEnd - xBegin ) * nbComponents; i++ )
+						imageBluredIt[ i ] = T( workIt2[ i ] + rounding );
+				}
+
+				delete[] background;
+				delete[] sums;
+			}
+		};
+
+		HorizontalFunc horizontalFunc;
+		horizontalFunc.thisIt = getDatas();
+		horizontalFunc.workIt = workBuffer;
+		horizontalFunc.background = background;
+		horizontalFunc.boxRadius = boxRadius;
+		horizontalFunc.offset = offset;
+		horizontalFunc.size = this -> size;
+		horizontalFunc.sizeWork = sizeWork;
+
+		VerticalFunc verticalFunc;
+		verticalFunc.workIt = workBuffer;
+		verticalFunc.workIt2 = workBuffer2;
+		verticalFunc.imageBluredIt = imageBlured.getDatas();
+		verticalFunc.background = background;
+		verticalFunc.boxRadius = boxRadius;
+		verticalFunc.margin = margin;
+		verticalFunc.sizeExtended = sizeExtended;
+		verticalFunc.sizeWork = sizeWork;
+
+		// About a dozen of operations by component whatever the radius.
+		const Size work( Size( sizeWork.x ) * Size( sizeWork.y ) * nbComponents * Size( 12 ) );
+		_runRows( sizeWork.y, horizontalFunc, work );
+		_runRows( sizeWork.x, verticalFunc, work );
+
+		delete[] workBuffer;
+		delete[] workBuffer2;
+
+		return imageBlured;
 	}
 
 
@@ -1947,8 +2082,8 @@ namespace Graphic {
 	ImageT<T> Graphic::ImageT<T>::applySobelFilter() {
 		typedef KernelType F;
 
-		static F sobelKernel1[3];
-		static F sobelKernel2[3];
+		F sobelKernel1[3];
+		F sobelKernel2[3];
 
 		computeSobel1Kernel( sobelKernel1 );
 		computeSobel2Kernel( sobelKernel2 );
@@ -1958,21 +2093,33 @@ namespace Graphic {
 		ImageT<F> imageHori( imageCasted.applyFilter<F, KernelFunc::None, T>( sobelKernel1, sobelKernel2, 3, ImageT<F>::ConvolutionOrder::HorizontalVertical, ImageT<F>::ConvolutionMode::NormalSize, ColorRGBA<F>( 0 ), KernelFunc::None() ), false );
 		ImageT<F> imageVert( imageCasted.applyFilter<F, KernelFunc::None, T>( sobelKernel1, sobelKernel2, 3, ImageT<F>::ConvolutionOrder::VerticalHorizontal, ImageT<F>::ConvolutionMode::NormalSize, ColorRGBA<F>( 0 ), KernelFunc::None() ), false );
 
-		F * imageHoriIt( imageHori.getDatas() );
-		F * imageVertIt( imageVert.getDatas() );
+		struct SobelFunc {
+			F * imageHoriIt;
+			F * imageVertIt;
+			unsigned int nbComponentsPerRow;
 
-		unsigned int imageNbComponents( this -> size.x * this -> size.y * getNbComponents() );
+			void operator()( const Math::Interval<Size> & rowInterval ) {
+				F * imageHoriIt( this -> imageHoriIt + rowInterval.getBegin() * this -> nbComponentsPerRow );
+				F * imageVertIt( this -> imageVertIt + rowInterval.getBegin() * this -> nbComponentsPerRow );
 
-		for ( unsigned int i( 0 ); i < imageNbComponents; i++ ) {
-			F & imageHoriPix( imageHoriIt[0] );
-			F & imageVertPix( imageVertIt[0] );
+				unsigned int imageNbComponents( rowInterval.getSize() * this -> nbComponentsPerRow );
 
-			F dist( Math::sqrt( imageHoriPix * imageHoriPix + imageVertPix * imageVertPix ) );
-			imageVertIt[0] = T( Math::min<F>( dist / F( 2 ), F( Color<T>::getMax() ) ) );
+				for ( unsigned int i( 0 ); i < imageNbComponents; i++ ) {
+					F & imageHoriPix( imageHoriIt[0] );
+					F & imageVertPix( imageVertIt[0] );
+
+					F dist( Math::sqrt( imageHoriPix * imageHoriPix + imageVertPix * imageVertPix ) );
+					imageVertIt[0] = T( Math::min<F>( dist / F( 2 ), F( Color<T>::getMax() ) ) );
+
+					imageHoriIt++;
+					imageVertIt++;
+				}
+			}
+		};
+
+		SobelFunc sobelFunc{ imageHori.getDatas(), imageVert.getDatas(), this -> size.x * getNbComponents() };
+		_runRows( this -> size.y, sobelFunc, Size( this -> size.x ) * Size( this -> size.y ) * Size( getNbComponents() ) );
 
-			imageHoriIt++;
-			imageVertIt++;
-		}
 		return ImageT<T>( imageVert, false );
 	}
 
@@ -2109,40 +2256,101 @@ namespace Graphic {
 		}
 
 		{
-			auto imageBorderIt = imageBorder.getDatas<C2>();
-			auto imageExtendedIt = imageExtended.getDatas<C2>();
+			// Each row of the result only reads imageBorder, the bands of rows are independent.
+			struct FilterFunc {
+				C2 * imageBorderIt;
+				C2 * imageExtendedIt;
+				const F * filter;
+				Math::Vec2<GSize> size;
+				GSize nbPixelsPerRowExtended;
+				unsigned int nbComponentsPerRowWithBorder;
+				unsigned int nbComponentsPerRowExtended;
+				F max;
+				KernelFunc * kernelFunc;
+
+				void operator()( const Math::Interval<Size> & rowInterval ) {
+					auto imageBorderIt = this -> imageBorderIt + rowInterval.getBegin() * this -> nbComponentsPerRowWithBorder;
+					auto imageExtendedIt = this -> imageExtendedIt + rowInterval.getBegin() * this -> nbComponentsPerRowExtended;
+
+					for ( Size y = rowInterval.getBegin(); y < rowInterval.getEnd(); y++ ) {
+						auto imageExtendedIt2 = imageBorderIt;
+						auto imageHoriIt2 = imageExtendedIt;
+						for ( typename Math::Vec2<GSize>::Type x = 0; x < this -> nbPixelsPerRowExtended; x++ ) {
+							auto imageExtendedIt3 = imageExtendedIt2;
+							auto filterIt2 = this -> filter;
+
+							Sum sum( 0 );
+							for ( GSize y = 0; y < this -> size.y; y++ ) {
+								auto imageExtendedIt4 = imageExtendedIt3;
+								for ( GSize x = 0; x < this -> size.x; x++ ) {
+									sum += Sum( imageExtendedIt4[0] ) * *( filterIt2 );
+
+									imageExtendedIt4++;
+									filterIt2++;
+								}
+								imageExtendedIt3 += this -> nbComponentsPerRowWithBorder;
+							}
+							( *this -> kernelFunc )( sum, this -> max );
+							imageHoriIt2[0] = C2( sum >> ImageT<T1>::getKernelSumNbBits<F>() );
+
+							imageExtendedIt2++;
+							imageHoriIt2++;
+						}
+
+
+						imageBorderIt += this -> nbComponentsPerRowWithBorder;
+						imageExtendedIt += this -> nbComponentsPerRowExtended;
+					}
+				}
+			};
 
 			constexpr F max( ( 1 << ImageT<T1>::getKernelSumNbBits<F>() ) * Color<T1>::getMax() );
 
-			for ( typename Math::Vec2<GSize>::Type y = 0; y < imageExtended.getSize().y; y++ ) {
-				auto imageExtendedIt2 = imageBorderIt;
-				auto imageHoriIt2 = imageExtendedIt;
-				for ( typename Math::Vec2<GSize>::Type x = 0; x < imageExtended.getSize().x; x++ ) {
-					auto imageExtendedIt3 = imageExtendedIt2;
-					auto filterIt2 = filter;
-
-					Sum sum( 0 );
-					for ( GSize y = 0; y < size.y; y++ ) {
-						auto imageExtendedIt4 = imageExtendedIt3;
-						for ( GSize x = 0; x < size.x; x++ ) {
-							sum += Sum( imageExtendedIt4[0] ) * *( filterIt2 );
-
-							imageExtendedIt4++;
-							filterIt2++;
+		// One pass of the separable filter, each row of the destination only reads the source, the bands of rows are independent.
+		struct FilterFunc {
+			C2 * srcIt;
+			C2 * dstIt;
+			const F * filter;
+			GSize kernelSize;
+			unsigned int filterOffset;
+			GSize nbPixelsPerRow;
+			unsigned int nbComponentsPerRowSrc;
+			unsigned int nbComponentsPerRowDst;
+			F max;
+			KernelFunc * kernelFunc;
+
+			void operator()( const Math::Interval<Size> & rowInterval ) {
+				auto srcIt = this -> srcIt + rowInterval.getBegin() * this -> nbComponentsPerRowSrc;
+				auto dstIt = this -> dstIt + rowInterval.getBegin() * this -> nbComponentsPerRowDst;
+
+				for ( Size y = rowInterval.getBegin(); y < rowInterval.getEnd(); y++ ) {
+					auto srcIt2 = srcIt;
+					auto dstIt2 = dstIt;
+					for ( typename Math::Vec2<GSize>::Type x = 0; x < this -> nbPixelsPerRow; x++ ) {
+						auto srcIt3 = srcIt2;
+
+						Sum sum( 0 );
+						for ( GSize i = 0; i < this -> kernelSize; i++ ) {
+							sum += Sum( srcIt3[0] ) * this -> filter[i];
+							srcIt3 += this -> filterOffset;
 						}
-						imageExtendedIt3 += nbComponentsPerRowWithBorder;
+						( *this -> kernelFunc )( sum, this -> max );
+						dstIt2[0] = C2( sum >> ImageT<T1>::getKernelSumNbBits<F>() );
+
+						srcIt2++;
+						dstIt2++;
 					}
-					kernelFunc( sum, max );
-					imageHoriIt2[0] = C2( sum >> ImageT<T1>::getKernelSumNbBits<F>() );
 
-					imageExtendedIt2++;
-					imageHoriIt2++;
+
+					srcIt += this -> nbComponentsPerRowSrc;
+					dstIt += this -> nbComponentsPerRowDst;
 				}
+			}
+		};
 
 
-				imageBorderIt += nbComponentsPerRowWithBorder;
-				imageExtendedIt += nbComponentsPerRowExtended;
-			}
+			FilterFunc filterFunc{ imageBorder.getDatas<C2>(), imageExtended.getDatas<C2>(), filter, size, imageExtended.getSize().x, nbComponentsPerRowWithBorder, nbComponentsPerRowExtended, max, &kernelFunc };
+			_runRows( imageExtended.getSize().y, filterFunc, Size( imageExtended.getSize().x ) * Size( imageExtended.getSize().y ) * Size( size.x * size.y ) );
 		}
 		return imageExtended;
 	}
@@ -2229,39 +2437,57 @@ namespace Graphic {
 		}
 
 		{
-			auto imageBorderIt = imageBorder.getDatas<C2>();
-			auto imageExtendedIt = imageExtended.getDatas<C2>();
-
-			constexpr F max( 1.0f * Color<T1>::getMax() );
+			// Each row of the result only reads imageBorder, the bands of rows are independent.
+			struct FilterFunc {
+				C2 * imageBorderIt;
+				C2 * imageExtendedIt;
+				const F * filter;
+				Math::Vec2<GSize> size;
+				GSize nbPixelsPerRowExtended;
+				unsigned int nbComponentsPerRowWithBorder;
+				unsigned int nbComponentsPerRowExtended;
+				F max;
+				KernelFunc * kernelFunc;
+
+				void operator()( const Math::Interval<Size> & rowInterval ) {
+					auto imageBorderIt = this -> imageBorderIt + rowInterval.getBegin() * this -> nbComponentsPerRowWithBorder;
+					auto imageExtendedIt = this -> imageExtendedIt + rowInterval.getBegin() * this -> nbComponentsPerRowExtended;
+
+					for ( Size y = rowInterval.getBegin(); y < rowInterval.getEnd(); y++ ) {
+						auto imageBorderIt2 = imageBorderIt;
+						auto imageExtendedIt2 = imageExtendedIt;
+						for ( typename Math::Vec2<GSize>::Type x = 0; x < this -> nbPixelsPerRowExtended; x++ ) {
+							auto imageExtendedIt3 = imageBorderIt2;
+							auto filterIt2 = this -> filter;
+
+							imageExtendedIt2[0] = C2( 0 );
+							for ( GSize y = 0; y < this -> size.y; y++ ) {
+								auto imageExtendedIt4 = imageExtendedIt3;
+								for ( GSize x = 0; x < this -> size.x; x++ ) {
+									imageExtendedIt2[0] += imageExtendedIt4[0] * *( filterIt2 );
+
+									imageExtendedIt4++;
+									filterIt2++;
+								}
+								imageExtendedIt3 += this -> nbComponentsPerRowWithBorder;
+							}
+							( *this -> kernelFunc )( imageExtendedIt2[0], this -> max );
 
-			for ( typename Math::Vec2<GSize>::Type y = 0; y < imageExtended.getSize().y; y++ ) {
-				auto imageBorderIt2 = imageBorderIt;
-				auto imageExtendedIt2 = imageExtendedIt;
-				for ( typename Math::Vec2<GSize>::Type x = 0; x < imageExtended.getSize().y; x++ ) {
-					auto imageExtendedIt3 = imageBorderIt2;
-					auto filterIt2 = filter;
-
-					imageExtendedIt2[0] = C2( 0 );
-					for ( GSize y = 0; y < size.y; y++ ) {
-						auto imageExtendedIt4 = imageExtendedIt3;
-						for ( GSize x = 0; x < size.x; x++ ) {
-							imageExtendedIt2[0] += imageExtendedIt4[0] * *( filterIt2 );
-
-							imageExtendedIt4++;
-							filterIt2++;
+							imageBorderIt2++;
+							imageExtendedIt2++;
 						}
-						imageExtendedIt3 += nbComponentsPerRowWithBorder;
-					}
-					kernelFunc( imageExtendedIt2[0], max );
 
-					imageBorderIt2++;
-					imageExtendedIt2++;
+
+						imageBorderIt += this -> nbComponentsPerRowWithBorder;
+						imageExtendedIt += this -> nbComponentsPerRowExtended;
+					}
 				}
+			};
 
+			constexpr F max( 1.0f * Color<T1>::getMax() );
 
-				imageBorderIt += nbComponentsPerRowWithBorder;
-				imageExtendedIt += nbComponentsPerRowExtended;
-			}
+			FilterFunc filterFunc{ imageBorder.getDatas<C2>(), imageExtended.getDatas<C2>(), filter, size, imageExtended.getSize().x, nbComponentsPerRowWithBorder, nbComponentsPerRowExtended, max, &kernelFunc };
+			_runRows( imageExtended.getSize().y, filterFunc, Size( imageExtended.getSize().x ) * Size( imageExtended.getSize().y ) * Size( size.x * size.y ) );
 		}
 		return imageExtended;
 	}
@@ -2385,29 +2611,8 @@ namespace Graphic {
 			}
 
 
-			for ( typename Math::Vec2<GSize>::Type y = 0; y < size.y; y++ ) {
-				auto imageBorderIt2 = imageBorderIt;
-				auto imageFilter1It2 = imageFilter1It;
-				for ( typename Math::Vec2<GSize>::Type x = 0; x < size.x; x++ ) {
-					auto imageBorderIt3 = imageBorderIt2;
-
-					Sum sum( 0 );
-					for ( GSize i = 0; i < kernelSize; i++ ) {
-						sum += Sum( imageBorderIt3[0] ) * filterX[i];
-						//imageBorderIt3++;
-						imageBorderIt3 += filterOffset;
-					}
-					kernelFunc( sum, max );
-					imageFilter1It2[0] = C2( sum >> ImageT<T1>::getKernelSumNbBits<F>() );
-
-					imageBorderIt2++;
-					imageFilter1It2++;
-				}
-
-
-				imageBorderIt += nbComponentsPerRowWithBorder;
-				imageFilter1It += nbComponentsPerRowWithBorder;
-			}
+			FilterFunc filterFunc{ imageBorderIt, imageFilter1It, filterX, kernelSize, filterOffset, size.x, nbComponentsPerRowWithBorder, nbComponentsPerRowWithBorder, max, &kernelFunc };
+			_runRows( size.y, filterFunc, Size( size.x ) * Size( size.y ) * Size( kernelSize ) );
 		}
 
 		{
@@ -2432,29 +2637,8 @@ namespace Graphic {
 			}
 
 
-			for ( typename Math::Vec2<GSize>::Type y = 0; y < size.y; y++ ) {
-				auto imageFilter2It2 = imageFilter2It;
-				auto imageFilter1It2 = imageFilter1It;
-				for ( typename Math::Vec2<GSize>::Type x = 0; x < size.x; x++ ) {
-
-					auto resultHoriIt3 = imageFilter1It2;
-
-					Sum sum( 0 );
-					for ( GSize i = 0; i < kernelSize; i++ ) {
-						sum += Sum( resultHoriIt3[0] ) * filterY[i];
-						resultHoriIt3 += filterOffset;
-					}
-					kernelFunc( sum, max );
-					imageFilter2It2[0] = C2( sum >> ImageT<T1>::getKernelSumNbBits<F>() );
-
-					imageFilter2It2++;
-					imageFilter1It2++;
-				}
-
-
-				imageFilter2It += nbComponentsPerRowExtended;
-				imageFilter1It += nbComponentsPerRowWithBorder;
-			}
+			FilterFunc filterFunc{ imageFilter1It, imageFilter2It, filterY, kernelSize, filterOffset, size.x, nbComponentsPerRowWithBorder, nbComponentsPerRowExtended, max, &kernelFunc };
+			_runRows( size.y, filterFunc, Size( size.x ) * Size( size.y ) * Size( kernelSize ) );
 		}
 		return imageFilter2;
 	}
@@ -2561,6 +2745,48 @@ namespace Graphic {
 
 		constexpr F max( 1.0 * Color<T1>::getMax() );
 
+		// One pass of the separable filter, each row of the destination only reads the source, the bands of rows are independent.
+		struct FilterFunc {
+			C2 * srcIt;
+			C2 * dstIt;
+			const F * filter;
+			GSize kernelSize;
+			unsigned int filterOffset;
+			GSize nbPixelsPerRow;
+			unsigned int nbComponentsPerRowSrc;
+			unsigned int nbComponentsPerRowDst;
+			F max;
+			KernelFunc * kernelFunc;
+
+			void operator()( const Math::Interval<Size> & rowInterval ) {
+				auto srcIt = this -> srcIt + rowInterval.getBegin() * this -> nbComponentsPerRowSrc;
+				auto dstIt = this -> dstIt + rowInterval.getBegin() * this -> nbComponentsPerRowDst;
+
+				for ( Size y = rowInterval.getBegin(); y < rowInterval.getEnd(); y++ ) {
+					auto srcIt2 = srcIt;
+					auto dstIt2 = dstIt;
+					for ( typename Math::Vec2<GSize>::Type x = 0; x < this -> nbPixelsPerRow; x++ ) {
+						auto srcIt3 = srcIt2;
+
+						dstIt2[0] = C2( 0.0 );
+						for ( GSize i = 0; i < this -> kernelSize; i++ ) {
+							dstIt2[0] += srcIt3[0] * this -> filter[i];
+							srcIt3 += this -> filterOffset;
+						}
+						( *this -> kernelFunc )( dstIt2[0], this -> max );
+
+						srcIt2++;
+						dstIt2++;
+					}
+
+
+					srcIt += this -> nbComponentsPerRowSrc;
+					dstIt += this -> nbComponentsPerRowDst;
+				}
+			}
+		};
+
+
 		{
 			C2 * imageFilter1It;
 			C2 * imageBorderIt;
@@ -2582,27 +2808,8 @@ namespace Graphic {
 			}
 
 
-			for ( typename Math::Vec2<GSize>::Type y = 0; y < size.y; y++ ) {
-				auto imageBorderIt2 = imageBorderIt;
-				auto imageFilter1It2 = imageFilter1It;
-				for ( typename Math::Vec2<GSize>::Type x = 0; x < size.x; x++ ) {
-					auto imageBorderIt3 = imageBorderIt2;
-
-					imageFilter1It2[0] = C2( 0.0 );
-					for ( GSize i = 0; i < kernelSize; i++ ) {
-						imageFilter1It2[0] += imageBorderIt3[0] * filterX[i];
-						imageBorderIt3 += filterOffset;
-					}
-					kernelFunc( imageFilter1It2[0], max );
-
-					imageBorderIt2++;
-					imageFilter1It2++;
-				}
-
-
-				imageBorderIt += nbComponentsPerRowWithBorder;
-				imageFilter1It += nbComponentsPerRowWithBorder;
-			}
+			FilterFunc filterFunc{ imageBorderIt, imageFilter1It, filterX, kernelSize, filterOffset, size.x, nbComponentsPerRowWithBorder, nbComponentsPerRowWithBorder, max, &kernelFunc };
+			_runRows( size.y, filterFunc, Size( size.x ) * Size( size.y ) * Size( kernelSize ) );
 		}
 
 		{
@@ -2627,28 +2834,8 @@ namespace Graphic {
 			}
 
 
-			for ( typename Math::Vec2<GSize>::Type y = 0; y < size.y; y++ ) {
-				auto imageFilter2It2 = imageFilter2It;
-				auto imageFilter1It2 = imageFilter1It;
-				for ( typename Math::Vec2<GSize>::Type x = 0; x < size.x; x++ ) {
-
-					auto resultHoriIt3 = imageFilter1It2;
-
-					imageFilter2It2[0] = C2( 0.0 );
-					for ( GSize i = 0; i < kernelSize; i++ ) {
-						imageFilter2It2[0] += resultHoriIt3[0] * filterY[i];
-						resultHoriIt3 += filterOffset;
-					}
-					kernelFunc( imageFilter2It2[0], max );
-
-					imageFilter2It2++;
-					imageFilter1It2++;
-				}
-
-
-				imageFilter2It += nbComponentsPerRowExtended;
-				imageFilter1It += nbComponentsPerRowWithBorder;
-			}
+			FilterFunc filterFunc{ imageFilter1It, imageFilter2It, filterY, kernelSize, filterOffset, size.x, nbComponentsPerRowWithBorder, nbComponentsPerRowExtended, max, &kernelFunc };
+			_runRows( size.y, filterFunc, Size( size.x ) * Size( size.y ) * Size( kernelSize ) );
 		}
 		return imageFilter2;
 	}
@@ -3968,163 +4155,6 @@ namespace Graphic {
 
 
 
-	template<typename T>
-	template<typename ColorFunc, typename BlendFunc, typename C1>
-	void ImageT<T>::_drawLineFunctorFilledBottom( const LineF & l, ColorFunc & colorFunc, const Rectangle & rectangle, const BlendFunc & blendFunc ) {
-		typedef Utility::TypesInfos<SumType>::Signed Bigger;
-
-		ASSERT_SPP( ( Utility::isBase<Graphic::BlendingFunc::Template, BlendFunc>::value ) );
-		DEBUG_SPP( Math::Vec2<typename Rectangle::Type> size( rectangle.getRightTop() - rectangle.getLeftBottom() ););
-
-		Math::Vec2<float> p0;
-		Math::Vec2<float> p1;
-
-
-		p0.y = l.getP0().y;
-		p0.x = l.getP0().x;
-
-		p1.y = l.getP1().y;
-		p1.x = l.getP1().x;
-
-		float dx = p1.x - p0.x;
-		float dy = p1.y - p0.y;
-
-		bool steep = Math::abs( dy ) > Math::abs( dx );
-
-		Math::Vec2<int> p0i( int( p0.x ), int( p0.y ) );
-		Math::Vec2<int> p1i( int( p1.x ), int( p1.y ) );
-
-		int thisRow = getSize().x;
-		Math::Vec2<int> i( p0i.x - rectangle.getLeft(), p0i.y - rectangle.getBottom() );
-		int xMax = p1i.x - rectangle.getLeft();
-		auto p0It = getDatas<C1>( rectangle.getLeft(), rectangle.getBottom() );
-
-		if ( steep ) {
-			float gradientF = dx / dy;
-			Bigger gradientI = -Bigger( gradientF * float( 1 << Utility::TypesInfos<T>::getNbBits() ) );
-
-			if ( dy < 0.0f ) {
-				auto it = p0It + thisRow * i.y + i.x;
-
-				Bigger intery = Bigger( 0 );
-				for ( ; i.x < xMax; ) {
-					int lastX = ( intery >> 8 );
-					int newX;
-					do {
-						unsigned char opacity = unsigned char( intery );
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *it, colorFunc( i ), opacity );
-
-						intery += gradientI;
-						newX = ( intery >> 8 );
-
-						it -= thisRow;
-						i.y--;
-					} while ( lastX == newX );
-
-					auto it2 = it;
-					auto tmp = i.y;
-					while ( i.y >= 0 ) {
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *it2, colorFunc( i ) );
-
-						it2 -= thisRow;
-						i.y--;
-					}
-					i.y = tmp;
-
-					i.x++;
-					it++;
-				}
-
-			} else {
-				auto it = p0It + thisRow * i.y + i.x;
-
-				Bigger intery = Bigger( -1 );
-				for ( ; i.x < xMax; ) {
-					auto it2 = it;
-					auto tmp = i.y;
-					while ( i.y > 0 ) {
-						it2 -= thisRow;
-						i.y--;
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *it2, colorFunc( i ) );
-					}
-					i.y = tmp;
-
-					int lastX = ( intery >> 8 );
-					int newX;
-					do {
-						unsigned char opacity = unsigned char( intery );
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *it, colorFunc( i ), opacity );
-
-						intery += gradientI;
-						newX = ( intery >> 8 );
-
-						it += thisRow;
-						i.y++;
-					} while ( lastX == newX );
-					i.x++;
-					it++;
-				}
-			}
-		} else {
-			float gradientF = dy / dx;
-			Bigger gradientI = Bigger( gradientF * float( 1 << Utility::TypesInfos<T>::getNbBits() ) );
-
-			if ( dy < 0.0f ) {
-				Bigger intery = Bigger( ( p0.y - float( rectangle.getBottom() ) ) * ( 1 << Utility::TypesInfos<T>::getNbBits() ) );
-				for ( ; i.x < xMax; ) {
-					i.y = ( intery >> 8 );
-					auto it = p0It + thisRow * i.y + i.x;
-
-					unsigned char opacity = unsigned char( intery );
-					ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-					blendFunc( *it, colorFunc( i ), opacity );
-
-					while ( i.y > 0 ) {
-						it -= thisRow;
-						i.y--;
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *it, colorFunc( i ) );
-					}
-
-					intery += gradientI;
-					i.x++;
-					it++;
-				}
-			} else {
-				Bigger intery = Bigger( ( p0.y - float( rectangle.getBottom() ) ) * float( 1 << Utility::TypesInfos<T>::getNbBits() ) );
-				for ( ; i.x < xMax; ) {
-					i.y = ( intery >> 8 );
-					auto it = p0It + thisRow * i.y + i.x;
-
-					auto it2 = it;
-					auto tmp = i.y;
-					while ( i.y > 0 ) {
-						it2 -= thisRow;
-						i.y--;
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *it2, colorFunc( i ) );
-					}
-					i.y = tmp;
-
-					unsigned char opacity = unsigned char( intery );
-					ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-					blendFunc( *it, colorFunc( i ), opacity );
-
-					intery += gradientI;
-					i.x++;
-					it++;
-				}
-			}
-		}
-	}
-
-
-
-
 	template<typename T>
 	void ImageT<T>::threshold( const ColorRGBA<T> & colorOver, const ColorRGBA<T> & colorUnder, const ColorRGBA<T> & limit ) {
 		struct Functor {
@@ -4682,15 +4712,18 @@ namespace Graphic {
 	template<typename BlendFunc, typename C1, typename C2>
 	void ImageT<T>::_drawBezierCurve( const PointF & p0, const PointF & p1, const PointF p2, const PointF & p3, unsigned int thickness, const C2 & color, const BlendFunc & blendFunc ) {
 		if ( getDatas() == NULL ) return;
-		unsigned int numberPoints = 50;
-
+		const unsigned int numberPoints = 50;
+		const float halfThickness( float( Math::max( thickness, 1u ) ) * 0.5f );
 
+		// The whole stroke is rasterized at once : a quad by segment and two triangles filling the joints, every one with the same orientation
+		// for their overlaps to be merged by the NonZero rule instead of being blended several times.
+		Rasterizer rasterizer;
 		Math::Vec2<float> p( p0 );
 		Math::Vec2<float> p_;
-		float t = 0;
+		Math::Vec2<float> normalLast( 0.0f );
+		float t = 0.0f;
 		float tIncr = 1.0f / float( numberPoints - 1 );
 		for ( unsigned int i = 0; i < numberPoints; i++ ) {
-
 			float oneMinusT = 1.0f - t;
 			float oneMinusTSquare = oneMinusT * oneMinusT;
 			float tSquare = t * t;
@@ -4702,11 +4735,31 @@ namespace Graphic {
 
 			p_.x = p0.x * p0Factor + p1.x * p1Factor + p2.x * p2Factor + p3.x * p3Factor;
 			p_.y = p0.y * p0Factor + p1.y * p1Factor + p2.y * p2Factor + p3.y * p3Factor;
+			t += tIncr;
+
+			const Math::Vec2<float> direction( p_ - p );
+			const float length( Math::sqrt( direction.x * direction.x + direction.y * direction.y ) );
+			if ( length == 0.0f ) continue;
+			const Math::Vec2<float> normal( -direction.y * halfThickness / length, direction.x * halfThickness / length );
+
+			const Math::Vec2<float> quad[ 4 ] = { p + normal, p_ + normal, p_ - normal, p - normal };
+			rasterizer.addPolygon( quad, Size( 4 ) );
+
+			if ( normalLast.x != 0.0f || normalLast.y != 0.0f ) {
+				// The quads are clockwise, the joint triangles are made clockwise too.
+				const bool isClockwise( normalLast.x * normal.y - normalLast.y * normal.x < 0.0f );
+				const Math::Vec2<float> triangleOutside[ 3 ] = { p, p + ( isClockwise ? normalLast : normal ), p + ( isClockwise ? normal : normalLast ) };
+				const Math::Vec2<float> triangleInside[ 3 ] = { p, p - ( isClockwise ? normalLast : normal ), p - ( isClockwise ? normal : normalLast ) };
+				rasterizer.addPolygon( triangleOutside, Size( 3 ) );
+				rasterizer.addPolygon( triangleInside, Size( 3 ) );
+			}
 
-			drawLineFunctor( Math::Line<float>( p, p_ ), ColorFunc::SimpleColor<C2>( color ), thickness, blendFunc );
+			normalLast = normal;
 			p = p_;
-			t += tIncr;
 		}
+
+		ColorFunc::SimpleColor<C2> colorFunc( color );
+		_drawRasterizerFunctor<ColorFunc::SimpleColor<C2>, BlendFunc, C1>( rasterizer, Rectangle( 0, 0, getSize().x, getSize().y ), colorFunc, FillRule::NonZero, blendFunc );
 	}
 
 
@@ -4728,110 +4781,69 @@ namespace Graphic {
 	template<typename T>
 	template<typename ColorFunc, typename BlendFunc, typename C1>
 	void ImageT<T>::_drawGraphValuesFunctor( const Vector<Math::Vec2<float>> & values, const Rectangle & rectangle, ColorFunc & colorFunc, BlendFunc & blendFunc ) {
-		WARNING_SPP( "Deprecated function" );
-		return;
-		if ( values.getSize() <= 2 ) {
+		if ( values.getSize() < 2 ) {
 			return;
 		}
 
-
-		Math::Rectangle<GSize> clampedRectangle = clampRectangle( rectangle );
-		Math::Vec2<GSize> size = clampedRectangle.getRightTop() - clampedRectangle.getLeftBottom();
-
-
-		colorFunc.init( clampedRectangle );
-
-
+		const Math::Vec2<float> size( float( rectangle.getRight() - rectangle.getLeft() ), float( rectangle.getTop() - rectangle.getBottom() ) );
+		const Math::Vec2<float> origin( float( rectangle.getLeft() ), float( rectangle.getBottom() ) );
 
 		Vector<Math::Vec2<float>> tangents;
-		tangents.reserve( values.getSize() );
-
-
+		tangents.resize( values.getSize() );
 
 		//Compute the first tangent
 		tangents[0] = ( ( values[1] - values[0] ) ) * 0.3f;
 
 		//Compute the last tangent
 		auto lastIndex = values.getSize() - 1;
-		tangents[lastIndex] = ( values[lastIndex - 1] - values[lastIndex] ) * 0.3f;
+		tangents[lastIndex] = ( values[lastIndex] - values[lastIndex - 1] ) * 0.3f;
 
 		//Compute the others tangents
 		for ( size_t i = 1; i < lastIndex; i++ ) {
 			const Math::Vec2<float> & p0 = values[i - 1];
-			const Math::Vec2<float> & p1 = values[i];
 			const Math::Vec2<float> & p2 = values[i + 1];
 
 			tangents[i] = ( ( p2 - p0 ) ) * 0.3f;
 		}
 
-
-		Math::Vec2<float> & p0 = const_cast< Math::Vec2<float> & >( values[0] );
-		Math::Vec2<float> & m0 = tangents[0];
-
-		//lets draw this !
+		// The area under the curve is a single polygon : the bottom corners and the curve sampled every pixel, rasterized in one pass.
+		Vector<Math::Vec2<float>> polygon;
+		polygon.push( Math::Vec2<float>( origin.x + values[0].x * size.x, origin.y ) );
+		polygon.push( origin + values[0] * size );
 		for ( size_t i = 1; i < values.getSize(); i++ ) {
-			Math::Vec2<float> & p1 = const_cast< Math::Vec2<float> & >( values[i] );
-			Math::Vec2<float> & m1 = tangents[i];
-
-
-			LineF lineClamped( p0, p1 );
-			Math::clamp( &lineClamped, Math::Rectangle<float>( 0, 0, 1, 1 ) );
-			p0 = lineClamped.getP0();
-			p1 = lineClamped.getP1();
-
-
-			//for each pixel
-			Math::Vec2<GSize> j;
-			PointF p, p_;
-			p_.x = float( int( p0.x * float( size.x ) + float( clampedRectangle.getLeft() ) ) );
-			p_.y = p0.y * float( size.y ) + float( clampedRectangle.getBottom() );
+			const Math::Vec2<float> & p0 = values[i - 1];
+			const Math::Vec2<float> & p1 = values[i];
+			const Math::Vec2<float> & m0 = tangents[i - 1];
+			const Math::Vec2<float> & m1 = tangents[i];
 
-			auto pixelBeginX = int( p_.x );
-			auto pixelEndX = int( p1.x * float( size.x ) + float( clampedRectangle.getLeft() ) );
-			auto numPixelstoDraw = pixelEndX - pixelBeginX;
-			float tIncr = 1.0f / ( float( numPixelstoDraw ) );
+			const int nbSamples = Math::max( int( Math::abs( p1.x - p0.x ) * size.x ), 1 );
+			const float tIncr = 1.0f / float( nbSamples );
 			float t = tIncr;
-
-
-			j.x = pixelBeginX;
-
-			for ( size_t k = 0; k < numPixelstoDraw; k++ ) {
-				j.x++;
-
+			for ( int k = 0; k < nbSamples; k++ ) {
 				float t2 = t * t;
 				float t3 = t2 * t;
 
-				//Compute the Hermite factors 
+				//Compute the Hermite factors
 				float p0Factor = 2.0f * t3 - 3.0f * t2 + 1.0f;
 				float m0Factor = t3 - 2.0f * t2 + t;
 
 				float p1Factor = -2.0f * t3 + 3.0f * t2;
 				float m1Factor = t3 - t2;
 
-				float y = p0.y * p0Factor + m0.y * m0Factor + p1.y * p1Factor + m1.y * m1Factor;
-
-
-				p.x = j.x;
-				p.y = y * float( size.y ) + float( clampedRectangle.getBottom() );
-
-
-				LineF line( p_, p );
-
-				//drawLine(line, ColorR<unsigned char>(0), 2);
-				_drawLineFunctorFilledBottom<ColorFunc, BlendFunc, C1>( line, colorFunc, clampedRectangle, blendFunc );
+				const Math::Vec2<float> p( p0 * p0Factor + m0 * m0Factor + p1 * p1Factor + m1 * m1Factor );
+				polygon.push( origin + p * size );
 
 				t += tIncr;
-				p_ = p;
 			}
-
-			p0 = p1;
-			m0 = m1;
-
-
 		}
+		polygon.push( Math::Vec2<float>( origin.x + values[lastIndex].x * size.x, origin.y ) );
 
+		Rasterizer rasterizer;
+		rasterizer.addPolygon( polygon.getData(), polygon.getSize() );
+		_drawRasterizerFunctor<ColorFunc, BlendFunc, C1>( rasterizer, rectangle, colorFunc, FillRule::NonZero, blendFunc );
 	}
 
+
 	template<typename T>
 	template<typename BlendFunc>
 	void ImageT<T>::drawRectangleRounded( const Rectangle & rectangle, unsigned int radius, const ColorR<T> & color, BlendFunc & blendFunc ) {
@@ -5345,15 +5357,89 @@ namespace Graphic {
 
 
 	template<typename T>
-	template<typename C, typename ColorSum, typename ColorFloat, typename SumType>
-	ImageT<T> ImageT<T>::_resample( const Math::Vec2<GSize> & newSize, ResamplingMode resamplingMode ) const {
-		typedef typename Float Float;
+	template<typename Func>
+	void ImageT<T>::_runRows( GSize nbRows, Func & func, Size work ) {
+		// Under this amount of work, waking the threads costs more than it saves.
+		constexpr Size minWork( 1 << 16 );
 
-		if ( newSize.x == this -> size.x && newSize.y == this -> size.y )
-			return *this;
+		if ( nbRows <= GSize( 0 ) ) return;
 
+		const Math::Interval<Size> rowInterval( Size( 0 ), Size( nbRows ) );
+		ThreadPool * threadPool( getThreadPool() );
+		if ( threadPool == NULL || threadPool -> getNbThreads() <= Size( 1 ) || work < minWork ) {
+			func( rowInterval );
+		} else {
+			threadPool -> runInterval( rowInterval, func );
+		}
+	}
 
-		ImageT<T> newImage( newSize, getFormat() );
+	template<typename T>
+	void ImageT<T>::_computeBoxBlurRadius( GSize radius, GSize( &boxRadius )[ 3 ] ) {
+		// Widths of the boxes giving the closest variance to the Gaussian one, the first boxes being the smallest (P. Kovesi, Fast Almost-Gaussian Filtering).
+		constexpr GSize nbBoxes( 3 );
+		const double sigma( double( radius * 2 + 1 ) / 4.0 );
+		const double variance12( 12.0 * sigma * sigma );
+
+		GSize widthLow( GSize( Math::sqrt( variance12 / double( nbBoxes ) + 1.0 ) ) );
+		if ( widthLow % 2 == 0 ) widthLow--;
+		const GSize widthHigh( widthLow + 2 );
+		const double nbBoxesLowf( ( variance12 - double( nbBoxes * widthLow * widthLow + 4 * nbBoxes * widthLow + 3 * nbBoxes ) ) / double( -4 * widthLow - 4 ) );
+		const GSize nbBoxesLow( GSize( nbBoxesLowf + 0.5 ) );
+
+		for ( GSize i( 0 ); i < nbBoxes; i++ )
+			boxRadius[ i ] = ( ( i < nbBoxesLow ) ? widthLow : widthHigh ) / 2;
+	}
+
+	template<typename T>
+	template<typename F>
+	void ImageT<T>::_applyBoxFilterLines( const F * inIt, F * outIt, Size nbLines, Size stride, GSize length, GSize radius, const F * background, double * sums ) {
+		// The sums are kept in double, the rows are long enough to accumulate a visible error in float.
+		const double oneOnWidth( 1.0 / double( radius * 2 + 1 ) );
+
+		for ( Size l( 0 ); l < nbLines; l++ )
+			sums[ l ] = 0.0;
+		for ( GSize i( -radius ); i <= radius; i++ ) {
+			const F * lineIt( ( i >= GSize( 0 ) && i < length ) ? inIt + Size( i ) * stride : background );
+			for ( Size l( 0 ); l < nbLines; l++ )
+				sums[ l ] += double( lineIt[ l ] );
+		}
+
+		for ( GSize i( 0 ); i < length; i++ ) {
+			F * lineOutIt( outIt + Size( i ) * stride );
+			for ( Size l( 0 ); l < nbLines; l++ )
+				lineOutIt[ l ] = F( sums[ l ] * oneOnWidth );
+
+			// Slide the window : add the entering value, remove the leaving one.
+			const F * lineAddIt( ( i + radius + 1 < length ) ? inIt + Size( i + radius + 1 ) * stride : background );
+			const F * lineSubIt( ( i - radius >= GSize( 0 ) ) ? inIt + Size( i - radius ) * stride : background );
+			for ( Size l( 0 ); l < nbLines; l++ )
+				sums[ l ] += double( lineAddIt[ l ] ) - double( lineSubIt[ l ] );
+		}
+	}
+
+
+
+	template<typename T>
+	template<typename C, typename ColorSum, typename ColorFloat, typename SumType>
+	ImageT<T> ImageT<T>::_resample( const Math::Vec2<GSize> & newSize, ResamplingMode resamplingMode ) const {
+		typedef typename Float Float;
+
+		if ( newSize.x == this -> size.x && newSize.y == this -> size.y )
+			return *this;
+
+		switch ( resamplingMode ) {
+			case ResamplingMode::Lanczos:
+				return _resampleWeighted<C>( newSize, ResamplingWeightsT<Float>::Filter::Lanczos );
+			case ResamplingMode::Bicubic:
+				return _resampleWeighted<C>( newSize, ResamplingWeightsT<Float>::Filter::Bicubic );
+			case ResamplingMode::Area:
+				return _resampleWeighted<C>( newSize, ResamplingWeightsT<Float>::Filter::Area );
+			default:
+				break;
+		}
+
+
+		ImageT<T> newImage( newSize, getFormat() );
 
 		Math::Vec2<float> ratio( float( this -> size.x ) / float( newSize.x ), float( this -> size.y ) / float( newSize.y ) );
 
@@ -5367,12 +5453,6 @@ namespace Graphic {
 
 
 
-		// Lanczos Upscaling is not supported, switched to linear instead
-		if ( isUpscaling.x || isUpscaling.y )
-			resamplingMode = ResamplingMode::Bilinear;
-
-
-
 		switch ( resamplingMode ) {
 			///////////////////////////////////////////
 			//// NEAREST
@@ -5383,73 +5463,110 @@ namespace Graphic {
 
 
 					if ( !isUpscaling.x && !isUpscaling.y ) { // If downscaling
-						Math::Vec2<GSize> i, j;
-						Math::Vec2<float> realPosition( 0 );
-
-						for ( i.y = 0; i.y < newSize.y; i.y++ ) {
-							auto newImageIt1 = newImageIt0;
-							realPosition.x = 0.0f;
-							j.y = Size( realPosition.y );
-							realPosition.y += ratio.y;
-
-							auto thisImageIt1 = thisImageIt0 + j.y * this -> size.y;
-
-							for ( i.x = 0; i.x < newSize.x; i.x++ ) {
-								C & newImagePixel = *newImageIt1;
-
-								j.x = Size( realPosition.x );
-								realPosition.x += ratio.x;
+						// Each new row only reads this image, the bands of rows are independent.
+						struct ResampleFunc {
+							const C * thisImageIt0;
+							C * newImageIt0;
+							Math::Vec2<GSize> size;
+							Math::Vec2<GSize> newSize;
+							Math::Vec2<float> ratio;
+
+							void operator()( const Math::Interval<Size> & rowInterval ) {
+								Math::Vec2<GSize> i, j;
+								Math::Vec2<float> realPosition( 0 );
+
+								// Accumulate the position like the previous rows would have done, for the very same rounding.
+								for ( i.y = 0; i.y < GSize( rowInterval.getBegin() ); i.y++ )
+									realPosition.y += this -> ratio.y;
+
+								auto newImageIt0 = this -> newImageIt0 + i.y * this -> newSize.x;
+								for ( ; i.y < GSize( rowInterval.getEnd() ); i.y++ ) {
+									auto newImageIt1 = newImageIt0;
+									realPosition.x = 0.0f;
+									j.y = Size( realPosition.y );
+									realPosition.y += this -> ratio.y;
+
+									auto thisImageIt1 = this -> thisImageIt0 + j.y * this -> size.y;
+
+									for ( i.x = 0; i.x < this -> newSize.x; i.x++ ) {
+										C & newImagePixel = *newImageIt1;
+
+										j.x = Size( realPosition.x );
+										realPosition.x += this -> ratio.x;
+
+										auto thisImageIt2 = thisImageIt1 + j.x;
+										const C & thisImagePixel = *thisImageIt2;
+										newImagePixel = thisImagePixel;
 
-								auto thisImageIt2 = thisImageIt1 + j.x;
-								const C & thisImagePixel = *thisImageIt2;
-								newImagePixel = thisImagePixel;
+										newImageIt1++;
+									}
 
-								newImageIt1++;
+									newImageIt0 += this -> newSize.x;
+								}
 							}
+						};
 
-							newImageIt0 += newSize.x;
-						}
+						ResampleFunc resampleFunc{ thisImageIt0, newImageIt0, this -> size, newSize, ratio };
+						_runRows( newSize.y, resampleFunc, Size( newSize.x ) * Size( newSize.y ) );
 					} else if ( isUpscaling.x && isUpscaling.y ) { // If upscaling
+						// Each row of this image writes its own rows of the new one, the bands of rows are independent.
+						struct ResampleFunc {
+							const C * thisImageIt0;
+							C * newImageIt0;
+							Math::Vec2<GSize> size;
+							Math::Vec2<GSize> newSize;
+							Math::Vec2<float> ratioInverse;
+
+							void operator()( const Math::Interval<Size> & rowInterval ) {
+								Math::Vec2<GSize> i, k, j0, j1;
+								Math::Vec2<float> realPosition( 0 );
+
+								// Accumulate the position like the previous rows would have done, for the very same rounding.
+								for ( i.y = 0; i.y < GSize( rowInterval.getBegin() ); i.y++ )
+									realPosition.y += this -> ratioInverse.y;
+
+								j0.y = Size( realPosition.y );
+								auto thisImageIt0 = this -> thisImageIt0 + i.y * this -> size.x;
+								for ( ; i.y < GSize( rowInterval.getEnd() ); i.y++ ) {
+									auto thisImageIt1 = thisImageIt0;
+									auto newImageIt1 = this -> newImageIt0 + j0.y * this -> newSize.x;
+									realPosition.x = 0.0f;
+									realPosition.y += this -> ratioInverse.y;
+									j1.y = Size( realPosition.y );
+
+									j0.x = Size( 0 );
+
+									for ( i.x = 0; i.x < this -> size.x; i.x++ ) {
+										const C & thisImagePixel = *thisImageIt1;
+
+										auto newImageIt2 = newImageIt1 + j0.x;
+										realPosition.x += this -> ratioInverse.x;
+										j1.x = Size( realPosition.x );
 
-						Math::Vec2<GSize> i, k, j0, j1;
-						Math::Vec2<float> realPosition( 0 );
-
-						j0.y = Size( 0 );
-						for ( i.y = 0; i.y < this -> size.y; i.y++ ) {
-							auto thisImageIt1 = thisImageIt0;
-							auto newImageIt1 = newImageIt0 + j0.y * newSize.x;
-							realPosition.x = 0.0f;
-							realPosition.y += ratioInverse.y;
-							j1.y = Size( realPosition.y );
-
-							j0.x = Size( 0 );
-
-							for ( i.x = 0; i.x < this -> size.x; i.x++ ) {
-								const C & thisImagePixel = *thisImageIt1;
-
-								auto newImageIt2 = newImageIt1 + j0.x;
-								realPosition.x += ratioInverse.x;
-								j1.x = Size( realPosition.x );
-
-								for ( k.y = j0.y; k.y < j1.y; k.y++ ) {
-									auto newImageIt3 = newImageIt2;
-									for ( k.x = j0.x; k.x < j1.x; k.x++ ) {
+										for ( k.y = j0.y; k.y < j1.y; k.y++ ) {
+											auto newImageIt3 = newImageIt2;
+											for ( k.x = j0.x; k.x < j1.x; k.x++ ) {
 
-										ASSERT_SPP( k.x >= 0 && k.y >= 0 && k.x < newSize.x && k.y < newSize.y );
-										C & newImagePixel = *newImageIt3;
-										newImagePixel = thisImagePixel;
+												ASSERT_SPP( k.x >= 0 && k.y >= 0 && k.x < this -> newSize.x && k.y < this -> newSize.y );
+												C & newImagePixel = *newImageIt3;
+												newImagePixel = thisImagePixel;
 
-										newImageIt3++;
+												newImageIt3++;
+											}
+											newImageIt2 += this -> newSize.x;
+										}
+										j0.x = j1.x;
+										thisImageIt1++;
 									}
-									newImageIt2 += newSize.x;
+
+									j0.y = j1.y;
+									thisImageIt0 += this -> size.x;
 								}
-								j0.x = j1.x;
-								thisImageIt1++;
 							}
+						};
 
-							j0.y = j1.y;
-							thisImageIt0 += this -> size.x;
-						}
+						ResampleFunc resampleFunc{ thisImageIt0, newImageIt0, this -> size, newSize, ratioInverse };
+						_runRows( this -> size.y, resampleFunc, Size( newSize.x ) * Size( newSize.y ) );
 					} else if ( !isUpscaling.x && isUpscaling.y ) { //Upscaling Y, Downscaling X
 						Math::Vec2<GSize> i, k, j0, j1;
 						Math::Vec2<float> realPosition( 0 );
@@ -5528,120 +5645,155 @@ namespace Graphic {
 
 
 					if ( !isUpscaling.x && !isUpscaling.y ) { // If downscaling
-						Math::Vec2<int> i, j0, j1, k;
-						Math::Vec2<float> realPosition( 0 );
+						// Each new row only reads this image, the bands of rows are independent.
+						struct ResampleFunc {
+							const C * thisImageIt0;
+							C * newImageIt0;
+							Math::Vec2<GSize> size;
+							Math::Vec2<GSize> newSize;
+							Math::Vec2<float> ratio;
 
-						for ( i.y = 0; i.y < newSize.y; i.y++ ) {
-							auto newImageIt1 = newImageIt0;
+							void operator()( const Math::Interval<Size> & rowInterval ) {
+								Math::Vec2<int> i, j0, j1, k;
+								Math::Vec2<float> realPosition( 0 );
 
-							j0.y = int( realPosition.y );
-							realPosition.y += ratio.y;
-							j1.y = int( realPosition.y );
+								// Accumulate the position like the previous rows would have done, for the very same rounding.
+								for ( i.y = 0; i.y < int( rowInterval.getBegin() ); i.y++ )
+									realPosition.y += this -> ratio.y;
 
-							C * thisImageIt1 = ( ( C * ) ( thisImageIt0 ) ) + j0.y * this -> size.x;
+								auto newImageIt0 = this -> newImageIt0 + i.y * this -> newSize.x;
+								for ( ; i.y < int( rowInterval.getEnd() ); i.y++ ) {
+									auto newImageIt1 = newImageIt0;
 
-							realPosition.x = 0.0f;
+									j0.y = int( realPosition.y );
+									realPosition.y += this -> ratio.y;
+									j1.y = int( realPosition.y );
 
-							for ( i.x = 0; i.x < newSize.x; i.x++ ) {
-								C & newImagePixel = *newImageIt1;
+									const C * thisImageIt1 = this -> thisImageIt0 + j0.y * this -> size.x;
 
-								j0.x = int( realPosition.x );
-								realPosition.x += ratio.x;
-								j1.x = int( realPosition.x );
+									realPosition.x = 0.0f;
 
-								auto thisImageIt2 = thisImageIt1 + j0.x;
+									for ( i.x = 0; i.x < this -> newSize.x; i.x++ ) {
+										C & newImagePixel = *newImageIt1;
 
-								ColorSum sum( 0 );
-								SumType sumFactors = ( j1.x - j0.x ) * ( j1.y - j0.y );
-								for ( k.y = j0.y; k.y < j1.y; k.y++ ) {
-									auto thisImageIt3 = thisImageIt2;
-									for ( k.x = j0.x; k.x < j1.x; k.x++ ) {
-										const C & thisImagePixel = *thisImageIt3;
-										sum += ColorSum( thisImagePixel );
+										j0.x = int( realPosition.x );
+										realPosition.x += this -> ratio.x;
+										j1.x = int( realPosition.x );
+
+										auto thisImageIt2 = thisImageIt1 + j0.x;
 
-										thisImageIt3++;
+										ColorSum sum( 0 );
+										SumType sumFactors = ( j1.x - j0.x ) * ( j1.y - j0.y );
+										for ( k.y = j0.y; k.y < j1.y; k.y++ ) {
+											auto thisImageIt3 = thisImageIt2;
+											for ( k.x = j0.x; k.x < j1.x; k.x++ ) {
+												const C & thisImagePixel = *thisImageIt3;
+												sum += ColorSum( thisImagePixel );
+
+												thisImageIt3++;
+											}
+											thisImageIt2 += this -> size.x;
+										}
+
+										newImagePixel = ( sum ) / sumFactors;
+										newImageIt1++;
 									}
-									thisImageIt2 += this -> size.x;
-								}
 
-								newImagePixel = ( sum ) / sumFactors;
-								newImageIt1++;
+									newImageIt0 += this -> newSize.x;
+								}
 							}
+						};
 
-							newImageIt0 += newSize.x;
-						}
+						ResampleFunc resampleFunc{ thisImageIt0, newImageIt0, this -> size, newSize, ratio };
+						_runRows( newSize.y, resampleFunc, Size( this -> size.x ) * Size( this -> size.y ) );
 					} else if ( isUpscaling.x && isUpscaling.y ) {  // If Upscaling
+						// Each row of this image writes its own rows of the new one, the bands of rows are independent.
+						struct ResampleFunc {
+							const C * thisImageIt0;
+							C * newImageIt0;
+							Math::Vec2<GSize> size;
+							Math::Vec2<GSize> newSize;
+							Math::Vec2<float> ratioInverse;
 
-						Math::Vec2<int> i, j0, j1, k;
-						Math::Vec2<float> realPosition( 0 );
-						Math::Vec2<int> kernelSize;
+							void operator()( const Math::Interval<Size> & rowInterval ) {
+								Math::Vec2<int> i, j0, j1, k;
+								Math::Vec2<float> realPosition( 0 );
+								Math::Vec2<int> kernelSize;
 
+								auto maxX = this -> size.x - 1;
 
-						auto maxX = this -> size.x - 1;
-						auto maxY = this -> size.y - 1;
+								// Accumulate the position like the previous rows would have done, for the very same rounding.
+								for ( i.y = 0; i.y < int( rowInterval.getBegin() ); i.y++ )
+									realPosition.y += this -> ratioInverse.y;
 
-						for ( i.y = 0; i.y < maxY; i.y++ ) {
-							auto thisImageIt1 = thisImageIt0;
+								auto thisImageIt0 = this -> thisImageIt0 + i.y * this -> size.x;
+								for ( ; i.y < int( rowInterval.getEnd() ); i.y++ ) {
+									auto thisImageIt1 = thisImageIt0;
 
-							j0.y = int( realPosition.y );
-							realPosition.y += ratioInverse.y;
-							j1.y = int( realPosition.y );
+									j0.y = int( realPosition.y );
+									realPosition.y += this -> ratioInverse.y;
+									j1.y = int( realPosition.y );
 
-							kernelSize.y = j1.y - j0.y;
-							Float yRelativeIncr = Float( 1.0 ) / Float( kernelSize.y );
+									kernelSize.y = j1.y - j0.y;
+									Float yRelativeIncr = Float( 1.0 ) / Float( kernelSize.y );
 
-							auto newImageIt1 = ( ( C * ) ( newImageIt0 ) ) + ( j0.y ) * newSize.x;
+									auto newImageIt1 = this -> newImageIt0 + ( j0.y ) * this -> newSize.x;
 
-							realPosition.x = 0.0f;
-							for ( i.x = 0; i.x < maxX; i.x++ ) {
-								ColorFloat thisImagePixel00( *( thisImageIt1 ) );
+									realPosition.x = 0.0f;
+									for ( i.x = 0; i.x < maxX; i.x++ ) {
+										ColorFloat thisImagePixel00( *( thisImageIt1 ) );
 
-								j0.x = int( realPosition.x );
-								realPosition.x += ratioInverse.x;
-								j1.x = int( realPosition.x );
+										j0.x = int( realPosition.x );
+										realPosition.x += this -> ratioInverse.x;
+										j1.x = int( realPosition.x );
 
-								kernelSize.x = j1.x - j0.x;
+										kernelSize.x = j1.x - j0.x;
 
-								auto newImageIt2 = newImageIt1 + ( j0.x );
+										auto newImageIt2 = newImageIt1 + ( j0.x );
 
-								if ( kernelSize.x == 1 && kernelSize.y == 1 ) {
-									C & newImagePixel = *newImageIt2;
+										if ( kernelSize.x == 1 && kernelSize.y == 1 ) {
+											C & newImagePixel = *newImageIt2;
 
-									newImagePixel = C( thisImagePixel00 );
-								} else {
-									ColorFloat thisImagePixel10( *( thisImageIt1 + 1 ) );
-									ColorFloat thisImagePixel01( *( thisImageIt1 + this -> size.x ) );
-									ColorFloat thisImagePixel11( *( thisImageIt1 + this -> size.x + 1 ) );
+											newImagePixel = C( thisImagePixel00 );
+										} else {
+											ColorFloat thisImagePixel10( *( thisImageIt1 + 1 ) );
+											ColorFloat thisImagePixel01( *( thisImageIt1 + this -> size.x ) );
+											ColorFloat thisImagePixel11( *( thisImageIt1 + this -> size.x + 1 ) );
 
-									Float xRelativeIncr = Float( 1.0 ) / Float( kernelSize.x );
+											Float xRelativeIncr = Float( 1.0 ) / Float( kernelSize.x );
 
-									Float yRelative( 0 );
+											Float yRelative( 0 );
 
-									for ( k.y = j0.y; k.y < j1.y; k.y++ ) {
-										auto newImageIt3 = newImageIt2;
-										Float yRelativeInverse = Float( 1.0 ) - yRelative;
-										ColorFloat avg1( ( thisImagePixel00 ) * yRelativeInverse + ( thisImagePixel01 ) * yRelative );
-										ColorFloat avg2( ( thisImagePixel10 ) * yRelativeInverse + ( thisImagePixel11 ) * yRelative );
+											for ( k.y = j0.y; k.y < j1.y; k.y++ ) {
+												auto newImageIt3 = newImageIt2;
+												Float yRelativeInverse = Float( 1.0 ) - yRelative;
+												ColorFloat avg1( ( thisImagePixel00 ) * yRelativeInverse + ( thisImagePixel01 ) * yRelative );
+												ColorFloat avg2( ( thisImagePixel10 ) * yRelativeInverse + ( thisImagePixel11 ) * yRelative );
 
-										Float xRelative( 0 );
-										for ( k.x = j0.x; k.x < j1.x; k.x++ ) {
-											Float xRelativeInverse = Float( 1.0 ) - xRelative;
-											ColorSum avg3( avg1 * xRelativeInverse + avg2 * xRelative );
+												Float xRelative( 0 );
+												for ( k.x = j0.x; k.x < j1.x; k.x++ ) {
+													Float xRelativeInverse = Float( 1.0 ) - xRelative;
+													ColorSum avg3( avg1 * xRelativeInverse + avg2 * xRelative );
 
-											C & newImagePixel = *( newImageIt3 );
-											newImagePixel = avg3;
+													C & newImagePixel = *( newImageIt3 );
+													newImagePixel = avg3;
 
-											xRelative += xRelativeIncr;
-											newImageIt3++;
+													xRelative += xRelativeIncr;
+													newImageIt3++;
+												}
+												yRelative += yRelativeIncr;
+												newImageIt2 += this -> newSize.x;
+											}
 										}
-										yRelative += yRelativeIncr;
-										newImageIt2 += newSize.x;
+										thisImageIt1++;
 									}
+									thisImageIt0 += this -> size.x;
 								}
-								thisImageIt1++;
 							}
-							thisImageIt0 += this -> size.x;
-						}
+						};
+
+						ResampleFunc resampleFunc{ thisImageIt0, newImageIt0, this -> size, newSize, ratioInverse };
+						_runRows( this -> size.y - 1, resampleFunc, Size( newSize.x ) * Size( newSize.y ) );
 
 					} else if ( !isUpscaling.x && isUpscaling.y ) {  //Upscaling Y, Downscaling X
 						Math::Vec2<int> i, j0, j1, k;
@@ -5810,138 +5962,164 @@ namespace Graphic {
 
 					break;
 				}
+		}
+		return newImage;
+	}
 
-				///////////////////////////////////////////
-				//// LANCZOS
-				///////////////////////////////////////////
-			case ResamplingMode::Lanczos:
-				{
-					static constexpr Float MIN( Color<Float>::getMin() );
-					struct Max {
-						ColorR<Float> operator()( const ColorR<Float> & c ) {
-							return ColorR<Float>( Math::max( c.r, MIN ) );
-						}
-						ColorRGB<Float> operator()( const ColorRGB<Float> & c ) {
-							return ColorRGB<Float>( Math::max( c.r, MIN ), Math::max( c.g, MIN ), Math::max( c.b, MIN ) );
-						}
-						ColorRGBA<Float> operator()( const ColorRGBA<Float> & c ) {
-							return ColorRGBA<Float>( Math::max( c.r, MIN ), Math::max( c.g, MIN ), Math::max( c.b, MIN ), Math::max( c.a, MIN ) );
-						}
-					};
-
-					Max maxFunctor;
-
-					Math::Vec2<float> ratioHalf( ratio.x * 0.7f, ratio.y * 0.7f );
-					Math::Vec2<Float> distanceDivider( Float( 1.1 ) * Float( 50 ) );
-
-
-
-
-					Math::Vec2<int> kernelSize( ratioHalf.x * 2.0f + 0.5f, ratioHalf.y * 2.0f + 0.5f );
-
+	template<typename T>
+	template<typename C>
+	ImageT<T> ImageT<T>::_resampleWeighted( const Math::Vec2<GSize> & newSize, typename ResamplingWeightsT<Float>::Filter filter ) const {
+		typedef Float F;
+		constexpr Size nbComponents( sizeof( C ) / sizeof( T ) );
 
+		const ResamplingWeightsT<F> * weightsX( ResamplingWeightsT<F>::acquire( this -> size.x, newSize.x, filter ) );
+		const ResamplingWeightsT<F> * weightsY( ResamplingWeightsT<F>::acquire( this -> size.y, newSize.y, filter ) );
 
-					distanceDivider.x /= Float( ratio.x );
-					distanceDivider.y /= Float( ratio.y );
+		ImageT<T> newImage( newSize, getFormat() );
 
+		// Result of the horizontal pass : every row of this image at the new width.
+		const Size nbComponentsPerRowTmp( Size( newSize.x ) * nbComponents );
+		F * imageTmp( new F[ nbComponentsPerRowTmp * Size( this -> size.y ) ] );
 
-					struct Lanczos {
-						Lanczos() {
-							constexpr Float A( 3.0f );
-							lanczosValues[0] = Float( 1.0 );
-							for ( int i = 1; i < 100; i++ ) {
-								Float x = Float( i ) / Float( 50 );
-								lanczosValues[i] = ( A * Math::sin( Math::pi() * x ) * Math::sin( ( Math::pi() * x ) / A ) ) / ( Math::pi() * Math::pi() * x * x );
-							}
-						}
-						Float operator()( int i ) {
-							ASSERT_SPP( i >= 0 && i < 100 );
-							return lanczosValues[i];
+		// Each row of this image is resampled to a row of the temporary one, the bands of rows are independent.
+		struct HorizontalFunc {
+			const T * thisImageIt0;
+			F * imageTmpIt0;
+			const ResamplingWeightsT<F> * weightsX;
+			Math::Vec2<GSize> size;
+			Math::Vec2<GSize> newSize;
+
+			void operator()( const Math::Interval<Size> & rowInterval ) {
+				const Size nbComponentsPerRow( Size( this -> size.x ) * nbComponents );
+				const Size nbComponentsPerRowTmp( Size( this -> newSize.x ) * nbComponents );
+
+				for ( Size y( rowInterval.getBegin() ); y < rowInterval.getEnd(); y++ ) {
+					const T * thisImageIt( this -> thisImageIt0 + y * nbComponentsPerRow );
+					F * imageTmpIt( this -> imageTmpIt0 + y * nbComponentsPerRowTmp );
+
+					for ( GSize x( 0 ); x < this -> newSize.x; x++ ) {
+						const T * pixelIt( thisImageIt + Size( this -> weightsX -> getFirst( x ) ) * nbComponents );
+						const F * weightIt( this -> weightsX -> getWeights( x ) );
+						const GSize nbWeights( this -> weightsX -> getNbWeights( x ) );
+
+						// The number of components being a constant, the compiler keeps the sums in registers.
+						F sum[ nbComponents ];
+						for ( Size c( 0 ); c < nbComponents; c++ )
+							sum[ c ] = F( 0 );
+						for ( GSize k( 0 ); k < nbWeights; k++ ) {
+							const F weight( weightIt[ k ] );
+							for ( Size c( 0 ); c < nbComponents; c++ )
+								sum[ c ] += F( pixelIt[ c ] ) * weight;
+							pixelIt += nbComponents;
 						}
+						for ( Size c( 0 ); c < nbComponents; c++ )
+							imageTmpIt[ c ] = sum[ c ];
+						imageTmpIt += nbComponents;
+					}
+				}
+			}
+		};
 
-						Float lanczosValues[100];
-					};
-
-					static Lanczos lanczosFunc;
-
-
-					if ( !isUpscaling.x && !isUpscaling.y ) { // If downscaling
-						Math::Vec2<int> i, j0, j1, k;
-						Math::Vec2<Float> j, j0f;
-						Math::Vec2<Float> realPositionInit( ( ratio.x ) / Float( 2.0 ), ( Float( ratio.y ) ) / Float( 2.0 ) );
-
-
-						KernelFunc::Max kernelFunctor;
-
-						j.y = realPositionInit.y;
-						j0f.y = j.y - ratioHalf.y + 0.5f;
-						for ( i.y = 0; i.y < newSize.y; i.y++ ) {
-							auto newImageIt1 = newImageIt0;
-
-							j0.y = Math::max<int>( int( j0f.y ), int( 0 ) );
-							j1.y = Math::min<int>( int( j0.y ) + kernelSize.y, int( this -> size.y ) );
-
-							ASSERT_SPP( j1.y <= this -> size.y && j0.y >= 0 );
-							if ( true ) {
-								auto thisImageIt1 = ( ( C * ) ( thisImageIt0 ) ) + j0.y * this -> size.x;
-
-								j.x = realPositionInit.x;
-								j0f.x = j.x - ratioHalf.x + 0.5f;
-
-								for ( i.x = 0; i.x < newSize.x; i.x++ ) {
-									C & newImagePixel = *newImageIt1;
-
-									j0.x = Math::max<int>( int( j0f.x ), int( 0 ) );
-									j1.x = Math::min<int>( int( j0.x ) + kernelSize.x, int( this -> size.x ) );
-
-									ASSERT_SPP( j1.x <= this -> size.x && j1.x >= 0 );
-									if ( true ) {
-										auto thisImageIt2 = thisImageIt1 + j0.x;
-
-										ColorFloat sum( 0 );
-										Float sumFactors( 0 );
-
-										for ( k.y = j0.y; k.y < j1.y; k.y++ ) {
-											auto thisImageIt3 = thisImageIt2;
-
-											Float disty = Float( Float( k.y ) - j.y ) * distanceDivider.y;
-											Float factorY( lanczosFunc( Math::abs( int( disty ) ) ) );
+		// Each new row is the weighted sum of rows of the temporary image, the bands of rows are independent.
+		struct VerticalFunc {
+			const F * imageTmpIt0;
+			T * newImageIt0;
+			const ResamplingWeightsT<F> * weightsY;
+			Math::Vec2<GSize> newSize;
+
+			void operator()( const Math::Interval<Size> & rowInterval ) {
+				const Size nbComponentsPerRow( Size( this -> newSize.x ) * nbComponents );
+				F * sumIt( new F[ nbComponentsPerRow ] );
+
+				// Bicubic and Lanczos have negative lobes, the results are clamped.
+				const F minValue( F( Color<T>::getMin() ) );
+				const F maxValue( Utility::TypesInfos<T>::isInteger() ? F( Color<T>::getMax() ) : F( 0 ) );
+				const F rounding( Utility::TypesInfos<T>::isInteger() ? F( 0.5 ) : F( 0 ) );
+
+				for ( Size y( rowInterval.getBegin() ); y < rowInterval.getEnd(); y++ ) {
+					const F * weightIt( this -> weightsY -> getWeights( GSize( y ) ) );
+					const GSize nbWeights( this -> weightsY -> getNbWeights( GSize( y ) ) );
+					const F * imageTmpIt( this -> imageTmpIt0 + Size( this -> weightsY -> getFirst( GSize( y ) ) ) * nbComponentsPerRow );
+
+					for ( Size i( 0 ); i < nbComponentsPerRow; i++ )
+						sumIt[ i ] = F( 0 );
+					for ( GSize k( 0 ); k < nbWeights; k++ ) {
+						_accumulateRow( sumIt, imageTmpIt, weightIt[ k ], nbComponentsPerRow );
+						imageTmpIt += nbComponentsPerRow;
+					}
 
+					T * newImageIt( this -> newImageIt0 + y * nbComponentsPerRow );
+					for ( Size i( 0 ); i < nbComponentsPerRow; i++ ) {
+						F value( Math::max( sumIt[ i ], minValue ) );
+						if ( Utility::TypesInfos<T>::isInteger() )
+							value = Math::min( value, maxValue );
+						newImageIt[ i ] = T( value + rounding );
+					}
+				}
 
-											for ( k.x = j0.x; k.x < j1.x; k.x++ ) {
-												const C & thisImagePixel = *thisImageIt3;
+				delete[] sumIt;
+			}
+		};
 
-												Float distx = Float( Float( k.x ) - j.x ) * distanceDivider.x;
-												Float factorX( lanczosFunc( Math::abs( int( distx ) ) ) );
+		HorizontalFunc horizontalFunc{ getDatas(), imageTmp, weightsX, this -> size, newSize };
+		_runRows( this -> size.y, horizontalFunc, Size( newSize.x ) * Size( this -> size.y ) * nbComponents * Size( weightsX -> getNbWeights( 0 ) ) );
 
-												Float factor = factorY * factorX;
+		VerticalFunc verticalFunc{ imageTmp, newImage.getDatas(), weightsY, newSize };
+		_runRows( newSize.y, verticalFunc, Size( newSize.x ) * Size( newSize.y ) * nbComponents * Size( weightsY -> getNbWeights( 0 ) ) );
 
-												sum += ColorFloat( thisImagePixel ) * factor;
-												sumFactors += factor;
-												thisImageIt3++;
-											}
-											thisImageIt2 += this -> size.x;
-										}
-										j.x += ratio.x;
-										j0f.x += ratio.x;
+		delete[] imageTmp;
 
+		ResamplingWeightsT<F>::release( weightsX );
+		ResamplingWeightsT<F>::release( weightsY );
 
+		return newImage;
+	}
 
-										newImagePixel = C( maxFunctor( ColorFloat( sum / sumFactors ) ) );
-									}
-									newImageIt1++;
-								}
-							}
-							j.y += ratio.y;
-							j0f.y += ratio.y;
+	template<typename T>
+	template<typename F>
+	void ImageT<T>::_accumulateRow( F * sumIt, const F * rowIt, const F & weight, Size nbValues ) {
+		for ( Size i( 0 ); i < nbValues; i++ )
+			sumIt[ i ] += rowIt[ i ] * weight;
+	}
 
-							newImageIt0 += newSize.x;
-						}
-					}
+	template<typename T>
+	void ImageT<T>::_accumulateRow( float * sumIt, const float * rowIt, const float & weight, Size nbValues ) {
+		// A multiplication then an addition by value (no fused multiply-add), the vectorized results are the same as the scalar ones.
+		Size i( 0 );
+		switch ( CPU::getIsa() ) {
+#if defined GRAPHIC_OPS_AVX2
+			case CPU::Isa::AVX2:
+				{
+					const __m256 weight8( _mm256_set1_ps( weight ) );
+					for ( ; i + Size( 8 ) <= nbValues; i += Size( 8 ) )
+						_mm256_storeu_ps( sumIt + i, _mm256_add_ps( _mm256_loadu_ps( sumIt + i ), _mm256_mul_ps( _mm256_loadu_ps( rowIt + i ), weight8 ) ) );
+					break;
+				}
+#endif
+#if defined GRAPHIC_OPS_SSE2
+			case CPU::Isa::AVX:
+			case CPU::Isa::SSE2:
+				{
+					const __m128 weight4( _mm_set1_ps( weight ) );
+					for ( ; i + Size( 4 ) <= nbValues; i += Size( 4 ) )
+						_mm_storeu_ps( sumIt + i, _mm_add_ps( _mm_loadu_ps( sumIt + i ), _mm_mul_ps( _mm_loadu_ps( rowIt + i ), weight4 ) ) );
+					break;
+				}
+#endif
+#if defined CPU_NEON
+			case CPU::Isa::NEON:
+				{
+					const float32x4_t weight4( vdupq_n_f32( weight ) );
+					for ( ; i + Size( 4 ) <= nbValues; i += Size( 4 ) )
+						vst1q_f32( sumIt + i, vaddq_f32( vld1q_f32( sumIt + i ), vmulq_f32( vld1q_f32( rowIt + i ), weight4 ) ) );
 					break;
 				}
+#endif
+			default:
+				break;
 		}
-		return newImage;
+		for ( ; i < nbValues; i++ )
+			sumIt[ i ] += rowIt[ i ] * weight;
 	}
 
 
@@ -5953,298 +6131,81 @@ namespace Graphic {
 	template<typename ColorFunc, typename BlendFunc>
 	void ImageT<T>::drawPolygonFunctor( const Math::Vec2<float> * vertices, Size nbVertices, const Rectangle & rectangle, ColorFunc & colorFunc, BlendFunc & blendFunc ) {
 		if ( getDatas() == NULL ) return;
+
+		// Compute the absolute coordinate from the relatives [0;1] and the size of the rectangle.
+		const Math::Vec2<float> size( float( rectangle.getRight() - rectangle.getLeft() ), float( rectangle.getTop() - rectangle.getBottom() ) );
+		const Math::Vec2<float> origin( float( rectangle.getLeft() ), float( rectangle.getBottom() ) );
+		Math::Vec2<float> * absoluteVertices = new Math::Vec2<float>[nbVertices];
+		for ( Size i = 0; i < nbVertices; i++ ) {
+			absoluteVertices[i] = origin + vertices[i] * size;
+		}
+
+		Rasterizer rasterizer;
+		rasterizer.addPolygon( absoluteVertices, nbVertices );
+		delete[] absoluteVertices;
+
+		drawRasterizerFunctor( rasterizer, rectangle, colorFunc, FillRule::NonZero, blendFunc );
+	}
+
+	template<typename T>
+	template<typename ColorFunc, typename BlendFunc>
+	void ImageT<T>::drawRasterizerFunctor( const Rasterizer & rasterizer, const Rectangle & rectangle, ColorFunc & colorFunc, FillRule fillRule, const BlendFunc & blendFunc ) {
+		if ( getDatas() == NULL ) return;
 		switch ( getFormat() ) {
 			case Format::R:
-				return _drawPolygonFunctor<ColorFunc, BlendFunc, ColorR<T>>( vertices, nbVertices, rectangle, colorFunc, blendFunc );
+				return _drawRasterizerFunctor<ColorFunc, BlendFunc, ColorR<T>>( rasterizer, rectangle, colorFunc, fillRule, blendFunc );
 			case Format::RGB:
-				return _drawPolygonFunctor<ColorFunc, BlendFunc, ColorRGB<T>>( vertices, nbVertices, rectangle, colorFunc, blendFunc );
+				return _drawRasterizerFunctor<ColorFunc, BlendFunc, ColorRGB<T>>( rasterizer, rectangle, colorFunc, fillRule, blendFunc );
 			case Format::RGBA:
-				return _drawPolygonFunctor<ColorFunc, BlendFunc, ColorRGBA<T>>( vertices, nbVertices, rectangle, colorFunc, blendFunc );
+				return _drawRasterizerFunctor<ColorFunc, BlendFunc, ColorRGBA<T>>( rasterizer, rectangle, colorFunc, fillRule, blendFunc );
 		}
 	}
 
-
-
-
-
 	template<typename T>
 	template<typename ColorFunc, typename BlendFunc, typename C1>
-	void ImageT<T>::_drawPolygonFunctor( const Math::Vec2<float> * vertices, Size nbVertices, const Rectangle & rectangle, ColorFunc & colorFunc, BlendFunc & blendFunc ) {
-		auto clampedRectangle = clampRectangle( rectangle );
-		auto size = clampedRectangle.getRightTop() - clampedRectangle.getLeftBottom();
-
-
-		struct Vertex {
-
-			Float dx;
-			Math::Vec2<Float> v;
-
-		};
-
-		Vertex * absoluteVertices = new Vertex[nbVertices];
-		Float * intersectionsDx = new Float[nbVertices];
-		Float * intersectionsX = new Float[nbVertices];
-
-
-		Math::Vec2<GSize> sizeMinusOne( size.x - 1, size.y - 1 );
-
-		// Compute the absolute coordinate from the relatives [0;1] and the size of the rectangle.
-		Math::Vec2<Float> v0Last = vertices[nbVertices - 1];
-		for ( unsigned int i = 0; i < nbVertices; i++ ) {
-			Vertex & v1 = absoluteVertices[i];
-			const Math::Vec2<float> & v0( vertices[i] );
-
-			v1.v.x = v0.x * size.x;
-			v1.v.y = v0.y * size.y;
-
-			Float dx = ( v0.x - v0Last.x );
-			Float dy = ( v0.y - v0Last.y );
-
-			v1.dx = dx / dy;
-
-			v0Last = v0;
-		}
-
-
-		C1 * p0it = ( ( C1 * ) this -> buffer ) + clampedRectangle.getBottom() * this -> size.x + clampedRectangle.getLeft();
-
-
-
-		// For each line, compute the intersections.
-		Math::Vec2<GSize> i;
-		for ( i.y = 0; i.y < size.y; i.y++ ) {
-			auto intersectionsDxIt = intersectionsDx;
-			auto intersectionsXIt = intersectionsX;
-			Float yf = Float( i.y );
-
-
-			Math::Vec2<Float> vertexLast = absoluteVertices[nbVertices - 1].v;
-			for ( GSize j = 0; j < nbVertices; j++ ) {
-				Vertex & vertex = absoluteVertices[j];
-
-				if ( ( yf < vertex.v.y && yf >= vertexLast.y ) || ( yf < vertexLast.y && yf >= vertex.v.y ) ) {
-					intersectionsXIt[0] = ( vertexLast.x + ( yf - vertexLast.y ) * vertex.dx );
-					intersectionsDxIt[0] = vertex.dx;
-					intersectionsXIt++;
-					intersectionsDxIt++;
-				}
-				vertexLast = vertex.v;
-			}
-
-
-
-
-
-			// Now we have all the intersections for a specified line. Let's order them with an insertion sort.
-			auto nbIntersections = intersectionsXIt - intersectionsX;
-
-			unsigned int j, k;
-			for ( j = 1; j < nbIntersections; j++ ) {
-				k = j;
-
-				while ( k > 0 && intersectionsX[k - 1] > intersectionsX[k] ) {
-					Utility::swap( intersectionsDx[k - 1], intersectionsDx[k] );
-					Utility::swap( intersectionsX[k - 1], intersectionsX[k] );
-
-					j--;
+	void ImageT<T>::_drawRasterizerFunctor( const Rasterizer & rasterizer, const Rectangle & rectangle, ColorFunc & colorFunc, FillRule fillRule, const BlendFunc & blendFunc ) {
+		typedef typename ColorFunc::Color C2;
+
+		// Receive the spans of a row, fetch their colors and blend them in one go with their coverage as mask.
+		struct SpanFunc {
+			inline void operator()( GSize y, GSize x, GSize nbPixels, const float * coverage ) {
+				const Math::Vec2<GSize> relative( x - rectangle.getLeft(), y - rectangle.getBottom() );
+				for ( GSize i( 0 ); i < nbPixels; i++ ) {
+					colorBuffer[ i ] = colorFunc( Math::Vec2<GSize>( relative.x + i, relative.y ) );
 				}
-			}
-
-
-			for ( GSize j = 1; j < nbIntersections; j += 2 ) {
-
-				Float & intersection0 = intersectionsX[j - 1];
-				Float & intersection1 = intersectionsX[j];
-
-				//If the zone to draw is less than one pixel
-				if ( intersection1 - intersection0 < 1.0f ) {
-
-					Float opacity = intersection1 - intersection0;
-					if ( opacity == 0.0f ) continue;
-					i.x = Size( ( intersection0 + intersection1 ) / 2 );
-
-					C1 * p1it = p0it + i.x;
-					ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-					blendFunc( *p1it, colorFunc( i ), opacity );
-
+				C1 * dataIt( ( ( C1 * ) buffer ) + y * width + x );
+				if ( coverage == NULL ) {
+					BlendingFunc::blendSpan( blendFunc, dataIt, colorBuffer, Size( nbPixels ) );
 				} else {
-					Float & intersectionDx0 = intersectionsDx[j - 1];
-					Float & intersectionDx1 = intersectionsDx[j];
-
-					intersection0 += 0.5f;
-					intersection1 += 0.5f;
-
-
-					Float gradient1 = Math::abs( intersectionDx1 );
-					Float gradient0 = Math::abs( intersectionDx0 );
-
-					int xMin, xMax;
-
-					// First Intersection !
-
-
-					//If the gradient is bigger than One, anti aliasing is easy
-					if ( gradient0 < 1.0f ) {
-						int intersection0i = int( intersection0 );
-
-
-						i.x = intersection0i;
-						Float opacity = ( intersection0 ) -Float( intersection0i );
-
-						C1 * p1it = p0it + i.x;
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *p1it, colorFunc( i ), 1.0f - opacity );
-
-						xMin = i.x + 1;
-					} else {
-						//the gradient is lower than 1.0, two possibilities here, Up or Down
-
-
-						if ( intersectionDx0 > 0.0f ) {
-
-
-							int intersection0i = int( intersection0 );
-							int intersection0Beforei = Math::max<int>( int( intersection0 - intersectionDx0 ), 0 );
-
-							Float incr = 1.0f / Float( intersection0i - intersection0Beforei );
-							Float opacity = 0.0f;
-
-							i.x = intersection0Beforei;
-
-							xMax = i.x;
-
-							C1 * p1it = p0it + i.x;
-							for ( ; i.x < intersection0i; i.x++ ) {
-
-								ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-								blendFunc( *p1it, colorFunc( i ), opacity );
-
-								opacity += incr;
-								p1it++;
-							}
-							xMin = i.x;
-						} else {
-							int intersection0i = int( intersection0 );
-							int intersection0Afteri = Math::max<int>( int( intersection0 + intersectionDx0 ), 0 );
-
-
-							Float incr = 1.0f / Float( intersection0i - intersection0Afteri );
-							Float opacity = 0.0f;
-
-							i.x = intersection0Afteri;
-
-							C1 * p1it = p0it + i.x;
-							for ( ; i.x < intersection0i; i.x++ ) {
-
-								ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-								blendFunc( *p1it, colorFunc( i ), opacity );
-
-								opacity += incr;
-								p1it++;
-							}
-							xMin = i.x;
-
-						}
-
-
-					}
-
-
-
-
-					// Second Intersection !
-
-					//If the gradient is bigger than One, anti aliasing is easy
-
-					if ( gradient1 < 1.0f ) {
-						int intersection1i = int( intersection1 );
-
-						i.x = Math::max<GSize>( intersection1i, xMin );
-						Float opacity = ( intersection1 ) -Float( intersection1i );
-
-						C1 * p1it = p0it + i.x;
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *p1it, colorFunc( i ), opacity );
-
-						xMax = i.x;
-					} else {
-
-						//the gradient is lower than 1.0, two possibilities here, Up or Down
-						if ( intersectionDx1 > 0.0f ) {
-							int intersection1i = int( intersection1 );
-							int intersection1Afteri = Math::min<int>( int( intersection1 + intersectionDx1 ), size.x );
-
-							Float incr = 1.0f / ( intersection1Afteri - intersection1i );
-							Float opacity = 1.0f;
-
-							i.x = Math::max<int>( intersection1i, xMin );
-							xMax = i.x;
-
-							C1 * p1it = p0it + i.x;
-							for ( ; i.x < intersection1Afteri; i.x++ ) {
-
-								ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-								blendFunc( *p1it, colorFunc( i ), opacity );
-
-								opacity -= incr;
-								p1it++;
-							}
-						} else {
-							int intersection1i = int( intersection1 );
-							int intersection1Beforei = Math::min<int>( int( intersection1 - intersectionDx1 ), size.x );
-
-
-
-							Float incr = 1.0f / ( intersection1Beforei - intersection1i );
-							Float opacity = 1.0f;
-
-							i.x = Math::max<int>( intersection1i, xMin );
-							xMax = i.x;
-
-							C1 * p1it = p0it + i.x;
-							for ( ; i.x < intersection1Beforei; i.x++ ) {
-
-								ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-								blendFunc( *p1it, colorFunc( i ), opacity );
-
-								opacity -= incr;
-								p1it++;
-							}
-
-						}
-					}
-
-					// Fill the inside !
-					i.x = xMin;
-					C1 * p1it = p0it + i.x;
-
-					for ( ; i.x < xMax; i.x++ ) {
-						ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-						blendFunc( *p1it, colorFunc( i ) );
-						p1it++;
+					for ( GSize i( 0 ); i < nbPixels; i++ ) {
+						maskBuffer[ i ] = ( Utility::TypesInfos<T>::isInteger() ) ? T( coverage[ i ] * float( Color<T>::getMax() ) + 0.5f ) : T( coverage[ i ] * float( Color<T>::getMax() ) );
 					}
+					BlendingFunc::blendSpan( blendFunc, dataIt, colorBuffer, maskBuffer, Size( 1 ), Size( nbPixels ) );
 				}
-
-				/*// Fill the inside !
-				i.x = int(intersection0);
-
-				for ( ; i.x < int( intersection1 ); i.x++ ) {
-					C1 * p1it = p0it + i.y * this -> size.x + i.x;
-					ASSERT_SPP( i.x >= 0 && i.y >= 0 && i.x < size.x && i.y < size.y );
-					blendFunc( *p1it, colorFunc( i ) );
-				}*/
 			}
 
+			const Math::Rectangle<GSize> & rectangle;
+			ColorFunc & colorFunc;
+			const BlendFunc & blendFunc;
+			T * buffer;
+			GSize width;
+			C2 * colorBuffer;
+			T * maskBuffer;
+		};
 
-			p0it += this -> size.x;
-		}
-
+		const Math::Rectangle<GSize> clampedRectangle( clampRectangle( rectangle ) );
+		const GSize width( clampedRectangle.getRight() - clampedRectangle.getLeft() );
+		if ( width <= GSize( 0 ) || clampedRectangle.getTop() <= clampedRectangle.getBottom() ) return;
 
+		colorFunc.init( clampedRectangle );
 
+		C2 * colorBuffer( new C2[ width ] );
+		T * maskBuffer( new T[ width ] );
+		SpanFunc spanFunc{ clampedRectangle, colorFunc, blendFunc, this -> buffer, this -> size.x, colorBuffer, maskBuffer };
+		rasterizer.rasterize( clampedRectangle, fillRule, spanFunc );
 
-		delete[] intersectionsDx;
-		delete[] intersectionsX;
-		delete[] absoluteVertices;
+		delete[] colorBuffer;
+		delete[] maskBuffer;
 	}
 
 
@@ -6445,32 +6406,32 @@ namespace Graphic {
 
 	template<typename T>
 	template<typename BlendFunc>
-	void ImageT<T>::drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorR<T> & color, const BlendFunc & blendFunc ) {
-		return drawImageShadowFunctor<ColorFunc::SimpleColor<ColorR<T>>>( point, thickness, image, ColorFunc::SimpleColor<ColorR<T>>( color ), blendFunc );
+	void ImageT<T>::drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorR<T> & color, const BlendFunc & blendFunc, BlurMode blurMode ) {
+		return drawImageShadowFunctor<ColorFunc::SimpleColor<ColorR<T>>>( point, thickness, image, ColorFunc::SimpleColor<ColorR<T>>( color ), blendFunc, blurMode );
 	}
 
 	template<typename T>
 	template<typename BlendFunc>
-	void ImageT<T>::drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGB<T> & color, const BlendFunc & blendFunc ) {
-		return drawImageShadowFunctor<ColorFunc::SimpleColor<ColorRGB<T>>>( point, thickness, image, ColorFunc::SimpleColor<ColorRGB<T>>( color ), blendFunc );
+	void ImageT<T>::drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGB<T> & color, const BlendFunc & blendFunc, BlurMode blurMode ) {
+		return drawImageShadowFunctor<ColorFunc::SimpleColor<ColorRGB<T>>>( point, thickness, image, ColorFunc::SimpleColor<ColorRGB<T>>( color ), blendFunc, blurMode );
 	}
 
 	template<typename T>
 	template<typename BlendFunc>
-	void ImageT<T>::drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGBA<T> & color, const BlendFunc & blendFunc ) {
-		return drawImageShadowFunctor<ColorFunc::SimpleColor<ColorRGBA<T>>>( point, thickness, image, ColorFunc::SimpleColor<ColorRGBA<T>>( color ), blendFunc );
+	void ImageT<T>::drawImageShadow( const Point & point, unsigned int thickness, const ImageT<T> & image, const ColorRGBA<T> & color, const BlendFunc & blendFunc, BlurMode blurMode ) {
+		return drawImageShadowFunctor<ColorFunc::SimpleColor<ColorRGBA<T>>>( point, thickness, image, ColorFunc::SimpleColor<ColorRGBA<T>>( color ), blendFunc, blurMode );
 	}
 
 
 	template<typename T>
 	template<typename ColorFunc, typename BlendFunc >
-	void ImageT<T>::drawImageShadowFunctor( const Point & point, unsigned int radius, const ImageT<T> & image, ColorFunc & colorFunc, const BlendFunc & blendFunc ) {
+	void ImageT<T>::drawImageShadowFunctor( const Point & point, unsigned int radius, const ImageT<T> & image, ColorFunc & colorFunc, const BlendFunc & blendFunc, BlurMode blurMode ) {
 		if ( getDatas() == NULL || image.getDatas() == NULL ) return;
 
 		if ( image.getFormat() == Format::R ) {
 			Point finalPoint( point.x - radius, point.y - radius );
 			if ( radius ) {
-				ImageT<T> imageBlured( image.applyGaussianBlur( radius, ImageT<T>::ConvolutionMode::ExtendedSize ) );
+				ImageT<T> imageBlured( image.applyGaussianBlur( radius, ImageT<T>::ConvolutionMode::ExtendedSize, ColorRGBA<T>::black, blurMode ) );
 				drawImageFunctor( finalPoint, colorFunc, Rectangle( imageBlured.getSize() ), imageBlured, blendFunc );
 			} else {
 				drawImageFunctor( finalPoint, colorFunc, Rectangle( image.getSize() ), image, blendFunc );
@@ -6479,7 +6440,7 @@ namespace Graphic {
 			ImageT<T> imageCopy( image.toFormat( Format::R, ColorConvertFunc::Alpha() ) );
 			Point finalPoint( point.x - radius, point.y - radius );
 			if ( radius ) {
-				ImageT<T> imageBlured( imageCopy.applyGaussianBlur( radius, ImageT<T>::ConvolutionMode::ExtendedSize ) );
+				ImageT<T> imageBlured( imageCopy.applyGaussianBlur( radius, ImageT<T>::ConvolutionMode::ExtendedSize, ColorRGBA<T>::black, blurMode ) );
 				drawImageFunctor( finalPoint, colorFunc, Rectangle( imageBlured.getSize() ), imageBlured, blendFunc );
 			} else {
 				drawImageFunctor( finalPoint, colorFunc, Rectangle( imageCopy.getSize() ), imageCopy, blendFunc );
@@ -0,0 +1,93 @@
+///@file Rasterizer.h
+///@brief Declares a scanline rasterizer of polygons with exact area coverage antialiasing.
+#pragma once
+
+#include "../Vector.h"
+#include "../Math/Math.h"
+#include "../Math/Rectangle.h"
+#include "BasicGraphic.h"
+
+namespace Graphic {
+
+	///@brief Rules deciding which parts of overlapping or self intersecting polygons are inside.
+	enum class FillRule : unsigned char {
+		NonZero,	///< Inside where the winding number is not zero (the overlapping polygons are merged).
+		EvenOdd		///< Inside where the winding number is odd (the overlapping parts are holes).
+	};
+
+	///@brief Scanline rasterizer of polygons, any number of them being drawn together (a whole chart, the stroke of a curve...).
+	///			The edges are sorted by their top and only the ones crossing the current row are kept in an active edge table.
+	///			For each row, the exact area covered by the edges is accumulated by pixel in a coverage buffer, its prefix sum being the winding number.
+	///			The pixels are then given by spans, the fully covered ones without any coverage to be drawn in one go.
+	///			The coordinates are in pixels, a pixel (x, y) covering [x, x + 1[ * [y, y + 1[.
+	///@template F Type of the coordinates and coverages.
+	template<typename F = float>
+	class RasterizerT {
+	public:
+		///@brief Create an empty rasterizer.
+		RasterizerT();
+
+		///@brief Add a closed polygon, the last vertex being linked to the first one.
+		///@param vertices Vertices of the polygon.
+		///@param nbVertices Number of vertices.
+		void addPolygon( const Math::Vec2<F> * vertices, Size nbVertices );
+
+		///@brief Add a single edge (the polygons have to be closed to be filled correctly).
+		///@param p0 Beginning of the edge.
+		///@param p1 End of the edge.
+		void addEdge( const Math::Vec2<F> & p0, const Math::Vec2<F> & p1 );
+
+		///@brief Remove every edge.
+		void clear();
+
+		///@brief Get the number of non horizontal edges added.
+		///@return Number of edges.
+		Size getNbEdges() const;
+
+		///@brief Rasterize the polygons inside a rectangle, row by row.
+		///@param clipRectangle Rectangle of pixels to be rasterized.
+		///@param fillRule Rule deciding the inside of the polygons.
+		///@param spanFunc Functor with operator() overloaded with : void operator()( GSize y, GSize x, GSize nbPixels, const F * coverage );
+		///					called for each span of covered pixels of a row, coverage being the coverage of each pixel between 0 and 1, or NULL if fully covered.
+		template<typename SpanFunc>
+		void rasterize( const Math::Rectangle<GSize> & clipRectangle, FillRule fillRule, SpanFunc & spanFunc ) const;
+
+	private:
+		struct Edge {
+			///@brief Top point (the smallest y).
+			Math::Vec2<F> p0;
+			///@brief Bottom point.
+			Math::Vec2<F> p1;
+			F dxOnDy;
+			///@brief 1 if the edge was going down, -1 otherwise.
+			F direction;
+		};
+
+		struct EdgeLess {
+			inline bool operator()( const Edge & e0, const Edge & e1 ) const { return e0.p0.y < e1.p0.y; }
+		};
+
+		///@brief Accumulate the area covered by a part of an edge inside a row, clipped horizontally to [0, width].
+		///@param accumulationIt Accumulation buffer of width + 2 values.
+		///@param width Width of the row.
+		///@param x0 Horizontal coordinate where the part enters the row.
+		///@param x1 Horizontal coordinate where the part leaves the row.
+		///@param height Signed height of the part (between -1 and 1).
+		static void _accumulateLine( F * accumulationIt, GSize width, F x0, F x1, F height );
+
+		///@brief Accumulate the area of a part of an edge already inside [0, width].
+		static void _accumulateCells( F * accumulationIt, F x0, F x1, F height );
+
+		///@brief Get the coverage of a winding number accumulated with the fill rule.
+		static F _getCoverage( F winding, FillRule fillRule );
+
+		Vector<Edge> edgeVector;
+		Math::Vec2<F> boundsMin;
+		Math::Vec2<F> boundsMax;
+	};
+
+	using Rasterizer = RasterizerT<float>;
+
+}
+
+#include "Rasterizer.hpp"
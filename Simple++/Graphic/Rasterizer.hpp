@@ -0,0 +1,221 @@
+namespace Graphic {
+
+	template<typename F>
+	RasterizerT<F>::RasterizerT() :
+		boundsMin( F( 0 ) ),
+		boundsMax( F( 0 ) ) { }
+
+	template<typename F>
+	void RasterizerT<F>::addPolygon( const Math::Vec2<F> * vertices, Size nbVertices ) {
+		if ( nbVertices < Size( 3 ) ) return;
+		for ( Size i( 0 ); i < nbVertices; i++ ) {
+			addEdge( vertices[ i ], vertices[ ( i + Size( 1 ) < nbVertices ) ? i + Size( 1 ) : Size( 0 ) ] );
+		}
+	}
+
+	template<typename F>
+	void RasterizerT<F>::addEdge( const Math::Vec2<F> & p0, const Math::Vec2<F> & p1 ) {
+		// The horizontal edges don't cover anything.
+		if ( p0.y == p1.y ) return;
+
+		Edge edge;
+		if ( p0.y < p1.y ) {
+			edge.p0 = p0;
+			edge.p1 = p1;
+			edge.direction = F( 1 );
+		} else {
+			edge.p0 = p1;
+			edge.p1 = p0;
+			edge.direction = F( -1 );
+		}
+		edge.dxOnDy = ( edge.p1.x - edge.p0.x ) / ( edge.p1.y - edge.p0.y );
+
+		if ( this -> edgeVector.getSize() ) {
+			this -> boundsMin.x = Math::min( this -> boundsMin.x, Math::min( p0.x, p1.x ) );
+			this -> boundsMax.x = Math::max( this -> boundsMax.x, Math::max( p0.x, p1.x ) );
+			this -> boundsMin.y = Math::min( this -> boundsMin.y, edge.p0.y );
+			this -> boundsMax.y = Math::max( this -> boundsMax.y, edge.p1.y );
+		} else {
+			this -> boundsMin = Math::Vec2<F>( Math::min( p0.x, p1.x ), edge.p0.y );
+			this -> boundsMax = Math::Vec2<F>( Math::max( p0.x, p1.x ), edge.p1.y );
+		}
+
+		this -> edgeVector.push( edge );
+	}
+
+	template<typename F>
+	void RasterizerT<F>::clear() {
+		this -> edgeVector.clear();
+		this -> boundsMin = Math::Vec2<F>( F( 0 ) );
+		this -> boundsMax = Math::Vec2<F>( F( 0 ) );
+	}
+
+	template<typename F>
+	inline Size RasterizerT<F>::getNbEdges() const {
+		return this -> edgeVector.getSize();
+	}
+
+	template<typename F>
+	template<typename SpanFunc>
+	void RasterizerT<F>::rasterize( const Math::Rectangle<GSize> & clipRectangle, FillRule fillRule, SpanFunc & spanFunc ) const {
+		// Under this distance of 0 or 1, a coverage is considered empty or full.
+		constexpr F epsilon( 1e-4 );
+
+		if ( this -> edgeVector.getSize() == Size( 0 ) ) return;
+
+		const GSize left( Math::max( clipRectangle.getLeft(), GSize( Math::floor( this -> boundsMin.x ) ) ) );
+		const GSize right( Math::min( clipRectangle.getRight(), GSize( Math::ceil( this -> boundsMax.x ) ) ) );
+		const GSize yBegin( Math::max( clipRectangle.getBottom(), GSize( Math::floor( this -> boundsMin.y ) ) ) );
+		const GSize yEnd( Math::min( clipRectangle.getTop(), GSize( Math::ceil( this -> boundsMax.y ) ) ) );
+		// The parts of the polygons on the left of the clip still count, they are moved on it's border.
+		const GSize xBegin( clipRectangle.getLeft() );
+		const GSize width( right - xBegin );
+		if ( right <= left || yEnd <= yBegin ) return;
+
+		// Sorted by top, the next edges to be activated are always at the beginning of what remains.
+		Vector<Edge> edgeSortedVector( this -> edgeVector );
+		EdgeLess edgeLess;
+		edgeSortedVector.sort( edgeLess );
+
+		Vector<Size> activeEdgeVector;
+		Size nextEdgeI( 0 );
+
+		F * accumulationBuffer( new F[ Size( width ) + Size( 2 ) ] );
+		F * coverageBuffer( new F[ Size( width ) ] );
+		for ( GSize x( 0 ); x < width + GSize( 2 ); x++ )
+			accumulationBuffer[ x ] = F( 0 );
+
+		for ( GSize y( yBegin ); y < yEnd; y++ ) {
+			const F rowBegin( y );
+			const F rowEnd( y + 1 );
+
+			// Activate the edges beginning before the end of the row, deactivate the ones already ended.
+			while ( nextEdgeI < edgeSortedVector.getSize() && edgeSortedVector[ nextEdgeI ].p0.y < rowEnd ) {
+				activeEdgeVector.push( nextEdgeI++ );
+			}
+			Size nbActiveEdges( 0 );
+			for ( Size i( 0 ); i < activeEdgeVector.getSize(); i++ ) {
+				if ( edgeSortedVector[ activeEdgeVector[ i ] ].p1.y > rowBegin ) {
+					activeEdgeVector[ nbActiveEdges++ ] = activeEdgeVector[ i ];
+				}
+			}
+			activeEdgeVector.resize( nbActiveEdges );
+			if ( nbActiveEdges == Size( 0 ) ) continue;
+
+			// Accumulate the part of each active edge inside the row.
+			for ( Size i( 0 ); i < nbActiveEdges; i++ ) {
+				const Edge & edge( edgeSortedVector[ activeEdgeVector[ i ] ] );
+				const F y0( Math::max( edge.p0.y, rowBegin ) );
+				const F y1( Math::min( edge.p1.y, rowEnd ) );
+				if ( y1 <= y0 ) continue;
+
+				const F x0( edge.p0.x + ( y0 - edge.p0.y ) * edge.dxOnDy - F( xBegin ) );
+				const F x1( edge.p0.x + ( y1 - edge.p0.y ) * edge.dxOnDy - F( xBegin ) );
+				_accumulateLine( accumulationBuffer, width, x0, x1, ( y1 - y0 ) * edge.direction );
+			}
+
+			// The prefix sum of the accumulated areas is the winding number of each pixel, the buffer is cleared at the same time.
+			F winding( 0 );
+			for ( GSize x( 0 ); x < width; x++ ) {
+				winding += accumulationBuffer[ x ];
+				accumulationBuffer[ x ] = F( 0 );
+				coverageBuffer[ x ] = _getCoverage( winding, fillRule );
+			}
+			accumulationBuffer[ width ] = F( 0 );
+			accumulationBuffer[ width + GSize( 1 ) ] = F( 0 );
+
+			// Send the spans, the fully covered and the partially covered ones separately.
+			GSize x( left - xBegin );
+			while ( x < width ) {
+				if ( coverageBuffer[ x ] <= epsilon ) {
+					x++;
+					continue;
+				}
+				const GSize spanBegin( x );
+				if ( coverageBuffer[ x ] >= F( 1 ) - epsilon ) {
+					do {
+						x++;
+					} while ( x < width && coverageBuffer[ x ] >= F( 1 ) - epsilon );
+					spanFunc( y, xBegin + spanBegin, x - spanBegin, ( const F * ) NULL );
+				} else {
+					do {
+						x++;
+					} while ( x < width && coverageBuffer[ x ] > epsilon && coverageBuffer[ x ] < F( 1 ) - epsilon );
+					spanFunc( y, xBegin + spanBegin, x - spanBegin, ( const F * ) coverageBuffer + spanBegin );
+				}
+			}
+		}
+
+		delete[] accumulationBuffer;
+		delete[] coverageBuffer;
+	}
+
+	template<typename F>
+	void RasterizerT<F>::_accumulateLine( F * accumulationIt, GSize width, F x0, F x1, F height ) {
+		const F widthF( width );
+
+		// Split the parts crossing a border, the part outside being then moved on it.
+		if ( ( x0 < F( 0 ) && x1 > F( 0 ) ) || ( x0 > F( 0 ) && x1 < F( 0 ) ) ) {
+			const F t( -x0 / ( x1 - x0 ) );
+			_accumulateLine( accumulationIt, width, x0, F( 0 ), height * t );
+			_accumulateLine( accumulationIt, width, F( 0 ), x1, height * ( F( 1 ) - t ) );
+			return;
+		}
+		if ( ( x0 < widthF && x1 > widthF ) || ( x0 > widthF && x1 < widthF ) ) {
+			const F t( ( widthF - x0 ) / ( x1 - x0 ) );
+			_accumulateLine( accumulationIt, width, x0, widthF, height * t );
+			_accumulateLine( accumulationIt, width, widthF, x1, height * ( F( 1 ) - t ) );
+			return;
+		}
+
+		_accumulateCells( accumulationIt, Math::clamp( x0, F( 0 ), widthF ), Math::clamp( x1, F( 0 ), widthF ), height );
+	}
+
+	template<typename F>
+	void RasterizerT<F>::_accumulateCells( F * accumulationIt, F x0, F x1, F height ) {
+		// Each pixel receives the part of the height on it's right inside the row, trapezoids for the pixels crossed by the line.
+		const F xMin( Math::min( x0, x1 ) );
+		const F xMax( Math::max( x0, x1 ) );
+		const GSize xMinI( GSize( Math::floor( xMin ) ) );
+		const GSize xMaxI( GSize( Math::ceil( xMax ) ) );
+
+		if ( xMaxI <= xMinI + GSize( 1 ) ) {
+			// Inside a single pixel.
+			const F xMiddle( F( 0.5 ) * ( x0 + x1 ) - F( xMinI ) );
+			accumulationIt[ xMinI ] += height - height * xMiddle;
+			accumulationIt[ xMinI + GSize( 1 ) ] += height * xMiddle;
+		} else {
+			const F slope( F( 1 ) / ( xMax - xMin ) );
+			const F xMinFrac( xMin - F( xMinI ) );
+			const F areaFirst( F( 0.5 ) * slope * ( F( 1 ) - xMinFrac ) * ( F( 1 ) - xMinFrac ) );
+			const F xMaxFrac( xMax - F( xMaxI ) + F( 1 ) );
+			const F areaLast( F( 0.5 ) * slope * xMaxFrac * xMaxFrac );
+
+			accumulationIt[ xMinI ] += height * areaFirst;
+			if ( xMaxI == xMinI + GSize( 2 ) ) {
+				accumulationIt[ xMinI + GSize( 1 ) ] += height * ( F( 1 ) - areaFirst - areaLast );
+			} else {
+				const F areaSecond( slope * ( F( 1.5 ) - xMinFrac ) );
+				accumulationIt[ xMinI + GSize( 1 ) ] += height * ( areaSecond - areaFirst );
+				for ( GSize x( xMinI + GSize( 2 ) ); x < xMaxI - GSize( 1 ); x++ )
+					accumulationIt[ x ] += height * slope;
+				const F areaBeforeLast( areaSecond + F( xMaxI - xMinI - GSize( 3 ) ) * slope );
+				accumulationIt[ xMaxI - GSize( 1 ) ] += height * ( F( 1 ) - areaBeforeLast - areaLast );
+			}
+			accumulationIt[ xMaxI ] += height * areaLast;
+		}
+	}
+
+	template<typename F>
+	inline F RasterizerT<F>::_getCoverage( F winding, FillRule fillRule ) {
+		const F windingAbs( Math::abs( winding ) );
+		if ( fillRule == FillRule::EvenOdd ) {
+			// Distance to the closest even number, between 0 and 1.
+			const F windingMod( windingAbs - F( 2 ) * Math::floor( windingAbs * F( 0.5 ) ) );
+			return ( windingMod > F( 1 ) ) ? F( 2 ) - windingMod : windingMod;
+		} else {
+			return Math::min( windingAbs, F( 1 ) );
+		}
+	}
+
+}
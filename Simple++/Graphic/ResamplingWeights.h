@@ -0,0 +1,119 @@
+///@file ResamplingWeights.h
+///@brief Declares the precomputed weights of a separable resampling, cached by sizes.
+#pragma once
+
+#include <mutex>
+
+#include "../Vector.h"
+#include "../Math/Math.h"
+#include "BasicGraphic.h"
+
+namespace Graphic {
+
+	///@brief Weights of a separable resampling along one dimension, precomputed once for a pair of source and destination sizes.
+	///			Each destination element is the weighted sum of a contiguous range of source elements, the weights of a range summing to one.
+	///			The tables are shared through a cache (acquire() / release()) to be reused by the images of the same size.
+	///@template F Type of the weights.
+	template<typename F = float>
+	class ResamplingWeightsT {
+	public:
+		///@brief Filters available.
+		enum class Filter : unsigned char {
+			Bicubic,	///< Keys cubic convolution (a = -0.5), support of 2.
+			Lanczos,	///< Lanczos windowed sinc (a = 3), support of 3.
+			Area		///< Mean of the source elements covered by the destination one, weighted by their exact coverage.
+		};
+
+		///@brief Compute the weights.
+		///@param srcSize Number of source elements.
+		///@param dstSize Number of destination elements.
+		///@param filter Filter to be used.
+		ResamplingWeightsT( GSize srcSize, GSize dstSize, Filter filter );
+
+		///@brief Get the number of source elements.
+		///@return Source size.
+		GSize getSrcSize() const;
+
+		///@brief Get the number of destination elements.
+		///@return Destination size.
+		GSize getDstSize() const;
+
+		///@brief Get the filter used.
+		///@return Filter.
+		Filter getFilter() const;
+
+		///@brief Get the first source element read by a destination one.
+		///@param i Index of the destination element.
+		///@return Index of the first source element.
+		GSize getFirst( GSize i ) const;
+
+		///@brief Get the number of source elements read by a destination one.
+		///@param i Index of the destination element.
+		///@return Number of weights.
+		GSize getNbWeights( GSize i ) const;
+
+		///@brief Get the weights of a destination element.
+		///@param i Index of the destination element.
+		///@return Pointer to the getNbWeights( i ) weights.
+		const F * getWeights( GSize i ) const;
+
+		///@brief Get the weights from the cache, computing them if not there yet.
+		///			When the cache is full of borrowed weights, the new ones aren't cached and are deleted by release().
+		///@param srcSize Number of source elements.
+		///@param dstSize Number of destination elements.
+		///@param filter Filter to be used.
+		///@return Weights to be given back with release().
+		static const ResamplingWeightsT<F> * acquire( GSize srcSize, GSize dstSize, Filter filter );
+
+		///@brief Give back weights borrowed with acquire().
+		///@param weights Weights to give back.
+		static void release( const ResamplingWeightsT<F> * weights );
+
+		///@brief Delete every cached weights not borrowed.
+		static void clearCache();
+
+		///@brief Maximum number of weights tables kept by the cache (the least recently used unborrowed one being deleted first, never exceeded).
+		static constexpr Size maxCacheSize = Size( 32 );
+
+	private:
+		///@brief Value of the filter at a distance x (in source elements, scaled for the downscaling).
+		static F _getFilterValue( Filter filter, F x );
+
+		///@brief Support of the filter (half width).
+		static F _getFilterSupport( Filter filter );
+
+		struct CacheEntry {
+			ResamplingWeightsT<F> * weights;
+			///@brief Number of acquire() not released yet.
+			Size nbReferences;
+			///@brief Value of the cache clock when last acquired.
+			Size lastUsed;
+		};
+
+		struct Cache {
+			Cache();
+			~Cache();
+
+			std::mutex mutex;
+			Vector<CacheEntry> entryVector;
+			Size clock;
+		};
+
+		static Cache & _getCache();
+
+		GSize srcSize;
+		GSize dstSize;
+		Filter filter;
+
+		///@brief Maximum number of weights of a destination element, the size of each range of weightVector.
+		GSize nbTaps;
+		Vector<GSize> firstVector;
+		Vector<GSize> nbWeightsVector;
+		Vector<F> weightVector;
+	};
+
+	using ResamplingWeights = ResamplingWeightsT<float>;
+
+}
+
+#include "ResamplingWeights.hpp"
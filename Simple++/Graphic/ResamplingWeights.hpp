@@ -0,0 +1,235 @@
+namespace Graphic {
+
+	template<typename F>
+	ResamplingWeightsT<F>::ResamplingWeightsT( GSize srcSize, GSize dstSize, Filter filter ) :
+		srcSize( srcSize ),
+		dstSize( dstSize ),
+		filter( filter ),
+		nbTaps( 0 ),
+		firstVector( Size( dstSize ) ),
+		nbWeightsVector( Size( dstSize ) ) {
+		ASSERT_SPP( srcSize > GSize( 0 ) && dstSize > GSize( 0 ) );
+
+		// Computed in double, only the final weights are stored as F.
+		const double scale( double( srcSize ) / double( dstSize ) );
+		// When downscaling, the filter is stretched to cover every source element (no aliasing).
+		const double filterScale( Math::max( scale, 1.0 ) );
+		const double support( double( _getFilterSupport( filter ) ) * filterScale );
+
+		Vector<double> weightsTmp;
+		Vector<double> weightsAll;
+		for ( GSize i( 0 ); i < dstSize; i++ ) {
+			GSize first;
+			GSize end;
+			weightsTmp.clear();
+
+			if ( filter == Filter::Area ) {
+				// Exact coverage of [begin, end[ over each source element.
+				const double begin( double( i ) * scale );
+				const double endf( double( i + 1 ) * scale );
+				first = GSize( begin );
+				end = Math::min( GSize( Math::ceil( endf ) ), srcSize );
+				for ( GSize x( first ); x < end; x++ ) {
+					weightsTmp.push( Math::min( double( x + 1 ), endf ) - Math::max( double( x ), begin ) );
+				}
+			} else {
+				const double center( ( double( i ) + 0.5 ) * scale );
+				first = Math::max( GSize( Math::floor( center - support + 0.5 ) ), GSize( 0 ) );
+				end = Math::min( GSize( Math::floor( center + support + 0.5 ) ), srcSize );
+				for ( GSize x( first ); x < end; x++ ) {
+					weightsTmp.push( double( _getFilterValue( filter, F( ( double( x ) + 0.5 - center ) / filterScale ) ) ) );
+				}
+			}
+
+			double sum( 0.0 );
+			for ( Size k( 0 ); k < weightsTmp.getSize(); k++ )
+				sum += weightsTmp[ k ];
+			if ( sum != 0.0 ) {
+				for ( Size k( 0 ); k < weightsTmp.getSize(); k++ )
+					weightsTmp[ k ] /= sum;
+			}
+
+			this -> firstVector[ i ] = first;
+			this -> nbWeightsVector[ i ] = GSize( weightsTmp.getSize() );
+			this -> nbTaps = Math::max( this -> nbTaps, GSize( weightsTmp.getSize() ) );
+			for ( Size k( 0 ); k < weightsTmp.getSize(); k++ )
+				weightsAll.push( weightsTmp[ k ] );
+		}
+
+		// One range of nbTaps weights by destination element, padded with zeros.
+		this -> weightVector.resize( Size( dstSize ) * Size( this -> nbTaps ), F( 0 ) );
+		Size k( 0 );
+		for ( GSize i( 0 ); i < dstSize; i++ ) {
+			F * weightIt( this -> weightVector.getData() + Size( i ) * Size( this -> nbTaps ) );
+			for ( GSize j( 0 ); j < this -> nbWeightsVector[ i ]; j++ )
+				weightIt[ j ] = F( weightsAll[ k++ ] );
+		}
+	}
+
+	template<typename F>
+	inline GSize ResamplingWeightsT<F>::getSrcSize() const {
+		return this -> srcSize;
+	}
+
+	template<typename F>
+	inline GSize ResamplingWeightsT<F>::getDstSize() const {
+		return this -> dstSize;
+	}
+
+	template<typename F>
+	inline typename ResamplingWeightsT<F>::Filter ResamplingWeightsT<F>::getFilter() const {
+		return this -> filter;
+	}
+
+	template<typename F>
+	inline GSize ResamplingWeightsT<F>::getFirst( GSize i ) const {
+		return this -> firstVector[ i ];
+	}
+
+	template<typename F>
+	inline GSize ResamplingWeightsT<F>::getNbWeights( GSize i ) const {
+		return this -> nbWeightsVector[ i ];
+	}
+
+	template<typename F>
+	inline const F * ResamplingWeightsT<F>::getWeights( GSize i ) const {
+		return this -> weightVector.getData() + Size( i ) * Size( this -> nbTaps );
+	}
+
+	template<typename F>
+	const ResamplingWeightsT<F> * ResamplingWeightsT<F>::acquire( GSize srcSize, GSize dstSize, Filter filter ) {
+		Cache & cache( _getCache() );
+		{
+			std::unique_lock<std::mutex> lock( cache.mutex );
+			cache.clock++;
+			for ( Size i( 0 ); i < cache.entryVector.getSize(); i++ ) {
+				CacheEntry & entry( cache.entryVector[ i ] );
+				if ( entry.weights -> srcSize == srcSize && entry.weights -> dstSize == dstSize && entry.weights -> filter == filter ) {
+					entry.nbReferences++;
+					entry.lastUsed = cache.clock;
+					return entry.weights;
+				}
+			}
+		}
+
+		// Compute outside of the lock, the other sizes don't have to wait for it.
+		ResamplingWeightsT<F> * weights( new ResamplingWeightsT<F>( srcSize, dstSize, filter ) );
+
+		std::unique_lock<std::mutex> lock( cache.mutex );
+		// Another thread may have computed the same ones meanwhile.
+		for ( Size i( 0 ); i < cache.entryVector.getSize(); i++ ) {
+			CacheEntry & entry( cache.entryVector[ i ] );
+			if ( entry.weights -> srcSize == srcSize && entry.weights -> dstSize == dstSize && entry.weights -> filter == filter ) {
+				delete weights;
+				entry.nbReferences++;
+				entry.lastUsed = cache.clock;
+				return entry.weights;
+			}
+		}
+
+		// Make room by deleting the least recently used unborrowed weights, if every one is borrowed these ones aren't cached.
+		while ( cache.entryVector.getSize() >= maxCacheSize ) {
+			Size oldestI( cache.entryVector.getSize() );
+			for ( Size i( 0 ); i < cache.entryVector.getSize(); i++ ) {
+				const CacheEntry & entry( cache.entryVector[ i ] );
+				if ( entry.nbReferences == Size( 0 ) && ( oldestI == cache.entryVector.getSize() || entry.lastUsed < cache.entryVector[ oldestI ].lastUsed ) ) {
+					oldestI = i;
+				}
+			}
+			if ( oldestI == cache.entryVector.getSize() ) return weights;
+			delete cache.entryVector[ oldestI ].weights;
+			cache.entryVector[ oldestI ] = cache.entryVector.getLast();
+			cache.entryVector.resize( cache.entryVector.getSize() - Size( 1 ) );
+		}
+
+		CacheEntry entry;
+		entry.weights = weights;
+		entry.nbReferences = Size( 1 );
+		entry.lastUsed = cache.clock;
+		cache.entryVector.push( entry );
+		return weights;
+	}
+
+	template<typename F>
+	void ResamplingWeightsT<F>::release( const ResamplingWeightsT<F> * weights ) {
+		Cache & cache( _getCache() );
+		std::unique_lock<std::mutex> lock( cache.mutex );
+		for ( Size i( 0 ); i < cache.entryVector.getSize(); i++ ) {
+			if ( cache.entryVector[ i ].weights == weights ) {
+				cache.entryVector[ i ].nbReferences--;
+				return;
+			}
+		}
+		// Not cached because the cache was full of borrowed weights.
+		delete weights;
+	}
+
+	template<typename F>
+	void ResamplingWeightsT<F>::clearCache() {
+		Cache & cache( _getCache() );
+		std::unique_lock<std::mutex> lock( cache.mutex );
+		Size nbKept( 0 );
+		for ( Size i( 0 ); i < cache.entryVector.getSize(); i++ ) {
+			if ( cache.entryVector[ i ].nbReferences == Size( 0 ) ) {
+				delete cache.entryVector[ i ].weights;
+			} else {
+				cache.entryVector[ nbKept++ ] = cache.entryVector[ i ];
+			}
+		}
+		cache.entryVector.resize( nbKept );
+	}
+
+	template<typename F>
+	F ResamplingWeightsT<F>::_getFilterValue( Filter filter, F x ) {
+		x = Math::abs( x );
+		switch ( filter ) {
+			case Filter::Bicubic:
+				{
+					constexpr F a( -0.5 );
+					if ( x < F( 1 ) ) return ( ( a + F( 2 ) ) * x - ( a + F( 3 ) ) ) * x * x + F( 1 );
+					if ( x < F( 2 ) ) return ( ( ( x - F( 5 ) ) * x + F( 8 ) ) * x - F( 4 ) ) * a;
+					return F( 0 );
+				}
+			case Filter::Lanczos:
+				{
+					constexpr F a( 3 );
+					if ( x == F( 0 ) ) return F( 1 );
+					if ( x >= a ) return F( 0 );
+					const F piX( Math::pi<F>() * x );
+					return ( a * Math::sin( piX ) * Math::sin( piX / a ) ) / ( piX * piX );
+				}
+			default:
+				return ( x < F( 0.5 ) ) ? F( 1 ) : F( 0 );
+		}
+	}
+
+	template<typename F>
+	F ResamplingWeightsT<F>::_getFilterSupport( Filter filter ) {
+		switch ( filter ) {
+			case Filter::Bicubic:
+				return F( 2 );
+			case Filter::Lanczos:
+				return F( 3 );
+			default:
+				return F( 0.5 );
+		}
+	}
+
+	template<typename F>
+	ResamplingWeightsT<F>::Cache::Cache() :
+		clock( 0 ) { }
+
+	template<typename F>
+	ResamplingWeightsT<F>::Cache::~Cache() {
+		for ( Size i( 0 ); i < this -> entryVector.getSize(); i++ ) {
+			delete this -> entryVector[ i ].weights;
+		}
+	}
+
+	template<typename F>
+	typename ResamplingWeightsT<F>::Cache & ResamplingWeightsT<F>::_getCache() {
+		static Cache cache;
+		return cache;
+	}
+
+}
@@ -0,0 +1,247 @@
+///@file		HashMap.h.
+///@brief		Declares the hash map class, an open addressing alternative to the red-black tree Map.
+#pragma once
+
+#if defined __SSE2__ || defined _M_X64 || defined _M_AMD64 || ( defined _M_IX86_FP && _M_IX86_FP >= 2 )
+#define HASHMAP_SSE2
+#include <emmintrin.h>
+#endif
+#if defined _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "SimpleLog.h"
+#include "IO/IO.h"
+#include "String.h"
+#include "Utility.h"
+#include "Math/Hash.h"
+#include "Map.h"
+
+
+///@brief Data structure used to store a "list" of elements represented by a "key" and a "value".
+///			The elements are stored in a flat open addressing table (Swiss table layout) :
+///			each slot owns one control byte (7 bits of the hash or Empty/Deleted) and the control bytes are probed 16 at a time.
+///			The API matches Map as closely as possible, except that the iteration order is unspecified.
+///@template I Index type.
+///@template T Value type.
+///@template Hash Functor with operator() overloaded with : Math::Hash::Value operator()( const I & ) const;
+///@see https://abseil.io/about/design/swisstables
+template<typename I, typename T, typename Hash = Math::Hash::Template>
+class HashMap : public IO::BasicIO {
+public:
+	///@brief Defines an alias representing the iterator (Pointer to a slot of the table).
+	typedef MapObject<I, T> * Iterator;
+
+	/** Type of the Index */
+	typedef I Index;
+
+	/** Type of the Value */
+	typedef T Value;
+
+	///@brief Number of control bytes probed at once.
+	static constexpr Size GroupSize = Size( 16 );
+
+	///@brief Empty Constructor
+	///@param hashFunc (Optional) Hashing functor.
+	HashMap( const Hash & hashFunc = Hash() );
+
+	///@brief Copy Constructor
+	///@param map HashMap to copy.
+	HashMap( const HashMap<I, T, Hash> & map );
+
+	///@brief Move Constructor
+	///@param map HashMap to move from.
+	HashMap( HashMap<I, T, Hash> && map );
+
+	///@brief Destructor
+	~HashMap();
+
+	///@brief Conversion to String operator
+	template<typename C = char>
+	operator BasicString<C>() const;
+
+	///@brief Copy operator
+	///@param map HashMap to copy.
+	///@return reference to THIS.
+	HashMap<I, T, Hash> & operator=( const HashMap<I, T, Hash> & map );
+
+	///@brief Move operator
+	///@param map HashMap to move from.
+	///@return reference to THIS.
+	HashMap<I, T, Hash> & operator=( HashMap<I, T, Hash> && map );
+
+	/************************************************************************/
+	/* ================             ITERATIONS             ================ */
+	/************************************************************************/
+
+	///@brief iterate ONE time the iterator and return if there is still data.
+	///@param it [in,out] The Iterator.
+	///@return True if the iterator is still valid, False otherwise.
+	bool iterate( typename HashMap<I, T, Hash>::Iterator * it ) const;
+
+	///@brief Iterate ONE time and set the pointer to the pointer of the data retrieved.
+	///@param it [in,out] The Iterator.
+	///@param i [out] Pointer to a pointer to the index retrieved.
+	///@param v [out] Pointer to a pointer to the value retrieved.
+	///@return True if the iterator is still valid, False otherwise.
+	bool iterate( typename HashMap<I, T, Hash>::Iterator * it, I ** i, T ** v ) const;
+
+	///@brief Iterate ONE time and set the pointer to the pointer of the data retrieved.
+	///@param it [in,out] The Iterator.
+	///@param i [out] Pointer to a pointer to the index retrieved.
+	///@param v [out] Pointer to a pointer to the value retrieved.
+	///@param testFunctor Functor to check a condition before incrementing the iterator
+	///						bool operator()( const T * e );
+	///@return True if the iterator is still valid, False otherwise.
+	template<typename TestFunctor>
+	bool iterate( typename HashMap<I, T, Hash>::Iterator * it, I ** i, T ** v, TestFunctor & testFunctor ) const;
+
+	///@brief get the Begin Iterator (first used slot).
+	typename HashMap<I, T, Hash>::Iterator getBegin() const;
+	typename HashMap<I, T, Hash>::Iterator begin() const;
+
+	///@brief get the End Iterator.
+	typename HashMap<I, T, Hash>::Iterator getEnd() const;
+	typename HashMap<I, T, Hash>::Iterator end() const;
+
+	/************************************************************************/
+	/* ================               ACCESS               ================ */
+	/************************************************************************/
+
+	///@brief Access from a value using an index.
+	///@param index Index of the Element to be retrieved.
+	///@return Pointer to the value if founded, if not, return NULL.
+	const T * operator[]( const I & index ) const;
+	T * operator[]( const I & index );
+
+	///@brief Access from a value using an index.
+	///@param index Index of the Element to be retrieved.
+	///@return Pointer to the value if founded, if not, return NULL.
+	const T * getValueI( const I & index ) const;
+	T * getValueI( const I & index );
+
+	///@brief Access from an [Index => Value] object using an index.
+	///@param index Index of the Element to be retrieved.
+	///@return Pointer to the object if founded, if not, return NULL.
+	const MapObject<I, T> * getObjectI( const I & index ) const;
+	MapObject<I, T> * getObjectI( const I & index );
+
+	///@brief Get the Value associated with an iterator (no bound check is done here).
+	const T & getValueIt( typename HashMap<I, T, Hash>::Iterator it ) const;
+	T & getValueIt( typename HashMap<I, T, Hash>::Iterator it );
+
+	///@brief Get the Index associated with an iterator (no bound check is done here).
+	const I & getIndexIt( typename HashMap<I, T, Hash>::Iterator it ) const;
+
+	///@brief Set the Value associated with an index ( The index has to already exists ).
+	///@param index Index used to set the value.
+	///@param v Value to be set.
+	void setValueI( const I & index, const T & v );
+
+	///@brief Set the Value associated with an iterator.
+	///@param it Iterator used to set the value.
+	///@param v Value to be set.
+	void setValueIt( typename HashMap<I, T, Hash>::Iterator it, const T & v );
+
+	///@brief Get if the HashMap is empty of not.
+	bool isEmpty() const;
+
+	///@brief Get the number of [Index => Value] stored.
+	Size getSize() const;
+
+	///@brief Get the number of slots allocated.
+	Size getMaxSize() const;
+
+	///@brief clear the complete HashMap (memory is kept).
+	void clear();
+
+	///@brief Allocate enough slots to store at least newSize elements without rehashing.
+	///@param newSize Number of elements.
+	void reserve( const Size newSize );
+
+	///@brief Insert a new [ Index => Value ] into the map
+	///@param index Index of the value to insert.
+	///@param value Value to be inserted.
+	///@return Pointer to the value just inserted, NULL if nothing has been inserted (index already existing).
+	T * insert( const I & index, const T & value );
+
+	///@brief Delete an element from the map.
+	///@param index Index to search and to be deleted.
+	///@return Boolean if a key has been deleted.
+	bool eraseI( const I & index );
+
+	///@brief Delete an element from the map.
+	///@param it Iterator of the element to be deleted.
+	///@return Boolean if the element has been deleted.
+	bool eraseIt( typename HashMap<I, T, Hash>::Iterator it );
+
+	///@brief Create an human readable string from this map.
+	template<typename S = String>
+	S toString() const;
+
+	///@brief read from a file stream
+	///@param stream stream used to read load this object
+	///@return boolean to know if the operation is a success of not.
+	template<typename Stream>
+	bool read( Stream * stream, int verbose = 0 );
+
+	///@brief write this object as binary into a file stream
+	///@param stream stream used to write this object
+	///@return boolean to know if the operation is a success of not.
+	template<typename Stream>
+	bool write( Stream * stream ) const;
+
+protected:
+	///@brief Type of the control bytes (A used slot store the 7 lower bits of it's hash).
+	typedef signed char CtrlByte;
+
+	///@brief Values of the free control bytes, both have the sign bit set.
+	enum class Ctrl : signed char {
+		Empty = -128,
+		Deleted = -2
+	};
+
+	static constexpr Size overflow = Size( -1 );
+
+	void _clear();
+	void _unload();
+
+	///@brief Allocate an empty table of capacity slots (capacity has to be a power of two multiple of GroupSize).
+	void _allocate( const Size capacity );
+
+	///@brief Re-insert every elements into a new table of newCapacity slots.
+	void _rehash( const Size newCapacity );
+
+	///@brief Search the slot of an index.
+	///@return Slot index or overflow if not founded.
+	Size _searchSlot( const I & index, const Math::Hash::Value h ) const;
+
+	///@brief Search the first free (Empty or Deleted) slot in the probe sequence of a hash.
+	Size _searchFreeSlot( const Math::Hash::Value h ) const;
+
+	///@brief Mark a slot as freed and destroy it's content.
+	void _eraseSlot( const Size slotI );
+
+	///@brief Compute the bitmask of the bytes of a group equals to b.
+	static unsigned int _matchGroup( const CtrlByte * group, const CtrlByte b );
+	///@brief Compute the bitmask of the Empty bytes of a group.
+	static unsigned int _matchGroupEmpty( const CtrlByte * group );
+	///@brief Compute the bitmask of the Empty or Deleted bytes of a group.
+	static unsigned int _matchGroupFree( const CtrlByte * group );
+	///@brief Get the index of the lowest bit set (mask has to be != 0).
+	static unsigned int _lowestBit( unsigned int mask );
+
+	static Size _getH1( const Math::Hash::Value h );
+	static CtrlByte _getH2( const Math::Hash::Value h );
+	static Size _getMaxLoad( const Size capacity );
+
+	CtrlByte * ctrlTable;
+	MapObject<I, T> * slotTable;
+	Size size;
+	Size capacity;
+	Size growthLeft;
+	Hash hashFunc;
+};
+
+
+#include "HashMap.hpp"
@@ -0,0 +1,553 @@
+
+
+template<typename I, typename T, typename Hash>
+HashMap<I, T, Hash>::HashMap( const Hash & hashFunc ) :
+	ctrlTable( NULL ),
+	slotTable( NULL ),
+	size( 0 ),
+	capacity( 0 ),
+	growthLeft( 0 ),
+	hashFunc( hashFunc ) {
+
+}
+
+template<typename I, typename T, typename Hash>
+HashMap<I, T, Hash>::HashMap( const HashMap<I, T, Hash> & map ) :
+	ctrlTable( NULL ),
+	slotTable( NULL ),
+	size( 0 ),
+	capacity( 0 ),
+	growthLeft( 0 ),
+	hashFunc( map.hashFunc ) {
+	*this = map;
+}
+
+template<typename I, typename T, typename Hash>
+HashMap<I, T, Hash>::HashMap( HashMap<I, T, Hash> && map ) :
+	ctrlTable( map.ctrlTable ),
+	slotTable( map.slotTable ),
+	size( map.size ),
+	capacity( map.capacity ),
+	growthLeft( map.growthLeft ),
+	hashFunc( Utility::toRValue( map.hashFunc ) ) {
+	map.ctrlTable = NULL;
+	map.slotTable = NULL;
+	map.size = Size( 0 );
+	map.capacity = Size( 0 );
+	map.growthLeft = Size( 0 );
+}
+
+template<typename I, typename T, typename Hash>
+HashMap<I, T, Hash>::~HashMap() {
+	_unload();
+}
+
+template<typename I, typename T, typename Hash>
+template<typename C>
+HashMap<I, T, Hash>::operator BasicString<C>() const {
+	return toString<BasicString<C>>();
+}
+
+template<typename I, typename T, typename Hash>
+HashMap<I, T, Hash> & HashMap<I, T, Hash>::operator=( const HashMap<I, T, Hash> & map ) {
+	if ( this == &map )
+		return *this;
+	_unload();
+
+	this -> hashFunc = map.hashFunc;
+	this -> size = map.size;
+	this -> capacity = map.capacity;
+	this -> growthLeft = map.growthLeft;
+
+	if ( map.capacity ) {
+		this -> ctrlTable = new CtrlByte[ map.capacity ];
+		this -> slotTable = new MapObject<I, T>[ map.capacity ];
+		Utility::copy( this -> ctrlTable, map.ctrlTable, map.capacity );
+		for ( Size i( 0 ); i < map.capacity; i++ ) {
+			if ( map.ctrlTable[ i ] >= CtrlByte( 0 ) )
+				this -> slotTable[ i ] = map.slotTable[ i ];
+		}
+	} else {
+		this -> ctrlTable = NULL;
+		this -> slotTable = NULL;
+	}
+
+	return *this;
+}
+
+template<typename I, typename T, typename Hash>
+HashMap<I, T, Hash> & HashMap<I, T, Hash>::operator=( HashMap<I, T, Hash> && map ) {
+	_unload();
+
+	this -> hashFunc = Utility::toRValue( map.hashFunc );
+	this -> ctrlTable = map.ctrlTable;
+	this -> slotTable = map.slotTable;
+	this -> size = map.size;
+	this -> capacity = map.capacity;
+	this -> growthLeft = map.growthLeft;
+
+	map.ctrlTable = NULL;
+	map.slotTable = NULL;
+	map.size = Size( 0 );
+	map.capacity = Size( 0 );
+	map.growthLeft = Size( 0 );
+	return *this;
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::_unload() {
+	delete[] this -> ctrlTable;
+	delete[] this -> slotTable;
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::_clear() {
+	_unload();
+	this -> ctrlTable = NULL;
+	this -> slotTable = NULL;
+	this -> size = Size( 0 );
+	this -> capacity = Size( 0 );
+	this -> growthLeft = Size( 0 );
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::clear() {
+	for ( Size i( 0 ); i < this -> capacity; i++ ) {
+		if ( this -> ctrlTable[ i ] >= CtrlByte( 0 ) )
+			this -> slotTable[ i ] = MapObject<I, T>();
+		this -> ctrlTable[ i ] = static_cast< CtrlByte >( Ctrl::Empty );
+	}
+	this -> size = Size( 0 );
+	this -> growthLeft = _getMaxLoad( this -> capacity );
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::reserve( const Size newSize ) {
+	Size newCapacity( GroupSize );
+	while ( _getMaxLoad( newCapacity ) < newSize )
+		newCapacity <<= Size( 1 );
+	if ( newCapacity > this -> capacity )
+		_rehash( newCapacity );
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::_allocate( const Size capacity ) {
+	_ASSERT_SPP( capacity >= GroupSize && ( capacity & ( capacity - Size( 1 ) ) ) == Size( 0 ) );
+
+	this -> ctrlTable = new CtrlByte[ capacity ];
+	this -> slotTable = new MapObject<I, T>[ capacity ];
+	for ( Size i( 0 ); i < capacity; i++ )
+		this -> ctrlTable[ i ] = static_cast< CtrlByte >( Ctrl::Empty );
+
+	this -> capacity = capacity;
+	this -> size = Size( 0 );
+	this -> growthLeft = _getMaxLoad( capacity );
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::_rehash( const Size newCapacity ) {
+	CtrlByte * oldCtrlTable( this -> ctrlTable );
+	MapObject<I, T> * oldSlotTable( this -> slotTable );
+	Size oldCapacity( this -> capacity );
+	Size oldSize( this -> size );
+
+	_allocate( newCapacity );
+
+	for ( Size i( 0 ); i < oldCapacity; i++ ) {
+		if ( oldCtrlTable[ i ] >= CtrlByte( 0 ) ) {
+			MapObject<I, T> & object( oldSlotTable[ i ] );
+			Math::Hash::Value h( this -> hashFunc( object.getIndex() ) );
+			Size slotI( _searchFreeSlot( h ) );
+			this -> ctrlTable[ slotI ] = _getH2( h );
+			this -> slotTable[ slotI ] = Utility::toRValue( object );
+		}
+	}
+	this -> size = oldSize;
+	this -> growthLeft -= oldSize;
+
+	delete[] oldCtrlTable;
+	delete[] oldSlotTable;
+}
+
+template<typename I, typename T, typename Hash>
+Size HashMap<I, T, Hash>::_searchSlot( const I & index, const Math::Hash::Value h ) const {
+	if ( this -> capacity == Size( 0 ) )
+		return overflow;
+
+	const Size groupMask( ( this -> capacity / GroupSize ) - Size( 1 ) );
+	const CtrlByte h2( _getH2( h ) );
+	Size groupI( _getH1( h ) & groupMask );
+
+	// Triangular probing visit every group once when the number of groups is a power of two.
+	for ( Size probeI( 1 ); probeI <= groupMask + Size( 1 ); probeI++ ) {
+		const Size groupOffset( groupI * GroupSize );
+		const CtrlByte * group( this -> ctrlTable + groupOffset );
+
+		for ( unsigned int mask( _matchGroup( group, h2 ) ); mask; mask &= mask - 1u ) {
+			const Size slotI( groupOffset + Size( _lowestBit( mask ) ) );
+			if ( this -> slotTable[ slotI ].getIndex() == index )
+				return slotI;
+		}
+		// A group with an empty slot has never been probed through.
+		if ( _matchGroupEmpty( group ) )
+			return overflow;
+
+		groupI = ( groupI + probeI ) & groupMask;
+	}
+	return overflow;
+}
+
+template<typename I, typename T, typename Hash>
+Size HashMap<I, T, Hash>::_searchFreeSlot( const Math::Hash::Value h ) const {
+	const Size groupMask( ( this -> capacity / GroupSize ) - Size( 1 ) );
+	Size groupI( _getH1( h ) & groupMask );
+
+	for ( Size probeI( 1 ); ; probeI++ ) {
+		const Size groupOffset( groupI * GroupSize );
+		const unsigned int mask( _matchGroupFree( this -> ctrlTable + groupOffset ) );
+		if ( mask )
+			return groupOffset + Size( _lowestBit( mask ) );
+
+		groupI = ( groupI + probeI ) & groupMask;
+	}
+}
+
+template<typename I, typename T, typename Hash>
+T * HashMap<I, T, Hash>::insert( const I & index, const T & value ) {
+	const Math::Hash::Value h( this -> hashFunc( index ) );
+
+	if ( _searchSlot( index, h ) != overflow )
+		return NULL;
+
+	if ( this -> growthLeft == Size( 0 ) ) {
+		if ( this -> capacity == Size( 0 ) ) {
+			_allocate( GroupSize );
+		} else if ( this -> size * Size( 16 ) <= this -> capacity * Size( 7 ) ) {
+			// Mostly Deleted slots, cleaning them is enough.
+			_rehash( this -> capacity );
+		} else {
+			_rehash( this -> capacity << Size( 1 ) );
+		}
+	}
+
+	const Size slotI( _searchFreeSlot( h ) );
+	if ( this -> ctrlTable[ slotI ] == static_cast< CtrlByte >( Ctrl::Empty ) )
+		this -> growthLeft--;
+
+	this -> ctrlTable[ slotI ] = _getH2( h );
+	this -> slotTable[ slotI ] = MapObject<I, T>( index, value );
+	this -> size++;
+
+	return &( this -> slotTable[ slotI ].getValue() );
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::_eraseSlot( const Size slotI ) {
+	const Size groupOffset( slotI & ~( GroupSize - Size( 1 ) ) );
+
+	// If the group still have an empty slot, no probe sequence ever went through it, the slot can be set back to Empty.
+	if ( _matchGroupEmpty( this -> ctrlTable + groupOffset ) ) {
+		this -> ctrlTable[ slotI ] = static_cast< CtrlByte >( Ctrl::Empty );
+		this -> growthLeft++;
+	} else {
+		this -> ctrlTable[ slotI ] = static_cast< CtrlByte >( Ctrl::Deleted );
+	}
+	this -> slotTable[ slotI ] = MapObject<I, T>();
+	this -> size--;
+}
+
+template<typename I, typename T, typename Hash>
+bool HashMap<I, T, Hash>::eraseI( const I & index ) {
+	const Size slotI( _searchSlot( index, this -> hashFunc( index ) ) );
+	if ( slotI == overflow )
+		return false;
+	_eraseSlot( slotI );
+	return true;
+}
+
+template<typename I, typename T, typename Hash>
+bool HashMap<I, T, Hash>::eraseIt( typename HashMap<I, T, Hash>::Iterator it ) {
+	if ( it < this -> slotTable || it >= this -> slotTable + this -> capacity )
+		return false;
+	const Size slotI( Size( it - this -> slotTable ) );
+	if ( this -> ctrlTable[ slotI ] < CtrlByte( 0 ) )
+		return false;
+	_eraseSlot( slotI );
+	return true;
+}
+
+template<typename I, typename T, typename Hash>
+const T * HashMap<I, T, Hash>::operator[]( const I & index ) const {
+	return getValueI( index );
+}
+
+template<typename I, typename T, typename Hash>
+T * HashMap<I, T, Hash>::operator[]( const I & index ) {
+	return getValueI( index );
+}
+
+template<typename I, typename T, typename Hash>
+const MapObject<I, T> * HashMap<I, T, Hash>::getObjectI( const I & index ) const {
+	return const_cast< HashMap<I, T, Hash> * >( this ) -> getObjectI( index );
+}
+
+template<typename I, typename T, typename Hash>
+MapObject<I, T> * HashMap<I, T, Hash>::getObjectI( const I & index ) {
+	const Size slotI( _searchSlot( index, this -> hashFunc( index ) ) );
+	if ( slotI == overflow )
+		return NULL;
+	return &( this -> slotTable[ slotI ] );
+}
+
+template<typename I, typename T, typename Hash>
+const T * HashMap<I, T, Hash>::getValueI( const I & index ) const {
+	return const_cast< HashMap<I, T, Hash> * >( this ) -> getValueI( index );
+}
+
+template<typename I, typename T, typename Hash>
+T * HashMap<I, T, Hash>::getValueI( const I & index ) {
+	MapObject<I, T> * objectFounded( getObjectI( index ) );
+	if ( objectFounded ) {
+		return &( objectFounded -> getValue() );
+	} else {
+		return NULL;
+	}
+}
+
+template<typename I, typename T, typename Hash>
+const T & HashMap<I, T, Hash>::getValueIt( typename HashMap<I, T, Hash>::Iterator it ) const {
+	return it -> getValue();
+}
+
+template<typename I, typename T, typename Hash>
+T & HashMap<I, T, Hash>::getValueIt( typename HashMap<I, T, Hash>::Iterator it ) {
+	return it -> getValue();
+}
+
+template<typename I, typename T, typename Hash>
+const I & HashMap<I, T, Hash>::getIndexIt( typename HashMap<I, T, Hash>::Iterator it ) const {
+	return it -> getIndex();
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::setValueI( const I & index, const T & v ) {
+	T * valueFounded( getValueI( index ) );
+	if ( valueFounded )
+		*valueFounded = v;
+}
+
+template<typename I, typename T, typename Hash>
+void HashMap<I, T, Hash>::setValueIt( typename HashMap<I, T, Hash>::Iterator it, const T & v ) {
+	it -> setValue( v );
+}
+
+template<typename I, typename T, typename Hash>
+bool HashMap<I, T, Hash>::isEmpty() const {
+	return this -> size == Size( 0 );
+}
+
+template<typename I, typename T, typename Hash>
+Size HashMap<I, T, Hash>::getSize() const {
+	return this -> size;
+}
+
+template<typename I, typename T, typename Hash>
+Size HashMap<I, T, Hash>::getMaxSize() const {
+	return this -> capacity;
+}
+
+template<typename I, typename T, typename Hash>
+bool HashMap<I, T, Hash>::iterate( typename HashMap<I, T, Hash>::Iterator * it ) const {
+	const MapObject<I, T> * endIt( this -> slotTable + this -> capacity );
+	if ( ( *it ) == endIt )
+		return false;
+
+	Size slotI( Size( ( *it ) - this -> slotTable ) + Size( 1 ) );
+	while ( slotI < this -> capacity && this -> ctrlTable[ slotI ] < CtrlByte( 0 ) )
+		slotI++;
+
+	( *it ) = this -> slotTable + slotI;
+	return slotI < this -> capacity;
+}
+
+template<typename I, typename T, typename Hash>
+bool HashMap<I, T, Hash>::iterate( typename HashMap<I, T, Hash>::Iterator * it, I ** i, T ** v ) const {
+	if ( ( *it ) == getEnd() )
+		return false;
+
+	( *i ) = &( ( *it ) -> getIndex() );
+	( *v ) = &( ( *it ) -> getValue() );
+
+	iterate( it );
+	return true;
+}
+
+template<typename I, typename T, typename Hash>
+template<typename TestFunctor>
+bool HashMap<I, T, Hash>::iterate( typename HashMap<I, T, Hash>::Iterator * it, I ** i, T ** v, TestFunctor & testFunctor ) const {
+	if ( ( *it ) == getEnd() )
+		return false;
+
+	( *i ) = &( ( *it ) -> getIndex() );
+	( *v ) = &( ( *it ) -> getValue() );
+
+	if ( testFunctor( ( *v ) ) ) {
+		iterate( it );
+		return true;
+	} else {
+		return false;
+	}
+}
+
+template<typename I, typename T, typename Hash>
+typename HashMap<I, T, Hash>::Iterator HashMap<I, T, Hash>::getBegin() const {
+	Size slotI( 0 );
+	while ( slotI < this -> capacity && this -> ctrlTable[ slotI ] < CtrlByte( 0 ) )
+		slotI++;
+	return this -> slotTable + slotI;
+}
+
+template<typename I, typename T, typename Hash>
+typename HashMap<I, T, Hash>::Iterator HashMap<I, T, Hash>::begin() const {
+	return getBegin();
+}
+
+template<typename I, typename T, typename Hash>
+typename HashMap<I, T, Hash>::Iterator HashMap<I, T, Hash>::getEnd() const {
+	return this -> slotTable + this -> capacity;
+}
+
+template<typename I, typename T, typename Hash>
+typename HashMap<I, T, Hash>::Iterator HashMap<I, T, Hash>::end() const {
+	return getEnd();
+}
+
+template<typename I, typename T, typename Hash>
+template<typename S>
+S HashMap<I, T, Hash>::toString() const {
+	S string;
+	string.reserve( this -> size * Size( 20 ) + Size( 2 ) );
+	string << typename S::ElemType( '{' ) << typename S::ElemType( '\n' );
+	for ( auto it( getBegin() ); it != getEnd(); iterate( &it ) ) {
+		string << typename S::ElemType( '\t' ) << S( *it ) << typename S::ElemType( '\n' );
+	}
+	string << typename S::ElemType( '}' );
+	return string;
+}
+
+template<typename I, typename T, typename Hash>
+template<typename Stream>
+bool HashMap<I, T, Hash>::read( Stream * stream, int verbose ) {
+	_clear();
+
+	if ( !IO::read( stream, &this -> hashFunc, verbose - 1 ) ) {
+		_clear();
+		return false;
+	}
+
+	Size nbObjects;
+	if ( !IO::read( stream, &nbObjects, verbose - 1 ) ) {
+		_clear();
+		return false;
+	}
+
+	reserve( nbObjects );
+
+	MapObject<I, T> object;
+	for ( Size i( 0 ); i < nbObjects; i++ ) {
+		if ( !IO::read( stream, &object, verbose - 1 ) ) {
+			_clear();
+			return false;
+		}
+		insert( object.getIndex(), object.getValue() );
+	}
+
+	return true;
+}
+
+template<typename I, typename T, typename Hash>
+template<typename Stream>
+bool HashMap<I, T, Hash>::write( Stream * stream ) const {
+	if ( !IO::write( stream, &this -> hashFunc ) )
+		return false;
+
+	if ( !IO::write( stream, &this -> size ) )
+		return false;
+
+	for ( auto it( getBegin() ); it != getEnd(); iterate( &it ) ) {
+		if ( !IO::write( stream, it ) )
+			return false;
+	}
+
+	return true;
+}
+
+template<typename I, typename T, typename Hash>
+unsigned int HashMap<I, T, Hash>::_matchGroup( const CtrlByte * group, const CtrlByte b ) {
+#if defined HASHMAP_SSE2
+	const __m128i ctrl( _mm_loadu_si128( reinterpret_cast< const __m128i * >( group ) ) );
+	return static_cast< unsigned int >( _mm_movemask_epi8( _mm_cmpeq_epi8( ctrl, _mm_set1_epi8( b ) ) ) );
+#else
+	unsigned int mask( 0 );
+	for ( unsigned int i( 0 ); i < static_cast< unsigned int >( GroupSize ); i++ ) {
+		if ( group[ i ] == b )
+			mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
+
+template<typename I, typename T, typename Hash>
+unsigned int HashMap<I, T, Hash>::_matchGroupEmpty( const CtrlByte * group ) {
+	return _matchGroup( group, static_cast< CtrlByte >( Ctrl::Empty ) );
+}
+
+template<typename I, typename T, typename Hash>
+unsigned int HashMap<I, T, Hash>::_matchGroupFree( const CtrlByte * group ) {
+#if defined HASHMAP_SSE2
+	// Empty and Deleted are the only control bytes with the sign bit set.
+	const __m128i ctrl( _mm_loadu_si128( reinterpret_cast< const __m128i * >( group ) ) );
+	return static_cast< unsigned int >( _mm_movemask_epi8( ctrl ) );
+#else
+	unsigned int mask( 0 );
+	for ( unsigned int i( 0 ); i < static_cast< unsigned int >( GroupSize ); i++ ) {
+		if ( group[ i ] < CtrlByte( 0 ) )
+			mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
+
+template<typename I, typename T, typename Hash>
+unsigned int HashMap<I, T, Hash>::_lowestBit( unsigned int mask ) {
+#if defined _MSC_VER
+	unsigned long i;
+	_BitScanForward( &i, mask );
+	return static_cast< unsigned int >( i );
+#elif defined __GNUC__
+	return static_cast< unsigned int >( __builtin_ctz( mask ) );
+#else
+	unsigned int i( 0 );
+	while ( !( mask & 1u ) ) {
+		mask >>= 1u;
+		i++;
+	}
+	return i;
+#endif
+}
+
+template<typename I, typename T, typename Hash>
+Size HashMap<I, T, Hash>::_getH1( const Math::Hash::Value h ) {
+	return Size( h >> Math::Hash::Value( 7 ) );
+}
+
+template<typename I, typename T, typename Hash>
+typename HashMap<I, T, Hash>::CtrlByte HashMap<I, T, Hash>::_getH2( const Math::Hash::Value h ) {
+	return static_cast< CtrlByte >( h & Math::Hash::Value( 0x7F ) );
+}
+
+template<typename I, typename T, typename Hash>
+Size HashMap<I, T, Hash>::_getMaxLoad( const Size capacity ) {
+	// Max load factor of 7/8.
+	return capacity - ( capacity >> Size( 3 ) );
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <type_traits>
+
 #include "../SimpleLog.h"
 
 namespace IO {
@@ -26,6 +28,32 @@ namespace IO {
 
 	using BasicIO = BasicIOT<int>;
 
+	///@brief Tells if a type is written as its raw memory, a buffer of it being then written or read with a single stream call.
+	///			True for every type not inheriting from BasicIO, to be specialized for the BasicIO classes whose write() gives the bytes of their memory.
+	template<typename C>
+	struct IsRawSerializable : std::integral_constant<bool, !std::is_base_of<BasicIO, C>::value> {};
+
+	///@brief Write and read the buffers of a class inheriting from BasicIO : with a single stream call if IsRawSerializable, element by element otherwise.
+	///			To be specialized for the classes whose buffers can be written faster than element by element.
+	template<typename C>
+	struct BufferSerializer {
+		///@brief write a buffer of objects inside the file stream.
+		///@param stream file stream where to write.
+		///@param buffer pointer to the table of objects we wanna write.
+		///@param size number of elements in the table.
+		///@return Boolean if the result is a success or not.
+		template<typename Stream>
+		static bool write( Stream* stream, const C* buffer, Size size );
+
+		///@brief read from a file stream to a buffer of objects.
+		///@param stream file stream where to read.
+		///@param buffer pointer to the table of objects we wanna read.
+		///@param size number of elements in the table.
+		///@return Boolean if the result is a success or not.
+		template<typename Stream>
+		static bool read( Stream* stream, C* buffer, Size size, int verbose );
+	};
+
 	///@brief write an object inside the file stream, this function will automatically test if the sent object (by pointer) inherit from BasicIO himself and then call his own write method.
 	///@param stream file stream where to write.
 	///@param object pointer to the object we wanna write.
@@ -96,6 +124,12 @@ namespace IO {
 	template<typename Stream, typename C>
 	static bool _readBuffer( Stream* stream, C* buffer, Size size, int verbose, ... );
 
+	template<typename Stream, typename C>
+	static bool _writeRawBuffer( Stream* stream, const C* buffer, Size size );
+
+	template<typename Stream, typename C>
+	static bool _readRawBuffer( Stream* stream, C* buffer, Size size );
+
 }
 
 
@@ -15,18 +15,46 @@ namespace IO {
 		return true;
 	}
 
+	template<typename C>
+	template<typename Stream>
+	bool BufferSerializer<C>::write( Stream* stream, const C* buffer, Size size ) {
+		if constexpr ( IsRawSerializable<C>::value ) {
+			return _writeRawBuffer( stream, buffer, size );
+		} else {
+			for ( Size i = 0; i < size; i++ ) {
+				if ( !buffer[ i ].write( stream ) )
+					return false;
+			}
+			return true;
+		}
+	}
+
+	template<typename C>
+	template<typename Stream>
+	bool BufferSerializer<C>::read( Stream* stream, C* buffer, Size size, int verbose ) {
+		if constexpr ( IsRawSerializable<C>::value ) {
+			return _readRawBuffer( stream, buffer, size );
+		} else {
+			for ( Size i = 0; i < size; i++ ) {
+				if ( !buffer[ i ].read( stream, verbose ) )
+					return false;
+			}
+			return true;
+		}
+	}
+
 	template<typename Stream, typename C>
 	bool _writeObject( Stream* stream, const C* buffer, const BasicIO* b ) {
-		return buffer->write( stream );
+		if constexpr ( IsRawSerializable<C>::value ) {
+			return _writeRawBuffer( stream, buffer, Size( 1 ) );
+		} else {
+			return buffer->write( stream );
+		}
 	}
 
 	template<typename Stream, typename C>
 	bool _writeObject( Stream* stream, const C* buffer, ... ) {
-		DEBUG_SPP( Size expectedSize( sizeof( C ) ); Size beginPos( stream->getPosition() ););
-		bool r( stream->write( ( char* ) buffer, sizeof( C ) ) );
-		DEBUG_SPP( Size charWrote( stream->getPosition() - beginPos ););
-		_ASSERT_SPP( charWrote == expectedSize );
-		return r;
+		return _writeRawBuffer( stream, buffer, Size( 1 ) );
 	}
 
 	template<typename Stream, typename C>
@@ -38,16 +66,16 @@ namespace IO {
 
 	template<typename Stream, typename C>
 	bool _readObject( Stream* stream, C* buffer, int verbose, BasicIO* b ) {
-		return buffer->read( stream, verbose );
+		if constexpr ( IsRawSerializable<C>::value ) {
+			return _readRawBuffer( stream, buffer, Size( 1 ) );
+		} else {
+			return buffer->read( stream, verbose );
+		}
 	}
 
 	template<typename Stream, typename C>
 	bool _readObject( Stream* stream, C* buffer, int verbose, ... ) {
-		DEBUG_SPP( Size expectedSize( sizeof( C ) ); Size beginPos( stream->getPosition() ););
-		bool r( stream->read( ( char* ) buffer, sizeof( C ) ) );
-		DEBUG_SPP( Size charRead( stream->getPosition() - beginPos ););
-		_ASSERT_SPP( charRead == expectedSize );
-		return r;
+		return _readRawBuffer( stream, buffer, Size( 1 ) );
 	}
 
 	template<typename Stream, typename C>
@@ -76,35 +104,39 @@ namespace IO {
 
 	template<typename Stream, typename C>
 	bool _writeBuffer( Stream* stream, const C* buffer, Size size, const BasicIO* b ) {
-		for ( Size i = 0; i < size; i++ ) {
-			if ( !buffer[ i ].write( stream ) )
-				return false;
-		}
-		return true;
+		return BufferSerializer<C>::write( stream, buffer, size );
 	}
 
 	template<typename Stream, typename C>
 	bool _writeBuffer( Stream* stream, const C* buffer, Size size, ... ) {
-		DEBUG_SPP( Size expectedSize( sizeof( C ) * size ); Size beginPos( stream->getPosition() ););
-		bool r( stream->write( ( char* ) buffer, sizeof( C ) * size ) );
-		DEBUG_SPP( Size charWrote( stream->getPosition() - beginPos ););
-		_ASSERT_SPP( charWrote == expectedSize );
-		return r;
+		return _writeRawBuffer( stream, buffer, size );
 	}
 
 
 
 	template<typename Stream, typename C>
 	bool _readBuffer( Stream* stream, C* buffer, Size size, int verbose, BasicIO* b ) {
-		for ( Size i = 0; i < size; i++ ) {
-			if ( !buffer[ i ].read( stream, verbose ) )
-				return false;
-		}
-		return true;
+		return BufferSerializer<C>::read( stream, buffer, size, verbose );
 	}
 
 	template<typename Stream, typename C>
 	bool _readBuffer( Stream* stream, C* buffer, Size size, int verbose, ... ) {
+		return _readRawBuffer( stream, buffer, size );
+	}
+
+
+
+	template<typename Stream, typename C>
+	bool _writeRawBuffer( Stream* stream, const C* buffer, Size size ) {
+		DEBUG_SPP( Size expectedSize( sizeof( C ) * size ); Size beginPos( stream->getPosition() ););
+		bool r( stream->write( ( char* ) buffer, sizeof( C ) * size ) );
+		DEBUG_SPP( Size charWrote( stream->getPosition() - beginPos ););
+		_ASSERT_SPP( charWrote == expectedSize );
+		return r;
+	}
+
+	template<typename Stream, typename C>
+	bool _readRawBuffer( Stream* stream, C* buffer, Size size ) {
 		DEBUG_SPP( Size expectedSize( sizeof( C ) * size ); Size beginPos( stream->getPosition() ););
 		bool r( stream->read( ( char* ) buffer, sizeof( C ) * size ) );
 		DEBUG_SPP( Size charRead( stream->getPosition() - beginPos ););
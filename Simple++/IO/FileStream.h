@@ -61,6 +61,12 @@ namespace IO {
 		///@return True if success, False otherwise.
 		bool read( char* data, Size size );
 
+		///@brief read at most size bytes from the file at the current position, less if the end of the file is reached.
+		///@param data Buffer to be filled with the read data.
+		///@param size Maximum number of bytes to be read.
+		///@return Number of bytes read (0 if at the end of the file or if an error has occurred).
+		Size readSome( char* data, Size size );
+
 		///@brief	Flush.
 		void sync();
 
@@ -54,6 +54,12 @@ namespace IO {
 		return !hasFailed();
 	}
 
+	template<typename T>
+	Size FileStreamT<T>::readSome( char* data, Size size ) {
+		this->stream.read( data, size );
+		return Size( this->stream.gcount() );
+	}
+
 	template<typename T>
 	inline void FileStreamT<T>::sync() {
 		this->stream.sync();
@@ -5,6 +5,7 @@
 #include "BasicIO.h"
 #include "../OS/Path.h"
 #include "FileStream.h"
+#include "MappedFileStream.h"
 
 namespace IO {
 
@@ -22,6 +23,14 @@ namespace IO {
 	template<typename C>
 	static bool read( const OS::Path& filePath, C* object, int verbose = 0 );
 
+	///@brief Same as read() but the file is mapped in memory, the object reading directly from the mapping.
+	///			The file must not be truncated by another process while read (SIGBUS on POSIX), and can't be opened for writing by another one on Windows until then.
+	///@param filePath file where to read.
+	///@param object pointer to the object we wanna read.
+	///@return Boolean if the result is a success or not.
+	template<typename C>
+	static bool readMapped( const OS::Path& filePath, C* object, int verbose = 0 );
+
 	///@brief open the file and read the complete file (from begin to end) and allocate a new data and copy data inside.
 	///@param filePath file to read.
 	///@param data [out] data buffer to be allocated and filled with the content of the file.
@@ -44,6 +44,27 @@ namespace IO {
 		return true;
 	}
 
+	template<typename C>
+	bool readMapped( const OS::Path& filePath, C* object, int verbose ) {
+
+		if ( verbose > 0 ) { Log::startStep( __func__, String::format( "Reading a new file \"%\"...", filePath ) ); }
+
+		MappedFileStream stream( filePath, IO::OpenMode::Read );
+		if ( !stream.isOpen() ) {
+			if ( verbose > 0 ) { Log::endStepFailure( __func__, String::format( "Unable to open the file." ) ); }
+			return false;
+		}
+
+		if ( !IO::read( &stream, object, verbose ) ) {
+			if ( verbose > 0 ) { Log::endStepFailure( __func__, String::format( "Failed to read." ) ); }
+			return false;
+		}
+
+		if ( verbose > 0 ) { Log::endStepSuccess( __func__, String::format( "Success." ) ); }
+
+		return true;
+	}
+
 	template<typename T>
 	Size readToBuffer( const OS::Path& filePath, char** data, int verbose ) {
 
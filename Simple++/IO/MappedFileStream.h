@@ -0,0 +1,169 @@
+#pragma once
+
+#if defined WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "../OS/Path.h"
+#include "FileStream.h"
+
+
+namespace IO {
+
+	///@brief File mapped in memory, with the same read/write interface than FileStreamT, the templated read/write methods accepting both.
+	///			Reading is a copy from the mapping (or no copy at all with readData()), without any system call.
+	///			In write modes, the mapping grows by doubling with the writes and the file is cut to its written size when closed.
+	///			The file must not be truncated by another process while mapped : reading past its new end raises SIGBUS on POSIX. On Windows, the other processes can only open it for reading until closed.
+	///@template Should be a String Type (WString, UTF8String...)
+	template<typename T>
+	class MappedFileStreamT {
+	public:
+		///@brief Constructor. Directly open and map the file. Can be checked afterward with isOpen().
+		///			Position will be set to 0.
+		///@param filePath Path to be opened.
+		///@param openMode Mode to open the file : Read maps an existing file read-only, Write creates or truncates it, ReadWrite opens or creates it keeping its content.
+		///@param reservedSize (Optional) In the write modes, size to be mapped directly to avoid the remappings when the final size is known.
+		MappedFileStreamT( const OS::PathT<T>& filePath, OpenMode openMode = OpenMode::Read, Size reservedSize = Size( 0 ) );
+
+		///@brief Move constructor, the mapping and the file are taken from stream which is left closed.
+		///@param stream Stream to be moved.
+		MappedFileStreamT( MappedFileStreamT<T>&& stream );
+
+		///@brief Not copyable, the mapping and the file are owned by a single stream.
+		MappedFileStreamT( const MappedFileStreamT<T>& stream ) = delete;
+
+		~MappedFileStreamT();
+
+		///@brief Move operator, close this stream then take the mapping and the file of stream which is left closed.
+		///@param stream Stream to be moved.
+		///@return Reference to this.
+		MappedFileStreamT<T>& operator=( MappedFileStreamT<T>&& stream );
+
+		///@brief Not copyable, the mapping and the file are owned by a single stream.
+		MappedFileStreamT<T>& operator=( const MappedFileStreamT<T>& stream ) = delete;
+
+		///@brief Get the associated path.
+		///@return File Path.
+		const OS::PathT<T>& getPath() const;
+
+		///@brief Test if the file actually exists on the operating system. (Same as Path::exists()).
+		bool exists() const;
+
+		///@brief Unmap and close this object.
+		void close();
+
+		///@brief Read the whole file and convert it to a String Object.
+		///@template C Should be a BasicStringT.
+		///@param [out] stringP String to be modified.
+		///@return number of char read (-1) if an error has occurred.
+		template<typename C>
+		Size readToString( BasicString<C>* stringP );
+
+		///@brief Write data into this file at the current position, growing the file if needed.
+		///@param data data to be wrtitten into the file.
+		///@param size number of bytes to be written.
+		///@return True if success, False otherwise.
+		bool write( const char* data, Size size );
+
+		///@brief read data from the file at the current position.
+		///@param data Buffer to be filled with the read data.
+		///@param size Number of bytes to be read.
+		///@return True if success, False otherwise.
+		bool read( char* data, Size size );
+
+		///@brief read at most size bytes from the file at the current position, less if the end of the file is reached.
+		///@param data Buffer to be filled with the read data.
+		///@param size Maximum number of bytes to be read.
+		///@return Number of bytes read (0 if at the end of the file or if an error has occurred).
+		Size readSome( char* data, Size size );
+
+		///@brief Read data without any copy, advancing the position as read() would.
+		///@param size Number of bytes to be read.
+		///@return Pointer inside the mapping, valid until the next write or close (NULL if less than size bytes are left).
+		const char* readData( Size size );
+
+		///@brief Flush the mapping to the file.
+		void sync();
+
+		///@brief get the current position.
+		///@return Current position.
+		Size getPosition();
+
+		///@brief Set the current position from the beginning.
+		///@param position New position to be set.
+		void setPositionFromBegin( Size position );
+
+		///@brief Set the current position from the end.
+		///@param position Number of bytes before the end.
+		void setPositionFromEnd( Size position );
+
+		///@brief Check if the last operation has failed or not.
+		///@return True if failed, False otherwise.
+		bool hasFailed() const;
+
+		///@brief Check if the File is currently open.
+		///@return True if opened, False otherwise.
+		bool isOpen() const;
+
+		///@brief read the complete file stream (from begin to end) and allocate a new data and copy data inside.
+		///@param data [out] data buffer to be allocated and filled with the content of the file stream.
+		///@return number of char read if succeed, -1 otherwise. (Pointer will be set to NULL if failed, allocated otherwise.)
+		Size readToBuffer( char** buffer );
+
+		///@brief Get the content of the file without any copy.
+		///@return Pointer to the beginning of the mapping, valid until the next write or close (NULL if the file is empty).
+		const char* getData() const;
+
+		///@brief Get the size of the file (the written size in the write modes).
+		///@return Size in bytes.
+		Size getSize() const;
+
+		/************************************************************************/
+		/* OPERATOR STREAM                                                      */
+		/************************************************************************/
+
+		///@brief Add a Character to the file.
+		///@param c Byte to be added.
+		///@return Reference to this.
+		MappedFileStreamT<T>& operator<<( char c );
+
+		///@brief Add multiples characteres to file.
+		MappedFileStreamT<T>& operator<<( const char* buffer );
+
+	private:
+		///@brief Map the file with a new size, the file being extended if needed.
+		///@param mappingSize Size to be mapped.
+		///@return True if success, False otherwise.
+		bool _map( Size mappingSize );
+
+		void _unmap();
+
+		OS::PathT<T> filePath;
+		OpenMode openMode;
+
+	#if defined WIN32
+		HANDLE fileHandle;
+		HANDLE mappingHandle;
+	#else
+		int fileDescriptor;
+	#endif
+
+		char* data;
+		///@brief Size currently mapped (bigger than fileSize in the write modes).
+		Size mappingSize;
+		///@brief Size of the file content.
+		Size fileSize;
+		Size position;
+		bool bFailed;
+	};
+
+	using MappedFileStream = MappedFileStreamT<OS::Path::StringType>;
+
+}
+
+#include "MappedFileStream.hpp"
@@ -0,0 +1,373 @@
+#include "MappedFileStream.h"
+namespace IO {
+
+	template<typename T>
+	MappedFileStreamT<T>::MappedFileStreamT( const OS::PathT<T>& filePath, OpenMode openMode, Size reservedSize ) :
+		filePath( filePath ),
+		openMode( openMode ),
+	#if defined WIN32
+		fileHandle( INVALID_HANDLE_VALUE ),
+		mappingHandle( NULL ),
+	#else
+		fileDescriptor( -1 ),
+	#endif
+		data( NULL ),
+		mappingSize( 0 ),
+		fileSize( 0 ),
+		position( 0 ),
+		bFailed( false ) {
+
+	#if defined WIN32
+		const DWORD desiredAccess( ( openMode == OpenMode::Read ) ? GENERIC_READ : ( GENERIC_READ | GENERIC_WRITE ) );
+		const DWORD creationDisposition( ( openMode == OpenMode::Read ) ? OPEN_EXISTING : ( ( openMode == OpenMode::Write ) ? CREATE_ALWAYS : OPEN_ALWAYS ) );
+		if constexpr ( sizeof( typename T::ElemType ) == sizeof( wchar_t ) ) {
+			this->fileHandle = CreateFileW( reinterpret_cast< const wchar_t* >( filePath.getData() ), desiredAccess, FILE_SHARE_READ, NULL, creationDisposition, FILE_ATTRIBUTE_NORMAL, NULL );
+		} else {
+			this->fileHandle = CreateFileA( reinterpret_cast< const char* >( filePath.getData() ), desiredAccess, FILE_SHARE_READ, NULL, creationDisposition, FILE_ATTRIBUTE_NORMAL, NULL );
+		}
+		if ( this->fileHandle == INVALID_HANDLE_VALUE ) {
+			this->bFailed = true;
+			return;
+		}
+
+		LARGE_INTEGER fileSizeLI;
+		if ( !GetFileSizeEx( this->fileHandle, &fileSizeLI ) ) {
+			this->bFailed = true;
+			close();
+			return;
+		}
+		this->fileSize = Size( fileSizeLI.QuadPart );
+	#else
+		const int flags( ( openMode == OpenMode::Read ) ? O_RDONLY : ( ( openMode == OpenMode::Write ) ? ( O_RDWR | O_CREAT | O_TRUNC ) : ( O_RDWR | O_CREAT ) ) );
+		this->fileDescriptor = ::open( reinterpret_cast< const char* >( filePath.getData() ), flags, 0644 );
+		if ( this->fileDescriptor < 0 ) {
+			this->bFailed = true;
+			return;
+		}
+
+		struct stat fileStat;
+		if ( fstat( this->fileDescriptor, &fileStat ) != 0 ) {
+			this->bFailed = true;
+			close();
+			return;
+		}
+		this->fileSize = Size( fileStat.st_size );
+	#endif
+
+		// An empty file can't be mapped, it will be when written.
+		const Size sizeToMap( ( openMode == OpenMode::Read ) ? this->fileSize : Math::max( this->fileSize, reservedSize ) );
+		if ( sizeToMap > Size( 0 ) && !_map( sizeToMap ) ) {
+			this->bFailed = true;
+			close();
+		}
+	}
+
+	template<typename T>
+	MappedFileStreamT<T>::MappedFileStreamT( MappedFileStreamT<T>&& stream ) :
+		filePath( Utility::toRValue( stream.filePath ) ),
+		openMode( stream.openMode ),
+	#if defined WIN32
+		fileHandle( stream.fileHandle ),
+		mappingHandle( stream.mappingHandle ),
+	#else
+		fileDescriptor( stream.fileDescriptor ),
+	#endif
+		data( stream.data ),
+		mappingSize( stream.mappingSize ),
+		fileSize( stream.fileSize ),
+		position( stream.position ),
+		bFailed( stream.bFailed ) {
+
+		// Leave stream closed, it's destructor has nothing to release.
+	#if defined WIN32
+		stream.fileHandle = INVALID_HANDLE_VALUE;
+		stream.mappingHandle = NULL;
+	#else
+		stream.fileDescriptor = -1;
+	#endif
+		stream.data = NULL;
+		stream.mappingSize = Size( 0 );
+		stream.fileSize = Size( 0 );
+		stream.position = Size( 0 );
+	}
+
+	template<typename T>
+	inline MappedFileStreamT<T>::~MappedFileStreamT() {
+		close();
+	}
+
+	template<typename T>
+	MappedFileStreamT<T>& MappedFileStreamT<T>::operator=( MappedFileStreamT<T>&& stream ) {
+		if ( &stream == this ) {
+			return *this;
+		}
+		close();
+
+		this->filePath = Utility::toRValue( stream.filePath );
+		this->openMode = stream.openMode;
+	#if defined WIN32
+		this->fileHandle = stream.fileHandle;
+		this->mappingHandle = stream.mappingHandle;
+		stream.fileHandle = INVALID_HANDLE_VALUE;
+		stream.mappingHandle = NULL;
+	#else
+		this->fileDescriptor = stream.fileDescriptor;
+		stream.fileDescriptor = -1;
+	#endif
+		this->data = stream.data;
+		this->mappingSize = stream.mappingSize;
+		this->fileSize = stream.fileSize;
+		this->position = stream.position;
+		this->bFailed = stream.bFailed;
+
+		stream.data = NULL;
+		stream.mappingSize = Size( 0 );
+		stream.fileSize = Size( 0 );
+		stream.position = Size( 0 );
+
+		return *this;
+	}
+
+	template<typename T>
+	const OS::PathT<T>& MappedFileStreamT<T>::getPath() const {
+		return this->filePath;
+	}
+
+	template<typename T>
+	bool MappedFileStreamT<T>::exists() const {
+		return this->filePath.exists();
+	}
+
+	template<typename T>
+	void MappedFileStreamT<T>::close() {
+		if ( !isOpen() ) {
+			return;
+		}
+
+		_unmap();
+
+	#if defined WIN32
+		// The mapping may have grown over what was written.
+		if ( this->openMode != OpenMode::Read ) {
+			LARGE_INTEGER fileSizeLI;
+			fileSizeLI.QuadPart = LONGLONG( this->fileSize );
+			SetFilePointerEx( this->fileHandle, fileSizeLI, NULL, FILE_BEGIN );
+			SetEndOfFile( this->fileHandle );
+		}
+		CloseHandle( this->fileHandle );
+		this->fileHandle = INVALID_HANDLE_VALUE;
+	#else
+		if ( this->openMode != OpenMode::Read ) {
+			if ( ftruncate( this->fileDescriptor, off_t( this->fileSize ) ) != 0 ) {
+				this->bFailed = true;
+			}
+		}
+		::close( this->fileDescriptor );
+		this->fileDescriptor = -1;
+	#endif
+	}
+
+	template<typename T>
+	template<typename C>
+	Size MappedFileStreamT<T>::readToString( BasicString<C>* stringP ) {
+		setPositionFromBegin( 0 );
+
+		if ( ( *stringP ).read( this, this->fileSize ) ) {
+			return stringP->getSize();
+		} else {
+			return Size( -1 );
+		}
+	}
+
+	template<typename T>
+	bool MappedFileStreamT<T>::write( const char* data, Size size ) {
+		if ( this->openMode == OpenMode::Read || !isOpen() ) {
+			this->bFailed = true;
+			return false;
+		}
+
+		const Size endPosition( this->position + size );
+		if ( endPosition > this->mappingSize ) {
+			Size newMappingSize( Math::max( this->mappingSize * Size( 2 ), Size( 4096 ) ) );
+			while ( newMappingSize < endPosition ) {
+				newMappingSize *= Size( 2 );
+			}
+			if ( !_map( newMappingSize ) ) {
+				this->bFailed = true;
+				return false;
+			}
+		}
+
+		Utility::copy( this->data + this->position, data, size );
+		this->position = endPosition;
+		this->fileSize = Math::max( this->fileSize, endPosition );
+		this->bFailed = false;
+		return true;
+	}
+
+	template<typename T>
+	bool MappedFileStreamT<T>::read( char* data, Size size ) {
+		if ( size == Size( 0 ) ) {
+			return true;
+		}
+		const char* dataRead( readData( size ) );
+		if ( !dataRead ) {
+			return false;
+		}
+		Utility::copy( data, dataRead, size );
+		return true;
+	}
+
+	template<typename T>
+	Size MappedFileStreamT<T>::readSome( char* data, Size size ) {
+		if ( this->position >= this->fileSize ) {
+			return Size( 0 );
+		}
+		const Size nbRead( Math::min( size, this->fileSize - this->position ) );
+		Utility::copy( data, this->data + this->position, nbRead );
+		this->position += nbRead;
+		return nbRead;
+	}
+
+	template<typename T>
+	const char* MappedFileStreamT<T>::readData( Size size ) {
+		if ( this->position > this->fileSize || size > this->fileSize - this->position ) {
+			this->bFailed = true;
+			return NULL;
+		}
+		const char* dataRead( this->data + this->position );
+		this->position += size;
+		this->bFailed = false;
+		return dataRead;
+	}
+
+	template<typename T>
+	void MappedFileStreamT<T>::sync() {
+		if ( !this->data || this->openMode == OpenMode::Read ) {
+			return;
+		}
+	#if defined WIN32
+		FlushViewOfFile( this->data, 0 );
+	#else
+		msync( this->data, this->mappingSize, MS_ASYNC );
+	#endif
+	}
+
+	template<typename T>
+	inline Size MappedFileStreamT<T>::getPosition() {
+		return this->position;
+	}
+
+	template<typename T>
+	inline void MappedFileStreamT<T>::setPositionFromBegin( Size position ) {
+		this->position = position;
+	}
+
+	template<typename T>
+	inline void MappedFileStreamT<T>::setPositionFromEnd( Size position ) {
+		this->position = this->fileSize - Math::min( position, this->fileSize );
+	}
+
+	template<typename T>
+	inline bool MappedFileStreamT<T>::hasFailed() const {
+		return this->bFailed;
+	}
+
+	template<typename T>
+	inline bool MappedFileStreamT<T>::isOpen() const {
+	#if defined WIN32
+		return this->fileHandle != INVALID_HANDLE_VALUE;
+	#else
+		return this->fileDescriptor >= 0;
+	#endif
+	}
+
+	template<typename T>
+	Size MappedFileStreamT<T>::readToBuffer( char** buffer ) {
+		if ( this->fileSize ) {
+			*buffer = new char[ this->fileSize ];
+			Utility::copy( *buffer, this->data, this->fileSize );
+		} else {
+			*buffer = NULL;
+			return Size( -1 );
+		}
+
+		return this->fileSize;
+	}
+
+	template<typename T>
+	inline const char* MappedFileStreamT<T>::getData() const {
+		return this->data;
+	}
+
+	template<typename T>
+	inline Size MappedFileStreamT<T>::getSize() const {
+		return this->fileSize;
+	}
+
+	template<typename T>
+	MappedFileStreamT<T>& MappedFileStreamT<T>::operator<<( char c ) {
+		write( &c, Size( 1 ) );
+		return *this;
+	}
+
+	template<typename T>
+	MappedFileStreamT<T>& MappedFileStreamT<T>::operator<<( const char* buffer ) {
+		write( buffer, BasicString<char>::getSize( buffer ) );
+		return *this;
+	}
+
+	template<typename T>
+	bool MappedFileStreamT<T>::_map( Size mappingSize ) {
+		_unmap();
+
+	#if defined WIN32
+		// In the write modes, mapping more than the file size extends it.
+		const unsigned long long int mappingSizeULL( mappingSize );
+		this->mappingHandle = CreateFileMappingW( this->fileHandle, NULL, ( this->openMode == OpenMode::Read ) ? PAGE_READONLY : PAGE_READWRITE, DWORD( mappingSizeULL >> 32 ), DWORD( mappingSizeULL & 0xFFFFFFFFULL ), NULL );
+		if ( !this->mappingHandle ) {
+			return false;
+		}
+		this->data = reinterpret_cast< char* >( MapViewOfFile( this->mappingHandle, ( this->openMode == OpenMode::Read ) ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, SIZE_T( mappingSize ) ) );
+		if ( !this->data ) {
+			CloseHandle( this->mappingHandle );
+			this->mappingHandle = NULL;
+			return false;
+		}
+	#else
+		if ( this->openMode != OpenMode::Read ) {
+			if ( ftruncate( this->fileDescriptor, off_t( mappingSize ) ) != 0 ) {
+				return false;
+			}
+		}
+		void* mapping( mmap( NULL, mappingSize, ( this->openMode == OpenMode::Read ) ? PROT_READ : ( PROT_READ | PROT_WRITE ), MAP_SHARED, this->fileDescriptor, 0 ) );
+		if ( mapping == MAP_FAILED ) {
+			return false;
+		}
+		this->data = reinterpret_cast< char* >( mapping );
+	#endif
+
+		this->mappingSize = mappingSize;
+		return true;
+	}
+
+	template<typename T>
+	void MappedFileStreamT<T>::_unmap() {
+		if ( this->data ) {
+		#if defined WIN32
+			UnmapViewOfFile( this->data );
+		#else
+			munmap( this->data, this->mappingSize );
+		#endif
+			this->data = NULL;
+		}
+	#if defined WIN32
+		if ( this->mappingHandle ) {
+			CloseHandle( this->mappingHandle );
+			this->mappingHandle = NULL;
+		}
+	#endif
+		this->mappingSize = Size( 0 );
+	}
+
+}
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstring>
+
 #include "../Log.h"
 #include "../UTF8String.h"
 #include "../IO/IO.h"
@@ -20,18 +22,22 @@
 #include "NodeValue.h"
 #include "NodeArray.h"
 #include "NodeMap.h"
+#include "StructuralIndex.h"
 
 
 namespace JSON {
 
 	///@brief Read this object using a pointer to a String Iterator.
+	///			A null terminated buffer of single byte characters is parsed in two stages : a StructuralIndex is built 64 bytes at a time, then the nodes are built by walking it.
+	///			Whatever the second stage does not read exactly as the byte by byte parser (an error included) is parsed again by the byte by byte parser, the trees are then always the same.
 	///@param buffer Pointer to a String iterator
 	///@param endFunc Functor to check the buffer end.
+	///@param arena (Optional) Arena where to place the nodes (NULL to use the heap), has to outlive them.
 	///@return bool True if success, False otherwise.
 	template<typename S = UTF8String, typename C = S::ElemType, typename EndFunc = BasicString<C>::IsEndSentinel>
-	NodeT<S>* parseT( const C** buffer, const EndFunc& endFunc = BasicString<C>::IS_END_SENTINEL );
+	NodeT<S>* parseT( const C** buffer, const EndFunc& endFunc = BasicString<C>::IS_END_SENTINEL, MemoryArena* arena = NULL );
 	template<typename S = UTF8String, typename C = S::ElemType, typename EndFunc = BasicString<C>::IsEndSentinel>
-	NodeT<S>* parseT( const C* buffer, const EndFunc& endFunc = BasicString<C>::IS_END_SENTINEL );
+	NodeT<S>* parseT( const C* buffer, const EndFunc& endFunc = BasicString<C>::IS_END_SENTINEL, MemoryArena* arena = NULL );
 
 	///@brief read this object using a type S.
 	///@param str String to read from.
@@ -39,6 +45,16 @@ namespace JSON {
 	template<typename S>
 	NodeT<S>* parseT( const S& str );
 
+	/** @brief	Private, do not use it */
+	template<typename S, typename C, typename EndFunc>
+	NodeT<S>* _parseT( const C** buffer, const EndFunc& endFunc, MemoryArena* arena );
+	/** @brief	Private, do not use it */
+	template<typename S, typename C>
+	NodeT<S>* _parseIndexedT( const C** buffer, MemoryArena* arena );
+	/** @brief	Private, do not use it */
+	template<typename S, typename C>
+	NodeT<S>* _parseIndexedValueT( const C* buffer, const unsigned int* indexTable, Size* indexI, Size* endI, MemoryArena* arena );
+
 
 	///@brief	Get a child node using it's name from a parent node and set the value to the given variable.
 	///			Powerfull method using type overloading to automatically convert the Node value to the correct type.
@@ -88,6 +104,10 @@ namespace JSON {
 	NodeT<S>* _toJSON( const C& v, const Jsonable* );
 	template<typename S, typename C>
 	NodeT<S>* _toJSON( const C& v, ... );
+	template<typename S>
+	NodeT<S>* _toJSON( const double& v, const double* );
+	template<typename S>
+	NodeT<S>* _toJSON( const float& v, const float* );
 
 	///@brief write an object to the file, this function will automatically test if the sent object (by pointer) inherit from BasicIO JSON::Jsonable and then call his own fromJSON method.
 	///@param filePath file where to write.
@@ -103,7 +123,15 @@ namespace JSON {
 	template<typename S = UTF8String, typename C>
 	bool read( const OS::Path& filePath, C* object, int verbose = 0 );
 
+	///@brief read from a file to an object like read(), but through a LazyDocumentT : only the nodes read by fromJSON() are created.
+	///@param filePath file where to read.
+	///@param object pointer to the object we wanna read.
+	///@return Boolean if the result is a success or not.
+	template<typename S = UTF8String, typename C>
+	bool readLazy( const OS::Path& filePath, C* object, int verbose = 0 );
+
 }
 
 
-#include "Json.hpp"
\ No newline at end of file
+#include "Json.hpp"
+#include "LazyDocument.h"
\ No newline at end of file
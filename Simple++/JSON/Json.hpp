@@ -2,7 +2,29 @@
 namespace JSON {
 
 	template<typename S, typename C, typename EndFunc>
-	NodeT<S>* parseT( const C** buffer, const EndFunc& endFunc ) {
+	NodeT<S>* parseT( const C** buffer, const EndFunc& endFunc, MemoryArena* arena ) {
+		if constexpr ( sizeof( C ) == 1 && Utility::isSame<EndFunc, typename BasicString<C>::IsEndSentinel>::value ) {
+			NodeT<S>* newNode( _parseIndexedT<S, C>( buffer, arena ) );
+			if ( newNode ) {
+				return newNode;
+			}
+		}
+		return _parseT<S, C, EndFunc>( buffer, endFunc, arena );
+	}
+
+	template<typename S, typename C, typename EndFunc>
+	NodeT<S>* parseT( const C* buffer, const EndFunc& endFunc, MemoryArena* arena ) {
+		return parseT<S, C, EndFunc>( &buffer, endFunc, arena );
+	}
+
+	template<typename S>
+	NodeT<S>* parseT( const S& str ) {
+		const typename S::ElemType* buffer( str.toCString() );
+		return parseT<S, typename S::ElemType>( buffer );
+	}
+
+	template<typename S, typename C, typename EndFunc>
+	NodeT<S>* _parseT( const C** buffer, const EndFunc& endFunc, MemoryArena* arena ) {
 		struct FunctorSpace {
 			bool operator()( const C& c ) { return c == C( '\n' ) || c == C( '\r' ) || c == C( '\t' ) || c == C( ' ' ); }
 		};
@@ -13,25 +35,28 @@ namespace JSON {
 		while ( functorSpace( *it ) ) it++;
 
 		if ( ( *it ) == C( '{' ) ) {
-			NodeMapT<S>* newNode( new NodeMapT<S>() );
+			NodeMapT<S>* newNode( NodeT<S>::template _newNode<NodeMapT<S>>( arena ) );
 
 			if ( !newNode -> readJSON( &it, endFunc ) ) {
+				NodeT<S>::_deleteNode( newNode );
 				return NULL;
 			} else {
 				return newNode;
 			}
 		} else if ( ( *it ) == C( '[' ) ) {
-			NodeArrayT<S>* newNode( new NodeArrayT<S>() );
+			NodeArrayT<S>* newNode( NodeT<S>::template _newNode<NodeArrayT<S>>( arena ) );
 
 			if ( !newNode -> readJSON( &it, endFunc ) ) {
+				NodeT<S>::_deleteNode( newNode );
 				return NULL;
 			} else {
 				return newNode;
 			}
 		} else {
-			NodeValueT<S>* newNode( new NodeValueT<S>() );
+			NodeValueT<S>* newNode( NodeT<S>::template _newNode<NodeValueT<S>>( arena ) );
 
 			if ( !newNode -> readJSON( &it, endFunc ) ) {
+				NodeT<S>::_deleteNode( newNode );
 				return NULL;
 			} else {
 				return newNode;
@@ -41,15 +66,181 @@ namespace JSON {
 		return NULL;
 	}
 
-	template<typename S, typename C, typename EndFunc>
-	NodeT<S>* parseT( const C* buffer, const EndFunc& endFunc ) {
-		return parseT<S, C, EndFunc>( &buffer, endFunc );
+	template<typename S, typename C>
+	NodeT<S>* _parseIndexedT( const C** buffer, MemoryArena* arena ) {
+		struct FunctorSpace {
+			bool operator()( const C& c ) { return c == C( '\n' ) || c == C( '\r' ) || c == C( '\t' ) || c == C( ' ' ); }
+		};
+		static FunctorSpace functorSpace;
+
+		const C*& it( *buffer );
+
+		// Stage 1.
+		StructuralIndex structuralIndex;
+		if ( !structuralIndex.build( reinterpret_cast< const char* >( it ), Size( std::strlen( reinterpret_cast< const char* >( it ) ) ) ) ) {
+			return NULL;
+		}
+
+		// The value begin at the first non space character.
+		Size beginI( 0 );
+		while ( functorSpace( it[ beginI ] ) ) beginI++;
+		if ( structuralIndex.getSize() == Size( 0 ) || structuralIndex.getData()[ 0 ] != beginI ) {
+			return NULL;
+		}
+
+		// Stage 2.
+		Size indexI( 0 );
+		Size endI;
+		NodeT<S>* newNode( _parseIndexedValueT<S, C>( it, structuralIndex.getData(), &indexI, &endI, arena ) );
+		if ( newNode ) {
+			it += endI;
+		}
+		return newNode;
 	}
 
-	template<typename S>
-	NodeT<S>* parseT( const S& str ) {
-		const typename S::ElemType* buffer( str.toCString() );
-		return parse<S, S::ElemType>( buffer );
+	template<typename S, typename C>
+	NodeT<S>* _parseIndexedValueT( const C* buffer, const unsigned int* indexTable, Size* indexI, Size* endI, MemoryArena* arena ) {
+		// Same functors than the byte by byte parser.
+		struct FunctorNodeName {
+			bool operator()( const C& c ) { return c != C( '"' ) && c != C( '\t' ) && c != C( '\n' ); }
+		};
+		struct FunctorContent {
+			bool operator()( const C& c ) { return c != C( ',' ) && c != C( '}' ) && c != C( ']' ) && c != C( ' ' ); }
+		};
+		struct FunctorSpace {
+			bool operator()( const C& c ) { return c == C( '\n' ) || c == C( '\r' ) || c == C( '\t' ) || c == C( ' ' ); }
+		};
+		static FunctorNodeName functorNodeName;
+		static FunctorContent functorContent;
+		static FunctorSpace functorSpace;
+
+		// Every position is followed by at least the end marker, NULL is returned as soon as something is not read exactly as the byte by byte parser would.
+		Size& i( *indexI );
+		const Size beginI( indexTable[ i ] );
+
+		if ( buffer[ beginI ] == C( '{' ) ) {
+			NodeMapT<S>* newNode( NodeT<S>::template _newNode<NodeMapT<S>>( arena ) );
+			i++;
+
+			while ( true ) {
+				const Size nameBeginI( indexTable[ i ] );
+				if ( buffer[ nameBeginI ] == C( '}' ) ) {
+					i++;
+					*endI = nameBeginI + Size( 1 );
+					return newNode;
+				}
+				if ( buffer[ nameBeginI ] != C( '"' ) ) {
+					break;
+				}
+
+				// The name end at the first quote, tabulation or new line.
+				const Size nameEndI( indexTable[ i + Size( 1 ) ] );
+				if ( nameEndI == nameBeginI + Size( 1 ) ) {
+					break;
+				}
+				Size nameI( nameBeginI + Size( 1 ) );
+				while ( nameI < nameEndI && functorNodeName( buffer[ nameI ] ) ) nameI++;
+				if ( nameI != nameEndI || buffer[ indexTable[ i + Size( 2 ) ] ] != C( ':' ) ) {
+					break;
+				}
+				i += Size( 3 );
+
+				NodeT<S>* childNode( _parseIndexedValueT<S, C>( buffer, indexTable, indexI, endI, arena ) );
+				if ( !childNode ) {
+					break;
+				}
+				childNode -> setName( S( buffer + nameBeginI + Size( 1 ), nameEndI - nameBeginI - Size( 1 ) ) );
+				newNode -> addChild( childNode );
+
+				const Size nextI( indexTable[ i ] );
+				if ( buffer[ nextI ] == C( ',' ) ) {
+					i++;
+				} else if ( buffer[ nextI ] != C( '}' ) ) {
+					break;
+				}
+			}
+
+			NodeT<S>::_deleteNode( newNode );
+			return NULL;
+		} else if ( buffer[ beginI ] == C( '[' ) ) {
+			NodeArrayT<S>* newNode( NodeT<S>::template _newNode<NodeArrayT<S>>( arena ) );
+			i++;
+
+			bool bSuccess( buffer[ indexTable[ i ] ] == C( ']' ) );
+			while ( !bSuccess ) {
+				NodeT<S>* childNode( _parseIndexedValueT<S, C>( buffer, indexTable, indexI, endI, arena ) );
+				if ( !childNode ) {
+					break;
+				}
+				newNode -> addChild( childNode );
+
+				const Size nextI( indexTable[ i ] );
+				if ( buffer[ nextI ] == C( ']' ) ) {
+					bSuccess = true;
+				} else if ( buffer[ nextI ] != C( ',' ) ) {
+					break;
+				} else {
+					i++;
+					// A ']' after a ',' is read differently depending on the spaces between them.
+					if ( buffer[ indexTable[ i ] ] == C( ']' ) ) {
+						break;
+					}
+				}
+			}
+
+			if ( !bSuccess ) {
+				NodeT<S>::_deleteNode( newNode );
+				return NULL;
+			}
+
+			Size afterI( indexTable[ i ] + Size( 1 ) );
+			while ( functorSpace( buffer[ afterI ] ) ) afterI++;
+			i++;
+			*endI = afterI;
+			return newNode;
+		} else if ( buffer[ beginI ] == C( '"' ) ) {
+			// The closing quote is always indexed after the opening one.
+			const Size valueEndI( indexTable[ i + Size( 1 ) ] );
+			NodeValueT<S>* newNode( NodeT<S>::template _newNode<NodeValueT<S>>( arena ) );
+			newNode -> _setValueJSON( buffer + beginI + Size( 1 ), valueEndI - beginI - Size( 1 ), true );
+			i += Size( 2 );
+			*endI = valueEndI + Size( 1 );
+			return newNode;
+		} else if ( buffer[ beginI ] == C( ':' ) || buffer[ beginI ] == C( ',' ) || buffer[ beginI ] == C( '}' ) || buffer[ beginI ] == C( ']' ) ) {
+			return NULL;
+		}
+
+		// Unquoted value, read until ',', '}', ']' or ' ' (new lines and tabulations included).
+		Size valueEndI( beginI );
+		while ( true ) {
+			if ( buffer[ valueEndI ] == C( '\0' ) ) {
+				return NULL;
+			}
+			if ( !functorContent( buffer[ valueEndI ] ) ) {
+				break;
+			}
+			valueEndI++;
+		}
+
+		// Only the beginnings of other unquoted values can be indexed inside it, the next position has to be the next non space character.
+		i++;
+		while ( indexTable[ i ] < valueEndI ) {
+			const C c( buffer[ indexTable[ i ] ] );
+			if ( c == C( '"' ) || c == C( '{' ) || c == C( '[' ) || c == C( ':' ) ) {
+				return NULL;
+			}
+			i++;
+		}
+		Size nextI( valueEndI );
+		while ( functorSpace( buffer[ nextI ] ) ) nextI++;
+		if ( indexTable[ i ] != nextI ) {
+			return NULL;
+		}
+
+		NodeValueT<S>* newNode( NodeT<S>::template _newNode<NodeValueT<S>>( arena ) );
+		newNode -> _setValueJSON( buffer + beginI, valueEndI - beginI, false );
+		*endI = valueEndI;
+		return newNode;
 	}
 
 	template<typename S, typename C>
@@ -294,6 +485,17 @@ namespace JSON {
 		return new NodeValueT<S>( S::toString( v ) );
 	}
 
+	template<typename S>
+	NodeT<S>* _toJSON( const double& v, const double* ) {
+		// Unquoted number with the shortest digits reading back to the same value.
+		return new NodeValueT<S>( v );
+	}
+
+	template<typename S>
+	NodeT<S>* _toJSON( const float& v, const float* ) {
+		return new NodeValueT<S>( v );
+	}
+
 	template<typename S, typename C>
 	bool write( const OS::Path& filePath, const C* object, int verbose ) {
 		if ( verbose > 0 ) { Log::startStep( __func__, String::format( "Writting a JSON file \"%\"...", filePath ) ); }
@@ -339,6 +541,28 @@ namespace JSON {
 		return true;
 	}
 
+	template<typename S, typename C>
+	bool readLazy( const OS::Path& filePath, C* object, int verbose ) {
+
+		if ( verbose > 0 ) { Log::startStep( __func__, String::format( "Reading a JSON objet." ) ); }
+
+		// Only the nodes read by fromJSON() are loaded.
+		JSON::LazyDocumentT<S> document;
+		if ( !document.readFileJSON( filePath, verbose - 1 ) || !document.getRoot() || document.getRoot() -> getType() != NodeT<S>::Type::Map ) {
+			if ( verbose > 0 ) { Log::endStepFailure( __func__, String::format( "Failed to read the file \"%\".", filePath ) ); }
+			return false;
+		}
+
+		if ( !fromJSON( document.getRoot(), object, verbose - 1 ) ) {
+			if ( verbose > 0 ) { Log::endStepFailure( __func__, String::format( "Failed to read the JSON::Node \"%\".", filePath ) ); }
+			return false;
+		}
+
+		if ( verbose > 0 ) { Log::endStepSuccess( __func__, String::format( "Success.", filePath ) ); }
+
+		return true;
+	}
+
 	template<typename S>
 	inline bool Jsonable::fromJSON( const JSON::NodeT<S>* node, int verbose ) {
 		ERROR_SPP( "Jsonable not overloaded the fromJSON method." );
@@ -0,0 +1,123 @@
+///@file JSON/LazyDocument.h
+///@brief Declares a JSON document loading it's nodes only when they are first accessed.
+#pragma once
+
+#include "../MemoryArena.h"
+#include "../Vector.h"
+
+#include "Json.h"
+#include "StructuralIndex.h"
+
+namespace JSON {
+
+	///@brief JSON document keeping it's source buffer and creating the nodes only when they are first accessed.
+	///			The buffer is checked once with a StructuralIndex, the root is then created empty : the children of a Map/Array are created when one of them is first accessed (getChildren(), getChild(), getElementsByName(), toString()...),
+	///			the names being copied at this time and the value of a Value only when getValue() is first called.
+	///			The nodes are the usual NodeMapT/NodeArrayT/NodeValueT ones (fromJSON() can read them) and are always the same than the ones parseT() would give.
+	///			Whatever the structural index can not describe exactly is parsed at once instead (the document is then not lazy).
+	///			The nodes live inside the arena of the document and have NOT to outlive it.
+	///			NOT thread safe, even through const methods : reading a node not loaded yet (getChildren(), getValue()... of a const node included) creates it's children or value without any lock.
+	///			A document shared between threads has to be locked by the caller, or fully loaded first (toString() for example).
+	template<typename S>
+	class LazyDocumentT : public IO::BasicIO {
+	public:
+		///@brief Element type of the buffer, a single byte one.
+		typedef typename S::ElemType C;
+
+		///@brief Create a new empty JSON LazyDocumentT.
+		LazyDocumentT();
+
+		///@brief Create a new JSON LazyDocumentT using a string to be parsed.
+		///@param str String to be parsed, copied (or moved) into the document.
+		LazyDocumentT( const S& str );
+		LazyDocumentT( S&& str );
+
+		///@brief Destructor, every loaded node is destroyed, their blocks being released at once with the arena.
+		~LazyDocumentT();
+
+		///@brief Get the root Node of this LazyDocumentT. Can be NULL.
+		///@return Pointer to the root Node of this LazyDocumentT. Can be NULL;
+		const NodeT<S>* getRoot() const;
+		NodeT<S>* getRoot();
+
+		///@brief Get the buffer the nodes are read from.
+		///@return Buffer.
+		const S& getBuffer() const;
+
+		///@brief Get the arena where the nodes of this LazyDocumentT are placed.
+		///@return Arena of this LazyDocumentT.
+		const MemoryArena& getArena() const;
+
+		///@brief Get if the nodes are loaded when first accessed (False if the buffer had to be parsed at once).
+		///@return True if lazy, False otherwise.
+		bool isLazy() const;
+
+		///@brief Get the first pointer to the node corresponding to the name searched in this sub tree (every map of it is then loaded until found).
+		///@param name Name to look for
+		///@return NodeT<S> pointer with the searched name or NULL if none.
+		NodeT<S>* getElementByName( const S& name ) const;
+
+		///@brief Get a vector filled by pointer to all the node corresponding to the name searched in this sub tree (every map of it is then loaded).
+		///@param name Name to look for
+		///@return Vector of NodeT<S>'s pointers with the searched name
+		Vector< NodeT<S>* > getElementsByName( const S& name ) const;
+
+		///@brief Read this object as an JSON file
+		///@param filePath Where to read
+		///@return True if success, False otherwise
+		bool readFileJSON( const OS::Path& filePath, int verbose = 0 );
+
+		///@brief Read this object using a type S.
+		///@param str String to read from, copied (or moved) into the document.
+		///@return bool True if success, False otherwise.
+		bool readJSON( const S& str );
+		bool readJSON( S&& str );
+
+		///@brief Print an human-readable String of this LazyDocumentT (every node is then loaded).
+		///@param indent Identation.
+		///@return Human-redable String.
+		template<typename S2 = S>
+		S2 toString( unsigned int indent = 0, bool beautyfy = true ) const;
+
+		///@brief Load the children of a Map/Array or the value of a Value, called by NodeT<S>::_load().
+		///@param node Node to be loaded.
+		void _load( NodeT<S>* node );
+
+	private:
+		LazyDocumentT( const LazyDocumentT<S>& document );
+		LazyDocumentT<S>& operator=( const LazyDocumentT<S>& document );
+
+		///@brief Index the buffer and create the root.
+		bool _read();
+
+		///@brief Check the value beginning at the position indexI can be read from the index exactly as the byte by byte parser would, filling nextTable.
+		///@param indexI Position of the value beginning, set to the one after the value.
+		///@param endI Set to the character after the value.
+		///@return True if success, False otherwise.
+		bool _indexValue( Size* indexI, Size* endI );
+
+		///@brief Create the node beginning at the position indexI, to be loaded later.
+		NodeT<S>* _newNode( const Size indexI );
+
+		///@brief Get the end of the unquoted value beginning at the character beginI.
+		Size _getValueEndI( const Size beginI ) const;
+
+		void _unload();
+
+		S buffer;
+		StructuralIndex structuralIndex;
+		///@brief For each position of the index where a value begin, the position following the value.
+		Vector<unsigned int> nextTable;
+
+		///@brief Arena where the node objects are placed, their blocks released at once with the document (their strings and containers stay on the heap).
+		MemoryArena arena;
+
+		NodeT<S>* rootNode;
+		bool bLazy;
+	};
+
+	using LazyDocument = LazyDocumentT<UTF8String>;
+
+}
+
+#include "LazyDocument.hpp"
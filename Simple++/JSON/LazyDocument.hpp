@@ -0,0 +1,388 @@
+namespace JSON {
+
+	template<typename S>
+	LazyDocumentT<S>::LazyDocumentT() :
+		rootNode( NULL ),
+		bLazy( false ) {
+		// The structural index only handle single byte characters.
+		static_assert( sizeof( C ) == 1 );
+	}
+
+	template<typename S>
+	LazyDocumentT<S>::LazyDocumentT( const S& str ) :
+		rootNode( NULL ),
+		bLazy( false ) {
+		static_assert( sizeof( C ) == 1 );
+		readJSON( str );
+	}
+
+	template<typename S>
+	LazyDocumentT<S>::LazyDocumentT( S&& str ) :
+		rootNode( NULL ),
+		bLazy( false ) {
+		static_assert( sizeof( C ) == 1 );
+		readJSON( Utility::toRValue( str ) );
+	}
+
+	template<typename S>
+	LazyDocumentT<S>::~LazyDocumentT() {
+		_unload();
+	}
+
+	template<typename S>
+	inline const NodeT<S>* LazyDocumentT<S>::getRoot() const {
+		return this -> rootNode;
+	}
+
+	template<typename S>
+	inline NodeT<S>* LazyDocumentT<S>::getRoot() {
+		return this -> rootNode;
+	}
+
+	template<typename S>
+	inline const S& LazyDocumentT<S>::getBuffer() const {
+		return this -> buffer;
+	}
+
+	template<typename S>
+	inline const MemoryArena& LazyDocumentT<S>::getArena() const {
+		return this -> arena;
+	}
+
+	template<typename S>
+	inline bool LazyDocumentT<S>::isLazy() const {
+		return this -> bLazy;
+	}
+
+	template<typename S>
+	inline NodeT<S>* LazyDocumentT<S>::getElementByName( const S& name ) const {
+		if ( this -> rootNode ) {
+			return this -> rootNode -> getElementByName( name );
+		}
+		return NULL;
+	}
+
+	template<typename S>
+	inline Vector<NodeT<S>*> LazyDocumentT<S>::getElementsByName( const S& name ) const {
+		if ( this -> rootNode ) {
+			return this -> rootNode -> getElementsByName( name );
+		}
+		return Vector<NodeT<S>*>();
+	}
+
+	template<typename S>
+	bool LazyDocumentT<S>::readFileJSON( const OS::Path& filePath, int verbose ) {
+		_unload();
+
+		if ( verbose > 0 ) { Log::startStep( __func__, String::format( "Reading new JSON file \"%\"...", filePath ) ); }
+
+		S strOut;
+		if ( IO::readToString( filePath, &strOut, verbose - 1 ) == Size( -1 ) ) {
+			if ( verbose > 0 ) { Log::endStepFailure( __func__, String::format( "Failed.", filePath ) ); }
+
+			return false;
+		}
+
+		if ( !readJSON( Utility::toRValue( strOut ) ) ) {
+			if ( verbose > 0 ) { Log::endStepFailure( __func__, String::format( "Failed.", filePath ) ); }
+
+			return false;
+		}
+
+		if ( verbose > 0 ) { Log::endStepSuccess( __func__, String::format( "Success.", filePath ) ); }
+
+		return true;
+	}
+
+	template<typename S>
+	bool LazyDocumentT<S>::readJSON( const S& str ) {
+		// The previous tree has to be released before it's buffer is replaced.
+		_unload();
+
+		this -> buffer = str;
+		return _read();
+	}
+
+	template<typename S>
+	bool LazyDocumentT<S>::readJSON( S&& str ) {
+		_unload();
+
+		this -> buffer = Utility::toRValue( str );
+		return _read();
+	}
+
+	template<typename S>
+	template<typename S2>
+	inline S2 LazyDocumentT<S>::toString( unsigned int indent, bool beautyfy ) const {
+		if ( this -> rootNode ) {
+			return this -> rootNode -> toString( indent, beautyfy );
+		} else {
+			return S2::null;
+		}
+	}
+
+	template<typename S>
+	void LazyDocumentT<S>::_load( NodeT<S>* node ) {
+		const C* buffer( this -> buffer.toCString() );
+		const unsigned int* indexTable( this -> structuralIndex.getData() );
+
+		// Loaded only once, has to be done first as addChild() load the node too.
+		node -> lazyDocument = NULL;
+		Size i( node -> lazyIndexI );
+
+		if ( node -> getType() == NodeT<S>::Type::Value ) {
+			NodeValueT<S>* valueNode( static_cast< NodeValueT<S> * >( node ) );
+			const Size beginI( indexTable[ i ] );
+			if ( buffer[ beginI ] == C( '"' ) ) {
+				valueNode -> value = S( buffer + beginI + Size( 1 ), Size( indexTable[ i + Size( 1 ) ] ) - beginI - Size( 1 ) );
+			} else {
+				valueNode -> value = S( buffer + beginI, _getValueEndI( beginI ) - beginI );
+			}
+			return;
+		}
+
+		// An array is a map without names.
+		NodeMapT<S>* mapNode( static_cast< NodeMapT<S> * >( node ) );
+		i++;
+
+		// The structure has been checked by _indexValue().
+		if ( node -> getType() == NodeT<S>::Type::Map ) {
+			while ( buffer[ indexTable[ i ] ] != C( '}' ) ) {
+				const Size nameBeginI( indexTable[ i ] + Size( 1 ) );
+				const Size nameEndI( indexTable[ i + Size( 1 ) ] );
+				i += Size( 3 );
+
+				NodeT<S>* childNode( _newNode( i ) );
+				childNode -> name = S( buffer + nameBeginI, nameEndI - nameBeginI );
+				mapNode -> addChild( childNode );
+
+				i = Size( this -> nextTable[ i ] );
+				if ( buffer[ indexTable[ i ] ] == C( ',' ) ) {
+					i++;
+				}
+			}
+		} else if ( buffer[ indexTable[ i ] ] != C( ']' ) ) {
+			while ( true ) {
+				mapNode -> addChild( _newNode( i ) );
+
+				i = Size( this -> nextTable[ i ] );
+				if ( buffer[ indexTable[ i ] ] == C( ']' ) ) {
+					break;
+				}
+				i++;
+			}
+		}
+	}
+
+	template<typename S>
+	bool LazyDocumentT<S>::_read() {
+		struct FunctorSpace {
+			bool operator()( const C& c ) { return c == C( '\n' ) || c == C( '\r' ) || c == C( '\t' ) || c == C( ' ' ); }
+		};
+		static FunctorSpace functorSpace;
+
+		const C* buffer( this -> buffer.toCString() );
+
+		// Can be empty.
+		if ( this -> buffer.getSize() == Size( 0 ) ) {
+			return true;
+		}
+
+		// Same requirements than the two stages of parseT().
+		Size beginI( 0 );
+		while ( functorSpace( buffer[ beginI ] ) ) beginI++;
+
+		// The byte by byte parser stop at the first null character.
+		this -> bLazy = this -> structuralIndex.build( reinterpret_cast< const char* >( buffer ), Size( std::strlen( reinterpret_cast< const char* >( buffer ) ) ) ) &&
+			this -> structuralIndex.getSize() > Size( 0 ) && Size( this -> structuralIndex.getData()[ 0 ] ) == beginI;
+
+		if ( this -> bLazy ) {
+			this -> nextTable.resizeNoCopy( this -> structuralIndex.getSize() + Size( 1 ) );
+
+			Size indexI( 0 );
+			Size endI;
+			this -> bLazy = _indexValue( &indexI, &endI );
+		}
+
+		if ( this -> bLazy ) {
+			this -> rootNode = _newNode( Size( 0 ) );
+		} else {
+			// Parse everything at once, exactly as parseT() would.
+			this -> nextTable.clear();
+			this -> rootNode = _parseT<S, C, typename BasicString<C>::IsEndSentinel>( &buffer, BasicString<C>::IS_END_SENTINEL, &this -> arena );
+		}
+
+		return this -> rootNode != NULL;
+	}
+
+	template<typename S>
+	bool LazyDocumentT<S>::_indexValue( Size* indexI, Size* endI ) {
+		// Same rules than _parseIndexedValueT(), without creating anything.
+		struct FunctorNodeName {
+			bool operator()( const C& c ) { return c != C( '"' ) && c != C( '\t' ) && c != C( '\n' ); }
+		};
+		struct FunctorSpace {
+			bool operator()( const C& c ) { return c == C( '\n' ) || c == C( '\r' ) || c == C( '\t' ) || c == C( ' ' ); }
+		};
+		static FunctorNodeName functorNodeName;
+		static FunctorSpace functorSpace;
+
+		const C* buffer( this -> buffer.toCString() );
+		const unsigned int* indexTable( this -> structuralIndex.getData() );
+
+		Size& i( *indexI );
+		const Size valueI( i );
+		const Size beginI( indexTable[ i ] );
+
+		if ( buffer[ beginI ] == C( '{' ) ) {
+			i++;
+
+			while ( true ) {
+				const Size nameBeginI( indexTable[ i ] );
+				if ( buffer[ nameBeginI ] == C( '}' ) ) {
+					i++;
+					*endI = nameBeginI + Size( 1 );
+					break;
+				}
+				if ( buffer[ nameBeginI ] != C( '"' ) ) {
+					return false;
+				}
+
+				const Size nameEndI( indexTable[ i + Size( 1 ) ] );
+				if ( nameEndI == nameBeginI + Size( 1 ) ) {
+					return false;
+				}
+				Size nameI( nameBeginI + Size( 1 ) );
+				while ( nameI < nameEndI && functorNodeName( buffer[ nameI ] ) ) nameI++;
+				if ( nameI != nameEndI || buffer[ indexTable[ i + Size( 2 ) ] ] != C( ':' ) ) {
+					return false;
+				}
+				i += Size( 3 );
+
+				if ( !_indexValue( indexI, endI ) ) {
+					return false;
+				}
+
+				const Size nextI( indexTable[ i ] );
+				if ( buffer[ nextI ] == C( ',' ) ) {
+					i++;
+				} else if ( buffer[ nextI ] != C( '}' ) ) {
+					return false;
+				}
+			}
+		} else if ( buffer[ beginI ] == C( '[' ) ) {
+			i++;
+
+			if ( buffer[ indexTable[ i ] ] != C( ']' ) ) {
+				while ( true ) {
+					if ( !_indexValue( indexI, endI ) ) {
+						return false;
+					}
+
+					const Size nextI( indexTable[ i ] );
+					if ( buffer[ nextI ] == C( ']' ) ) {
+						break;
+					} else if ( buffer[ nextI ] != C( ',' ) ) {
+						return false;
+					}
+					i++;
+					// A ']' after a ',' is read differently depending on the spaces between them.
+					if ( buffer[ indexTable[ i ] ] == C( ']' ) ) {
+						return false;
+					}
+				}
+			}
+
+			Size afterI( indexTable[ i ] + Size( 1 ) );
+			while ( functorSpace( buffer[ afterI ] ) ) afterI++;
+			i++;
+			*endI = afterI;
+		} else if ( buffer[ beginI ] == C( '"' ) ) {
+			*endI = Size( indexTable[ i + Size( 1 ) ] ) + Size( 1 );
+			i += Size( 2 );
+		} else if ( buffer[ beginI ] == C( ':' ) || buffer[ beginI ] == C( ',' ) || buffer[ beginI ] == C( '}' ) || buffer[ beginI ] == C( ']' ) ) {
+			return false;
+		} else {
+			const Size valueEndI( _getValueEndI( beginI ) );
+			if ( buffer[ valueEndI ] == C( '\0' ) ) {
+				return false;
+			}
+
+			// Only the beginnings of other unquoted values can be indexed inside it, the next position has to be the next non space character.
+			i++;
+			while ( indexTable[ i ] < valueEndI ) {
+				const C c( buffer[ indexTable[ i ] ] );
+				if ( c == C( '"' ) || c == C( '{' ) || c == C( '[' ) || c == C( ':' ) ) {
+					return false;
+				}
+				i++;
+			}
+			Size nextI( valueEndI );
+			while ( functorSpace( buffer[ nextI ] ) ) nextI++;
+			if ( indexTable[ i ] != nextI ) {
+				return false;
+			}
+			*endI = valueEndI;
+		}
+
+		this -> nextTable[ valueI ] = static_cast< unsigned int >( i );
+		return true;
+	}
+
+	template<typename S>
+	NodeT<S>* LazyDocumentT<S>::_newNode( const Size indexI ) {
+		const C* buffer( this -> buffer.toCString() );
+		const Size beginI( this -> structuralIndex.getData()[ indexI ] );
+
+		NodeT<S>* newNode;
+		if ( buffer[ beginI ] == C( '{' ) ) {
+			newNode = NodeT<S>::template _newNode<NodeMapT<S>>( &this -> arena );
+		} else if ( buffer[ beginI ] == C( '[' ) ) {
+			newNode = NodeT<S>::template _newNode<NodeArrayT<S>>( &this -> arena );
+		} else {
+			NodeValueT<S>* valueNode( NodeT<S>::template _newNode<NodeValueT<S>>( &this -> arena ) );
+			if ( buffer[ beginI ] != C( '"' ) ) {
+				valueNode -> bAddQuotes = false;
+
+				// "null" is known now, nothing more to load.
+				const Size valueEndI( _getValueEndI( beginI ) );
+				if ( valueEndI - beginI == Size( 4 ) && buffer[ beginI ] == C( 'n' ) && buffer[ beginI + Size( 1 ) ] == C( 'u' ) &&
+					 buffer[ beginI + Size( 2 ) ] == C( 'l' ) && buffer[ beginI + Size( 3 ) ] == C( 'l' ) ) {
+					valueNode -> type = NodeT<S>::Type::Null;
+					return valueNode;
+				}
+			}
+			newNode = valueNode;
+		}
+
+		newNode -> lazyDocument = this;
+		newNode -> lazyIndexI = indexI;
+		return newNode;
+	}
+
+	template<typename S>
+	Size LazyDocumentT<S>::_getValueEndI( const Size beginI ) const {
+		// Same as the byte by byte parser, read until ',', '}', ']' or ' ' (new lines and tabulations included).
+		struct FunctorContent {
+			bool operator()( const C& c ) { return c != C( ',' ) && c != C( '}' ) && c != C( ']' ) && c != C( ' ' ); }
+		};
+		static FunctorContent functorContent;
+
+		const C* buffer( this -> buffer.toCString() );
+
+		Size valueEndI( beginI );
+		while ( buffer[ valueEndI ] != C( '\0' ) && functorContent( buffer[ valueEndI ] ) ) valueEndI++;
+		return valueEndI;
+	}
+
+	template<typename S>
+	void LazyDocumentT<S>::_unload() {
+		if ( this -> rootNode ) {
+			NodeT<S>::_deleteNode( this -> rootNode );
+			this -> rootNode = NULL;
+		}
+		this -> arena.clear();
+		this -> bLazy = false;
+	}
+
+}
@@ -12,6 +12,7 @@
 #include "../Math/BasicMath.h"
 #include "../OS/Path.h"
 #include "../StaticTable.h"
+#include "../MemoryArena.h"
 
 
 namespace JSON {
@@ -25,10 +26,15 @@ namespace JSON {
 	template<typename S>
 	class NodeMapT;
 
+	template<typename S>
+	class LazyDocumentT;
+
 	///@brief Represent a node in the JSON Tree, Only 3 Types available ( Map, Array and Value )
 	template<typename S>
 	class NodeT : public IO::BasicIO {
 	public:
+		friend class LazyDocumentT<S>;
+
 		enum class Type : unsigned int {
 			Map,
 			Array,
@@ -107,6 +113,7 @@ namespace JSON {
 		///@brief set the name of this node
 		///@param name Name of this node
 		virtual void setName( const S& name );
+		void setName( S&& name );
 
 		///@brief get the name of this node
 		///@return name of this node
@@ -231,6 +238,17 @@ namespace JSON {
 		template<typename C = S, typename Elem = C::ElemType>
 		void _writeJSON( C& o, unsigned int indent = 0, bool beautyfy = true ) const;
 
+		///@brief Create a new node of type N, inside the arena if not NULL (the node and every child parsed into it will then use it).
+		///@param arena Arena where to place the node (NULL to use the heap).
+		///@param args Arguments forwarded to the constructor.
+		///@return Pointer to the new node, to be released with _deleteNode().
+		template<typename N, typename... Args>
+		static N* _newNode( MemoryArena* arena, Args&&... args );
+
+		///@brief Delete a node created by _newNode(), only it's destructor is called if it lives inside an arena.
+		///@param node Node to be deleted (can be NULL).
+		static void _deleteNode( NodeT<S>* node );
+
 		NodeMapT<S>* parent;
 	protected:
 		///@brief Check if the buffer at the current position is the expected character. Increment the buffer it True.
@@ -243,6 +261,10 @@ namespace JSON {
 		virtual void _clear();
 		virtual void _unload();
 
+		///@brief Load what has not been read yet of a node of a LazyDocumentT (the children of a Map/Array, the value of a Value), nothing otherwise.
+		///			Modify the node and it's document through const accessors without any lock, NOT thread safe.
+		void _load() const;
+
 		template<typename Stream>
 		bool _write( Stream* stream ) const;
 		template<typename Stream>
@@ -251,6 +273,14 @@ namespace JSON {
 		Type type;
 		S name;
 
+		///@brief Arena owning the memory of this node, NULL if allocated on the heap.
+		MemoryArena* arena;
+
+		///@brief Lazy document this node has not been loaded from yet, NULL if already loaded.
+		LazyDocumentT<S>* lazyDocument;
+		///@brief Position of the first character of this node inside the structural index of lazyDocument.
+		Size lazyIndexI;
+
 		static const Vector< NodeT<S>* > emptyVector;
 	};
 
@@ -281,7 +311,7 @@ namespace JSON {
 		///@param rootNode JSON node.
 		DocumentT( NodeT<S>* rootNode );
 
-		///@brief Destructor.
+		///@brief Destructor, the tree is still walked to destroy every node (their names, values and children containers are on the heap), only the node blocks are released at once with the arena.
 		~DocumentT();
 
 		///@brief Get the root Node of this DocumentT. Can be NULL.
@@ -289,6 +319,10 @@ namespace JSON {
 		const NodeT<S>* getRoot() const;
 		NodeT<S>* getRoot();
 
+		///@brief Get the arena where the parsed nodes of this DocumentT are placed.
+		///@return Arena of this DocumentT.
+		const MemoryArena& getArena() const;
+
 		///@brief Get the first pointer to the node corresponding to the name searched in this sub tree.
 		///@param name Name to look for
 		///@return NodeT<S> pointer with the searched name or NULL if none.
@@ -354,6 +388,13 @@ namespace JSON {
 	private:
 		void _unload();
 
+		///@brief Arenas where the parsed node objects are placed, their blocks released at once with the document.
+		///			Only the nodes themselves live there : the strings and containers inside them still allocate on the heap.
+		///			A new buffer is parsed into the unused one, the current tree being released only once the parsing has succeeded.
+		MemoryArena arenaTable[ 2 ];
+		///@brief Index of the arena of the current tree inside arenaTable.
+		unsigned char arenaI;
+
 		NodeT<S>* rootNode;
 	};
 
@@ -9,6 +9,8 @@ namespace JSON {
 	template<typename S>
 	NodeT<S>::NodeT( typename NodeT<S>::Type type ) :
 		type( type ),
+		arena( NULL ),
+		lazyDocument( NULL ),
 		parent( NULL ) {
 
 		// Ensure S is a derived of BasicString.
@@ -18,7 +20,10 @@ namespace JSON {
 	template<typename S>
 	NodeT<S>::NodeT( const S& name, typename NodeT<S>::Type type ) :
 		name( name ),
-		type( type ) {
+		type( type ),
+		arena( NULL ),
+		lazyDocument( NULL ),
+		parent( NULL ) {
 
 	}
 
@@ -26,6 +31,8 @@ namespace JSON {
 	NodeT<S>::NodeT( const NodeT<S>& node ) :
 		type( node.type ),
 		name( node.name ),
+		arena( NULL ),
+		lazyDocument( NULL ),
 		parent( NULL ) {
 
 	}
@@ -34,7 +41,12 @@ namespace JSON {
 	NodeT<S>::NodeT( NodeT<S>&& node ) :
 		type( Utility::toRValue( node.type ) ),
 		name( Utility::toRValue( node.name ) ),
-		parent( Utility::toRValue( node.parent ) ) {}
+		arena( NULL ),
+		lazyDocument( node.lazyDocument ),
+		lazyIndexI( node.lazyIndexI ),
+		parent( Utility::toRValue( node.parent ) ) {
+		node.lazyDocument = NULL;
+	}
 
 	template<typename S>
 	NodeT<S>::~NodeT() {
@@ -46,6 +58,7 @@ namespace JSON {
 		this -> type = node.type;
 		this -> name = name;
 		this -> parent = NULL;
+		this -> lazyDocument = NULL;
 
 		return *this;
 	}
@@ -55,6 +68,9 @@ namespace JSON {
 		this -> type = Utility::toRValue( node.type );
 		this -> name = Utility::toRValue( node.name );
 		this -> parent = Utility::toRValue( node.parent );
+		this -> lazyDocument = node.lazyDocument;
+		this -> lazyIndexI = node.lazyIndexI;
+		node.lazyDocument = NULL;
 
 		return *this;
 	}
@@ -159,6 +175,14 @@ namespace JSON {
 		this -> name = name;
 	}
 
+	template<typename S>
+	void NodeT<S>::setName( S&& name ) {
+		if ( this -> parent ) {
+			getParent() -> _setChildName( this, this -> name, name );
+		}
+		this -> name = Utility::toRValue( name );
+	}
+
 	template<typename S>
 	const S& NodeT<S>::getName() const {
 		return this -> name;
@@ -408,6 +432,38 @@ namespace JSON {
 		return true;
 	}
 
+	template<typename S>
+	template<typename N, typename... Args>
+	N* NodeT<S>::_newNode( MemoryArena* arena, Args&&... args ) {
+		if ( arena ) {
+			N* newNode( arena -> create<N>( std::forward<Args>( args )... ) );
+			static_cast< NodeT<S> * >( newNode ) -> arena = arena;
+			return newNode;
+		} else {
+			return new N( std::forward<Args>( args )... );
+		}
+	}
+
+	template<typename S>
+	void NodeT<S>::_deleteNode( NodeT<S>* node ) {
+		if ( !node ) {
+			return;
+		}
+		if ( node -> arena ) {
+			// The memory itself belongs to the arena.
+			MemoryArena::destroy( node );
+		} else {
+			delete node;
+		}
+	}
+
+	template<typename S>
+	inline void NodeT<S>::_load() const {
+		if ( this -> lazyDocument ) {
+			this -> lazyDocument -> _load( const_cast< NodeT<S> * >( this ) );
+		}
+	}
+
 	template<typename S>
 	void NodeT<S>::_clear() {
 
@@ -492,23 +548,24 @@ namespace JSON {
 
 	template<typename S>
 	inline DocumentT<S>::DocumentT() :
+		arenaI( 0 ),
 		rootNode( NULL ) {}
 
 	template<typename S>
 	inline DocumentT<S>::DocumentT( const S& str ) :
+		arenaI( 0 ),
 		rootNode( NULL ) {
 		readJSON( str );
 	}
 
 	template<typename S>
 	inline DocumentT<S>::DocumentT( NodeT<S>* rootNode ) :
+		arenaI( 0 ),
 		rootNode( rootNode ) {}
 
 	template<typename S>
 	inline DocumentT<S>::~DocumentT() {
-		if ( this->rootNode ) {
-			delete this->rootNode;
-		}
+		_unload();
 	}
 
 	template<typename S>
@@ -521,6 +578,11 @@ namespace JSON {
 		return this->rootNode;
 	}
 
+	template<typename S>
+	inline const MemoryArena& DocumentT<S>::getArena() const {
+		return this->arenaTable[ this->arenaI ];
+	}
+
 	template<typename S>
 	inline NodeT<S>* DocumentT<S>::getElementByName( const S& name ) const {
 		if ( this->rootNode ) {
@@ -551,15 +613,13 @@ namespace JSON {
 
 	template<typename S>
 	inline bool DocumentT<S>::readFileJSON( const OS::Path& filePath, int verbose ) {
-		_unload();
-
 		if ( verbose > 0 ) { Log::startStep( __func__, String::format( "Reading new JSON file \"%\"...", filePath ) ); }
 
+		// The current tree is kept if the file can't be read or parsed.
 		S strOut;
 		if ( !IO::readToString( filePath, &strOut ) != size_t( -1 ) ) {
 			if ( verbose > 0 ) { Log::endStepFailure( __func__, String::format( "Failed.", filePath ) ); }
 
-			_unload();
 			return false;
 		}
 
@@ -607,9 +667,9 @@ namespace JSON {
 			switch ( rootNodeType ) {
 				case NodeT<S>::Type::Map:
 					{
-						NodeMapT<S>* newRootNode( new NodeMapT<S>() );
+						NodeMapT<S>* newRootNode( NodeT<S>::template _newNode<NodeMapT<S>>( &this->arenaTable[ this->arenaI ] ) );
 						if ( !IO::read( stream, newRootNode, verbose - 1 ) ) {
-							delete newRootNode;
+							NodeT<S>::_deleteNode( newRootNode );
 							return false;
 						}
 						this->rootNode = newRootNode;
@@ -617,9 +677,9 @@ namespace JSON {
 					}
 				case NodeT<S>::Type::Value:
 					{
-						NodeValueT<S>* newRootNode( new NodeValueT<S>() );
+						NodeValueT<S>* newRootNode( NodeT<S>::template _newNode<NodeValueT<S>>( &this->arenaTable[ this->arenaI ] ) );
 						if ( !IO::read( stream, newRootNode, verbose - 1 ) ) {
-							delete newRootNode;
+							NodeT<S>::_deleteNode( newRootNode );
 							return false;
 						}
 						this->rootNode = newRootNode;
@@ -627,9 +687,9 @@ namespace JSON {
 					}
 				case NodeT<S>::Type::Array:
 					{
-						NodeArrayT<S>* newRootNode( new NodeArrayT<S>() );
+						NodeArrayT<S>* newRootNode( NodeT<S>::template _newNode<NodeArrayT<S>>( &this->arenaTable[ this->arenaI ] ) );
 						if ( !IO::read( stream, newRootNode, verbose - 1 ) ) {
-							delete newRootNode;
+							NodeT<S>::_deleteNode( newRootNode );
 							return false;
 						}
 						this->rootNode = newRootNode;
@@ -695,9 +755,10 @@ namespace JSON {
 	template<typename S>
 	inline void DocumentT<S>::_unload() {
 		if ( this->rootNode ) {
-			delete this->rootNode;
+			NodeT<S>::_deleteNode( this->rootNode );
 			this->rootNode = NULL;
 		}
+		this->arenaTable[ this->arenaI ].clear();
 	}
 
 	template<typename S>
@@ -710,14 +771,19 @@ namespace JSON {
 			return true;
 		}
 
-		NodeT<S>* newNode( parseT<S, C, EndFunc>( &it, endFunc ) );
+		// Parse into the unused arena, the current tree is only released once the new one is complete.
+		const unsigned char newArenaI( this->arenaI ^ ( unsigned char ) 1 );
+		NodeT<S>* newNode( parseT<S, C, EndFunc>( &it, endFunc, &this->arenaTable[ newArenaI ] ) );
 
 		if ( newNode ) {
 			_unload();
+			this->arenaI = newArenaI;
 			this->rootNode = newNode;
 			return true;
 		}
 
+		// The nodes of the failed parsing have already been destroyed.
+		this->arenaTable[ newArenaI ].clear();
 		return false;
 	}
 
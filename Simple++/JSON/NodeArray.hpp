@@ -55,7 +55,7 @@ namespace JSON {
 				break;
 			}
 
-			NodeT<S>* newNode( parseT<S, C, EndFunc>( &it, endFunc ) );
+			NodeT<S>* newNode( _parseT<S, C, EndFunc>( &it, endFunc, this -> arena ) );
 			if ( newNode ) {
 				this -> addChild( newNode );
 			}
@@ -86,6 +86,7 @@ namespace JSON {
 	template<typename S>
 	template<typename C, typename Elem>
 	void NodeArrayT<S>::_writeJSON( C& o, unsigned int indent, bool beautyfy ) const {
+		this -> _load();
 		if ( this -> getName().getSize() ) {
 			o << Elem( '"' );
 			o << this -> getName();
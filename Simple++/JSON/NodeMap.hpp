@@ -21,6 +21,7 @@ namespace JSON {
 	template<typename S>
 	NodeMapT<S>::NodeMapT( const NodeMapT<S>& node ) :
 		NodeT<S>( node ) {
+		node._load();
 		for ( auto it( node.childrenVector.getBegin() ); it != node.childrenVector.getEnd(); node.childrenVector.iterate( &it ) ) {
 			NodeT<S>* newNode( new NodeT<S>( *( node.childrenVector.getValueIt( it ) ) ) );
 			addChild( newNode );
@@ -44,6 +45,7 @@ namespace JSON {
 	NodeMapT<S>& NodeMapT<S>::operator=( const NodeMapT<S>& node ) {
 		NodeT<S>::operator=( node );
 
+		node._load();
 		for ( auto it( node.childrenVector.getBegin() ); it != node.childrenVector.getEnd(); node.childrenVector.iterate( &it ) ) {
 			NodeT<S>* newNode( new NodeT<S>( *( node.childrenVector.getValueIt( it ) ) ) );
 			addChild( newNode );
@@ -85,6 +87,7 @@ namespace JSON {
 
 	template<typename S>
 	Size NodeMapT<S>::getNbChildren() const {
+		this -> _load();
 		return this -> childrenVector.getSize();
 	}
 
@@ -93,6 +96,7 @@ namespace JSON {
 		if ( !child ) {
 			return;
 		}
+		this -> _load();
 
 		if ( child -> getParent() ) {
 			child -> getParent() -> removeChild( child );
@@ -131,17 +135,19 @@ namespace JSON {
 		for ( auto it( this -> childrenVector.getBegin() ); it != this -> childrenVector.getEnd(); this -> childrenVector.iterate( &it ) ) {
 			NodeT<S>* node( this -> childrenVector.getValueIt( it ) );
 
-			delete node;
+			NodeT<S>::_deleteNode( node );
 		}
 	}
 
 	template<typename S>
 	const Vector<NodeT<S>*>& NodeMapT<S>::getChildren() const {
+		this -> _load();
 		return this ->childrenVector;
 	}
 
 	template<typename S>
 	const Vector< NodeT<S>* >& NodeMapT<S>::getChildren( const S& name ) const {
+		this -> _load();
 		auto childP = this -> childrenMap[ name ];
 		if ( childP ) return *childP;
 		else return NodeT<S>::emptyVector;
@@ -163,6 +169,7 @@ namespace JSON {
 
 	template<typename S>
 	NodeT<S>* NodeMapT<S>::getChild( const S& name ) {
+		this -> _load();
 		auto childP = this -> childrenMap[ name ];
 		if ( childP ) {
 			Vector<NodeT<S>* > childVector( *childP );
@@ -180,6 +187,7 @@ namespace JSON {
 
 	template<typename S>
 	NodeT<S>* NodeMapT<S>::getChild( Size i ) {
+		this -> _load();
 		if ( i < this->childrenVector.getSize() ) {
 			return this->childrenVector.getValueI( i );
 		} else {
@@ -191,7 +199,7 @@ namespace JSON {
 	bool NodeMapT<S>::deleteChild( NodeT<S>* child ) {
 		NodeT<S>* childRemoved( removeChild( child ) );
 		if ( childRemoved ) {
-			delete childRemoved;
+			NodeT<S>::_deleteNode( childRemoved );
 			return true;
 		} else {
 			return false;
@@ -202,7 +210,7 @@ namespace JSON {
 	bool NodeMapT<S>::deleteChild( Size i ) {
 		NodeT<S>* childRemoved( removeChild( i ) );
 		if ( childRemoved ) {
-			delete childRemoved;
+			NodeT<S>::_deleteNode( childRemoved );
 			return true;
 		} else {
 			return false;
@@ -211,6 +219,7 @@ namespace JSON {
 
 	template<typename S>
 	NodeT<S>* NodeMapT<S>::removeChild( NodeT<S>* child ) {
+		this -> _load();
 		if ( this -> childrenVector.eraseFirst( child ) ) {
 			if ( child -> getName().getSize() )
 				this -> childrenMap.eraseFirst( child -> getName(), child );
@@ -223,6 +232,7 @@ namespace JSON {
 
 	template<typename S>
 	NodeT<S>* NodeMapT<S>::removeChild( Size i ) {
+		this -> _load();
 		if ( i >= this -> childrenVector.getSize() ) {
 			return NULL;
 		} else {
@@ -243,6 +253,8 @@ namespace JSON {
 	bool NodeMapT<S>::read( Stream* stream, int verbose ) {
 		_unload();
 
+		this -> lazyDocument = NULL;
+
 		this -> childrenMap.clear();
 		this -> childrenVector.clear();
 
@@ -278,10 +290,10 @@ namespace JSON {
 				switch ( newNodeType ) {
 					case Type::Map:
 						{
-							NodeMapT<S>* newNode( new NodeMapT<S>() );
+							NodeMapT<S>* newNode( NodeT<S>::template _newNode<NodeMapT<S>>( this -> arena ) );
 							newNode -> parent = this;
 							if ( !IO::read( stream, newNode, verbose - 1 ) ) {
-								delete newNode;
+								NodeT<S>::_deleteNode( newNode );
 								_clear();
 								return false;
 							}
@@ -292,10 +304,10 @@ namespace JSON {
 						}
 					case Type::Value:
 						{
-							NodeValueT<S>* newNode( new NodeValueT<S>() );
+							NodeValueT<S>* newNode( NodeT<S>::template _newNode<NodeValueT<S>>( this -> arena ) );
 							newNode -> parent = this;
 							if ( !IO::read( stream, newNode, verbose - 1 ) ) {
-								delete newNode;
+								NodeT<S>::_deleteNode( newNode );
 								_clear();
 								return false;
 							}
@@ -306,10 +318,10 @@ namespace JSON {
 						}
 					case Type::Array:
 						{
-							NodeArrayT<S>* newNode( new NodeArrayT<S>() );
+							NodeArrayT<S>* newNode( NodeT<S>::template _newNode<NodeArrayT<S>>( this -> arena ) );
 							newNode -> parent = this;
 							if ( !IO::read( stream, newNode, verbose - 1 ) ) {
-								delete newNode;
+								NodeT<S>::_deleteNode( newNode );
 								_clear();
 								return false;
 							}
@@ -320,10 +332,10 @@ namespace JSON {
 						}
 					default:
 						{
-							NodeT<S>* newNode( new NodeT<S>( newNodeType ) );
+							NodeT<S>* newNode( NodeT<S>::template _newNode<NodeT<S>>( this -> arena, newNodeType ) );
 							newNode -> parent = this;
 							if ( !IO::read( stream, newNode, verbose - 1 ) ) {
-								delete newNode;
+								NodeT<S>::_deleteNode( newNode );
 								_clear();
 								return false;
 							}
@@ -352,6 +364,7 @@ namespace JSON {
 
 	template<typename S>
 	void NodeMapT<S>::_getElementsByName( Vector < NodeT<S>* >* nodeVector, const S& name ) const {
+		this -> _load();
 		const Vector < NodeT<S>* >* vectorFounded( this -> childrenMap[ name ] );
 		if ( vectorFounded ) {
 			// Concat the new one with what we already have
@@ -368,6 +381,7 @@ namespace JSON {
 
 	template<typename S>
 	inline NodeT<S>* NodeMapT<S>::_getElementByName( const S& name ) const {
+		this -> _load();
 		const Vector < NodeT<S>* >* vectorFounded( this -> childrenMap[ name ] );
 		if ( vectorFounded ) {
 			return vectorFounded->getFirst();
@@ -389,6 +403,7 @@ namespace JSON {
 	template<typename S>
 	template<typename Stream>
 	bool NodeMapT<S>::write( Stream* stream ) const {
+		this -> _load();
 		if ( !NodeT<S>::_write( stream ) ) {
 			return false;
 		}
@@ -417,6 +432,7 @@ namespace JSON {
 	template<typename S>
 	template<typename C, typename Elem>
 	void NodeMapT<S>::_writeJSON( C& o, unsigned int indent, bool beautyfy ) const {
+		this -> _load();
 
 		if ( this -> getName().getSize() ) {
 			o << Elem( '"' );
@@ -556,9 +572,9 @@ namespace JSON {
 					while ( functorSpace( *it ) ) it++;
 					if ( !_expectChar( &it, C( ':' ) ) ) return false;
 
-					NodeT<S>* newNode( parseT<S, C, EndFunc>( &it, endFunc ) );
+					NodeT<S>* newNode( _parseT<S, C, EndFunc>( &it, endFunc, this -> arena ) );
 					if ( newNode ) {
-						newNode -> setName( nodeName );
+						newNode -> setName( Utility::toRValue( nodeName ) );
 						this -> addChild( newNode );
 					} else {
 						ERROR_SPP( String::format( TEXT( "[JSON Error] : Unable to parse the property \"%\"." ), nodeName ) );
@@ -23,6 +23,7 @@ namespace JSON {
 	template<typename S>
 	class NodeValueT : public NodeT<S> {
 	public:
+		friend class LazyDocumentT<S>;
 
 		enum class ValueType {
 			String,
@@ -42,6 +43,7 @@ namespace JSON {
 		NodeValueT( long long int value );
 		NodeValueT( unsigned long long int value );
 		NodeValueT( double value );
+		NodeValueT( float value );
 		NodeValueT( bool value );
 		template<typename P>
 		NodeValueT( const P* nullPtr );						// nullptr only.
@@ -55,6 +57,7 @@ namespace JSON {
 		NodeValueT( const S& name, long long int value );
 		NodeValueT( const S& name, unsigned long long int value );
 		NodeValueT( const S& name, double value );
+		NodeValueT( const S& name, float value );
 		NodeValueT( const S& name, bool value );
 		template<typename P>
 		NodeValueT( const S& name, const P* nullPtr );						// nullptr only.
@@ -80,6 +83,8 @@ namespace JSON {
 		virtual void setValue( unsigned long long int value ) override;
 		virtual void setValue( double value ) override;
 		virtual void setValue( bool value ) override;
+		///@brief Set a float value, written with the shortest digits reading back to the float (and not to the double).
+		void setValue( float value );
 
 		template<typename P>
 		void setValue( const P* nullPtr );						// nullptr only.
@@ -115,6 +120,13 @@ namespace JSON {
 		///@param tabs Number of tabulations to be added.
 		template<typename C = S, typename Elem = C::ElemType>
 		void _writeJSON( C& o, unsigned int indent = 0, bool beautyfy = true ) const;
+
+		///@brief Set the value as read by readJSON() ("null" unquoted giving a Null node).
+		///@param buffer Characters of the value (without the quotes).
+		///@param size Number of characters.
+		///@param bQuoted If the value was between quotes.
+		template<typename C>
+		void _setValueJSON( const C* buffer, const Size size, const bool bQuoted );
 	protected:
 		S value;
 		bool bAddQuotes;
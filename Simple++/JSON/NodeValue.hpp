@@ -48,6 +48,12 @@ namespace JSON {
 		setValue( value );
 	}
 
+	template<typename S>
+	inline NodeValueT<S>::NodeValueT( float value ) :
+		NodeT<S>( NodeT<S>::Type::Value ) {
+		setValue( value );
+	}
+
 	template<typename S>
 	inline NodeValueT<S>::NodeValueT( bool value ) :
 		NodeT<S>( NodeT<S>::Type::Value ) {
@@ -103,6 +109,13 @@ namespace JSON {
 		setValue( value );
 	}
 
+	template<typename S>
+	inline NodeValueT<S>::NodeValueT( const S& name, float value ) :
+		NodeT<S>( NodeT<S>::Type::Value ) {
+		this -> name = name;
+		setValue( value );
+	}
+
 	template<typename S>
 	inline NodeValueT<S>::NodeValueT( const S& name, bool value ) :
 		NodeT<S>( NodeT<S>::Type::Value ),
@@ -121,7 +134,7 @@ namespace JSON {
 	template<typename S>
 	NodeValueT<S>::NodeValueT( const NodeValueT<S>& node ) :
 		NodeT( node ),
-		value( node.value ),
+		value( node.getValue() ),
 		bAddQuotes( node.bAddQuotes ),
 		name( node.name ) {
 
@@ -138,47 +151,62 @@ namespace JSON {
 
 	template<typename S>
 	const S& NodeValueT<S>::getValue() const {
+		this -> _load();
 		return this -> value;
 	}
 
 	template<typename S>
 	void NodeValueT<S>::setValue( const S& value ) {
+		this -> lazyDocument = NULL;
 		this -> value = value;
 		this -> bAddQuotes = true;
 	}
 
 	template<typename S>
 	inline void NodeValueT<S>::setValue( int value ) {
+		this -> lazyDocument = NULL;
 		this -> value = S::toString( value );
 		this -> bAddQuotes = false;
 	}
 
 	template<typename S>
 	inline void NodeValueT<S>::setValue( unsigned int value ) {
+		this -> lazyDocument = NULL;
 		this -> value = S::toString( value );
 		this -> bAddQuotes = false;
 	}
 
 	template<typename S>
 	inline void NodeValueT<S>::setValue( long long int value ) {
+		this -> lazyDocument = NULL;
 		this -> value = S::toString( value );
 		this -> bAddQuotes = false;
 	}
 
 	template<typename S>
 	inline void NodeValueT<S>::setValue( unsigned long long int value ) {
+		this -> lazyDocument = NULL;
 		this -> value = S::toString( value );
 		this -> bAddQuotes = false;
 	}
 
 	template<typename S>
 	inline void NodeValueT<S>::setValue( double value ) {
-		this -> value = S::toString( value );
+		this -> lazyDocument = NULL;
+		this -> value = S::toString( value, S::ShortestPrecision );
+		this -> bAddQuotes = false;
+	}
+
+	template<typename S>
+	inline void NodeValueT<S>::setValue( float value ) {
+		this -> lazyDocument = NULL;
+		this -> value = S::toString( value, S::ShortestPrecision );
 		this -> bAddQuotes = false;
 	}
 
 	template<typename S>
 	inline void NodeValueT<S>::setValue( bool value ) {
+		this -> lazyDocument = NULL;
 		this -> value = S::toString( value );
 		this -> bAddQuotes = false;
 	}
@@ -186,6 +214,7 @@ namespace JSON {
 	template<typename S>
 	template<typename P>
 	inline void NodeValueT<S>::setValue( const P* nullPtr ) {
+		this -> lazyDocument = NULL;
 		const S nullString( "null" );
 		this -> value = nullString;
 		this -> bAddQuotes = false;
@@ -210,8 +239,6 @@ namespace JSON {
 		static FunctorContent functorContent;
 		static FunctorSpace functorSpace;
 
-		static const S nullString( "null" );
-
 		const C*& it( *buffer );
 
 		// Value node.
@@ -232,13 +259,11 @@ namespace JSON {
 				it++;
 			}
 
-			S nodeValue( beginIt, Size( it - beginIt ) );
+			const C* endIt( it );
 
 			if ( !_expectChar( &it, C( '"' ) ) ) return false;
 
-			this -> value = nodeValue;
-			this -> type = Type::Value;
-			this -> bAddQuotes = true;
+			_setValueJSON( beginIt, Size( endIt - beginIt ), true );
 		} else {
 			// Value without quote.
 
@@ -253,19 +278,32 @@ namespace JSON {
 				it++;
 			}
 
-			S nodeValue( beginIt, Size( it - beginIt ) );
+			_setValueJSON( beginIt, Size( it - beginIt ), false );
+		}
 
+		return true;
+	}
+
+	template<typename S>
+	template<typename C>
+	void NodeValueT<S>::_setValueJSON( const C* buffer, const Size size, const bool bQuoted ) {
+		static const S nullString( "null" );
+
+		S nodeValue( buffer, size );
+
+		if ( bQuoted ) {
+			this -> value = Utility::toRValue( nodeValue );
+			this -> type = Type::Value;
+			this -> bAddQuotes = true;
+		} else {
 			if ( nodeValue == nullString ) {
 				this -> type = Type::Null;
 			} else {
-				this -> value = nodeValue;
+				this -> value = Utility::toRValue( nodeValue );
 				this -> type = Type::Value;
 			}
-
 			this -> bAddQuotes = false;
 		}
-
-		return true;
 	}
 
 	template<typename S>
@@ -304,6 +342,7 @@ namespace JSON {
 	template<typename S>
 	template<typename Stream>
 	bool NodeValueT<S>::read( Stream* stream, int verbose ) {
+		this -> lazyDocument = NULL;
 		if ( !NodeT<S>::_read( stream ) ) {
 			_clear();
 			return false;
@@ -322,6 +361,7 @@ namespace JSON {
 	template<typename S>
 	template<typename Stream>
 	bool NodeValueT<S>::write( Stream* stream ) const {
+		this -> _load();
 		if ( !NodeT<S>::_write( stream ) ) {
 			return false;
 		}
@@ -0,0 +1,80 @@
+///@file		JSON/StructuralIndex.h.
+///@brief		Declares the first stage of the JSON parser, an index of the structural characters built 64 bytes at a time.
+#pragma once
+
+#include "../CPU.h"
+#include "../Utility.h"
+
+namespace JSON {
+
+	///@brief Positions of every structural character ('{', '}', '[', ']', ':' and ','), of every unescaped quote and of the first character of every unquoted value outside of the strings.
+	///			The buffer is classified 64 bytes at a time into bit masks (with SSE2 or AVX2 following CPU::getIsa()), the strings are then found with a prefix xor of the quotes.
+	///			A quote is escaped when the character before it is a backslash, exactly as the byte by byte parser reads it.
+	///			Used by parseT() as the first stage, the second one building the nodes by walking the positions.
+	template<typename T>
+	class StructuralIndexT {
+	public:
+		///@brief Empty constructor.
+		StructuralIndexT();
+
+		///@brief Destructor.
+		~StructuralIndexT();
+
+		///@brief Build the index of a buffer, the previous one being discarded.
+		///@param buffer Buffer to index.
+		///@param size Number of characters of the buffer.
+		///@return True if success, False if the buffer end inside a string or is bigger than 4GB.
+		bool build( const char * buffer, const Size size );
+
+		///@brief Get the number of indexed positions.
+		///@return Number of positions.
+		Size getSize() const;
+
+		///@brief Get the indexed positions in increasing order, followed by the size of the buffer (as an end marker).
+		///@return Pointer to the getSize() + 1 positions.
+		const unsigned int * getData() const;
+
+	private:
+		///@brief Classes of the characters of a 64 bytes block, the bit i being set if the character i is of this class.
+		struct Block {
+			unsigned long long quote;
+			unsigned long long backslash;
+			unsigned long long op;
+			unsigned long long space;
+		};
+
+		///@brief Classifiers, classify( data, block ) fill block from the 64 characters of data.
+		struct _ClassifierScalar {
+			inline static void classify( const unsigned char * data, Block * block );
+		};
+#if defined CPU_X86
+		struct _ClassifierSSE2 {
+			CPU_TARGET_SSE2 inline static void classify( const unsigned char * data, Block * block );
+		};
+		struct _ClassifierAVX2 {
+			CPU_TARGET_AVX2 inline static void classify( const unsigned char * data, Block * block );
+		};
+#endif
+
+		StructuralIndexT( const StructuralIndexT<T> & index );
+		StructuralIndexT<T> & operator=( const StructuralIndexT<T> & index );
+
+		template<typename Classifier>
+		bool _build( const unsigned char * buffer, const Size size );
+
+		void _reserve( const Size capacity );
+
+		static unsigned long long _prefixXor( unsigned long long bits );
+		static unsigned int _getNbBits( unsigned long long bits );
+		static unsigned int _getTrailingZeros( const unsigned long long bits );
+
+		unsigned int * indexTable;
+		Size size;
+		Size capacity;
+	};
+
+	using StructuralIndex = StructuralIndexT<int>;
+
+}
+
+#include "StructuralIndex.hpp"
@@ -0,0 +1,279 @@
+namespace JSON {
+
+	template<typename T>
+	StructuralIndexT<T>::StructuralIndexT() :
+		indexTable( NULL ),
+		size( 0 ),
+		capacity( 0 ) {
+
+	}
+
+	template<typename T>
+	StructuralIndexT<T>::~StructuralIndexT() {
+		delete[] this -> indexTable;
+	}
+
+	template<typename T>
+	bool StructuralIndexT<T>::build( const char * buffer, const Size size ) {
+		this -> size = Size( 0 );
+
+		// The positions are stored on 32 bits, the last one being the end marker.
+		if ( size >= Size( 0xFFFFFFFF ) ) {
+			return false;
+		}
+
+		switch ( CPU::getIsa() ) {
+#if defined CPU_X86
+			case CPU::Isa::AVX2:
+				return _build<_ClassifierAVX2>( reinterpret_cast< const unsigned char * >( buffer ), size );
+			case CPU::Isa::AVX:
+			case CPU::Isa::SSE2:
+				return _build<_ClassifierSSE2>( reinterpret_cast< const unsigned char * >( buffer ), size );
+#endif
+			default:
+				return _build<_ClassifierScalar>( reinterpret_cast< const unsigned char * >( buffer ), size );
+		}
+	}
+
+	template<typename T>
+	Size StructuralIndexT<T>::getSize() const {
+		return this -> size;
+	}
+
+	template<typename T>
+	const unsigned int * StructuralIndexT<T>::getData() const {
+		return this -> indexTable;
+	}
+
+	template<typename T>
+	template<typename Classifier>
+	bool StructuralIndexT<T>::_build( const unsigned char * buffer, const Size size ) {
+		// Roughly one position every 8 characters for a common document, grown when needed.
+		_reserve( size / Size( 8 ) + Size( 128 ) );
+
+		// State carried from one block to the next one.
+		unsigned long long prevBackslash( 0 );
+		unsigned long long prevInString( 0 );
+		unsigned long long prevScalar( 0 );
+
+		Block block;
+		for ( Size blockI( 0 ); blockI < size; blockI += Size( 64 ) ) {
+			if ( blockI + Size( 64 ) <= size ) {
+				Classifier::classify( buffer + blockI, &block );
+			} else {
+				// Last block, padded with spaces.
+				unsigned char lastData[ 64 ];
+				const Size lastSize( size - blockI );
+				for ( Size i( 0 ); i < lastSize; i++ ) {
+					lastData[ i ] = buffer[ blockI + i ];
+				}
+				for ( Size i( lastSize ); i < Size( 64 ); i++ ) {
+					lastData[ i ] = ' ';
+				}
+				Classifier::classify( lastData, &block );
+			}
+
+			const unsigned long long escapedQuote( block.quote & ( ( block.backslash << 1 ) | prevBackslash ) );
+			prevBackslash = block.backslash >> 63;
+
+			// Every character from an opening quote (included) to the closing one (excluded).
+			const unsigned long long quote( block.quote & ~escapedQuote );
+			const unsigned long long inString( _prefixXor( quote ) ^ prevInString );
+			prevInString = 0ULL - ( inString >> 63 );
+
+			// Characters of the unquoted values, only the first one of each is indexed.
+			const unsigned long long scalar( ~( block.op | block.space | quote | inString ) );
+			const unsigned long long scalarBegin( scalar & ~( ( scalar << 1 ) | prevScalar ) );
+			prevScalar = scalar >> 63;
+
+			unsigned long long structural( ( block.op & ~inString ) | quote | scalarBegin );
+
+			if ( this -> size + Size( 64 ) > this -> capacity ) {
+				_reserve( this -> capacity * Size( 2 ) + Size( 64 ) );
+			}
+			// Four positions written at a time, the ones after the last position are overwritten by the next block.
+			const unsigned int blockPosition( static_cast< unsigned int >( blockI ) );
+			unsigned int * indexIt( this -> indexTable + this -> size );
+			this -> size += _getNbBits( structural );
+			while ( structural ) {
+				indexIt[ 0 ] = blockPosition + _getTrailingZeros( structural );
+				structural &= structural - 1ULL;
+				indexIt[ 1 ] = blockPosition + _getTrailingZeros( structural );
+				structural &= structural - 1ULL;
+				indexIt[ 2 ] = blockPosition + _getTrailingZeros( structural );
+				structural &= structural - 1ULL;
+				indexIt[ 3 ] = blockPosition + _getTrailingZeros( structural );
+				structural &= structural - 1ULL;
+				indexIt += 4;
+			}
+		}
+
+		if ( this -> size + Size( 1 ) > this -> capacity ) {
+			_reserve( this -> size + Size( 1 ) );
+		}
+		this -> indexTable[ this -> size ] = static_cast< unsigned int >( size );
+
+		// An unterminated string.
+		return prevInString == 0ULL;
+	}
+
+	template<typename T>
+	void StructuralIndexT<T>::_reserve( const Size capacity ) {
+		if ( capacity <= this -> capacity ) {
+			return;
+		}
+		unsigned int * newIndexTable( new unsigned int[ capacity ] );
+		for ( Size i( 0 ); i < this -> size; i++ ) {
+			newIndexTable[ i ] = this -> indexTable[ i ];
+		}
+		delete[] this -> indexTable;
+		this -> indexTable = newIndexTable;
+		this -> capacity = capacity;
+	}
+
+	template<typename T>
+	unsigned long long StructuralIndexT<T>::_prefixXor( unsigned long long bits ) {
+		// Bit i become the xor of the bits 0 to i.
+		bits ^= bits << 1;
+		bits ^= bits << 2;
+		bits ^= bits << 4;
+		bits ^= bits << 8;
+		bits ^= bits << 16;
+		bits ^= bits << 32;
+		return bits;
+	}
+
+	template<typename T>
+	unsigned int StructuralIndexT<T>::_getNbBits( unsigned long long bits ) {
+		bits = bits - ( ( bits >> 1 ) & 0x5555555555555555ULL );
+		bits = ( bits & 0x3333333333333333ULL ) + ( ( bits >> 2 ) & 0x3333333333333333ULL );
+		bits = ( bits + ( bits >> 4 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+		return static_cast< unsigned int >( ( bits * 0x0101010101010101ULL ) >> 56 );
+	}
+
+	template<typename T>
+	unsigned int StructuralIndexT<T>::_getTrailingZeros( const unsigned long long bits ) {
+		// The last bit is forced, 0 then gives 63 instead of being undefined (the flattening may ask it).
+		const unsigned long long forcedBits( bits | ( 1ULL << 63 ) );
+#if defined _MSC_VER
+		unsigned long i;
+#if defined _M_X64
+		_BitScanForward64( &i, forcedBits );
+#else
+		if ( !_BitScanForward( &i, static_cast< unsigned long >( forcedBits ) ) ) {
+			_BitScanForward( &i, static_cast< unsigned long >( forcedBits >> 32 ) );
+			i += 32;
+		}
+#endif
+		return static_cast< unsigned int >( i );
+#else
+		return static_cast< unsigned int >( __builtin_ctzll( forcedBits ) );
+#endif
+	}
+
+	template<typename T>
+	void StructuralIndexT<T>::_ClassifierScalar::classify( const unsigned char * data, Block * block ) {
+		block -> quote = 0ULL;
+		block -> backslash = 0ULL;
+		block -> op = 0ULL;
+		block -> space = 0ULL;
+		for ( unsigned int i( 0 ); i < 64; i++ ) {
+			const unsigned long long bit( 1ULL << i );
+			switch ( data[ i ] ) {
+				case '"':
+					block -> quote |= bit;
+					break;
+				case '\\':
+					block -> backslash |= bit;
+					break;
+				case '{':
+				case '}':
+				case '[':
+				case ']':
+				case ':':
+				case ',':
+					block -> op |= bit;
+					break;
+				case ' ':
+				case '\t':
+				case '\n':
+				case '\r':
+					block -> space |= bit;
+					break;
+			}
+		}
+	}
+
+#if defined CPU_X86
+	template<typename T>
+	void StructuralIndexT<T>::_ClassifierSSE2::classify( const unsigned char * data, Block * block ) {
+		const __m128i quote( _mm_set1_epi8( '"' ) );
+		const __m128i backslash( _mm_set1_epi8( '\\' ) );
+		// '{' | 0x20 == '{', '[' | 0x20 == '{', the same for '}' and ']'.
+		const __m128i lowerBit( _mm_set1_epi8( 0x20 ) );
+		const __m128i openBracket( _mm_set1_epi8( '{' ) );
+		const __m128i closeBracket( _mm_set1_epi8( '}' ) );
+		const __m128i colon( _mm_set1_epi8( ':' ) );
+		const __m128i comma( _mm_set1_epi8( ',' ) );
+		const __m128i space( _mm_set1_epi8( ' ' ) );
+		const __m128i tab( _mm_set1_epi8( '\t' ) );
+		const __m128i newLine( _mm_set1_epi8( '\n' ) );
+		const __m128i carriageReturn( _mm_set1_epi8( '\r' ) );
+
+		block -> quote = 0ULL;
+		block -> backslash = 0ULL;
+		block -> op = 0ULL;
+		block -> space = 0ULL;
+		for ( unsigned int i( 0 ); i < 64; i += 16 ) {
+			const __m128i c( _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + i ) ) );
+			const __m128i cLower( _mm_or_si128( c, lowerBit ) );
+
+			const __m128i op( _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( cLower, openBracket ), _mm_cmpeq_epi8( cLower, closeBracket ) ),
+											_mm_or_si128( _mm_cmpeq_epi8( c, colon ), _mm_cmpeq_epi8( c, comma ) ) ) );
+			const __m128i spaces( _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( c, space ), _mm_cmpeq_epi8( c, tab ) ),
+												_mm_or_si128( _mm_cmpeq_epi8( c, newLine ), _mm_cmpeq_epi8( c, carriageReturn ) ) ) );
+
+			block -> quote |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm_movemask_epi8( _mm_cmpeq_epi8( c, quote ) ) ) ) << i;
+			block -> backslash |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm_movemask_epi8( _mm_cmpeq_epi8( c, backslash ) ) ) ) << i;
+			block -> op |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm_movemask_epi8( op ) ) ) << i;
+			block -> space |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm_movemask_epi8( spaces ) ) ) << i;
+		}
+	}
+
+	template<typename T>
+	void StructuralIndexT<T>::_ClassifierAVX2::classify( const unsigned char * data, Block * block ) {
+		const __m256i quote( _mm256_set1_epi8( '"' ) );
+		const __m256i backslash( _mm256_set1_epi8( '\\' ) );
+		// '{' | 0x20 == '{', '[' | 0x20 == '{', the same for '}' and ']'.
+		const __m256i lowerBit( _mm256_set1_epi8( 0x20 ) );
+		const __m256i openBracket( _mm256_set1_epi8( '{' ) );
+		const __m256i closeBracket( _mm256_set1_epi8( '}' ) );
+		const __m256i colon( _mm256_set1_epi8( ':' ) );
+		const __m256i comma( _mm256_set1_epi8( ',' ) );
+		const __m256i space( _mm256_set1_epi8( ' ' ) );
+		const __m256i tab( _mm256_set1_epi8( '\t' ) );
+		const __m256i newLine( _mm256_set1_epi8( '\n' ) );
+		const __m256i carriageReturn( _mm256_set1_epi8( '\r' ) );
+
+		block -> quote = 0ULL;
+		block -> backslash = 0ULL;
+		block -> op = 0ULL;
+		block -> space = 0ULL;
+		for ( unsigned int i( 0 ); i < 64; i += 32 ) {
+			const __m256i c( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( data + i ) ) );
+			const __m256i cLower( _mm256_or_si256( c, lowerBit ) );
+
+			const __m256i op( _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( cLower, openBracket ), _mm256_cmpeq_epi8( cLower, closeBracket ) ),
+											   _mm256_or_si256( _mm256_cmpeq_epi8( c, colon ), _mm256_cmpeq_epi8( c, comma ) ) ) );
+			const __m256i spaces( _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( c, space ), _mm256_cmpeq_epi8( c, tab ) ),
+												   _mm256_or_si256( _mm256_cmpeq_epi8( c, newLine ), _mm256_cmpeq_epi8( c, carriageReturn ) ) ) );
+
+			block -> quote |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm256_movemask_epi8( _mm256_cmpeq_epi8( c, quote ) ) ) ) << i;
+			block -> backslash |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm256_movemask_epi8( _mm256_cmpeq_epi8( c, backslash ) ) ) ) << i;
+			block -> op |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm256_movemask_epi8( op ) ) ) << i;
+			block -> space |= static_cast< unsigned long long >( static_cast< unsigned int >( _mm256_movemask_epi8( spaces ) ) ) << i;
+		}
+	}
+#endif
+
+}
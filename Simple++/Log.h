@@ -26,6 +26,10 @@
 
 #include <iostream>
 #include <stdio.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 #include "BuildConfig.h"
 #include "SimpleLog.h"
@@ -102,6 +106,17 @@ public:
 	virtual void increaseIndent() = 0;
 	virtual void decreaseIndent() = 0;
 
+	///@brief	Wait for every message already received to be written.
+	virtual void flush() {}
+
+protected:
+	///@brief	Format a message line after its date : severity, steps, title, indentation, message and new line.
+	static void _formatMessage( BasicString<T>* str,
+								const BasicString<T>& logTitle,
+								const BasicString<T>& logMessage,
+								typename SimpleLogT<T>::MessageSeverity severity,
+								Size nbSteps,
+								int indent );
 };
 
 using LogHandler = LogHandlerT<char>;
@@ -135,6 +150,8 @@ public:
 	///@brief	Sync the filestream.
 	void sync();
 
+	virtual void flush() override;
+
 	void setSTDOut( bool bSTDOut );
 	void setFileOut( bool bFileOut );
 
@@ -151,6 +168,132 @@ private:
 
 using LogDefaultHandler = LogDefaultHandlerT<char>;
 
+///@brief	Log handler writing from a background thread, the logging threads only format their message into a lock-free ring buffer.
+///			The writer thread empties the ring buffer by batches, each batch being written with one call to the console and one to the file.
+///			The date of the messages is formatted by the writer, at most once per second.
+template<typename T>
+class LogAsyncHandlerT : public LogHandlerT<T> {
+public:
+	///@brief	What to do when a message is logged while the ring buffer is full.
+	enum class OverflowPolicy : unsigned char {
+		Drop,	///< The message is lost (counted by getNbDropped()), the logging thread never waits.
+		Block	///< The logging thread waits for the writer to make room.
+	};
+
+	///@brief	Constructor, start the writer thread.
+	///@param	capacity		(Optional) Number of messages the ring buffer can hold (rounded up to a power of two).
+	///@param	overflowPolicy	(Optional) What to do when the ring buffer is full.
+	LogAsyncHandlerT( Size capacity = Size( 8192 ), OverflowPolicy overflowPolicy = OverflowPolicy::Drop );
+
+	///@brief	Destructor, write the remaining messages and stop the writer thread.
+	~LogAsyncHandlerT();
+
+	virtual void message( const BasicString<T>& logTitle,
+						  const BasicString<T>& logMessage,
+						  typename SimpleLogT<T>::MessageSeverity severity,
+						  typename SimpleLogT<T>::MessageColor color
+	) override;
+
+	virtual void startStep( const BasicString<T>& logTitle,
+							const BasicString<T>& logMessage
+	) override;
+
+	virtual void endStep( const BasicString<T>& logTitle,
+						  const BasicString<T>& logMessage,
+						  typename SimpleLogT<T>::MessageColor color
+	) override;
+
+	virtual void increaseIndent() override;
+	virtual void decreaseIndent() override;
+
+	///@brief	Wait for every message already logged to be written and the file to be synced (to be called before shutting down).
+	virtual void flush() override;
+
+	///@brief	Set an output file path to write the resulting logs into a file.
+	void setOutFilePath( const OS::Path& outFilePath );
+
+	void setSTDOut( bool bSTDOut );
+	void setFileOut( bool bFileOut );
+
+	void setOverflowPolicy( OverflowPolicy overflowPolicy );
+
+	///@brief	Get the number of messages lost because the ring buffer was full.
+	///@return	Number of messages dropped.
+	Size getNbDropped() const;
+
+	///@brief	Number of messages over which a batch is written without waiting for the ring buffer to be empty.
+	static constexpr Size maxBatchSize = Size( 4096 );
+
+private:
+	///@brief	Message formatted by the logging thread, waiting for the writer.
+	struct Record {
+		///@brief	Formatted line without its date (the buffer is kept from one use of the slot to the next).
+		BasicString<T> line;
+		Time::TimePointS time;
+		typename SimpleLogT<T>::MessageColor color;
+		///@brief	If the message is an empty line.
+		bool bNewLine;
+	};
+
+	///@brief	Slot of the ring buffer, its sequence telling if it is free for the position to be written or filled for the one to be read.
+	struct Slot {
+		std::atomic<Size> sequence;
+		Record record;
+	};
+
+	///@brief	Claim a slot for a new record.
+	///@return	Slot to be filled then published with _publish() (NULL if full with the Drop policy).
+	Slot* _claim( Size* position );
+
+	///@brief	Make a filled slot available to the writer.
+	void _publish( Slot* slot, Size position );
+
+	void _writerLoop();
+
+	///@brief	Write the messages buffered for the console with their color.
+	void _writeConsole();
+
+	///@brief	Write the messages buffered for the file.
+	void _writeFile();
+
+	///@brief	Get the date of a record, formatted again only when the second changed.
+	const BasicString<T>& _getDateStr( const Time::TimePointS& time );
+
+	Slot* slotTable;
+	Size capacityMask;
+	std::atomic<Size> enqueueI;
+	Size dequeueI;
+	std::atomic<Size> nbWritten;
+	std::atomic<Size> nbDropped;
+	std::atomic<OverflowPolicy> overflowPolicy;
+
+	std::atomic<int> indent{ 0 };
+	std::atomic<Size> nbSteps{ 0 };
+	std::mutex stepMutex;
+	Vector<Time::TimePointMS> stepStartTimeStack;
+
+	std::atomic<bool> bSTDOut{ false };
+	std::atomic<bool> bFileOut{ false };
+
+	///@brief	Used by the writer thread only.
+	BasicString<T> consoleBuffer;
+	BasicString<T> fileBuffer;
+	typename SimpleLogT<T>::MessageColor consoleColor;
+	Time::TimePointS dateStrTime;
+	BasicString<T> dateStr;
+
+	std::mutex fileMutex;
+	IO::FileStream* fileStream{ NULL };
+
+	std::thread* writerThread;
+	std::mutex sleepMutex;
+	std::condition_variable sleepCondition;
+	std::atomic<bool> bWriterSleeping;
+	std::atomic<bool> bStop;
+};
+
+using LogAsyncHandler = LogAsyncHandlerT<char>;
+
 
 template<typename T>
 class LogT : public SimpleLogT<T> {
@@ -180,6 +323,7 @@ public:
 
 	void callOnIncreaseIndent();
 	void callOnDecreaseIndent();
+	void callOnFlush();
 
 	void setDisplayError( bool bDisplayError );
 	void setDisplayWarning( bool bDisplayWarning );
@@ -267,6 +411,11 @@ public:
 	static void increaseIndent();
 	static void lowerIndent();
 
+	/**
+	 * @brief Wait for every handler to have written the messages already logged (the asynchronous ones write from their own thread).
+	 */
+	static void flush();
+
 	const LogDefaultHandlerT<T> & getDefaultHandler() const;
 	LogDefaultHandlerT<T> & getDefaultHandler();
 
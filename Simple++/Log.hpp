@@ -67,6 +67,13 @@ inline void LogT<T>::callOnDecreaseIndent() {
 	}
 }
 
+template<typename T>
+inline void LogT<T>::callOnFlush() {
+	for ( Size i( 0 ); i < this->handlerVector.getSize(); i++ ) {
+		this->handlerVector.getValueI( i )->flush();
+	}
+}
+
 template<typename T>
 inline void LogT<T>::setDisplayError( bool bDisplayError ) {
 	this->bDisplayError = bDisplayError;
@@ -231,6 +238,11 @@ inline void LogT<T>::lowerIndent() {
 	LogT<T>::getInstance()->callOnDecreaseIndent();
 }
 
+template<typename T>
+inline void LogT<T>::flush() {
+	LogT<T>::getInstance()->callOnFlush();
+}
+
 template<typename T>
 inline const LogDefaultHandlerT<T>& LogT<T>::getDefaultHandler() const {
 	return this->defaultHandler;
@@ -260,6 +272,40 @@ inline LogT<T>* LogT<T>::getInstance() {
 }
 
 
+template<typename T>
+void LogHandlerT<T>::_formatMessage( BasicString<T>* str, const BasicString<T>& logTitle, const BasicString<T>& logMessage, typename SimpleLogT<T>::MessageSeverity severity, Size nbSteps, int indent ) {
+	static const BasicString<T> severityStrTable[] = { "  ERROR", "WARNING", "   INFO", "VERBOSE" };
+
+	( *str ) << BasicString<T>::ElemType( '[' );
+	( *str ) << severityStrTable[ static_cast< unsigned char >( severity ) ];
+	( *str ) << BasicString<T>::ElemType( ']' );
+
+	//  Display the current steps.
+	for ( Size i( 0 ); i < nbSteps; i++ ) {
+		( *str ) << BasicString<T>::ElemType( ' ' );
+		( *str ) << BasicString<T>::ElemType( ' ' );
+		( *str ) << BasicString<T>::ElemType( '|' );
+	}
+
+	( *str ) << BasicString<T>::ElemType( ' ' );
+
+	if ( logTitle.getSize() > Size( 0 ) ) {
+		( *str ) << BasicString<T>::ElemType( '[' );
+		( *str ) << logTitle;
+		( *str ) << BasicString<T>::ElemType( ']' );
+		( *str ) << BasicString<T>::ElemType( ' ' );
+	}
+
+	//  Display the current indentation.
+	for ( int i( 0 ); i < indent; i++ ) {
+		( *str ) << BasicString<T>::ElemType( '\t' );
+	}
+
+	( *str ) << logMessage;
+	( *str ) << BasicString<T>::ElemType( '\n' );
+}
+
+
 template<typename T>
 inline LogDefaultHandlerT<T>::~LogDefaultHandlerT() {
 	if ( this->fileStream ) {
@@ -269,8 +315,6 @@ inline LogDefaultHandlerT<T>::~LogDefaultHandlerT() {
 
 template<typename T>
 inline void LogDefaultHandlerT<T>::message( const BasicString<T>& logTitle, const BasicString<T>& logMessage, typename SimpleLogT<T>::MessageSeverity severity, typename SimpleLogT<T>::MessageColor color ) {
-	static const BasicString<T> severityStrTable[] = { "  ERROR", "WARNING", "   INFO", "VERBOSE" };
-
 	if ( logTitle.getSize() == Size( 0 ) && logMessage.getSize() == Size( 0 ) ) {
 		std::cout << std::endl;
 		return;
@@ -285,35 +329,7 @@ inline void LogDefaultHandlerT<T>::message( const BasicString<T>& logTitle, cons
 	str << Time::Date( Time::getTime<Time::Second>() ).toStringISO();
 	str << BasicString<T>::ElemType( ']' );
 
-	str << BasicString<T>::ElemType( '[' );
-	str << severityStrTable[ static_cast< unsigned char >( severity ) ];
-	str << BasicString<T>::ElemType( ']' );
-
-	//  Display the current indentation.
-	for ( Size i( 0 ); i < this->stepStartTimeStack.getSize(); i++ ) {
-		str << BasicString<T>::ElemType( ' ' );
-		str << BasicString<T>::ElemType( ' ' );
-		str << BasicString<T>::ElemType( '|' );
-	}
-
-	str << BasicString<T>::ElemType( ' ' );
-
-	if ( logTitle.getSize() > Size( 0 ) ) {
-		str << BasicString<T>::ElemType( '[' );
-		str << logTitle;
-		str << BasicString<T>::ElemType( ']' );
-		str << BasicString<T>::ElemType( ' ' );
-	}
-
-
-
-	//  Display the current indentation.
-	for ( Size i( 0 ); i < this->indent; i++ ) {
-		str << BasicString<T>::ElemType( '\t' );
-	}
-
-	str << logMessage;
-	str << BasicString<T>::ElemType( '\n' );
+	LogHandlerT<T>::_formatMessage( &str, logTitle, logMessage, severity, this->stepStartTimeStack.getSize(), this->indent );
 
 	if ( this->bSTDOut ) {
 		if constexpr ( sizeof( T ) == 2 ) {
@@ -391,6 +407,11 @@ inline void LogDefaultHandlerT<T>::sync() {
 	}
 }
 
+template<typename T>
+inline void LogDefaultHandlerT<T>::flush() {
+	sync();
+}
+
 template<typename T>
 inline void LogDefaultHandlerT<T>::setSTDOut( bool bSTDOut ) {
 	if ( this->bSTDOut == bSTDOut ) {
@@ -408,3 +429,302 @@ inline void LogDefaultHandlerT<T>::setFileOut( bool bFileOut ) {
 
 	this->bFileOut = bFileOut;
 }
+
+
+template<typename T>
+LogAsyncHandlerT<T>::LogAsyncHandlerT( Size capacity, OverflowPolicy overflowPolicy ) :
+	enqueueI( Size( 0 ) ),
+	dequeueI( Size( 0 ) ),
+	nbWritten( Size( 0 ) ),
+	nbDropped( Size( 0 ) ),
+	overflowPolicy( overflowPolicy ),
+	consoleColor( SimpleLogT<T>::MessageColor::White ),
+	bWriterSleeping( false ),
+	bStop( false ) {
+
+	// A power of two to get the slot of a position with a mask.
+	Size capacityPow2( 2 );
+	while ( capacityPow2 < capacity ) {
+		capacityPow2 <<= Size( 1 );
+	}
+	this->capacityMask = capacityPow2 - Size( 1 );
+
+	this->slotTable = new Slot[ capacityPow2 ];
+	for ( Size i( 0 ); i < capacityPow2; i++ ) {
+		this->slotTable[ i ].sequence.store( i, std::memory_order_relaxed );
+	}
+
+	this->writerThread = new std::thread( &LogAsyncHandlerT<T>::_writerLoop, this );
+}
+
+template<typename T>
+LogAsyncHandlerT<T>::~LogAsyncHandlerT() {
+	this->bStop.store( true, std::memory_order_release );
+	this->sleepCondition.notify_one();
+	this->writerThread->join();
+	delete this->writerThread;
+
+	delete[] this->slotTable;
+	if ( this->fileStream ) {
+		this->fileStream->sync();
+		delete this->fileStream;
+	}
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::message( const BasicString<T>& logTitle, const BasicString<T>& logMessage, typename SimpleLogT<T>::MessageSeverity severity, typename SimpleLogT<T>::MessageColor color ) {
+	Size position;
+	Slot* slot( _claim( &position ) );
+	if ( !slot ) {
+		return;
+	}
+
+	// The slot is owned by this thread until published, its string keeps its buffer from one message to the next.
+	Record& record( slot->record );
+	record.time = Time::getTime<Time::Second>();
+	record.color = color;
+	record.bNewLine = ( logTitle.getSize() == Size( 0 ) && logMessage.getSize() == Size( 0 ) );
+	record.line.clear();
+	if ( !record.bNewLine ) {
+		LogHandlerT<T>::_formatMessage( &record.line, logTitle, logMessage, severity, this->nbSteps.load( std::memory_order_relaxed ), this->indent.load( std::memory_order_relaxed ) );
+	}
+
+	_publish( slot, position );
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::startStep( const BasicString<T>& logTitle, const BasicString<T>& logMessage ) {
+
+	message( logTitle, logMessage, SimpleLogT<T>::MessageSeverity::Info, SimpleLogT<T>::MessageColor::Cyan );
+
+	std::unique_lock<std::mutex> lock( this->stepMutex );
+	this->stepStartTimeStack.push( Time::getTime<Time::MilliSecond>() );
+	this->nbSteps.store( this->stepStartTimeStack.getSize(), std::memory_order_relaxed );
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::endStep( const BasicString<T>& logTitle, const BasicString<T>& logMessage, typename SimpleLogT<T>::MessageColor color ) {
+	Time::TimePointMS nowTimeMS( Time::getTime<Time::MilliSecond>() );
+
+	Time::Duration<Time::MilliSecond> elapsedTime( 0 );
+
+	{
+		std::unique_lock<std::mutex> lock( this->stepMutex );
+		if ( this->stepStartTimeStack.getSize() > Size( 0 ) ) {
+			Time::TimePointMS& startTimePoint( this->stepStartTimeStack.pop() );
+			elapsedTime = Time::Duration<Time::MilliSecond>( nowTimeMS - startTimePoint );
+		}
+		this->nbSteps.store( this->stepStartTimeStack.getSize(), std::memory_order_relaxed );
+	}
+
+	BasicString<T> logTitleWTime;
+
+	logTitleWTime << logTitle;
+	logTitleWTime << BasicString<T>::ElemType( ' ' );
+	logTitleWTime << BasicString<T>::ElemType( '-' );
+	logTitleWTime << BasicString<T>::ElemType( ' ' );
+	logTitleWTime << BasicString<T>::toString( float( elapsedTime.getValue() ) / 1000.0f, 3 );
+	logTitleWTime << BasicString<T>::ElemType( 's' );
+
+	message( logTitleWTime, logMessage, SimpleLogT<T>::MessageSeverity::Info, color );
+}
+
+template<typename T>
+inline void LogAsyncHandlerT<T>::increaseIndent() {
+	this->indent.fetch_add( 1, std::memory_order_relaxed );
+}
+
+template<typename T>
+inline void LogAsyncHandlerT<T>::decreaseIndent() {
+	this->indent.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::flush() {
+	// Every position claimed before now will be published, wait for the writer to be past them.
+	const Size target( this->enqueueI.load( std::memory_order_acquire ) );
+	while ( this->nbWritten.load( std::memory_order_acquire ) < target ) {
+		this->sleepCondition.notify_one();
+		std::this_thread::yield();
+	}
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::setOutFilePath( const OS::Path& outFilePath ) {
+	std::unique_lock<std::mutex> lock( this->fileMutex );
+
+	if ( this->fileStream ) {
+		delete this->fileStream;
+		this->fileStream = NULL;
+	}
+
+	if ( outFilePath.getSize() > Size( 0 ) ) {
+		this->fileStream = new IO::FileStream( outFilePath, IO::OpenMode::Write );
+	}
+}
+
+template<typename T>
+inline void LogAsyncHandlerT<T>::setSTDOut( bool bSTDOut ) {
+	this->bSTDOut.store( bSTDOut, std::memory_order_relaxed );
+}
+
+template<typename T>
+inline void LogAsyncHandlerT<T>::setFileOut( bool bFileOut ) {
+	this->bFileOut.store( bFileOut, std::memory_order_relaxed );
+}
+
+template<typename T>
+inline void LogAsyncHandlerT<T>::setOverflowPolicy( OverflowPolicy overflowPolicy ) {
+	this->overflowPolicy.store( overflowPolicy, std::memory_order_relaxed );
+}
+
+template<typename T>
+inline Size LogAsyncHandlerT<T>::getNbDropped() const {
+	return this->nbDropped.load( std::memory_order_relaxed );
+}
+
+template<typename T>
+typename LogAsyncHandlerT<T>::Slot* LogAsyncHandlerT<T>::_claim( Size* position ) {
+	Size enqueuePosition( this->enqueueI.load( std::memory_order_relaxed ) );
+	while ( true ) {
+		Slot* slot( this->slotTable + ( enqueuePosition & this->capacityMask ) );
+		const Size sequence( slot->sequence.load( std::memory_order_acquire ) );
+
+		if ( sequence == enqueuePosition ) {
+			// The slot is free for this position, take it if no other thread did.
+			if ( this->enqueueI.compare_exchange_weak( enqueuePosition, enqueuePosition + Size( 1 ), std::memory_order_relaxed ) ) {
+				*position = enqueuePosition;
+				return slot;
+			}
+		} else if ( enqueuePosition - sequence <= this->capacityMask + Size( 1 ) ) {
+			// The slot still holds the record of the previous round, the ring buffer is full.
+			if ( this->overflowPolicy.load( std::memory_order_relaxed ) == OverflowPolicy::Drop ) {
+				this->nbDropped.fetch_add( Size( 1 ), std::memory_order_relaxed );
+				return NULL;
+			}
+			this->sleepCondition.notify_one();
+			std::this_thread::yield();
+			enqueuePosition = this->enqueueI.load( std::memory_order_relaxed );
+		} else {
+			// Another thread took this position.
+			enqueuePosition = this->enqueueI.load( std::memory_order_relaxed );
+		}
+	}
+}
+
+template<typename T>
+inline void LogAsyncHandlerT<T>::_publish( Slot* slot, Size position ) {
+	slot->sequence.store( position + Size( 1 ), std::memory_order_release );
+
+	// The writer sleeps with a timeout, the lock is not needed to not loose a wake up.
+	if ( this->bWriterSleeping.load( std::memory_order_relaxed ) ) {
+		this->sleepCondition.notify_one();
+	}
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::_writerLoop() {
+	while ( true ) {
+		const bool bStopAsked( this->bStop.load( std::memory_order_acquire ) );
+		const bool bSTDOut( this->bSTDOut.load( std::memory_order_relaxed ) );
+		const bool bFileOut( this->bFileOut.load( std::memory_order_relaxed ) );
+
+		Size nbRead( 0 );
+		while ( nbRead < LogAsyncHandlerT<T>::maxBatchSize ) {
+			Slot* slot( this->slotTable + ( this->dequeueI & this->capacityMask ) );
+			if ( slot->sequence.load( std::memory_order_acquire ) != this->dequeueI + Size( 1 ) ) {
+				break;
+			}
+
+			const Record& record( slot->record );
+			if ( record.bNewLine ) {
+				if ( bSTDOut ) {
+					this->consoleBuffer << BasicString<T>::ElemType( '\n' );
+				}
+				if ( bFileOut ) {
+					this->fileBuffer << BasicString<T>::ElemType( '\n' );
+				}
+			} else {
+				const BasicString<T>& dateStr( _getDateStr( record.time ) );
+				if ( bSTDOut ) {
+					// The console color applies to everything written, change it only between two writes.
+					if ( record.color != this->consoleColor ) {
+						_writeConsole();
+						this->consoleColor = record.color;
+					}
+					this->consoleBuffer << BasicString<T>::ElemType( '[' );
+					this->consoleBuffer << dateStr;
+					this->consoleBuffer << BasicString<T>::ElemType( ']' );
+					this->consoleBuffer << record.line;
+				}
+				if ( bFileOut ) {
+					this->fileBuffer << BasicString<T>::ElemType( '[' );
+					this->fileBuffer << dateStr;
+					this->fileBuffer << BasicString<T>::ElemType( ']' );
+					this->fileBuffer << record.line;
+				}
+			}
+
+			// Give the slot back for the next round.
+			slot->sequence.store( this->dequeueI + this->capacityMask + Size( 1 ), std::memory_order_release );
+			this->dequeueI++;
+			nbRead++;
+		}
+
+		if ( nbRead > Size( 0 ) ) {
+			_writeConsole();
+			_writeFile();
+			this->nbWritten.store( this->dequeueI, std::memory_order_release );
+			continue;
+		}
+
+		// Stop only when nothing was left.
+		if ( bStopAsked ) {
+			break;
+		}
+
+		std::unique_lock<std::mutex> lock( this->sleepMutex );
+		this->bWriterSleeping.store( true, std::memory_order_relaxed );
+		this->sleepCondition.wait_for( lock, std::chrono::milliseconds( 10 ) );
+		this->bWriterSleeping.store( false, std::memory_order_relaxed );
+	}
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::_writeConsole() {
+	if ( this->consoleBuffer.getSize() == Size( 0 ) ) {
+		return;
+	}
+
+	SimpleLogT<T>::setConsoleColor( this->consoleColor );
+	if constexpr ( sizeof( T ) == 2 ) {
+		std::wcout << this->consoleBuffer.toCString();
+	} else {
+		std::cout << this->consoleBuffer.toCString();
+	}
+	this->consoleBuffer.clear();
+}
+
+template<typename T>
+void LogAsyncHandlerT<T>::_writeFile() {
+	if ( this->fileBuffer.getSize() == Size( 0 ) ) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock( this->fileMutex );
+	if ( this->fileStream ) {
+		this->fileStream->write( reinterpret_cast< const char* >( this->fileBuffer.toCString() ), this->fileBuffer.getSize() * sizeof( T ) );
+		this->fileStream->sync();
+	}
+	this->fileBuffer.clear();
+}
+
+template<typename T>
+const BasicString<T>& LogAsyncHandlerT<T>::_getDateStr( const Time::TimePointS& time ) {
+	if ( this->dateStr.getSize() == Size( 0 ) || time != this->dateStrTime ) {
+		this->dateStrTime = time;
+		this->dateStr.clear();
+		this->dateStr << Time::Date( time ).toStringISO();
+	}
+	return this->dateStr;
+}
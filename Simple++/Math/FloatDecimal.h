@@ -0,0 +1,109 @@
+///@file		Math/FloatDecimal.h.
+///@brief		Declares the exact conversions between the binary floating points and their decimal representation.
+#pragma once
+
+#include <cstring>
+#if defined _MSC_VER && defined _M_X64
+#include <intrin.h>
+#endif
+
+namespace Math {
+
+	namespace FloatDecimal {
+
+		///@brief Unsigned integer of 128 bits.
+		struct UInt128 {
+			unsigned long long int hi;
+			unsigned long long int lo;
+		};
+
+		///@brief Decimal number significand * 10^exponent.
+		struct Decimal {
+			unsigned long long int significand;
+			int exponent;
+		};
+
+		///@brief Smallest and biggest exponents e of the table of the 10^e.
+		constexpr int pow10MinExponent = -342;
+		constexpr int pow10MaxExponent = 324;
+
+		///@brief Multiply two 64 bits integers without any loss.
+		///@param a First operand.
+		///@param b Second operand.
+		///@return 128 bits product.
+		inline static UInt128 mul128( unsigned long long int a, unsigned long long int b );
+
+		///@brief Get floor(log2(10^e)).
+		///@param e Exponent, in [-1650, 1650].
+		///@return Computed value.
+		inline static int floorLog2Pow10( int e );
+
+		///@brief Get floor(log10(2^e)).
+		///@param e Exponent, in [-2620, 2620].
+		///@return Computed value.
+		inline static int floorLog10Pow2( int e );
+
+		///@brief Get floor(log10(3/4 * 2^e)).
+		///@param e Exponent, in [-2985, 2936].
+		///@return Computed value.
+		inline static int floorLog10ThreeQuartersPow2( int e );
+
+		///@brief Get the 128 most significant bits of 10^e, truncated (floor(10^e * 2^(127 - floorLog2Pow10(e)))).
+		///@param e Exponent, in [pow10MinExponent, pow10MaxExponent].
+		///@return 10^e normalized in [2^127, 2^128).
+		inline static const UInt128 & getPow10( int e );
+
+		///@brief Compute the shortest decimal reading back to the same double, the closest one if several (Schubfach algorithm, exact).
+		///@param number Finite and strictly positive number.
+		///@return Decimal representation, without trailing zeros in the significand (at most 17 digits).
+		inline static Decimal toDecimal( double number );
+
+		///@brief Compute the shortest decimal reading back to the same float, the closest one if several (Schubfach algorithm, exact).
+		///@param number Finite and strictly positive number.
+		///@return Decimal representation, without trailing zeros in the significand (at most 9 digits).
+		inline static Decimal toDecimal( float number );
+
+		///@brief Compute the double closest to significand * 10^exponent, ties to even (Clinger fast path, Eisel-Lemire algorithm otherwise, exact).
+		///@param significand Decimal significand.
+		///@param exponent Decimal exponent.
+		///@return Closest double (0 or infinity if out of range).
+		inline static double toDouble( unsigned long long int significand, int exponent );
+
+		///@brief Compute the float closest to significand * 10^exponent, ties to even (Clinger fast path, Eisel-Lemire algorithm otherwise, exact).
+		///@param significand Decimal significand.
+		///@param exponent Decimal exponent.
+		///@return Closest float (0 or infinity if out of range).
+		inline static float toFloat( unsigned long long int significand, int exponent );
+
+		///@brief Count the leading zero bits.
+		///@param v Non zero integer.
+		///@return Number of zeros before the most significant bit set.
+		inline static int countLeadingZeros( unsigned long long int v );
+
+		///@brief Compute the IEEE bits of the binary floating point closest to w * 10^q (Eisel-Lemire algorithm).
+		///@param w Non zero decimal significand.
+		///@param q Decimal exponent.
+		///@param bFloat If the bits are the ones of a float and not of a double.
+		inline static unsigned long long int _toBinary( unsigned long long int w, int q, bool bFloat );
+
+		///@brief Round (g + 1) * cp / 2^128 to odd, g being the truncated 10^e of getPow10().
+		inline static unsigned long long int _roundToOdd( const UInt128 & g, unsigned long long int cp );
+
+		///@brief Round (g + 1) * cp / 2^64 to odd, g being the 64 most significant bits of getPow10().
+		inline static unsigned long long int _roundToOdd( unsigned long long int g, unsigned long long int cp );
+
+		///@brief Compute the shortest decimal inside the rounding interval of c * 2^q.
+		///@param c Binary significand.
+		///@param q Binary exponent.
+		///@param bLowerCloser If the previous floating point is at half the distance of the next one (c being a power of 2).
+		///@param bFloat If the number is a float and not a double.
+		inline static Decimal _toDecimal( unsigned long long int c, int q, bool bLowerCloser, bool bFloat );
+
+		///@brief Remove the trailing zeros of a decimal significand.
+		inline static Decimal _removeTrailingZeros( Decimal decimal );
+
+	}
+
+}
+
+#include "FloatDecimal.hpp"
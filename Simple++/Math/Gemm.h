@@ -0,0 +1,109 @@
+///@file		Math/Gemm.h.
+///@brief		Declares the general matrix multiplication engine used by Math::Mat.
+#pragma once
+
+#include "../CPU.h"
+#include "../Utility.h"
+#include "BasicMath.h"
+
+namespace Math {
+
+	namespace Gemm {
+
+		///@brief Operation applied to an operand before the product.
+		enum class Op : unsigned char {
+			None,
+			Transpose
+		};
+
+		///@brief Compute C = op(A) * op(B), or C += op(A) * op(B), every matrix being stored row major.
+		///			float and double are computed by cache blocked and register blocked kernels (with the instruction set of CPU::getIsa()), the other types use the naive loop.
+		///			The k products of an element are summed in the same order than the naive loop (no FMA), the results are bit identical.
+		///@param m Number of rows of op(A) and C.
+		///@param n Number of columns of op(B) and C.
+		///@param k Number of columns of op(A) and of rows of op(B).
+		///@param a Pointer to the first element of A.
+		///@param lda Distance between two rows of A (as stored).
+		///@param opA Operation applied to A (Op::Transpose reads A as stored k x m without any copy).
+		///@param b Pointer to the first element of B.
+		///@param ldb Distance between two rows of B (as stored).
+		///@param opB Operation applied to B (Op::Transpose reads B as stored n x k without any copy).
+		///@param c Pointer to the first element of C (must not overlap A or B).
+		///@param ldc Distance between two rows of C.
+		///@param bAccumulate (Optional) If the product has to be added to C instead of overwriting it.
+		template<typename T>
+		inline void multiply( const Size m, const Size n, const Size k, const T * a, const Size lda, const Op opA, const T * b, const Size ldb, const Op opB, T * c, const Size ldc, const bool bAccumulate = false );
+		inline void multiply( const Size m, const Size n, const Size k, const float * a, const Size lda, const Op opA, const float * b, const Size ldb, const Op opB, float * c, const Size ldc, const bool bAccumulate = false );
+		inline void multiply( const Size m, const Size n, const Size k, const double * a, const Size lda, const Op opA, const double * b, const Size ldb, const Op opB, double * c, const Size ldc, const bool bAccumulate = false );
+
+		///@brief Naive triple loop version of multiply(), used for the small products and as the reference of the blocked one.
+		template<typename T>
+		inline void multiplyNaive( const Size m, const Size n, const Size k, const T * a, const Size lda, const Op opA, const T * b, const Size ldb, const Op opB, T * c, const Size ldc, const bool bAccumulate = false );
+
+
+
+		/** @brief	Private, do not use it */
+		template<typename T, Size MR>
+		inline void _packA( const Size mc, const Size kc, const T * a, const Size lda, const Op opA, T * aPacked );
+		/** @brief	Private, do not use it */
+		template<typename T, Size NR>
+		inline void _packB( const Size kc, const Size nc, const T * b, const Size ldb, const Op opB, T * bPacked );
+		/** @brief	Private, do not use it */
+		template<typename Kernel, typename T>
+		inline void _multiplyBlocked( const Size m, const Size n, const Size k, const T * a, const Size lda, const Op opA, const T * b, const Size ldb, const Op opB, T * c, const Size ldc, const bool bAccumulate );
+
+		///@brief Micro kernels, each one compute a MR x NR tile of C from a packed A panel (MR values by k) and a packed B panel (NR values by k).
+		///			compute( kc, aPanel, bPanel, c, ldc, bLoad ) : c[ i * ldc + j ] = ( bLoad ? c[ i * ldc + j ] : 0 ) + sum( aPanel[ p * MR + i ] * bPanel[ p * NR + j ] ).
+		///			MC, KC and NC are the cache blocks sizes (MC x KC of A for L2, KC x NR of B for L1).
+		template<typename T>
+		struct _KernelScalar {
+			static constexpr Size MR = Size( 4 );
+			static constexpr Size NR = Size( 4 );
+			static constexpr Size MC = Size( 120 );
+			static constexpr Size KC = Size( 256 );
+			static constexpr Size NC = Size( 2048 );
+
+			inline static void compute( const Size kc, const T * aPanel, const T * bPanel, T * c, const Size ldc, const bool bLoad );
+		};
+#if defined CPU_X86
+		struct _KernelSSE2Float {
+			static constexpr Size MR = Size( 4 );
+			static constexpr Size NR = Size( 8 );
+			static constexpr Size MC = Size( 120 );
+			static constexpr Size KC = Size( 256 );
+			static constexpr Size NC = Size( 2048 );
+
+			CPU_TARGET_SSE2 inline static void compute( const Size kc, const float * aPanel, const float * bPanel, float * c, const Size ldc, const bool bLoad );
+		};
+		struct _KernelSSE2Double {
+			static constexpr Size MR = Size( 4 );
+			static constexpr Size NR = Size( 4 );
+			static constexpr Size MC = Size( 60 );
+			static constexpr Size KC = Size( 256 );
+			static constexpr Size NC = Size( 2048 );
+
+			CPU_TARGET_SSE2 inline static void compute( const Size kc, const double * aPanel, const double * bPanel, double * c, const Size ldc, const bool bLoad );
+		};
+		struct _KernelAVXFloat {
+			static constexpr Size MR = Size( 6 );
+			static constexpr Size NR = Size( 16 );
+			static constexpr Size MC = Size( 120 );
+			static constexpr Size KC = Size( 256 );
+			static constexpr Size NC = Size( 2048 );
+
+			CPU_TARGET_AVX inline static void compute( const Size kc, const float * aPanel, const float * bPanel, float * c, const Size ldc, const bool bLoad );
+		};
+		struct _KernelAVXDouble {
+			static constexpr Size MR = Size( 6 );
+			static constexpr Size NR = Size( 8 );
+			static constexpr Size MC = Size( 60 );
+			static constexpr Size KC = Size( 256 );
+			static constexpr Size NC = Size( 2048 );
+
+			CPU_TARGET_AVX inline static void compute( const Size kc, const double * aPanel, const double * bPanel, double * c, const Size ldc, const bool bLoad );
+		};
+#endif
+	}
+}
+
+#include "Gemm.hpp"
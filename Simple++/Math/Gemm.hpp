@@ -0,0 +1,480 @@
+namespace Math {
+
+	namespace Gemm {
+
+		template<typename T>
+		void multiply( const Size m, const Size n, const Size k, const T * a, const Size lda, const Op opA, const T * b, const Size ldb, const Op opB, T * c, const Size ldc, const bool bAccumulate ) {
+			multiplyNaive( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+		}
+
+		void multiply( const Size m, const Size n, const Size k, const float * a, const Size lda, const Op opA, const float * b, const Size ldb, const Op opB, float * c, const Size ldc, const bool bAccumulate ) {
+			// The packing would cost more than it saves on the small products.
+			if ( m * n * k < Size( 4096 ) ) {
+				return multiplyNaive( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+			}
+			switch ( CPU::getIsa() ) {
+#if defined CPU_X86
+				case CPU::Isa::AVX2:
+				case CPU::Isa::AVX:
+					return _multiplyBlocked<_KernelAVXFloat>( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+				case CPU::Isa::SSE2:
+					return _multiplyBlocked<_KernelSSE2Float>( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+#endif
+				default:
+					return _multiplyBlocked<_KernelScalar<float>>( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+			}
+		}
+
+		void multiply( const Size m, const Size n, const Size k, const double * a, const Size lda, const Op opA, const double * b, const Size ldb, const Op opB, double * c, const Size ldc, const bool bAccumulate ) {
+			// The packing would cost more than it saves on the small products.
+			if ( m * n * k < Size( 4096 ) ) {
+				return multiplyNaive( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+			}
+			switch ( CPU::getIsa() ) {
+#if defined CPU_X86
+				case CPU::Isa::AVX2:
+				case CPU::Isa::AVX:
+					return _multiplyBlocked<_KernelAVXDouble>( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+				case CPU::Isa::SSE2:
+					return _multiplyBlocked<_KernelSSE2Double>( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+#endif
+				default:
+					return _multiplyBlocked<_KernelScalar<double>>( m, n, k, a, lda, opA, b, ldb, opB, c, ldc, bAccumulate );
+			}
+		}
+
+		template<typename T>
+		void multiplyNaive( const Size m, const Size n, const Size k, const T * a, const Size lda, const Op opA, const T * b, const Size ldb, const Op opB, T * c, const Size ldc, const bool bAccumulate ) {
+			const Size aStrideI( ( opA == Op::None ) ? lda : Size( 1 ) );
+			const Size aStrideP( ( opA == Op::None ) ? Size( 1 ) : lda );
+			const Size bStrideP( ( opB == Op::None ) ? ldb : Size( 1 ) );
+			const Size bStrideJ( ( opB == Op::None ) ? Size( 1 ) : ldb );
+
+			for ( Size i( 0 ); i < m; i++ ) {
+				for ( Size j( 0 ); j < n; j++ ) {
+					T value( bAccumulate ? c[ i * ldc + j ] : T( 0 ) );
+
+					for ( Size p( 0 ); p < k; p++ ) {
+						value += a[ i * aStrideI + p * aStrideP ] * b[ p * bStrideP + j * bStrideJ ];
+					}
+
+					c[ i * ldc + j ] = value;
+				}
+			}
+		}
+
+		template<typename T, Size MR>
+		void _packA( const Size mc, const Size kc, const T * a, const Size lda, const Op opA, T * aPacked ) {
+			// One panel of MR rows after the other, each panel stored column by column, the missing rows are padded with zeros.
+			for ( Size ir( 0 ); ir < mc; ir += MR ) {
+				const Size mr( Math::min( MR, mc - ir ) );
+				if ( opA == Op::None ) {
+					for ( Size p( 0 ); p < kc; p++ ) {
+						for ( Size i( 0 ); i < mr; i++ ) {
+							aPacked[ p * MR + i ] = a[ ( ir + i ) * lda + p ];
+						}
+						for ( Size i( mr ); i < MR; i++ ) {
+							aPacked[ p * MR + i ] = T( 0 );
+						}
+					}
+				} else {
+					for ( Size p( 0 ); p < kc; p++ ) {
+						const T * aRow( a + p * lda + ir );
+						for ( Size i( 0 ); i < mr; i++ ) {
+							aPacked[ p * MR + i ] = aRow[ i ];
+						}
+						for ( Size i( mr ); i < MR; i++ ) {
+							aPacked[ p * MR + i ] = T( 0 );
+						}
+					}
+				}
+				aPacked += MR * kc;
+			}
+		}
+
+		template<typename T, Size NR>
+		void _packB( const Size kc, const Size nc, const T * b, const Size ldb, const Op opB, T * bPacked ) {
+			// One panel of NR columns after the other, each panel stored row by row, the missing columns are padded with zeros.
+			for ( Size jr( 0 ); jr < nc; jr += NR ) {
+				const Size nr( Math::min( NR, nc - jr ) );
+				if ( opB == Op::None ) {
+					for ( Size p( 0 ); p < kc; p++ ) {
+						const T * bRow( b + p * ldb + jr );
+						for ( Size j( 0 ); j < nr; j++ ) {
+							bPacked[ p * NR + j ] = bRow[ j ];
+						}
+						for ( Size j( nr ); j < NR; j++ ) {
+							bPacked[ p * NR + j ] = T( 0 );
+						}
+					}
+				} else {
+					for ( Size p( 0 ); p < kc; p++ ) {
+						for ( Size j( 0 ); j < nr; j++ ) {
+							bPacked[ p * NR + j ] = b[ ( jr + j ) * ldb + p ];
+						}
+						for ( Size j( nr ); j < NR; j++ ) {
+							bPacked[ p * NR + j ] = T( 0 );
+						}
+					}
+				}
+				bPacked += NR * kc;
+			}
+		}
+
+		template<typename Kernel, typename T>
+		void _multiplyBlocked( const Size m, const Size n, const Size k, const T * a, const Size lda, const Op opA, const T * b, const Size ldb, const Op opB, T * c, const Size ldc, const bool bAccumulate ) {
+			constexpr Size MR( Kernel::MR );
+			constexpr Size NR( Kernel::NR );
+
+			if ( k == Size( 0 ) ) {
+				if ( !bAccumulate ) {
+					for ( Size i( 0 ); i < m; i++ ) {
+						for ( Size j( 0 ); j < n; j++ ) {
+							c[ i * ldc + j ] = T( 0 );
+						}
+					}
+				}
+				return;
+			}
+
+			const Size mcMax( Math::min( Kernel::MC, ( ( m + MR - Size( 1 ) ) / MR ) * MR ) );
+			const Size ncMax( Math::min( Kernel::NC, ( ( n + NR - Size( 1 ) ) / NR ) * NR ) );
+			const Size kcMax( Math::min( Kernel::KC, k ) );
+			T * aPacked( new T[ mcMax * kcMax ] );
+			T * bPacked( new T[ kcMax * ncMax ] );
+			T tileTable[ MR * NR ];
+
+			for ( Size jc( 0 ); jc < n; jc += Kernel::NC ) {
+				const Size nc( Math::min( Kernel::NC, n - jc ) );
+
+				for ( Size pc( 0 ); pc < k; pc += Kernel::KC ) {
+					const Size kc( Math::min( Kernel::KC, k - pc ) );
+					// Every block after the first one of k continue the sums where the previous one stopped.
+					const bool bLoad( bAccumulate || pc > Size( 0 ) );
+
+					_packB<T, NR>( kc, nc, ( opB == Op::None ) ? ( b + pc * ldb + jc ) : ( b + jc * ldb + pc ), ldb, opB, bPacked );
+
+					for ( Size ic( 0 ); ic < m; ic += Kernel::MC ) {
+						const Size mc( Math::min( Kernel::MC, m - ic ) );
+
+						_packA<T, MR>( mc, kc, ( opA == Op::None ) ? ( a + ic * lda + pc ) : ( a + pc * lda + ic ), lda, opA, aPacked );
+
+						for ( Size jr( 0 ); jr < nc; jr += NR ) {
+							const Size nr( Math::min( NR, nc - jr ) );
+							const T * bPanel( bPacked + jr * kc );
+
+							for ( Size ir( 0 ); ir < mc; ir += MR ) {
+								const Size mr( Math::min( MR, mc - ir ) );
+								const T * aPanel( aPacked + ir * kc );
+								T * cTile( c + ( ic + ir ) * ldc + jc + jr );
+
+								if ( mr == MR && nr == NR ) {
+									Kernel::compute( kc, aPanel, bPanel, cTile, ldc, bLoad );
+								} else {
+									// Border tile, computed into a full size one.
+									if ( bLoad ) {
+										for ( Size i( 0 ); i < mr; i++ ) {
+											Utility::copy( tileTable + i * NR, cTile + i * ldc, nr );
+										}
+									}
+									Kernel::compute( kc, aPanel, bPanel, tileTable, NR, bLoad );
+									for ( Size i( 0 ); i < mr; i++ ) {
+										Utility::copy( cTile + i * ldc, tileTable + i * NR, nr );
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+
+			delete[] aPacked;
+			delete[] bPacked;
+		}
+
+		template<typename T>
+		void _KernelScalar<T>::compute( const Size kc, const T * aPanel, const T * bPanel, T * c, const Size ldc, const bool bLoad ) {
+			T tileTable[ MR ][ NR ];
+			for ( Size i( 0 ); i < MR; i++ ) {
+				for ( Size j( 0 ); j < NR; j++ ) {
+					tileTable[ i ][ j ] = bLoad ? c[ i * ldc + j ] : T( 0 );
+				}
+			}
+
+			for ( Size p( 0 ); p < kc; p++ ) {
+				for ( Size i( 0 ); i < MR; i++ ) {
+					for ( Size j( 0 ); j < NR; j++ ) {
+						tileTable[ i ][ j ] += aPanel[ i ] * bPanel[ j ];
+					}
+				}
+				aPanel += MR;
+				bPanel += NR;
+			}
+
+			for ( Size i( 0 ); i < MR; i++ ) {
+				for ( Size j( 0 ); j < NR; j++ ) {
+					c[ i * ldc + j ] = tileTable[ i ][ j ];
+				}
+			}
+		}
+
+#if defined CPU_X86
+		CPU_TARGET_SSE2 void _KernelSSE2Float::compute( const Size kc, const float * aPanel, const float * bPanel, float * c, const Size ldc, const bool bLoad ) {
+			__m128 c00, c01;
+			__m128 c10, c11;
+			__m128 c20, c21;
+			__m128 c30, c31;
+			if ( bLoad ) {
+				c00 = _mm_loadu_ps( c );
+				c01 = _mm_loadu_ps( c + Size( 4 ) );
+				c10 = _mm_loadu_ps( c + ldc );
+				c11 = _mm_loadu_ps( c + ldc + Size( 4 ) );
+				c20 = _mm_loadu_ps( c + Size( 2 ) * ldc );
+				c21 = _mm_loadu_ps( c + Size( 2 ) * ldc + Size( 4 ) );
+				c30 = _mm_loadu_ps( c + Size( 3 ) * ldc );
+				c31 = _mm_loadu_ps( c + Size( 3 ) * ldc + Size( 4 ) );
+			} else {
+				c00 = _mm_setzero_ps();
+				c01 = _mm_setzero_ps();
+				c10 = _mm_setzero_ps();
+				c11 = _mm_setzero_ps();
+				c20 = _mm_setzero_ps();
+				c21 = _mm_setzero_ps();
+				c30 = _mm_setzero_ps();
+				c31 = _mm_setzero_ps();
+			}
+
+			for ( Size p( 0 ); p < kc; p++ ) {
+				const __m128 b0( _mm_loadu_ps( bPanel ) );
+				const __m128 b1( _mm_loadu_ps( bPanel + Size( 4 ) ) );
+				const __m128 a0( _mm_load1_ps( aPanel ) );
+				const __m128 a1( _mm_load1_ps( aPanel + Size( 1 ) ) );
+				const __m128 a2( _mm_load1_ps( aPanel + Size( 2 ) ) );
+				const __m128 a3( _mm_load1_ps( aPanel + Size( 3 ) ) );
+				c00 = _mm_add_ps( c00, _mm_mul_ps( a0, b0 ) );
+				c01 = _mm_add_ps( c01, _mm_mul_ps( a0, b1 ) );
+				c10 = _mm_add_ps( c10, _mm_mul_ps( a1, b0 ) );
+				c11 = _mm_add_ps( c11, _mm_mul_ps( a1, b1 ) );
+				c20 = _mm_add_ps( c20, _mm_mul_ps( a2, b0 ) );
+				c21 = _mm_add_ps( c21, _mm_mul_ps( a2, b1 ) );
+				c30 = _mm_add_ps( c30, _mm_mul_ps( a3, b0 ) );
+				c31 = _mm_add_ps( c31, _mm_mul_ps( a3, b1 ) );
+				aPanel += Size( 4 );
+				bPanel += Size( 8 );
+			}
+
+			_mm_storeu_ps( c, c00 );
+			_mm_storeu_ps( c + Size( 4 ), c01 );
+			_mm_storeu_ps( c + ldc, c10 );
+			_mm_storeu_ps( c + ldc + Size( 4 ), c11 );
+			_mm_storeu_ps( c + Size( 2 ) * ldc, c20 );
+			_mm_storeu_ps( c + Size( 2 ) * ldc + Size( 4 ), c21 );
+			_mm_storeu_ps( c + Size( 3 ) * ldc, c30 );
+			_mm_storeu_ps( c + Size( 3 ) * ldc + Size( 4 ), c31 );
+		}
+
+		CPU_TARGET_SSE2 void _KernelSSE2Double::compute( const Size kc, const double * aPanel, const double * bPanel, double * c, const Size ldc, const bool bLoad ) {
+			__m128d c00, c01;
+			__m128d c10, c11;
+			__m128d c20, c21;
+			__m128d c30, c31;
+			if ( bLoad ) {
+				c00 = _mm_loadu_pd( c );
+				c01 = _mm_loadu_pd( c + Size( 2 ) );
+				c10 = _mm_loadu_pd( c + ldc );
+				c11 = _mm_loadu_pd( c + ldc + Size( 2 ) );
+				c20 = _mm_loadu_pd( c + Size( 2 ) * ldc );
+				c21 = _mm_loadu_pd( c + Size( 2 ) * ldc + Size( 2 ) );
+				c30 = _mm_loadu_pd( c + Size( 3 ) * ldc );
+				c31 = _mm_loadu_pd( c + Size( 3 ) * ldc + Size( 2 ) );
+			} else {
+				c00 = _mm_setzero_pd();
+				c01 = _mm_setzero_pd();
+				c10 = _mm_setzero_pd();
+				c11 = _mm_setzero_pd();
+				c20 = _mm_setzero_pd();
+				c21 = _mm_setzero_pd();
+				c30 = _mm_setzero_pd();
+				c31 = _mm_setzero_pd();
+			}
+
+			for ( Size p( 0 ); p < kc; p++ ) {
+				const __m128d b0( _mm_loadu_pd( bPanel ) );
+				const __m128d b1( _mm_loadu_pd( bPanel + Size( 2 ) ) );
+				const __m128d a0( _mm_load1_pd( aPanel ) );
+				const __m128d a1( _mm_load1_pd( aPanel + Size( 1 ) ) );
+				const __m128d a2( _mm_load1_pd( aPanel + Size( 2 ) ) );
+				const __m128d a3( _mm_load1_pd( aPanel + Size( 3 ) ) );
+				c00 = _mm_add_pd( c00, _mm_mul_pd( a0, b0 ) );
+				c01 = _mm_add_pd( c01, _mm_mul_pd( a0, b1 ) );
+				c10 = _mm_add_pd( c10, _mm_mul_pd( a1, b0 ) );
+				c11 = _mm_add_pd( c11, _mm_mul_pd( a1, b1 ) );
+				c20 = _mm_add_pd( c20, _mm_mul_pd( a2, b0 ) );
+				c21 = _mm_add_pd( c21, _mm_mul_pd( a2, b1 ) );
+				c30 = _mm_add_pd( c30, _mm_mul_pd( a3, b0 ) );
+				c31 = _mm_add_pd( c31, _mm_mul_pd( a3, b1 ) );
+				aPanel += Size( 4 );
+				bPanel += Size( 4 );
+			}
+
+			_mm_storeu_pd( c, c00 );
+			_mm_storeu_pd( c + Size( 2 ), c01 );
+			_mm_storeu_pd( c + ldc, c10 );
+			_mm_storeu_pd( c + ldc + Size( 2 ), c11 );
+			_mm_storeu_pd( c + Size( 2 ) * ldc, c20 );
+			_mm_storeu_pd( c + Size( 2 ) * ldc + Size( 2 ), c21 );
+			_mm_storeu_pd( c + Size( 3 ) * ldc, c30 );
+			_mm_storeu_pd( c + Size( 3 ) * ldc + Size( 2 ), c31 );
+		}
+
+		CPU_TARGET_AVX void _KernelAVXFloat::compute( const Size kc, const float * aPanel, const float * bPanel, float * c, const Size ldc, const bool bLoad ) {
+			__m256 c00, c01;
+			__m256 c10, c11;
+			__m256 c20, c21;
+			__m256 c30, c31;
+			__m256 c40, c41;
+			__m256 c50, c51;
+			if ( bLoad ) {
+				c00 = _mm256_loadu_ps( c );
+				c01 = _mm256_loadu_ps( c + Size( 8 ) );
+				c10 = _mm256_loadu_ps( c + ldc );
+				c11 = _mm256_loadu_ps( c + ldc + Size( 8 ) );
+				c20 = _mm256_loadu_ps( c + Size( 2 ) * ldc );
+				c21 = _mm256_loadu_ps( c + Size( 2 ) * ldc + Size( 8 ) );
+				c30 = _mm256_loadu_ps( c + Size( 3 ) * ldc );
+				c31 = _mm256_loadu_ps( c + Size( 3 ) * ldc + Size( 8 ) );
+				c40 = _mm256_loadu_ps( c + Size( 4 ) * ldc );
+				c41 = _mm256_loadu_ps( c + Size( 4 ) * ldc + Size( 8 ) );
+				c50 = _mm256_loadu_ps( c + Size( 5 ) * ldc );
+				c51 = _mm256_loadu_ps( c + Size( 5 ) * ldc + Size( 8 ) );
+			} else {
+				c00 = _mm256_setzero_ps();
+				c01 = _mm256_setzero_ps();
+				c10 = _mm256_setzero_ps();
+				c11 = _mm256_setzero_ps();
+				c20 = _mm256_setzero_ps();
+				c21 = _mm256_setzero_ps();
+				c30 = _mm256_setzero_ps();
+				c31 = _mm256_setzero_ps();
+				c40 = _mm256_setzero_ps();
+				c41 = _mm256_setzero_ps();
+				c50 = _mm256_setzero_ps();
+				c51 = _mm256_setzero_ps();
+			}
+
+			for ( Size p( 0 ); p < kc; p++ ) {
+				const __m256 b0( _mm256_loadu_ps( bPanel ) );
+				const __m256 b1( _mm256_loadu_ps( bPanel + Size( 8 ) ) );
+				const __m256 a0( _mm256_broadcast_ss( aPanel ) );
+				const __m256 a1( _mm256_broadcast_ss( aPanel + Size( 1 ) ) );
+				const __m256 a2( _mm256_broadcast_ss( aPanel + Size( 2 ) ) );
+				const __m256 a3( _mm256_broadcast_ss( aPanel + Size( 3 ) ) );
+				const __m256 a4( _mm256_broadcast_ss( aPanel + Size( 4 ) ) );
+				const __m256 a5( _mm256_broadcast_ss( aPanel + Size( 5 ) ) );
+				c00 = _mm256_add_ps( c00, _mm256_mul_ps( a0, b0 ) );
+				c01 = _mm256_add_ps( c01, _mm256_mul_ps( a0, b1 ) );
+				c10 = _mm256_add_ps( c10, _mm256_mul_ps( a1, b0 ) );
+				c11 = _mm256_add_ps( c11, _mm256_mul_ps( a1, b1 ) );
+				c20 = _mm256_add_ps( c20, _mm256_mul_ps( a2, b0 ) );
+				c21 = _mm256_add_ps( c21, _mm256_mul_ps( a2, b1 ) );
+				c30 = _mm256_add_ps( c30, _mm256_mul_ps( a3, b0 ) );
+				c31 = _mm256_add_ps( c31, _mm256_mul_ps( a3, b1 ) );
+				c40 = _mm256_add_ps( c40, _mm256_mul_ps( a4, b0 ) );
+				c41 = _mm256_add_ps( c41, _mm256_mul_ps( a4, b1 ) );
+				c50 = _mm256_add_ps( c50, _mm256_mul_ps( a5, b0 ) );
+				c51 = _mm256_add_ps( c51, _mm256_mul_ps( a5, b1 ) );
+				aPanel += Size( 6 );
+				bPanel += Size( 16 );
+			}
+
+			_mm256_storeu_ps( c, c00 );
+			_mm256_storeu_ps( c + Size( 8 ), c01 );
+			_mm256_storeu_ps( c + ldc, c10 );
+			_mm256_storeu_ps( c + ldc + Size( 8 ), c11 );
+			_mm256_storeu_ps( c + Size( 2 ) * ldc, c20 );
+			_mm256_storeu_ps( c + Size( 2 ) * ldc + Size( 8 ), c21 );
+			_mm256_storeu_ps( c + Size( 3 ) * ldc, c30 );
+			_mm256_storeu_ps( c + Size( 3 ) * ldc + Size( 8 ), c31 );
+			_mm256_storeu_ps( c + Size( 4 ) * ldc, c40 );
+			_mm256_storeu_ps( c + Size( 4 ) * ldc + Size( 8 ), c41 );
+			_mm256_storeu_ps( c + Size( 5 ) * ldc, c50 );
+			_mm256_storeu_ps( c + Size( 5 ) * ldc + Size( 8 ), c51 );
+		}
+
+		CPU_TARGET_AVX void _KernelAVXDouble::compute( const Size kc, const double * aPanel, const double * bPanel, double * c, const Size ldc, const bool bLoad ) {
+			__m256d c00, c01;
+			__m256d c10, c11;
+			__m256d c20, c21;
+			__m256d c30, c31;
+			__m256d c40, c41;
+			__m256d c50, c51;
+			if ( bLoad ) {
+				c00 = _mm256_loadu_pd( c );
+				c01 = _mm256_loadu_pd( c + Size( 4 ) );
+				c10 = _mm256_loadu_pd( c + ldc );
+				c11 = _mm256_loadu_pd( c + ldc + Size( 4 ) );
+				c20 = _mm256_loadu_pd( c + Size( 2 ) * ldc );
+				c21 = _mm256_loadu_pd( c + Size( 2 ) * ldc + Size( 4 ) );
+				c30 = _mm256_loadu_pd( c + Size( 3 ) * ldc );
+				c31 = _mm256_loadu_pd( c + Size( 3 ) * ldc + Size( 4 ) );
+				c40 = _mm256_loadu_pd( c + Size( 4 ) * ldc );
+				c41 = _mm256_loadu_pd( c + Size( 4 ) * ldc + Size( 4 ) );
+				c50 = _mm256_loadu_pd( c + Size( 5 ) * ldc );
+				c51 = _mm256_loadu_pd( c + Size( 5 ) * ldc + Size( 4 ) );
+			} else {
+				c00 = _mm256_setzero_pd();
+				c01 = _mm256_setzero_pd();
+				c10 = _mm256_setzero_pd();
+				c11 = _mm256_setzero_pd();
+				c20 = _mm256_setzero_pd();
+				c21 = _mm256_setzero_pd();
+				c30 = _mm256_setzero_pd();
+				c31 = _mm256_setzero_pd();
+				c40 = _mm256_setzero_pd();
+				c41 = _mm256_setzero_pd();
+				c50 = _mm256_setzero_pd();
+				c51 = _mm256_setzero_pd();
+			}
+
+			for ( Size p( 0 ); p < kc; p++ ) {
+				const __m256d b0( _mm256_loadu_pd( bPanel ) );
+				const __m256d b1( _mm256_loadu_pd( bPanel + Size( 4 ) ) );
+				const __m256d a0( _mm256_broadcast_sd( aPanel ) );
+				const __m256d a1( _mm256_broadcast_sd( aPanel + Size( 1 ) ) );
+				const __m256d a2( _mm256_broadcast_sd( aPanel + Size( 2 ) ) );
+				const __m256d a3( _mm256_broadcast_sd( aPanel + Size( 3 ) ) );
+				const __m256d a4( _mm256_broadcast_sd( aPanel + Size( 4 ) ) );
+				const __m256d a5( _mm256_broadcast_sd( aPanel + Size( 5 ) ) );
+				c00 = _mm256_add_pd( c00, _mm256_mul_pd( a0, b0 ) );
+				c01 = _mm256_add_pd( c01, _mm256_mul_pd( a0, b1 ) );
+				c10 = _mm256_add_pd( c10, _mm256_mul_pd( a1, b0 ) );
+				c11 = _mm256_add_pd( c11, _mm256_mul_pd( a1, b1 ) );
+				c20 = _mm256_add_pd( c20, _mm256_mul_pd( a2, b0 ) );
+				c21 = _mm256_add_pd( c21, _mm256_mul_pd( a2, b1 ) );
+				c30 = _mm256_add_pd( c30, _mm256_mul_pd( a3, b0 ) );
+				c31 = _mm256_add_pd( c31, _mm256_mul_pd( a3, b1 ) );
+				c40 = _mm256_add_pd( c40, _mm256_mul_pd( a4, b0 ) );
+				c41 = _mm256_add_pd( c41, _mm256_mul_pd( a4, b1 ) );
+				c50 = _mm256_add_pd( c50, _mm256_mul_pd( a5, b0 ) );
+				c51 = _mm256_add_pd( c51, _mm256_mul_pd( a5, b1 ) );
+				aPanel += Size( 6 );
+				bPanel += Size( 8 );
+			}
+
+			_mm256_storeu_pd( c, c00 );
+			_mm256_storeu_pd( c + Size( 4 ), c01 );
+			_mm256_storeu_pd( c + ldc, c10 );
+			_mm256_storeu_pd( c + ldc + Size( 4 ), c11 );
+			_mm256_storeu_pd( c + Size( 2 ) * ldc, c20 );
+			_mm256_storeu_pd( c + Size( 2 ) * ldc + Size( 4 ), c21 );
+			_mm256_storeu_pd( c + Size( 3 ) * ldc, c30 );
+			_mm256_storeu_pd( c + Size( 3 ) * ldc + Size( 4 ), c31 );
+			_mm256_storeu_pd( c + Size( 4 ) * ldc, c40 );
+			_mm256_storeu_pd( c + Size( 4 ) * ldc + Size( 4 ), c41 );
+			_mm256_storeu_pd( c + Size( 5 ) * ldc, c50 );
+			_mm256_storeu_pd( c + Size( 5 ) * ldc + Size( 4 ), c51 );
+		}
+#endif
+
+	}
+}
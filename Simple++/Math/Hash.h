@@ -0,0 +1,65 @@
+///@file		Math/Hash.h.
+///@brief		Declares the hashing functions used by the hashed containers.
+#pragma once
+
+#include "../Utility.h"
+#include "../String.h"
+#include "../UTF8String.h"
+#include "../OS/Path.h"
+
+template<typename S>
+class InternedStringT;
+
+namespace Math {
+
+	namespace Hash {
+
+		///@brief Type of a computed hash.
+		typedef unsigned long long int Value;
+
+		///@brief Finalize a 64 bits integer to spread every input bit over the whole result (MurmurHash3 fmix64).
+		///@param x Value to mix.
+		///@return Mixed value.
+		inline static Value mix( Value x );
+
+		///@brief Hash a raw buffer of bytes (FNV-1a followed by a mix to fix the weak low bits).
+		///@param data Pointer to the first byte.
+		///@param size Number of bytes to hash.
+		///@return Hash of the buffer.
+		inline static Value hashBytes( const void * data, Size size );
+
+		///@brief Used to hash an element of type T.
+		///@param x Element to be hashed.
+		///@return Hash value of the element.
+		inline static Value hash( const bool & x );
+		inline static Value hash( const char & x );
+		inline static Value hash( const unsigned char & x );
+		inline static Value hash( const wchar_t & x );
+		inline static Value hash( const short & x );
+		inline static Value hash( const unsigned short & x );
+		inline static Value hash( const int & x );
+		inline static Value hash( const unsigned int & x );
+		inline static Value hash( const long int & x );
+		inline static Value hash( const unsigned long int & x );
+		inline static Value hash( const long long int & x );
+		inline static Value hash( const unsigned long long int & x );
+		template<typename C>
+		inline static Value hash( const BasicString<C> & x );
+		template<typename C>
+		inline static Value hash( const UTF8StringT<C> & x );
+		template<typename S>
+		inline static Value hash( const OS::PathT<S> & x );
+		template<typename S>
+		inline static Value hash( const InternedStringT<S> & x );
+		template<typename C>
+		inline static Value hash( C * const & x );
+
+		///@brief Class Template for doing Hash, the default hashing functor of the hashed containers.
+		class Template {
+		public:
+			template<typename T> inline Value operator() ( const T & x ) const;
+		};
+	}
+}
+
+#include "Hash.hpp"
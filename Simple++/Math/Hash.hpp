@@ -0,0 +1,105 @@
+namespace Math {
+
+	namespace Hash {
+
+		Value mix( Value x ) {
+			x ^= x >> Value( 33 );
+			x *= Value( 0xff51afd7ed558ccdULL );
+			x ^= x >> Value( 33 );
+			x *= Value( 0xc4ceb9fe1a85ec53ULL );
+			x ^= x >> Value( 33 );
+			return x;
+		}
+
+		Value hashBytes( const void * data, Size size ) {
+			const unsigned char * it( reinterpret_cast< const unsigned char * >( data ) );
+			const unsigned char * endIt( it + size );
+			Value h( Value( 0xcbf29ce484222325ULL ) );
+			for ( ; it < endIt; it++ ) {
+				h ^= Value( *it );
+				h *= Value( 0x100000001b3ULL );
+			}
+			return mix( h ^ Value( size ) );
+		}
+
+		Value hash( const bool & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const char & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const unsigned char & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const wchar_t & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const short & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const unsigned short & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const int & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const unsigned int & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const long int & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const unsigned long int & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const long long int & x ) {
+			return mix( Value( x ) );
+		}
+
+		Value hash( const unsigned long long int & x ) {
+			return mix( Value( x ) );
+		}
+
+		template<typename C>
+		Value hash( const BasicString<C> & x ) {
+			return hashBytes( x.getData(), x.getSize() * sizeof( C ) );
+		}
+
+		template<typename C>
+		Value hash( const UTF8StringT<C> & x ) {
+			return hashBytes( x.getData(), x.getSize() * sizeof( C ) );
+		}
+
+		template<typename S>
+		Value hash( const OS::PathT<S> & x ) {
+			return hash( static_cast< const S & >( x ) );
+		}
+
+		template<typename S>
+		Value hash( const InternedStringT<S> & x ) {
+			return x.getHash();
+		}
+
+		template<typename C>
+		Value hash( C * const & x ) {
+			return mix( Value( reinterpret_cast< Size >( x ) ) );
+		}
+
+		template<typename T>
+		inline Value Template::operator() ( const T & x ) const {
+			return hash( x );
+		}
+
+	}
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Thread.h"
+#include "../../ThreadPool.h"
 #include "../../Mutex.h"
 #include "../../Time/Time.h"
 #include "../../IO/BasicIO.h"
@@ -17,7 +18,7 @@ namespace Math {
 
 	namespace ML {
 
-		template<typename T = double, typename M = Model::BasicModel, typename OptimizerFunc = Optimizer::Adam<T>, Size NbThreads = Size(1)>
+		template<typename T = double, typename M = Model::BasicModel, typename OptimizerFunc = Optimizer::Adam<T>>
 		class DeepNeuralNetwork : public IO::BasicIO {
 		public:
 			class GetPercent {
@@ -90,9 +91,9 @@ namespace Math {
 			bool loadFromFile(int verbose = 1);
 
 			template<Size I>
-			const NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>* getLayer() const;
+			const NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>* getLayer() const;
 			template<Size I>
-			NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>* getLayer();
+			NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>* getLayer();
 
 			void computeForwardPropagation();
 			void computeForwardPropagation(const Math::Interval<Size>& dataIInterval);
@@ -111,9 +112,15 @@ namespace Math {
 			void setLearningRateFactor(const T& learningRateFactor);
 			const T& getLearningRateFactor() const;
 
-			void copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork);
-			void copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork);
-			void copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork);
+			///@brief Set the number of threads used by the forward/backward propagations and the model updates (The calling thread included, 1 to stay single threaded).
+			///			Default to 1, ThreadPool::getDefaultNbThreads() to use every hardware thread.
+			void setNbThreads(const Size nbThreads);
+			///@brief Get the number of threads used by the forward/backward propagations and the model updates.
+			Size getNbThreads() const;
+
+			void copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork);
+			void copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork);
+			void copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork);
 			template<Size I>
 			void setParamMat(const Mat<T>& paramMat);
 			template<Size I>
@@ -134,7 +141,7 @@ namespace Math {
 			void optimizeCluster(const Math::Interval<Size>& trainInterval, const Size nbIterations, const Size nbSearchThreads = Size(16), const Time::Duration<Time::MilliSecond>& saveDuration = Time::Duration<Time::MilliSecond>(30000), const Math::Interval<Size>& testInterval = Math::Interval<Size>(Size(0), Size(10000)), int verbose = 2);
 
 			void updateModel(const T& learningRateFactor = T(1.0));
-			void updateModel(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>*>& deepNeuralNetworkVector, const T& learningRateFactor = T(1.0));
+			void updateModel(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc>*>& deepNeuralNetworkVector, const T& learningRateFactor = T(1.0));
 
 			T computeCostLogF(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTableVector) const;
 			T computeCostLog(const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTableVector) const;
@@ -215,20 +222,20 @@ namespace Math {
 
 			///@brief Set the average for each layer of every paramMat.
 			template<Size I = Size(0)>
-			void _setParamMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>*>& deepNeuralNetworkVector);
+			void _setParamMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc>*>& deepNeuralNetworkVector);
 
 			///@brief Set the average for each layer of every gradMat.
 			template<Size I = Size(0)>
-			void _setGradMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>*>& deepNeuralNetworkVector);
+			void _setGradMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc>*>& deepNeuralNetworkVector);
 
 			template<Size I = Size(0)>
-			void _copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork);
+			void _copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork);
 
 			template<Size I = Size(0)>
-			void _copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork);
+			void _copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork);
 
 			template<Size I = Size(0)>
-			void _copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork);
+			void _copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork);
 
 			template<Size I = Size(0)>
 			constexpr Size _getNbParams() const;
@@ -269,14 +276,18 @@ namespace Math {
 
 			Mutex optimizeMutex;
 
+			// Persistent workers shared by every layer, single threaded until setNbThreads() is called.
+			ThreadPool threadPool;
+
 			OS::Path filePath;
 		};
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::DeepNeuralNetwork(const OptimizerFunc& optimizerFunc, const OS::Path& filePath) :
+		template<typename T, typename M, typename OptimizerFunc>
+		inline DeepNeuralNetwork<T, M, OptimizerFunc>::DeepNeuralNetwork(const OptimizerFunc& optimizerFunc, const OS::Path& filePath) :
 			bNeedForwardPropagation(true),
 			epochNum(0),
 			learningRateFactor(1.0),
+			threadPool(Size(1)),
 			filePath(filePath)
 		{
 			static_assert( Utility::isBase<Model::BasicModel, M>::value, "Model type unknown." );
@@ -299,13 +310,13 @@ namespace Math {
 
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::~DeepNeuralNetwork() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline DeepNeuralNetwork<T, M, OptimizerFunc>::~DeepNeuralNetwork() {
 			_destructNeuralLayer<Size(0)>();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::addData(const StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable, const StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::addData(const StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable, const StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) {
 			this->optimizeMutex.lock();
 			{
 				this->featureVector.push(featureTable);
@@ -318,8 +329,8 @@ namespace Math {
 			this->optimizeMutex.unlock();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::addData(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::addData(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) {
 			ASSERT_SPP(featureTableVector.getSize() == outTableVector.getSize());
 			this->optimizeMutex.lock();
 			{
@@ -337,8 +348,8 @@ namespace Math {
 			this->optimizeMutex.unlock();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::setData(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::setData(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) {
 			ASSERT_SPP(featureTableVector.getSize() == outTableVector.getSize());
 			this->optimizeMutex.lock();
 			{
@@ -350,8 +361,8 @@ namespace Math {
 			this->optimizeMutex.unlock();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::checkNbDataNbParamsRatio(const Math::Interval<Size>& dataIInterval, int verbose) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::checkNbDataNbParamsRatio(const Math::Interval<Size>& dataIInterval, int verbose) const {
 			const T nbDataNbParamsRatio(T(dataIInterval.getSize()) / T(getNbParams()));
 
 			if ( nbDataNbParamsRatio < T(1.0) ) {
@@ -363,20 +374,20 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::addData(const Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>& data) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::addData(const Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>& data) {
 			addData(data.getFeatures(), data.getOuts());
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::addData(const Vector<Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>>& dataVector) {
-			const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>> featureVector(DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::createFeatureVector(dataVector));
-			const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> outVector(DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::createOutVector(dataVector));
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::addData(const Vector<Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>>& dataVector) {
+			const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>> featureVector(DeepNeuralNetwork<T, M, OptimizerFunc>::createFeatureVector(dataVector));
+			const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> outVector(DeepNeuralNetwork<T, M, OptimizerFunc>::createOutVector(dataVector));
 			return addData(featureVector, outVector);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::clearData() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::clearData() {
 			this->optimizeMutex.lock();
 			{
 				this->featureVector.clear();
@@ -388,23 +399,23 @@ namespace Math {
 			this->optimizeMutex.unlock();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline const StaticTable<T, M::m[ 0 ][ 0 ]>& DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getFeatures(const Size dataI) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline const StaticTable<T, M::m[ 0 ][ 0 ]>& DeepNeuralNetwork<T, M, OptimizerFunc>::getFeatures(const Size dataI) const {
 			return this->featureVector.getValueI(dataI);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline const StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getOuts(const Size dataI) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline const StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& DeepNeuralNetwork<T, M, OptimizerFunc>::getOuts(const Size dataI) const {
 			return this->expectedYVector.getValueI(dataI);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeFeature() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeFeature() {
 			normalizeFeature(Math::Interval<Size>(Size(0), getNbData()));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeFeature(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeFeature(const Math::Interval<Size>& dataIInterval) {
 
 			ASSERT_SPP(this->featureVector.getSize());
 
@@ -485,13 +496,13 @@ namespace Math {
 			this->bNeedForwardPropagation = true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeOut() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeOut() {
 			normalizeOut(Math::Interval<Size>(Size(0), getNbData()));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeOut(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeOut(const Math::Interval<Size>& dataIInterval) {
 
 			ASSERT_SPP(this->expectedYVector.getSize());
 
@@ -530,8 +541,8 @@ namespace Math {
 			this->bNeedForwardPropagation = true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeFeature(StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeFeature(StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable) const {
 			for ( Size featureI(0); featureI < featureTable.getSize(); featureI++ ) {
 				T& v(featureTable[ featureI ]);
 
@@ -543,15 +554,15 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeFeature(Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeFeature(Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector) const {
 			for ( Size dataI(0); dataI < featureTableVector.getSize(); dataI++ ) {
 				normalizeFeature(featureTableVector.getValueI(dataI));
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::unnormalizeFeature(StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::unnormalizeFeature(StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable) const {
 			for ( Size featureI(0); featureI < featureTable.getSize(); featureI++ ) {
 				T& v(featureTable[ featureI ]);
 
@@ -559,15 +570,15 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::unnormalizeFeature(Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::unnormalizeFeature(Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector) const {
 			for ( Size dataI(0); dataI < featureTableVector.getSize(); dataI++ ) {
 				unnormalizeFeature(featureTableVector.getValueI(dataI));
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeOut(StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeOut(StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) const {
 			for ( Size outI(0); outI < outTable.getSize(); outI++ ) {
 				T& v(outTable[ outI ]);
 
@@ -575,15 +586,15 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeOut(Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeOut(Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
 			for ( Size dataI(0); dataI < outTableVector.getSize(); dataI++ ) {
 				normalizeOut(outTableVector.getValueI(dataI));
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::unnormalizeOut(StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::unnormalizeOut(StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) const {
 			for ( Size outI(0); outI < outTable.getSize(); outI++ ) {
 				T& v(outTable[ outI ]);
 
@@ -591,15 +602,15 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::unnormalizeOut(Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::unnormalizeOut(Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
 			for ( Size dataI(0); dataI < outTableVector.getSize(); dataI++ ) {
 				unnormalizeOut(outTableVector.getValueI(dataI));
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline Vector<StaticTable<T, M::m[ 0 ][ 0 ]>> DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::createFeatureVector(const Vector<Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>>& dataVector) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline Vector<StaticTable<T, M::m[ 0 ][ 0 ]>> DeepNeuralNetwork<T, M, OptimizerFunc>::createFeatureVector(const Vector<Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>>& dataVector) {
 			Vector<StaticTable<T, M::m[ 0 ][ 0 ]>> featureVector;
 			featureVector.resize(dataVector.getSize());
 
@@ -611,8 +622,8 @@ namespace Math {
 			return featureVector;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::createOutVector(const Vector<Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>>& dataVector) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> DeepNeuralNetwork<T, M, OptimizerFunc>::createOutVector(const Vector<Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>>& dataVector) {
 			Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> outVector;
 			outVector.resize(dataVector.getSize());
 
@@ -624,9 +635,9 @@ namespace Math {
 			return outVector;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<typename S>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::exportDataSetJSON(const OS::Path& filePath, int verbose) const {
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::exportDataSetJSON(const OS::Path& filePath, int verbose) const {
 			JSON::NodeArrayT<S>* rootNode(new JSON::NodeArrayT<S>());
 
 			JSON::DocumentT<S> document(rootNode);
@@ -651,28 +662,28 @@ namespace Math {
 			return bSuccess;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline const Size DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getNbData() const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline const Size DeepNeuralNetwork<T, M, OptimizerFunc>::getNbData() const {
 			return this->featureVector.getSize();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline constexpr Size DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getNbParams() const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline constexpr Size DeepNeuralNetwork<T, M, OptimizerFunc>::getNbParams() const {
 			return _getNbParams<Size(0)>();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline const OS::Path& DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getFilePath() const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline const OS::Path& DeepNeuralNetwork<T, M, OptimizerFunc>::getFilePath() const {
 			return this->filePath;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::setFilePath(const OS::Path& filePath) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::setFilePath(const OS::Path& filePath) {
 			this->filePath = filePath;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::saveToFile(const OS::Path& filePath, int verbose) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::saveToFile(const OS::Path& filePath, int verbose) const {
 			if ( !IO::write(filePath, this) ) {
 				if ( verbose > -1 ) { Log::displayWarning(String::format("Unable to save the DeepNeuralNetwork to the file \"%\".", filePath)); }
 				return false;
@@ -681,8 +692,8 @@ namespace Math {
 			return true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::loadFromFile(const OS::Path& filePath, int verbose) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::loadFromFile(const OS::Path& filePath, int verbose) {
 			if ( !IO::read( filePath, this, verbose -1 ) ) {
 				if ( verbose > -1 ) { Log::displayWarning(String::format("Unable to load the DeepNeuralNetwork from the file \"%\".", filePath)); }
 				return false;
@@ -691,8 +702,8 @@ namespace Math {
 			return true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::saveToFile(int verbose) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::saveToFile(int verbose) const {
 			if ( this->filePath.getSize() ) {
 				if ( !saveToFile(this->filePath, verbose) ) {
 					return false;
@@ -701,8 +712,8 @@ namespace Math {
 			return true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::loadFromFile(int verbose) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::loadFromFile(int verbose) {
 			if ( this->filePath.getSize() ) {
 				if ( !loadFromFile(this->filePath, verbose) ) {
 					return false;
@@ -711,39 +722,39 @@ namespace Math {
 			return true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeForwardPropagation() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeForwardPropagation() {
 			if ( this->bNeedForwardPropagation ) {
 				computeForwardPropagation(Math::Interval<Size>(Size(0), getNbData()));
 				this->bNeedForwardPropagation = false;
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeForwardPropagation(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeForwardPropagation(const Math::Interval<Size>& dataIInterval) {
 			_computeForwardPropagation<Size(0)>(dataIInterval);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeForwardPropagationS(const Size dataIBegin) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeForwardPropagationS(const Size dataIBegin) {
 			_computeForwardPropagationS<Size(0)>(dataIBegin);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeForwardPropagation(const Size dataI) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeForwardPropagation(const Size dataI) {
 			_computeForwardPropagation<Size(0)>(dataI);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeForwardPropagation(const StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable, StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeForwardPropagation(const StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable, StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable) const {
 			StaticTable<T, M::m[ 0 ][ 0 ]> featureTableNormalized(featureTable);
 			normalizeFeature(featureTableNormalized);
 			_computeForwardPropagation<Size(0)>(featureTableNormalized, outTable);
 			unnormalizeOut(outTable);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeForwardPropagation(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeForwardPropagation(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
 			outTableVector.resize(featureTableVector.getSize());
 
 			Vector<StaticTable<T, M::m[ 0 ][ 0 ]>> featureTableVectorNormalized(featureTableVector);
@@ -752,100 +763,110 @@ namespace Math {
 			unnormalizeOut(outTableVector);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeForwardPropagation(Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>& data) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeForwardPropagation(Data<T, M::m[ 0 ][ 0 ], M::m[ M::nbLayers - Size(1) ][ 1 ]>& data) const {
 			const StaticTable<T, M::m[ 0 ][ 0 ]>& featureTable(data.getFeatures());
 			StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTable(data.getOuts());
 			computeForwardPropagation(featureTable, outTable);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeBackPropagation(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeBackPropagation(const Math::Interval<Size>& dataIInterval) {
 			_computeBackPropagation<M::nbLayers - Size(1)>(dataIInterval);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeBackPropagationS(const Size dataIBegin) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeBackPropagationS(const Size dataIBegin) {
 			_computeBackPropagationS<M::nbLayers - Size(1)>(dataIBegin);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline const Size DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getEpoch() const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline const Size DeepNeuralNetwork<T, M, OptimizerFunc>::getEpoch() const {
 			return this->epochNum;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::setEpoch(const Size epochNum) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::setEpoch(const Size epochNum) {
 			this->epochNum = epochNum;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::setLearningRateFactor(const T& learningRateFactor) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::setLearningRateFactor(const T& learningRateFactor) {
 			this->learningRateFactor = learningRateFactor;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline const T& DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getLearningRateFactor() const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline const T& DeepNeuralNetwork<T, M, OptimizerFunc>::getLearningRateFactor() const {
 			return this->learningRateFactor;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::setNbThreads(const Size nbThreads) {
+			this->threadPool.setNbThreads(nbThreads);
+		}
+
+		template<typename T, typename M, typename OptimizerFunc>
+		inline Size DeepNeuralNetwork<T, M, OptimizerFunc>::getNbThreads() const {
+			return this->threadPool.getNbThreads();
+		}
+
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork) {
 			_copyParamMat<Size(0)>(deepNeuralNetwork);
 			this->bNeedForwardPropagation = true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork) {
 			_copyGradMat<Size(0)>(deepNeuralNetwork);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork) {
 			_copyOptimizerFunc<Size(0)>(deepNeuralNetwork);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::resetParams() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::resetParams() {
 			_resetParams<Size(0)>();
 			setLearningRateFactor(T(1.0));
 			setEpoch(Size(0));
 			this->bNeedForwardPropagation = true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::resetOptimizerFunc() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::resetOptimizerFunc() {
 			_resetOptimizerFunc<Size(0)>();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::resetAll() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::resetAll() {
 			resetParams();
 			clearData();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::setParamMat(const Mat<T>& paramMat) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::setParamMat(const Mat<T>& paramMat) {
 			getLayer<I>()->setParamMat(paramMat);
 			this->bNeedForwardPropagation = true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::setGradMat(const Mat<T>& gradMat) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::setGradMat(const Mat<T>& gradMat) {
 			getLayer<I>()->setGradMat(gradMat);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::optimize(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::optimize(const Math::Interval<Size>& dataIInterval) {
 			computeGrad(dataIInterval);
 			updateModel(getLearningRateFactor());
 			setEpoch(getEpoch() + Size(1));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::optimizeStochastic(const Vector<Math::Interval<Size>>& trainIntervalVector) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::optimizeStochastic(const Vector<Math::Interval<Size>>& trainIntervalVector) {
 			for ( Size i(0); i < trainIntervalVector.getSize(); i++ ) {
 				const Math::Interval<Size>& dataIInterval(trainIntervalVector.getValueI(i));
 				ASSERT_SPP(dataIInterval.getSize() == M::dataChunkSize);
@@ -855,8 +876,8 @@ namespace Math {
 			setEpoch(getEpoch() + Size(1));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::optimizeStochastic(const Math::Interval<Size>& trainInterval, const Size nbIterations, const Time::Duration<Time::MilliSecond>& saveDuration, const Math::Interval<Size>& testInterval, int verbose) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::optimizeStochastic(const Math::Interval<Size>& trainInterval, const Size nbIterations, const Time::Duration<Time::MilliSecond>& saveDuration, const Math::Interval<Size>& testInterval, int verbose) {
 
 			const GetPercent getPercent(nbIterations);
 
@@ -879,7 +900,7 @@ namespace Math {
 			if ( verbose > 0 ) { Log::displayLog(String::format("Initial MSE of % and coeficient of determination of %%.", lastMSETest, lastCOD)); }
 
 			// Compute the interval sizes.
-			Vector<Math::Interval<Size>> trainIntervalVector(DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::createDataIntervalVector(trainInterval));
+			Vector<Math::Interval<Size>> trainIntervalVector(DeepNeuralNetwork<T, M, OptimizerFunc>::createDataIntervalVector(trainInterval));
 
 			Time::TimePointMS timePointBegin(Time::getTime<Time::MilliSecond>());
 			Time::TimePointMS timePointLast(timePointBegin.getValue());
@@ -940,17 +961,20 @@ namespace Math {
 			if ( verbose > 0 ) { Log::endStepSuccess(String::format("Finished with a cost of % and a coeficient of determination of %%.", computeMeanSquaredError(testIntervalSafe), computeCoefficientOfDetermination(testIntervalSafe) * T(100))); }
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::optimizeCluster(const Math::Interval<Size>& trainInterval, const Size nbIterations, const Size nbSearchThreads, const Time::Duration<Time::MilliSecond>& saveDuration, const Math::Interval<Size>& testInterval, int verbose) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::optimizeCluster(const Math::Interval<Size>& trainInterval, const Size nbIterations, const Size nbSearchThreads, const Time::Duration<Time::MilliSecond>& saveDuration, const Math::Interval<Size>& testInterval, int verbose) {
 
-			class SearchThread : public DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>, public Thread {
+			class SearchThread : public DeepNeuralNetwork<T, M, OptimizerFunc>, public Thread {
 			public:
 				SearchThread(const OptimizerFunc& optimizerFunc) :
-					DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>(optimizerFunc)
-				{}
+					DeepNeuralNetwork<T, M, OptimizerFunc>(optimizerFunc)
+				{
+					// The search threads already run in parallel.
+					setNbThreads(Size(1));
+				}
 
 				void init() {
-					this->trainIntervalVector = DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::createDataIntervalVector(Math::Interval<Size>(Size(0), getNbData()));
+					this->trainIntervalVector = DeepNeuralNetwork<T, M, OptimizerFunc>::createDataIntervalVector(Math::Interval<Size>(Size(0), getNbData()));
 				}
 
 				void run() override {
@@ -971,7 +995,7 @@ namespace Math {
 				Size intervalI;
 			};
 
-			// using SearchThread = SearchThread<T, M, OptimizerFunc, NbThreads>;
+			// using SearchThread = SearchThread<T, M, OptimizerFunc>;
 			const GetPercent getPercent(nbIterations);
 
 			if ( verbose > 0 ) { Log::startStep(String::format("Starting clustered gradient descent with % iterations over % data...", nbIterations, trainInterval.toString())); }
@@ -1131,20 +1155,20 @@ namespace Math {
 			if ( verbose > 0 ) { Log::endStepSuccess(String::format("Finished with a cost of % and a coeficient of determination of %%.", computeMeanSquaredError(testIntervalSafe), computeCoefficientOfDetermination(testIntervalSafe) * T(100))); }
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeGrad(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeGrad(const Math::Interval<Size>& dataIInterval) {
 			computeForwardPropagation(dataIInterval);
 			computeBackPropagation(dataIInterval);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeGradS(const Size dataIBegin) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::computeGradS(const Size dataIBegin) {
 			computeForwardPropagationS(dataIBegin);
 			computeBackPropagationS(dataIBegin);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline Vector<Math::Interval<Size>> DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::createDataIntervalVector(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline Vector<Math::Interval<Size>> DeepNeuralNetwork<T, M, OptimizerFunc>::createDataIntervalVector(const Math::Interval<Size>& dataIInterval) {
 			Vector<Math::Interval<Size>> dataIntervalVector;
 
 			constexpr Size intervalSize(M::dataChunkSize);
@@ -1157,93 +1181,93 @@ namespace Math {
 			return dataIntervalVector;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::updateModel(const T& learningRateFactor) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::updateModel(const T& learningRateFactor) {
 			_updateModel<Size(0)>(learningRateFactor);
 			this->bNeedForwardPropagation = true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::updateModel(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>*>& deepNeuralNetworkVector, const T& learningRateFactor) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::updateModel(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc>*>& deepNeuralNetworkVector, const T& learningRateFactor) {
 			for ( Size i(0); i < deepNeuralNetworkVector.getSize(); i++ ) {
-				DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>* deepNeuralNetwork(deepNeuralNetworkVector.getValueI(i));
+				DeepNeuralNetwork<T, M, OptimizerFunc>* deepNeuralNetwork(deepNeuralNetworkVector.getValueI(i));
 
 				copyGradMat(*deepNeuralNetwork);
 				updateModel(learningRateFactor);
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCostLogF(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCostLogF(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
 			Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> outTable(featureTable.getSize());
 			computeForwardPropagation(featureTable, outTable);
 			return getLayer<M::nbLayers - Size(1)>()->computeCostLog(Math::Interval<Size>(Size(0), featureTable.getSize()), outTable, expectedOutTable);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCostLog(const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCostLog(const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
 			return getLayer<M::nbLayers - Size(1)>()->computeCostLog(Math::Interval<Size>(Size(0), outTable.getSize()), outTable, expectedOutTable);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCostLog(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCostLog(const Math::Interval<Size>& dataIInterval) {
 			computeForwardPropagation(dataIInterval);
 			return getLayer<M::nbLayers - Size(1)>()->computeCostLog(dataIInterval, getLayer<M::nbLayers - Size(1)>()->getOutVector(), this->expectedYVector);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCostLog() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCostLog() {
 			return computeCostLog(Interval<Size>(Size(0), getNbData()));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeMeanSquaredErrorF(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeMeanSquaredErrorF(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
 			Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> outTable(featureTable.getSize());
 			computeForwardPropagation(featureTable, outTable);
 			return getLayer<M::nbLayers - Size(1)>()->computeMeanSquaredError(Math::Interval<Size>(Size(0), featureTable.getSize()), outTable, expectedOutTable);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeMeanSquaredError(const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeMeanSquaredError(const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
 			return getLayer<M::nbLayers - Size(1)>()->computeMeanSquaredError(Math::Interval<Size>(Size(0), outTable.getSize()), outTable, expectedOutTable);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeMeanSquaredError(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeMeanSquaredError(const Math::Interval<Size>& dataIInterval) {
 			computeForwardPropagation(dataIInterval);
 			return getLayer<M::nbLayers - Size(1)>()->computeMeanSquaredError(dataIInterval, getLayer<M::nbLayers - Size(1)>()->getOutVector(), this->expectedYVector);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeMeanSquaredError() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeMeanSquaredError() {
 			return computeMeanSquaredError(Interval<Size>(Size(0), getNbData()));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCoefficientOfDeterminationF(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCoefficientOfDeterminationF(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTableVector) const {
 			Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> outTableVector(featureTableVector.getSize());
 			computeForwardPropagation(featureTableVector, outTableVector);
 			return getLayer<M::nbLayers - Size(1)>()->computeCoefficientOfDetermination(Math::Interval<Size>(Size(0), featureTableVector.getSize()), outTableVector, expectedOutTableVector);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCoefficientOfDetermination(const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCoefficientOfDetermination(const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTable, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& expectedOutTable) const {
 			return getLayer<M::nbLayers - Size(1)>()->computeCoefficientOfDetermination(Math::Interval<Size>(Size(0), outTable.getSize()), outTable, expectedOutTable);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCoefficientOfDetermination(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCoefficientOfDetermination(const Math::Interval<Size>& dataIInterval) {
 			computeForwardPropagation(dataIInterval);
 			return getLayer<M::nbLayers - Size(1)>()->computeCoefficientOfDetermination(dataIInterval, getLayer<M::nbLayers - Size(1)>()->getOutVector(), this->expectedYVector);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeCoefficientOfDetermination() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::computeCoefficientOfDetermination() {
 			return computeCoefficientOfDetermination(Interval<Size>(Size(0), getNbData()));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeFeatureImportance(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc>::computeFeatureImportance(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector) const {
 			StaticTable<T, M::m[ 0 ][ 0 ]> featureImportanceTable;
 
 			Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>> outTableVector(featureTableVector.getSize());
@@ -1252,8 +1276,8 @@ namespace Math {
 			return computeFeatureImportance(featureTableVector, outTableVector);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeFeatureImportance(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc>::computeFeatureImportance(const Vector<StaticTable<T, M::m[ 0 ][ 0 ]>>& featureTableVector, const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector) const {
 			StaticTable<T, M::m[ 0 ][ 0 ]> featureImportanceTable;
 
 			const T baseMeanSquaredError(computeMeanSquaredErrorF(featureTableVector, outTableVector));
@@ -1291,8 +1315,8 @@ namespace Math {
 			return featureImportanceTable;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeFeatureImportance(const Math::Interval<Size>& dataIInterval) {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc>::computeFeatureImportance(const Math::Interval<Size>& dataIInterval) {
 			computeForwardPropagation(dataIInterval);
 			const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector(getLayer < M::nbLayers - Size(1) >()->getOutVector());
 
@@ -1300,8 +1324,8 @@ namespace Math {
 											Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>(outTableVector.getIterator(dataIInterval.getBegin()), outTableVector.getIterator(dataIInterval.getEnd())));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::computeFeatureImportance() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline StaticTable<T, M::m[ 0 ][ 0 ]> DeepNeuralNetwork<T, M, OptimizerFunc>::computeFeatureImportance() {
 			computeForwardPropagation();
 			const Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVector(getLayer< M::nbLayers - Size(1) >()->getOutVector());
 
@@ -1309,8 +1333,8 @@ namespace Math {
 											Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>(outTableVector));
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::resetNormalizeTable() {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::resetNormalizeTable() {
 			for ( Size featureI(0); featureI < this->normalizeFeatureTable.getSize(); featureI++ ) {
 				Math::Interval<T>& i(this->normalizeFeatureTable.getValueI(featureI));
 				i.x = T(0.0);
@@ -1324,43 +1348,43 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeFeature(const T& x, const Math::Interval<T>& v) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeFeature(const T& x, const Math::Interval<T>& v) const {
 			// return ( x - v.x ) / v.y;
 			return v.scale(x);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::unnormalizeFeature(const T& x, const Math::Interval<T>& v) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::unnormalizeFeature(const T& x, const Math::Interval<T>& v) const {
 			// return x * v.y + v.x;
 			return v.unscale(x);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::normalizeOut(const T& x, const Math::Interval<T>& v) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::normalizeOut(const T& x, const Math::Interval<T>& v) const {
 			return v.scale(x);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
-		inline T DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::unnormalizeOut(const T& x, const Math::Interval<T>& v) const {
+		template<typename T, typename M, typename OptimizerFunc>
+		inline T DeepNeuralNetwork<T, M, OptimizerFunc>::unnormalizeOut(const T& x, const Math::Interval<T>& v) const {
 			return v.unscale(x);
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline const NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>* DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getLayer() const {
-			return const_cast< DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads> * >( this )->getLayer<I>();
+		inline const NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>* DeepNeuralNetwork<T, M, OptimizerFunc>::getLayer() const {
+			return const_cast< DeepNeuralNetwork<T, M, OptimizerFunc> * >( this )->getLayer<I>();
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>* DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::getLayer() {
-			return reinterpret_cast< NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>* >( this->layerTable[ I ] );
+		inline NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>* DeepNeuralNetwork<T, M, OptimizerFunc>::getLayer() {
+			return reinterpret_cast< NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>* >( this->layerTable[ I ] );
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<typename Stream>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::read( Stream * stream, int verbose ) {
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::read( Stream * stream, int verbose ) {
 			Size nbLayers;
 			if ( !IO::read( stream, &nbLayers, verbose -1 ) ) {
 				return false;
@@ -1410,9 +1434,9 @@ namespace Math {
 			return true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<typename Stream>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::write(Stream* stream) const {
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::write(Stream* stream) const {
 			const Size nbLayers(getNbLayers());
 			if ( !IO::write(stream, &nbLayers) ) {
 				return false;
@@ -1447,9 +1471,9 @@ namespace Math {
 			return true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_computeForwardPropagation(const Size dataI) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_computeForwardPropagation(const Size dataI) {
 			if constexpr ( I < M::nbLayers ) {
 				if constexpr ( I == M::nbLayers - Size(1) ) {
 					getLayer<I>()->computeForwardPropagation<M::ActivationFunc>(dataI, this->activationFunc);
@@ -1461,9 +1485,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_computeForwardPropagation(const Math::Interval<Size>& dataIInterval) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_computeForwardPropagation(const Math::Interval<Size>& dataIInterval) {
 			if constexpr ( I < M::nbLayers ) {
 				if constexpr ( I == M::nbLayers - Size(1) ) {
 					getLayer<I>()->computeForwardPropagation<M::ActivationFunc>(dataIInterval, this->activationFunc);
@@ -1475,9 +1499,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_computeForwardPropagationS(const Size dataIBegin) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_computeForwardPropagationS(const Size dataIBegin) {
 			if constexpr ( I < M::nbLayers ) {
 				if constexpr ( I == M::nbLayers - Size(1) ) {
 					getLayer<I>()->computeForwardPropagationS<M::ActivationFunc, M::dataChunkSize>(dataIBegin, this->activationFunc);
@@ -1489,9 +1513,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_computeForwardPropagation(const StaticTable<T, M::m[ I ][ 0 ]>& featureTable, StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTableFinal) const {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_computeForwardPropagation(const StaticTable<T, M::m[ I ][ 0 ]>& featureTable, StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>& outTableFinal) const {
 			if constexpr ( I < M::nbLayers ) {
 				if constexpr ( I < M::nbLayers - Size(1) ) {
 					StaticTable<T, M::m[ I ][ 1 ]> outTable;
@@ -1503,9 +1527,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_computeForwardPropagation(const Vector<StaticTable<T, M::m[ I ][ 0 ]>>& featureTableVector, Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVectorFinal) const {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_computeForwardPropagation(const Vector<StaticTable<T, M::m[ I ][ 0 ]>>& featureTableVector, Vector<StaticTable<T, M::m[ M::nbLayers - Size(1) ][ 1 ]>>& outTableVectorFinal) const {
 			if constexpr ( I < M::nbLayers ) {
 				if constexpr ( I < M::nbLayers - Size(1) ) {
 					Vector<StaticTable<T, M::m[ I ][ 1 ]>> outTableVector(outTableVectorFinal.getSize());
@@ -1517,11 +1541,11 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_computeBackPropagation(const Math::Interval<Size>& dataIInterval) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_computeBackPropagation(const Math::Interval<Size>& dataIInterval) {
 			if constexpr ( I >= Size(0) ) {
-				NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>* neuralLayer(getLayer<I>());
+				NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>* neuralLayer(getLayer<I>());
 
 				// Compute dZx
 				if constexpr ( I == M::nbLayers - Size(1) ) {
@@ -1537,11 +1561,11 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_computeBackPropagationS(const Size dataIBegin) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_computeBackPropagationS(const Size dataIBegin) {
 			if constexpr ( I >= Size(0) ) {
-				NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>* neuralLayer(getLayer<I>());
+				NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>* neuralLayer(getLayer<I>());
 
 				// Compute dZx
 				if constexpr ( I == M::nbLayers - Size(1) ) {
@@ -1557,9 +1581,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_updateModel(const T& learningRateFactor) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_updateModel(const T& learningRateFactor) {
 			if constexpr ( I < M::nbLayers ) {
 				getLayer<I>()->updateModel(learningRateFactor, this->epochNum);
 
@@ -1567,9 +1591,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_constructNeuralLayer(const OptimizerFunc& optimizerFunc) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_constructNeuralLayer(const OptimizerFunc& optimizerFunc) {
 			if constexpr ( I < M::nbLayers ) {
 				const Vector<StaticTable<T, M::m[ I ][ 0 ]>>* inVector;
 				if constexpr ( I == Size(0) ) {
@@ -1577,14 +1601,14 @@ namespace Math {
 				} else {
 					inVector = &getLayer<I - Size(1)>()->getOutVector();
 				}
-				this->layerTable[ I ] = reinterpret_cast< void* >( new NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc, NbThreads>(inVector, optimizerFunc) );
+				this->layerTable[ I ] = reinterpret_cast< void* >( new NeuralLayerMT<T, M::m[ I ][ 0 ], M::m[ I ][ 1 ], OptimizerFunc>(inVector, optimizerFunc, &this->threadPool) );
 				_constructNeuralLayer<I + Size(1)>(optimizerFunc);
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_destructNeuralLayer() {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_destructNeuralLayer() {
 			if constexpr ( I < M::nbLayers ) {
 				delete getLayer<I>();
 
@@ -1592,9 +1616,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline constexpr bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_checkModel() const {
+		inline constexpr bool DeepNeuralNetwork<T, M, OptimizerFunc>::_checkModel() const {
 			if constexpr ( I < M::nbLayers ) {
 
 				if ( M::m[ I - Size(1) ][ 1 ] != M::m[ I ][ 0 ] ) {
@@ -1608,18 +1632,18 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_setNbData() {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_setNbData() {
 			if constexpr ( I < M::nbLayers ) {
 				getLayer<I>()->setNbData(getNbData());
 				_setNbData<I + Size(1)>();
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_resetParams() {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_resetParams() {
 			if constexpr ( I < M::nbLayers ) {
 				if constexpr ( I == M::nbLayers - Size(1) ) {
 					getLayer<I>()->resetParams<M::ActivationFunc>(this->activationFunc);
@@ -1630,25 +1654,25 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_resetOptimizerFunc() {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_resetOptimizerFunc() {
 			if constexpr ( I < M::nbLayers ) {
 				getLayer<I>()->resetOptimizerFunc();
 				_resetOptimizerFunc<I + Size(1)>();
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_setParamMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>*>& deepNeuralNetworkVector) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_setParamMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc>*>& deepNeuralNetworkVector) {
 			if constexpr ( I < M::nbLayers ) {
 				Mat<T> paramMatSum(M::m[ I ][ 1 ], M::m[ I ][ 0 ] + Size(1));
 
 				paramMatSum.zeros();
 
 				for ( Size i(0); i < deepNeuralNetworkVector.getSize(); i++ ) {
-					const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>* deepNeuralNetwork(deepNeuralNetworkVector.getValueI(i));
+					const DeepNeuralNetwork<T, M, OptimizerFunc>* deepNeuralNetwork(deepNeuralNetworkVector.getValueI(i));
 					paramMatSum += deepNeuralNetwork->getLayer<I>()->getParamMat();
 				}
 
@@ -1660,16 +1684,16 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_setGradMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>*>& deepNeuralNetworkVector) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_setGradMatMean(const Vector<DeepNeuralNetwork<T, M, OptimizerFunc>*>& deepNeuralNetworkVector) {
 			if constexpr ( I < M::nbLayers ) {
 				Mat<T> gradMatSum(M::m[ I ][ 1 ], M::m[ I ][ 0 ] + Size(1));
 
 				gradMatSum.zeros();
 
 				for ( Size i(0); i < deepNeuralNetworkVector.getSize(); i++ ) {
-					const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>* deepNeuralNetwork(deepNeuralNetworkVector.getValueI(i));
+					const DeepNeuralNetwork<T, M, OptimizerFunc>* deepNeuralNetwork(deepNeuralNetworkVector.getValueI(i));
 					gradMatSum += deepNeuralNetwork->getLayer<I>()->getParamMat();
 				}
 
@@ -1681,9 +1705,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_copyParamMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork) {
 			if constexpr ( I < M::nbLayers ) {
 				setParamMat<I>(deepNeuralNetwork.getLayer<I>()->getParamMat());
 				// getLayer<I>()->resetOptimizerFunc();
@@ -1691,27 +1715,27 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_copyGradMat(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork) {
 			if constexpr ( I < M::nbLayers ) {
 				setGradMat<I>(deepNeuralNetwork.getLayer<I>()->getGradMat());
 				_copyGradMat<I + Size(1)>(deepNeuralNetwork);
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline void DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>& deepNeuralNetwork) {
+		inline void DeepNeuralNetwork<T, M, OptimizerFunc>::_copyOptimizerFunc(const DeepNeuralNetwork<T, M, OptimizerFunc>& deepNeuralNetwork) {
 			if constexpr ( I < M::nbLayers ) {
 				getLayer<I>()->setOptimizerFunc(deepNeuralNetwork.getLayer<I>()->getOptimizerFunc());
 				_copyOptimizerFunc<I + Size(1)>(deepNeuralNetwork);
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I>
-		inline constexpr Size DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_getNbParams() const {
+		inline constexpr Size DeepNeuralNetwork<T, M, OptimizerFunc>::_getNbParams() const {
 			if constexpr ( I < M::nbLayers ) {
 				return getLayer<I>()->getNbParams() + _getNbParams<I + Size(1)>();
 			} else {
@@ -1719,9 +1743,9 @@ namespace Math {
 			}
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I, typename Stream>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_write(Stream* stream) const {
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::_write(Stream* stream) const {
 			if constexpr ( I < M::nbLayers ) {
 				if ( !IO::write(stream, getLayer<I>()) ) {
 					return false;
@@ -1732,9 +1756,9 @@ namespace Math {
 			return true;
 		}
 
-		template<typename T, typename M, typename OptimizerFunc, Size NbThreads>
+		template<typename T, typename M, typename OptimizerFunc>
 		template<Size I, typename Stream>
-		inline bool DeepNeuralNetwork<T, M, OptimizerFunc, NbThreads>::_read(Stream* stream) {
+		inline bool DeepNeuralNetwork<T, M, OptimizerFunc>::_read(Stream* stream) {
 			if constexpr ( I < M::nbLayers ) {
 				if ( !IO::read(stream, getLayer<I>()) ) {
 					return false;
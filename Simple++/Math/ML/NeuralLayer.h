@@ -109,6 +109,9 @@ namespace Math {
 			void computeForwardPropagationS( const Size dataIBegin, const ActivationFunc& activationFunc );
 			template<typename ActivationFunc, Size NbData>
 			void computeForwardPropagationS( const StaticTable<StaticTable<T, NbFeatures>, NbData>& featureTableTable, StaticTable<StaticTable<T, NbNeurons>, NbData>& outTableTable, const ActivationFunc& activationFunc ) const;
+			///@brief Compute the forward propagation of the neurons inside neuronIInterval only (Used to split the work between threads).
+			template<typename ActivationFunc, Size NbData>
+			void computeForwardPropagationS( const Size dataIBegin, const Math::Interval<Size>& neuronIInterval, const ActivationFunc& activationFunc );
 
 
 			/************************************************************************/
@@ -130,20 +133,30 @@ namespace Math {
 								 const StaticTable<StaticTable<T, NbFeaturesNext + Size( 1 )>, NbNeuronsNext>& nextParamTable,
 								 StaticTable<StaticTable<T, NbNeurons>, NbData>& deltaTableTable,
 								 const ActivationFunc& activationFunc ) const;
+			///@brief Compute the deltas of the neurons inside neuronIInterval only (Used to split the work between threads).
+			template<Size NbFeaturesNext, Size NbNeuronsNext, typename ActivationFunc, Size NbData>
+			void computeDeltasS( const Size dataIBegin, const Math::Interval<Size>& neuronIInterval, const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>& nextNeuralLayer, const ActivationFunc& activationFunc );
 
 			/************************************************************************/
 			/* ================          Back Propagation          ================ */
 			/************************************************************************/
 
 			void computeBackPropagation( const Math::Interval<Size>& dataIInterval );
+			///@brief Compute the gradients of the neurons inside neuronIInterval only (Used to split the work between threads).
+			void computeBackPropagation( const Math::Interval<Size>& dataIInterval, const Math::Interval<Size>& neuronIInterval );
 			template<Size NbData>
 			void computeBackPropagationS( const Size dataIBegin );
 			template<Size NbData>
 			void computeBackPropagationS( const StaticTable<StaticTable<T, NbFeatures>, NbData>& inTableTable, const StaticTable<StaticTable<T, NbNeurons>, NbData>& deltaTableTable, StaticTable<StaticTable<T, NbFeatures + Size( 1 )>, NbNeurons>& gradTableTable );
+			///@brief Compute the gradients of the neurons inside neuronIInterval only (Used to split the work between threads).
+			template<Size NbData>
+			void computeBackPropagationS( const Size dataIBegin, const Math::Interval<Size>& neuronIInterval );
 
 
 
 			void updateModel( const T& learningRateFactor, const Size epochNum );
+			///@brief Update the params of the neurons inside neuronIInterval only (Used to split the work between threads).
+			void updateModel( const T& learningRateFactor, const Size epochNum, const Math::Interval<Size>& neuronIInterval );
 
 			T computeCostLog( const Math::Interval<Size>& dataIInterval, const Vector<StaticTable<T, NbNeurons>>& outTableVector, const Vector<StaticTable<T, NbNeurons>>& expectedOutTableVector ) const;
 			T computeMeanSquaredError( const Math::Interval<Size>& dataIInterval, const Vector<StaticTable<T, NbNeurons>>& outTableVector, const Vector<StaticTable<T, NbNeurons>>& expectedOutTableVector ) const;
@@ -519,6 +532,21 @@ namespace Math {
 			}
 		}
 
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<typename ActivationFunc, Size NbData>
+		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagationS( const Size dataIBegin, const Math::Interval<Size>& neuronIInterval, const ActivationFunc& activationFunc ) {
+			const StaticTable<StaticTable<T, NbFeatures>, NbData>& featureTableTable( *reinterpret_cast< const StaticTable<StaticTable<T, NbFeatures>, NbData> * >( getInVector().getData() + dataIBegin ) );
+			StaticTable<StaticTable<T, NbNeurons>, NbData>& outTableTable( *reinterpret_cast< StaticTable<StaticTable<T, NbNeurons>, NbData> * >( getOutVector().getData() + dataIBegin ) );
+
+			for ( Size dataI( 0 ); dataI < NbData; dataI++ ) {
+				const StaticTable<T, NbFeatures>& featureTable( featureTableTable[ dataI ] );
+				StaticTable<T, NbNeurons>& outTable( outTableTable[ dataI ] );
+				for ( Size neuronI( neuronIInterval.getBegin() ); neuronI < neuronIInterval.getEnd(); neuronI++ ) {
+					outTable[ neuronI ] = computeY( neuronI, featureTable, activationFunc );
+				}
+			}
+		}
+
 		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
 		template<typename ActivationFunc>
 		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagation( const StaticTable<T, NbFeatures>& featureTable, StaticTable<T, NbNeurons>& outTable, const ActivationFunc& activationFunc ) const {
@@ -533,10 +561,15 @@ namespace Math {
 
 		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
 		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagation( const Math::Interval<Size>& dataIInterval ) {
+			computeBackPropagation( dataIInterval, Math::Interval<Size>( Size( 0 ), getNbNeurons() ) );
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagation( const Math::Interval<Size>& dataIInterval, const Math::Interval<Size>& neuronIInterval ) {
 			const T sizeInverse( T( 1 ) / T( dataIInterval.getSize() ) );
 
 			for ( Size featureI( 0 ); featureI < getNbFeatures(); featureI++ ) {
-				for ( Size neuronI( 0 ); neuronI < getNbNeurons(); neuronI++ ) {
+				for ( Size neuronI( neuronIInterval.getBegin() ); neuronI < neuronIInterval.getEnd(); neuronI++ ) {
 
 					T dotSum( 0 );
 					for ( Size dataI( dataIInterval.getBegin() ); dataI < dataIInterval.getEnd(); dataI++ ) {
@@ -547,7 +580,7 @@ namespace Math {
 					setGrad( neuronI, featureI, dotSum );
 				}
 			}
-			for ( Size neuronI( 0 ); neuronI < getNbNeurons(); neuronI++ ) {
+			for ( Size neuronI( neuronIInterval.getBegin() ); neuronI < neuronIInterval.getEnd(); neuronI++ ) {
 
 				T dotSum( 0 );
 				for ( Size dataI( dataIInterval.getBegin() ); dataI < dataIInterval.getEnd(); dataI++ ) {
@@ -573,7 +606,12 @@ namespace Math {
 
 		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
 		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::updateModel( const T& learningRateFactor, const Size epochNum ) {
-			for ( Size neuronI( 0 ); neuronI < getNbNeurons(); neuronI++ ) {
+			updateModel( learningRateFactor, epochNum, Math::Interval<Size>( Size( 0 ), getNbNeurons() ) );
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::updateModel( const T& learningRateFactor, const Size epochNum, const Math::Interval<Size>& neuronIInterval ) {
+			for ( Size neuronI( neuronIInterval.getBegin() ); neuronI < neuronIInterval.getEnd(); neuronI++ ) {
 				for ( Size paramI( 0 ); paramI < getNbNeuronParams(); paramI++ ) {
 					const T& grad( getGrads( neuronI )[ paramI ] );
 					T& param( getParams( neuronI )[ paramI ] );
@@ -789,6 +827,29 @@ namespace Math {
 			}
 		}
 
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<Size NbFeaturesNext, Size NbNeuronsNext, typename ActivationFunc, Size NbData>
+		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeDeltasS( const Size dataIBegin, const Math::Interval<Size>& neuronIInterval, const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>& nextNeuralLayer, const ActivationFunc& activationFunc ) {
+			const StaticTable<StaticTable<T, NbNeurons>, NbData>& outTableTable( *reinterpret_cast< const StaticTable<StaticTable<T, NbNeurons>, NbData> * >( getOutVector().getData() + dataIBegin ) );
+			const StaticTable<StaticTable<T, NbNeuronsNext>, NbData>& nextDeltaTableTable( *reinterpret_cast< const StaticTable<StaticTable<T, NbNeuronsNext>, NbData> * >( nextNeuralLayer.getDeltaVector().getData() + dataIBegin ) );
+			const StaticTable<StaticTable<T, NbFeaturesNext + Size( 1 )>, NbNeuronsNext>& nextParamTable( nextNeuralLayer.getParamTableTable() );
+			StaticTable<StaticTable<T, NbNeurons>, NbData>& deltaTableTable( *reinterpret_cast< StaticTable<StaticTable<T, NbNeurons>, NbData> * >( getDeltaVector().getData() + dataIBegin ) );
+
+			for ( Size dataI( 0 ); dataI < NbData; dataI++ ) {
+				const StaticTable<T, NbNeurons>& outTable( outTableTable[ dataI ] );
+				const StaticTable<T, NbNeuronsNext>& nextDeltaTable( nextDeltaTableTable[ dataI ] );
+				StaticTable<T, NbNeurons>& deltaTable( deltaTableTable[ dataI ] );
+
+				for ( Size neuronI( neuronIInterval.getBegin() ); neuronI < neuronIInterval.getEnd(); neuronI++ ) {
+					T dotSum( 0 );
+					for ( Size nextNeuronI( 0 ); nextNeuronI < NbNeuronsNext; nextNeuronI++ ) {
+						dotSum += nextParamTable[ nextNeuronI ][ neuronI ] * nextDeltaTable[ nextNeuronI ];
+					}
+					deltaTable[ neuronI ] = dotSum * activationFunc.grad( outTable[ neuronI ] );
+				}
+			}
+		}
+
 		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
 		template<Size NbData>
 		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagationS( const Size dataIBegin ) {
@@ -826,6 +887,33 @@ namespace Math {
 			}
 		}
 
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<Size NbData>
+		inline void NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagationS( const Size dataIBegin, const Math::Interval<Size>& neuronIInterval ) {
+			const StaticTable<StaticTable<T, NbFeatures>, NbData>& inTableTable( *reinterpret_cast< const StaticTable<StaticTable<T, NbFeatures>, NbData> * >( getInVector().getData() + dataIBegin ) );
+			const StaticTable<StaticTable<T, NbNeurons>, NbData>& deltaTableTable( *reinterpret_cast< const StaticTable<StaticTable<T, NbNeurons>, NbData> * >( getDeltaVector().getData() + dataIBegin ) );
+			StaticTable<StaticTable<T, NbFeatures + Size( 1 )>, NbNeurons>& gradTableTable( getGradTableTable() );
+			constexpr T sizeInverse( T( 1 ) / T( NbData ) );
+
+			for ( Size neuronI( neuronIInterval.getBegin() ); neuronI < neuronIInterval.getEnd(); neuronI++ ) {
+				StaticTable<T, NbFeatures + Size( 1 )>& gradTable( gradTableTable[ neuronI ] );
+
+				for ( Size featureI( 0 ); featureI < getNbFeatures(); featureI++ ) {
+					T dotSum( 0 );
+					for ( Size dataI( 0 ); dataI < NbData; dataI++ ) {
+						dotSum += inTableTable[ dataI ][ featureI ] * deltaTableTable[ dataI ][ neuronI ];
+					}
+					gradTable[ featureI ] = dotSum * sizeInverse;
+				}
+
+				T dotSum( 0 );
+				for ( Size dataI( 0 ); dataI < NbData; dataI++ ) {
+					dotSum += deltaTableTable[ dataI ][ neuronI ];
+				}
+				gradTable[ getNbFeatures() ] = dotSum * sizeInverse;
+			}
+		}
+
 	}
 
 }
\ No newline at end of file
@@ -1,112 +1,235 @@
 #pragma once
 
-#include "../../Thread.h"
+#include "../../ThreadPool.h"
 #include "NeuralLayer.h"
 
 namespace Math {
 
 	namespace ML {
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads = Size(16)>
+		///@brief NeuralLayer splitting it's work (data or neurons intervals) between the threads of a ThreadPool.
+		///			The pool is not owned by the layer, every layer of a DeepNeuralNetwork share the one of the network.
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
 		class NeuralLayerMT : public NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc> {
 		public:
-			NeuralLayerMT(const Vector<StaticTable<T, NbFeatures>>* inTableVector, const OptimizerFunc& optimizerFunc);
+			///@brief Minimum number of multiply-add a task has to do, under that the work is done on the calling thread.
+			static constexpr Size minTaskWork = Size( 4096 );
 
-			constexpr Size getNbThreads() const;
+			NeuralLayerMT( const Vector<StaticTable<T, NbFeatures>>* inTableVector, const OptimizerFunc& optimizerFunc, ThreadPool * threadPool = NULL );
 
-			void setNbData(const Size nbData);
+			///@brief Get the number of threads used (1 without a ThreadPool).
+			Size getNbThreads() const;
+
+			ThreadPool * getThreadPool() const;
+			void setThreadPool( ThreadPool * threadPool );
 
 			using NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagation;
 			template<typename ActivationFunc>
-			void computeForwardPropagation(const Math::Interval<Size>& dataIInterval, const ActivationFunc& activationFunc);
+			void computeForwardPropagation( const Math::Interval<Size>& dataIInterval, const ActivationFunc& activationFunc );
 			template<typename ActivationFunc>
-			void computeForwardPropagation(const Math::Interval<Size>& dataIInterval, const Vector<StaticTable<T, NbFeatures>>& featureTableVector, Vector<StaticTable<T, NbNeurons>>& outTableVector, const ActivationFunc& activationFunc) const;
+			void computeForwardPropagation( const Math::Interval<Size>& dataIInterval, const Vector<StaticTable<T, NbFeatures>>& featureTableVector, Vector<StaticTable<T, NbNeurons>>& outTableVector, const ActivationFunc& activationFunc ) const;
 
-			template<typename ActivationFunc>
-			void _runComputeForwardPropagation(const Math::Interval<Size>* dataIInterval, const Vector<StaticTable<T, NbFeatures>>* featureTableVector, Vector<StaticTable<T, NbNeurons>>* outTableVector, const ActivationFunc* activationFunc);
+			using NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagationS;
+			template<typename ActivationFunc, Size NbData>
+			void computeForwardPropagationS( const Size dataIBegin, const ActivationFunc& activationFunc );
+
+			using NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeDeltas;
+			template<Size NbFeaturesNext, Size NbNeuronsNext, typename ActivationFunc>
+			void computeDeltas( const Math::Interval<Size>& dataIInterval, const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>& nextNeuralLayer, const ActivationFunc& activationFunc );
 
-			void test(const int * i);
+			using NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeDeltasS;
+			template<Size NbFeaturesNext, Size NbNeuronsNext, typename ActivationFunc, Size NbData>
+			void computeDeltasS( const Size dataIBegin, const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>& nextNeuralLayer, const ActivationFunc& activationFunc );
 
-			static void createIntervalTable(const Math::Interval<Size>& interval, StaticTable<Math::Interval<Size>, NbThreads>& outTable);
+			using NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagation;
+			void computeBackPropagation( const Math::Interval<Size>& dataIInterval );
+
+			using NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagationS;
+			template<Size NbData>
+			void computeBackPropagationS( const Size dataIBegin );
+
+			using NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::updateModel;
+			void updateModel( const T& learningRateFactor, const Size epochNum );
 
 		private:
-			StaticTable<Math::Interval<Size>, NbThreads> neuronIIntervalTable;
-			StaticTable<Math::Interval<Size>, NbThreads> dataIIntervalTable;
+			///@brief Call func( neuronIInterval ) over [0;NbNeurons[, split between the threads if the work is big enough.
+			template<typename Func>
+			void _runNeurons( Func& func, const Size work ) const;
+
+			///@brief Call func( dataIInterval ) over dataIInterval, split between the threads if the work is big enough.
+			template<typename Func>
+			void _runData( const Math::Interval<Size>& dataIInterval, Func& func, const Size work ) const;
+
+			ThreadPool * threadPool;
 		};
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
-		inline NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::NeuralLayerMT(const Vector<StaticTable<T, NbFeatures>>* inTableVector, const OptimizerFunc& optimizerFunc) :
-			NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>(inTableVector, optimizerFunc)
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::NeuralLayerMT( const Vector<StaticTable<T, NbFeatures>>* inTableVector, const OptimizerFunc& optimizerFunc, ThreadPool * threadPool ) :
+			NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>( inTableVector, optimizerFunc ),
+			threadPool( threadPool )
 		{
-			static_assert( NbNeurons % NbThreads == Size(0), "NbNeurons is not a multiple of NbThreads" );
 
-			for ( Size i(0); i < getNbThreads(); i++ ) {
-				neuronIIntervalTable[ i ].setBegin(getNbNeurons() / getNbThreads() * i);
-				neuronIIntervalTable[ i ].setEnd(getNbNeurons() / getNbThreads() * (i + Size(1)));
-			}
 		}
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
-		inline constexpr Size NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::getNbThreads() const {
-			return NbThreads;
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline Size NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::getNbThreads() const {
+			return this->threadPool ? this->threadPool->getNbThreads() : Size( 1 );
 		}
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
-		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::setNbData(const Size nbData) {
-			NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::setNbData(nbData);
-
-			NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::createIntervalTable(Math::Interval<Size>(Size(0), nbData), this->dataIIntervalTable);
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline ThreadPool * NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::getThreadPool() const {
+			return this->threadPool;
 		}
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
-		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::test(const int * i) {
-			
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::setThreadPool( ThreadPool * threadPool ) {
+			this->threadPool = threadPool;
 		}
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
-		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::createIntervalTable(const Math::Interval<Size>& interval, StaticTable<Math::Interval<Size>, NbThreads>& outTable) {
-			Vector<Math::Interval<Size>> intervalVector(interval.split(NbThreads));
-
-			Size i(0);
-			for ( ; i < intervalVector.getSize(); i++ ) {
-				outTable[ i ] = intervalVector.getValueI(i);
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<typename Func>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::_runNeurons( Func& func, const Size work ) const {
+			const Math::Interval<Size> neuronIInterval( Size( 0 ), NbNeurons );
+			if ( getNbThreads() <= Size( 1 ) || work < minTaskWork * Size( 2 ) ) {
+				func( neuronIInterval );
+			} else {
+				this->threadPool->runInterval( neuronIInterval, func );
 			}
-			for ( ; i < NbThreads; i++ ) {
-				outTable[ i ] = Math::Interval<Size>(Size(0), Size(0));
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<typename Func>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::_runData( const Math::Interval<Size>& dataIInterval, Func& func, const Size work ) const {
+			if ( getNbThreads() <= Size( 1 ) || work < minTaskWork * Size( 2 ) ) {
+				func( dataIInterval );
+			} else {
+				this->threadPool->runInterval( dataIInterval, func );
 			}
 		}
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
 		template<typename ActivationFunc>
-		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::computeForwardPropagation(const Math::Interval<Size>& dataIInterval, const ActivationFunc& activationFunc) {
-			computeForwardPropagation(dataIInterval, getInVector(), getOutVector(), activationFunc);
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagation( const Math::Interval<Size>& dataIInterval, const ActivationFunc& activationFunc ) {
+			computeForwardPropagation( dataIInterval, this->getInVector(), this->getOutVector(), activationFunc );
 		}
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
 		template<typename ActivationFunc>
-		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::computeForwardPropagation(const Math::Interval<Size>& dataIInterval, const Vector<StaticTable<T, NbFeatures>>& featureTableVector, Vector<StaticTable<T, NbNeurons>>& outTableVector, const ActivationFunc& activationFunc) const {
-			if constexpr ( NbThreads <= Size(1) ) {
-				return NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagation(dataIInterval, featureTableVector, outTableVector, activationFunc);
-			} else {
-				StaticTable<std::thread, NbThreads> threadTable;
-				for ( Size i(0); i < getNbThreads(); i++ ) {
-					threadTable[ i ] = std::thread(&NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::_runComputeForwardPropagation< ActivationFunc>,
-												   const_cast< NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads> * >( this ),
-												   &this->dataIIntervalTable[i],
-												   &featureTableVector,
-												   &outTableVector,
-												   &activationFunc);
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagation( const Math::Interval<Size>& dataIInterval, const Vector<StaticTable<T, NbFeatures>>& featureTableVector, Vector<StaticTable<T, NbNeurons>>& outTableVector, const ActivationFunc& activationFunc ) const {
+			struct ForwardFunc {
+				const NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>* neuralLayer;
+				const Vector<StaticTable<T, NbFeatures>>* featureTableVector;
+				Vector<StaticTable<T, NbNeurons>>* outTableVector;
+				const ActivationFunc* activationFunc;
+
+				void operator()( const Math::Interval<Size>& dataIInterval ) {
+					neuralLayer->NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagation( dataIInterval, *featureTableVector, *outTableVector, *activationFunc );
 				}
-				for ( Size i(0); i < getNbThreads(); i++ ) {
-					threadTable[ i ].join();
+			};
+
+			ForwardFunc forwardFunc{ this, &featureTableVector, &outTableVector, &activationFunc };
+			_runData( dataIInterval, forwardFunc, dataIInterval.getSize() * NbFeatures * NbNeurons );
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<typename ActivationFunc, Size NbData>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagationS( const Size dataIBegin, const ActivationFunc& activationFunc ) {
+			// A stochastic chunk is small, split the neurons instead of the data.
+			struct ForwardFunc {
+				NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>* neuralLayer;
+				Size dataIBegin;
+				const ActivationFunc* activationFunc;
+
+				void operator()( const Math::Interval<Size>& neuronIInterval ) {
+					neuralLayer->NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::template computeForwardPropagationS<ActivationFunc, NbData>( dataIBegin, neuronIInterval, *activationFunc );
 				}
-			}
+			};
+
+			ForwardFunc forwardFunc{ this, dataIBegin, &activationFunc };
+			_runNeurons( forwardFunc, NbData * NbFeatures * NbNeurons );
 		}
 
-		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc, Size NbThreads>
-		template<typename ActivationFunc>
-		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc, NbThreads>::_runComputeForwardPropagation(const Math::Interval<Size>* dataIInterval, const Vector<StaticTable<T, NbFeatures>>* featureTableVector, Vector<StaticTable<T, NbNeurons>>* outTableVector, const ActivationFunc* activationFunc) {
-			NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeForwardPropagation(*dataIInterval, *featureTableVector, *outTableVector, *activationFunc);
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<Size NbFeaturesNext, Size NbNeuronsNext, typename ActivationFunc>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::computeDeltas( const Math::Interval<Size>& dataIInterval, const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>& nextNeuralLayer, const ActivationFunc& activationFunc ) {
+			struct DeltasFunc {
+				NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>* neuralLayer;
+				const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>* nextNeuralLayer;
+				const ActivationFunc* activationFunc;
+
+				void operator()( const Math::Interval<Size>& dataIInterval ) {
+					neuralLayer->NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::template computeDeltas<NbFeaturesNext, NbNeuronsNext, ActivationFunc>( dataIInterval, *nextNeuralLayer, *activationFunc );
+				}
+			};
+
+			DeltasFunc deltasFunc{ this, &nextNeuralLayer, &activationFunc };
+			_runData( dataIInterval, deltasFunc, dataIInterval.getSize() * NbNeurons * NbNeuronsNext );
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<Size NbFeaturesNext, Size NbNeuronsNext, typename ActivationFunc, Size NbData>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::computeDeltasS( const Size dataIBegin, const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>& nextNeuralLayer, const ActivationFunc& activationFunc ) {
+			struct DeltasFunc {
+				NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>* neuralLayer;
+				Size dataIBegin;
+				const NeuralLayer<T, NbFeaturesNext, NbNeuronsNext, OptimizerFunc>* nextNeuralLayer;
+				const ActivationFunc* activationFunc;
+
+				void operator()( const Math::Interval<Size>& neuronIInterval ) {
+					neuralLayer->NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::template computeDeltasS<NbFeaturesNext, NbNeuronsNext, ActivationFunc, NbData>( dataIBegin, neuronIInterval, *nextNeuralLayer, *activationFunc );
+				}
+			};
+
+			DeltasFunc deltasFunc{ this, dataIBegin, &nextNeuralLayer, &activationFunc };
+			_runNeurons( deltasFunc, NbData * NbNeurons * NbNeuronsNext );
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagation( const Math::Interval<Size>& dataIInterval ) {
+			// Every neuron own it's gradients, split the neurons so no reduction is needed.
+			struct BackPropagationFunc {
+				NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>* neuralLayer;
+				const Math::Interval<Size>* dataIInterval;
+
+				void operator()( const Math::Interval<Size>& neuronIInterval ) {
+					neuralLayer->NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagation( *dataIInterval, neuronIInterval );
+				}
+			};
+
+			BackPropagationFunc backPropagationFunc{ this, &dataIInterval };
+			_runNeurons( backPropagationFunc, dataIInterval.getSize() * ( NbFeatures + Size( 1 ) ) * NbNeurons );
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		template<Size NbData>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::computeBackPropagationS( const Size dataIBegin ) {
+			struct BackPropagationFunc {
+				NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>* neuralLayer;
+				Size dataIBegin;
+
+				void operator()( const Math::Interval<Size>& neuronIInterval ) {
+					neuralLayer->NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::template computeBackPropagationS<NbData>( dataIBegin, neuronIInterval );
+				}
+			};
+
+			BackPropagationFunc backPropagationFunc{ this, dataIBegin };
+			_runNeurons( backPropagationFunc, NbData * ( NbFeatures + Size( 1 ) ) * NbNeurons );
+		}
+
+		template<typename T, Size NbFeatures, Size NbNeurons, typename OptimizerFunc>
+		inline void NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>::updateModel( const T& learningRateFactor, const Size epochNum ) {
+			struct UpdateFunc {
+				NeuralLayerMT<T, NbFeatures, NbNeurons, OptimizerFunc>* neuralLayer;
+				const T* learningRateFactor;
+				Size epochNum;
+
+				void operator()( const Math::Interval<Size>& neuronIInterval ) {
+					neuralLayer->NeuralLayer<T, NbFeatures, NbNeurons, OptimizerFunc>::updateModel( *learningRateFactor, epochNum, neuronIInterval );
+				}
+			};
+
+			UpdateFunc updateFunc{ this, &learningRateFactor, epochNum };
+			_runNeurons( updateFunc, ( NbFeatures + Size( 1 ) ) * NbNeurons * Size( 8 ) );
 		}
 
 	}
@@ -6,6 +6,7 @@
 
 #include "BasicMath.h"
 #include "Vec.h"
+#include "Gemm.h"
 
 namespace Math {
 
@@ -176,6 +177,22 @@ namespace Math {
 		Mat<T>& operator--();
 		Mat<T> operator-();
 
+		///@brief Set this to the matrix product op(a) * op(b), resized if needed.
+		///@param a First operand (must not be this).
+		///@param b Second operand (must not be this).
+		///@param opA (Optional) Operation applied to a, Gemm::Op::Transpose multiply by the transposed of a without any copy.
+		///@param opB (Optional) Operation applied to b, Gemm::Op::Transpose multiply by the transposed of b without any copy.
+		///@return reference to THIS.
+		Mat<T>& setMul(const Mat<T>& a, const Mat<T>& b, const Gemm::Op opA = Gemm::Op::None, const Gemm::Op opB = Gemm::Op::None);
+
+		///@brief Add the matrix product op(a) * op(b) to this (this += op(a) * op(b)) without any temporary.
+		///@param a First operand (must not be this).
+		///@param b Second operand (must not be this).
+		///@param opA (Optional) Operation applied to a, Gemm::Op::Transpose multiply by the transposed of a without any copy.
+		///@param opB (Optional) Operation applied to b, Gemm::Op::Transpose multiply by the transposed of b without any copy.
+		///@return reference to THIS.
+		Mat<T>& addMul(const Mat<T>& a, const Mat<T>& b, const Gemm::Op opA = Gemm::Op::None, const Gemm::Op opB = Gemm::Op::None);
+
 		/************************************************************************/
 		/* ================                MISC                ================ */
 		/************************************************************************/
@@ -537,6 +554,34 @@ namespace Math {
 		return *this;
 	}
 
+	template<typename T>
+	inline Mat<T>& Mat<T>::setMul(const Mat<T>& a, const Mat<T>& b, const Gemm::Op opA, const Gemm::Op opB) {
+		ASSERT_SPP(this != &a && this != &b);
+		const Size sizeM(( opA == Gemm::Op::None ) ? a.getSizeM() : a.getSizeN());
+		const Size sizeK(( opA == Gemm::Op::None ) ? a.getSizeN() : a.getSizeM());
+		const Size sizeN(( opB == Gemm::Op::None ) ? b.getSizeN() : b.getSizeM());
+		ASSERT_SPP(sizeK == (( opB == Gemm::Op::None ) ? b.getSizeM() : b.getSizeN()));
+
+		resizeNoCopy(sizeM, sizeN);
+		Gemm::multiply(sizeM, sizeN, sizeK, a.getData(), a.getSizeN(), opA, b.getData(), b.getSizeN(), opB, this->dataTable, sizeN);
+
+		return *this;
+	}
+
+	template<typename T>
+	inline Mat<T>& Mat<T>::addMul(const Mat<T>& a, const Mat<T>& b, const Gemm::Op opA, const Gemm::Op opB) {
+		ASSERT_SPP(this != &a && this != &b);
+		const Size sizeM(( opA == Gemm::Op::None ) ? a.getSizeM() : a.getSizeN());
+		const Size sizeK(( opA == Gemm::Op::None ) ? a.getSizeN() : a.getSizeM());
+		const Size sizeN(( opB == Gemm::Op::None ) ? b.getSizeN() : b.getSizeM());
+		ASSERT_SPP(sizeK == (( opB == Gemm::Op::None ) ? b.getSizeM() : b.getSizeN()));
+		ASSERT_SPP(getSizeM() == sizeM && getSizeN() == sizeN);
+
+		Gemm::multiply(sizeM, sizeN, sizeK, a.getData(), a.getSizeN(), opA, b.getData(), b.getSizeN(), opB, this->dataTable, sizeN, true);
+
+		return *this;
+	}
+
 	template<typename T>
 	inline const Size Mat<T>::getNbElem(const Size m, const Size n) const {
 		return m * n;
@@ -663,7 +708,18 @@ namespace Math {
 	template<typename T>
 	template<typename C>
 	inline Mat<T>& Mat<T>::operator*=(const Mat<C>& m) {
-		return *this = *this * m;
+		const Mat<T>& mT(m);
+		ASSERT_SPP(getSizeN() == mT.getSizeM());
+
+		// The product cannot be done in place, compute it into a new buffer and take it.
+		T* newBuffer(new T[ getNbElem(getSizeM(), mT.getSizeN()) ]);
+		Gemm::multiply(getSizeM(), mT.getSizeN(), getSizeN(), this->dataTable, getSizeN(), Gemm::Op::None, mT.getData(), mT.getSizeN(), Gemm::Op::None, newBuffer, mT.getSizeN());
+		delete[] this->dataTable;
+		this->dataTable = newBuffer;
+		this->size = getNbElem(getSizeM(), mT.getSizeN());
+		this->n = mT.getSizeN();
+
+		return *this;
 	}
 
 	template<typename T>
@@ -1022,17 +1078,7 @@ namespace Math {
 	Mat<T> operator*(const Mat<T>& m1, const Mat<T>& m2) {
 		ASSERT_SPP(m1.getSizeN() == m2.getSizeM());
 		Mat<T> r(m1.getSizeM(), m2.getSizeN());
-		for ( Size i(0); i < r.getSizeM(); i++ ) {
-			for ( Size j(0); j < r.getSizeN(); j++ ) {
-				T value(0);
-
-				for ( Size k(0); k < m1.getSizeN(); k++ ) {
-					value += m1.getValueI(i, k) * m2.getValueI(k, j);
-				}
-
-				r.setValueI(i, j, value);
-			}
-		}
+		Gemm::multiply(r.getSizeM(), r.getSizeN(), m1.getSizeN(), m1.getData(), m1.getSizeN(), Gemm::Op::None, m2.getData(), m2.getSizeN(), Gemm::Op::None, r.getData(), r.getSizeN());
 		return r;
 	}
 
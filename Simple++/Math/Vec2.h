@@ -256,6 +256,14 @@ namespace Math {
 
 }
 
+namespace IO {
+
+	///@brief A Vec2 of raw values is written as its raw memory (when its empty bases didn't add any padding).
+	template<typename T>
+	struct IsRawSerializable<Math::Vec2<T>> : std::integral_constant<bool, IsRawSerializable<T>::value && sizeof( Math::Vec2<T> ) == sizeof( T ) * Size( 2 )> {};
+
+}
+
 
 
 
@@ -0,0 +1,97 @@
+///@file		MemoryArena.h.
+///@brief		Declares a monotonic arena allocator.
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <utility>
+
+#include "SimpleLog.h"
+#include "Utility.h"
+
+
+///@brief Monotonic allocator : memory is taken from big chunks by moving a pointer and is only given back all at once.
+///			Used to place a lot of small objects sharing the same lifetime (the nodes of a parsed document for example).
+///			The objects created inside an arena are NEVER deleted, their destructor has to be called with destroy() if needed.
+///			Not thread safe.
+template<typename T>
+class MemoryArenaT {
+public:
+	///@brief Constructor
+	///@param chunkSize (Optional) Size in bytes of the chunks allocated from the heap (a block bigger than a quarter of it get it's own chunk).
+	MemoryArenaT( const Size chunkSize = Size( 65536 ) );
+
+	///@brief Move constructor, the chunks are taken from arena which is left empty.
+	///@param arena Arena to move.
+	MemoryArenaT( MemoryArenaT<T> && arena );
+
+	///@brief Destructor, release every chunk (the objects destructors are NOT called).
+	~MemoryArenaT();
+
+	///@brief Move operator, release our chunks and take the ones of arena which is left empty.
+	///@param arena Arena to move.
+	///@return Reference to this.
+	MemoryArenaT<T> & operator=( MemoryArenaT<T> && arena );
+
+	///@brief Allocate a block of memory inside the arena.
+	///@param size Size in bytes.
+	///@param alignment (Optional) Alignment of the block (power of two).
+	///@return Pointer to the block, valid until the arena is cleared or destroyed.
+	void * allocate( const Size size, const Size alignment = Size( alignof( std::max_align_t ) ) );
+
+	///@brief Construct a new object of type C inside the arena.
+	///@param args Arguments forwarded to the constructor.
+	///@return Pointer to the new object.
+	template<typename C, typename... Args>
+	C * create( Args && ... args );
+
+	///@brief Call the destructor of an object created by create(), the memory is kept until the arena is cleared.
+	///@param object Object to destroy.
+	template<typename C>
+	static void destroy( C * object );
+
+	///@brief Release every chunk at once (the objects destructors are NOT called).
+	void clear();
+
+	///@brief Get the number of allocations served by the arena since the last clear().
+	Size getNbAllocations() const;
+
+	///@brief Get the number of chunks allocated from the heap.
+	Size getNbChunks() const;
+
+	///@brief Get the number of bytes handed out by the arena since the last clear().
+	Size getAllocatedSize() const;
+
+	///@brief Get the number of bytes allocated from the heap.
+	Size getReservedSize() const;
+
+private:
+	///@brief Header placed at the beginning of each chunk, the data follow it.
+	struct Chunk {
+		Chunk * next;
+		Size size;
+	};
+
+	MemoryArenaT( const MemoryArenaT<T> & arena );
+	MemoryArenaT<T> & operator=( const MemoryArenaT<T> & arena );
+
+	///@brief Allocate a new chunk of dataSize bytes from the heap (not linked).
+	Chunk * _newChunk( const Size dataSize );
+
+	///@brief Get the first address after it aligned on alignment.
+	static Size _align( const unsigned char * it, const Size alignment );
+
+	Size chunkSize;
+	Chunk * chunkList;
+	unsigned char * currentIt;
+	unsigned char * currentEndIt;
+
+	Size nbAllocations;
+	Size nbChunks;
+	Size allocatedSize;
+	Size reservedSize;
+};
+
+using MemoryArena = MemoryArenaT<int>;
+
+#include "MemoryArena.hpp"
@@ -0,0 +1,160 @@
+template<typename T>
+MemoryArenaT<T>::MemoryArenaT( const Size chunkSize ) :
+	chunkSize( chunkSize ),
+	chunkList( NULL ),
+	currentIt( NULL ),
+	currentEndIt( NULL ),
+	nbAllocations( 0 ),
+	nbChunks( 0 ),
+	allocatedSize( 0 ),
+	reservedSize( 0 ) {
+
+}
+
+template<typename T>
+MemoryArenaT<T>::MemoryArenaT( MemoryArenaT<T> && arena ) :
+	chunkSize( arena.chunkSize ),
+	chunkList( arena.chunkList ),
+	currentIt( arena.currentIt ),
+	currentEndIt( arena.currentEndIt ),
+	nbAllocations( arena.nbAllocations ),
+	nbChunks( arena.nbChunks ),
+	allocatedSize( arena.allocatedSize ),
+	reservedSize( arena.reservedSize ) {
+	arena.chunkList = NULL;
+	arena.clear();
+}
+
+template<typename T>
+MemoryArenaT<T>::~MemoryArenaT() {
+	clear();
+}
+
+template<typename T>
+MemoryArenaT<T> & MemoryArenaT<T>::operator=( MemoryArenaT<T> && arena ) {
+	if ( &arena == this ) {
+		return *this;
+	}
+	clear();
+
+	this -> chunkSize = arena.chunkSize;
+	this -> chunkList = arena.chunkList;
+	this -> currentIt = arena.currentIt;
+	this -> currentEndIt = arena.currentEndIt;
+	this -> nbAllocations = arena.nbAllocations;
+	this -> nbChunks = arena.nbChunks;
+	this -> allocatedSize = arena.allocatedSize;
+	this -> reservedSize = arena.reservedSize;
+
+	arena.chunkList = NULL;
+	arena.clear();
+
+	return *this;
+}
+
+template<typename T>
+void * MemoryArenaT<T>::allocate( const Size size, const Size alignment ) {
+	Size alignedAddr( _align( this -> currentIt, alignment ) );
+
+	if ( this -> currentIt == NULL || alignedAddr + size > reinterpret_cast< Size >( this -> currentEndIt ) ) {
+		if ( size + alignment > ( this -> chunkSize >> Size( 2 ) ) ) {
+			// Big block, give it it's own chunk and keep filling the current one.
+			Chunk * chunk( _newChunk( size + alignment ) );
+			if ( this -> chunkList ) {
+				chunk -> next = this -> chunkList -> next;
+				this -> chunkList -> next = chunk;
+			} else {
+				chunk -> next = NULL;
+				this -> chunkList = chunk;
+				this -> currentIt = reinterpret_cast< unsigned char * >( chunk ) + chunk -> size;
+				this -> currentEndIt = this -> currentIt;
+			}
+			this -> nbAllocations++;
+			this -> allocatedSize += size;
+			return reinterpret_cast< void * >( _align( reinterpret_cast< unsigned char * >( chunk ) + sizeof( Chunk ), alignment ) );
+		}
+
+		Chunk * chunk( _newChunk( this -> chunkSize ) );
+		chunk -> next = this -> chunkList;
+		this -> chunkList = chunk;
+		this -> currentIt = reinterpret_cast< unsigned char * >( chunk ) + sizeof( Chunk );
+		this -> currentEndIt = reinterpret_cast< unsigned char * >( chunk ) + chunk -> size;
+		alignedAddr = _align( this -> currentIt, alignment );
+	}
+
+	this -> currentIt = reinterpret_cast< unsigned char * >( alignedAddr + size );
+	this -> nbAllocations++;
+	this -> allocatedSize += size;
+
+	return reinterpret_cast< void * >( alignedAddr );
+}
+
+template<typename T>
+template<typename C, typename... Args>
+C * MemoryArenaT<T>::create( Args && ... args ) {
+	void * memory( allocate( Size( sizeof( C ) ), Size( alignof( C ) ) ) );
+	return new( memory ) C( std::forward<Args>( args )... );
+}
+
+template<typename T>
+template<typename C>
+void MemoryArenaT<T>::destroy( C * object ) {
+	object -> ~C();
+}
+
+template<typename T>
+void MemoryArenaT<T>::clear() {
+	Chunk * chunk( this -> chunkList );
+	while ( chunk ) {
+		Chunk * nextChunk( chunk -> next );
+		delete[] reinterpret_cast< unsigned char * >( chunk );
+		chunk = nextChunk;
+	}
+
+	this -> chunkList = NULL;
+	this -> currentIt = NULL;
+	this -> currentEndIt = NULL;
+	this -> nbAllocations = Size( 0 );
+	this -> nbChunks = Size( 0 );
+	this -> allocatedSize = Size( 0 );
+	this -> reservedSize = Size( 0 );
+}
+
+template<typename T>
+Size MemoryArenaT<T>::getNbAllocations() const {
+	return this -> nbAllocations;
+}
+
+template<typename T>
+Size MemoryArenaT<T>::getNbChunks() const {
+	return this -> nbChunks;
+}
+
+template<typename T>
+Size MemoryArenaT<T>::getAllocatedSize() const {
+	return this -> allocatedSize;
+}
+
+template<typename T>
+Size MemoryArenaT<T>::getReservedSize() const {
+	return this -> reservedSize;
+}
+
+template<typename T>
+typename MemoryArenaT<T>::Chunk * MemoryArenaT<T>::_newChunk( const Size dataSize ) {
+	const Size totalSize( Size( sizeof( Chunk ) ) + dataSize );
+
+	Chunk * chunk( reinterpret_cast< Chunk * >( new unsigned char[ totalSize ] ) );
+	chunk -> next = NULL;
+	chunk -> size = totalSize;
+
+	this -> nbChunks++;
+	this -> reservedSize += totalSize;
+
+	return chunk;
+}
+
+template<typename T>
+Size MemoryArenaT<T>::_align( const unsigned char * it, const Size alignment ) {
+	return ( reinterpret_cast< Size >( it ) + alignment - Size( 1 ) ) & ~( alignment - Size( 1 ) );
+}
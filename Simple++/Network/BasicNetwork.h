@@ -18,6 +18,11 @@
 #include <arpa/inet.h>
 #include <unistd.h> /* close */
 #include <netdb.h> /* gethostbyname */
+#include <fcntl.h> /* fcntl */
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/resource.h> /* getrlimit */
+typedef int SOCKET;
 #define INVALID_SOCKET -1
 #define SOCKET_ERROR -1
 #define closesocket(s) close(s)
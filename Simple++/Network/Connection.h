@@ -192,14 +192,30 @@ namespace Network {
 
 		/**
 		 * @brief 	Send data to the connection (after a connect)
+		 * 			With TCP, the bytes the system could not take (short write or would block on a non-blocking connection)
+		 * 			are queued inside the connection and sent by flush() once it is writable again.
 		 *
 		 * @param 	buffer	Data buffer to be sent.
 		 * @param 	size  	size of the data buffer.
 		 *
-		 * @returns	true if success else false.
+		 * @returns	true if success (sent or queued) else false.
 		 */
 		bool send( const char * buffer, int size );
 
+		/**
+		 * @brief 	Send the bytes queued by send() until everything is sent or the connection would block.
+		 *
+		 * @returns	true if success (even if some bytes are still queued) else false.
+		 */
+		bool flush();
+
+		/**
+		 * @brief 	get the number of bytes queued by send() and not yet sent.
+		 *
+		 * @returns	Number of bytes waiting for flush().
+		 */
+		Size getPendingOutputSize() const;
+
 		/**
 		 * @brief 	Send data to an address
 		 *
@@ -251,6 +267,30 @@ namespace Network {
 		 */
 		bool isConnected() const;
 
+		/**
+		 * @brief 	Retrieve if the connection is listening for TCP clients.
+		 *
+		 * @returns	if listening or not.
+		 */
+		bool isListening() const;
+
+		/**
+		 * @brief 	Set the connection blocking or non-blocking.
+		 * 			On a non-blocking connection, accept() and receive() return immediately and isWouldBlock() tells if nothing was available.
+		 *
+		 * @param 	blocking	True to make the calls blocking (default), false otherwise.
+		 *
+		 * @returns	true if success else false.
+		 */
+		bool setBlocking( bool blocking );
+
+		/**
+		 * @brief 	Retrieve if the last failed socket call only failed because it would have blocked (non-blocking connections).
+		 *
+		 * @returns	True if the last error is a "would block" one.
+		 */
+		static bool isWouldBlock();
+
 		/**
 		 * @brief 	listen and return the Socket created
 		 *
@@ -358,10 +398,28 @@ namespace Network {
 		 */
 		bool _tryListen( AddrInfo * addrInfo, int maxClients );
 
+		/**
+		 * @brief 	Queue bytes to be sent by flush().
+		 *
+		 * @param 	buffer	Data buffer to be queued.
+		 * @param 	size  	size of the data buffer.
+		 */
+		void _queueOutput( const char * buffer, Size size );
+
+	#if defined (linux)
+		/** @brief	Flags of the TCP sends, a peer having closed the connection making them fail with EPIPE instead of raising SIGPIPE */
+		static constexpr int SendFlags = MSG_NOSIGNAL;
+	#else
+		static constexpr int SendFlags = 0;
+	#endif
+
 		/** @brief	The socket */
 		SOCKET mSocket;
 		/** @brief	True if actually listenning, False otherwise. */
 		bool mIsListening;
+		/** @brief	Bytes queued by send(), the ones before mPendingOutputI being already sent */
+		Vector<char> mPendingOutput;
+		Size mPendingOutputI;
 	};
 
 	using Connection = ConnectionT<int>;
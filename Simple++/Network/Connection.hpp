@@ -5,7 +5,8 @@ namespace Network {
 	ConnectionT<T>::ConnectionT( const Address& address ) :
 		Address( address ),
 		mSocket( SOCKET( -1 ) ),
-		mIsListening( false ) {
+		mIsListening( false ),
+		mPendingOutputI( 0 ) {
 
 	}
 	/*
@@ -28,7 +29,8 @@ namespace Network {
 	}*/
 
 	template<typename T>
-	ConnectionT<T>::ConnectionT( ctor ) : Address( ctor::null ) {
+	ConnectionT<T>::ConnectionT( ctor ) : Address( ctor::null ),
+		mPendingOutputI( 0 ) {
 
 	}
 
@@ -60,7 +62,8 @@ namespace Network {
 	ConnectionT<T>::ConnectionT() :
 		Address( ctor::null ),
 		mSocket( SOCKET( -1 ) ),
-		mIsListening( false ) {
+		mIsListening( false ),
+		mPendingOutputI( 0 ) {
 
 	}
 
@@ -429,6 +432,8 @@ namespace Network {
 		}
 
 		this -> mIsListening = false;
+		this -> mPendingOutput.clear();
+		this -> mPendingOutputI = Size( 0 );
 	}
 
 
@@ -437,9 +442,23 @@ namespace Network {
 	template<typename T>
 	bool ConnectionT<T>::send( const char* buffer, int size ) {
 		if ( getSockType() == SockType::TCP ) {
-			if ( ::send( this -> mSocket, buffer, size, 0 ) == SOCKET_ERROR ) {
-				ERROR_SPP( "Unable to send TCP data." );
-				return false;
+			// Nothing can be sent before the bytes already queued.
+			if ( getPendingOutputSize() > Size( 0 ) ) {
+				_queueOutput( buffer, Size( size ) );
+				return flush();
+			}
+			int nbSent( 0 );
+			while ( nbSent < size ) {
+				int amountSent( ::send( this -> mSocket, buffer + nbSent, size - nbSent, SendFlags ) );
+				if ( amountSent == SOCKET_ERROR ) {
+					if ( isWouldBlock() ) {
+						_queueOutput( buffer + nbSent, Size( size - nbSent ) );
+						return true;
+					}
+					ERROR_SPP( "Unable to send TCP data." );
+					return false;
+				}
+				nbSent += amountSent;
 			}
 		} else if ( getSockType() == SockType::UDP ) {
 			if ( ::sendto( this -> mSocket, buffer, size, 0, getSockAddr(), ( int ) getSockAddrLen() ) == SOCKET_ERROR ) {
@@ -450,6 +469,40 @@ namespace Network {
 		return true;
 	}
 
+	template<typename T>
+	bool ConnectionT<T>::flush() {
+		while ( this -> mPendingOutputI < this -> mPendingOutput.getSize() ) {
+			int amountSent( ::send( this -> mSocket, this -> mPendingOutput.getData() + this -> mPendingOutputI, int( this -> mPendingOutput.getSize() - this -> mPendingOutputI ), SendFlags ) );
+			if ( amountSent == SOCKET_ERROR ) {
+				if ( isWouldBlock() )
+					return true;
+				ERROR_SPP( "Unable to send TCP data." );
+				return false;
+			}
+			this -> mPendingOutputI += Size( amountSent );
+		}
+		this -> mPendingOutput.clear();
+		this -> mPendingOutputI = Size( 0 );
+		return true;
+	}
+
+	template<typename T>
+	Size ConnectionT<T>::getPendingOutputSize() const {
+		return this -> mPendingOutput.getSize() - this -> mPendingOutputI;
+	}
+
+	template<typename T>
+	void ConnectionT<T>::_queueOutput( const char* buffer, Size size ) {
+		// Drop the bytes already sent before growing the queue.
+		const Size pendingSize( getPendingOutputSize() );
+		if ( this -> mPendingOutputI > Size( 0 ) ) {
+			memmove( this -> mPendingOutput.getData(), this -> mPendingOutput.getData() + this -> mPendingOutputI, pendingSize );
+			this -> mPendingOutputI = Size( 0 );
+		}
+		this -> mPendingOutput.resize( pendingSize + size );
+		memcpy( this -> mPendingOutput.getData() + pendingSize, buffer, size );
+	}
+
 	template<typename T>
 	bool ConnectionT<T>::accept( ConnectionT<T>* clientSocket ) {
 		if ( !isConnected() ) {
@@ -471,7 +524,9 @@ namespace Network {
 		clientSocket -> ai_addrlen = sockLen;
 
 		if ( clientSock == INVALID_SOCKET ) {
-			ERROR_SPP( "Unable to accept new client" );
+			if ( !isWouldBlock() ) {
+				ERROR_SPP( "Unable to accept new client" );
+			}
 			return false;
 		}
 
@@ -492,12 +547,55 @@ namespace Network {
 		return this -> mSocket;
 	}
 
+	template<typename T>
+	bool ConnectionT<T>::isListening() const {
+		return this -> mIsListening;
+	}
+
+	template<typename T>
+	bool ConnectionT<T>::setBlocking( bool blocking ) {
+		if ( !isConnected() ) {
+			ERROR_SPP( "Socket not binded." );
+			return false;
+		}
+	#if defined WIN32
+		u_long nonBlocking( blocking ? 0 : 1 );
+		if ( ::ioctlsocket( this -> mSocket, FIONBIO, &nonBlocking ) == SOCKET_ERROR ) {
+			ERROR_SPP( "Unable to change the blocking mode of the socket." );
+			return false;
+		}
+	#else
+		int flags( ::fcntl( this -> mSocket, F_GETFL, 0 ) );
+		if ( flags == -1 ) {
+			ERROR_SPP( "Unable to retrieve the flags of the socket." );
+			return false;
+		}
+		flags = blocking ? ( flags & ~O_NONBLOCK ) : ( flags | O_NONBLOCK );
+		if ( ::fcntl( this -> mSocket, F_SETFL, flags ) == -1 ) {
+			ERROR_SPP( "Unable to change the blocking mode of the socket." );
+			return false;
+		}
+	#endif
+		return true;
+	}
+
+	template<typename T>
+	bool ConnectionT<T>::isWouldBlock() {
+	#if defined WIN32
+		return WSAGetLastError() == WSAEWOULDBLOCK;
+	#else
+		return errno == EAGAIN || errno == EWOULDBLOCK;
+	#endif
+	}
+
 	template<typename T>
 	int ConnectionT<T>::receive( char* buffer, int maxSize ) {
 		int amountRead = ::recv( this -> mSocket, buffer, maxSize, 0 );
 		if ( amountRead < 0 ) {
 			if ( amountRead == SOCKET_ERROR ) {
-				ERROR_SPP( "Error while receiving !" );
+				if ( !isWouldBlock() ) {
+					ERROR_SPP( "Error while receiving !" );
+				}
 				return amountRead;
 			}
 			return 0;
@@ -526,6 +624,9 @@ namespace Network {
 		Address::operator=( Utility::toRValue( socket ) );
 		this -> mSocket = Utility::toRValue( socket.mSocket );
 		this -> mIsListening = Utility::toRValue( socket.mIsListening );
+		this -> mPendingOutput = Utility::toRValue( socket.mPendingOutput );
+		this -> mPendingOutputI = socket.mPendingOutputI;
+		socket.mPendingOutputI = Size( 0 );
 		return *this;
 	}
 
@@ -3,16 +3,19 @@
 #include "../ParamContainer.h"
 #include "Url.h"
 #include "TLSConnection.h"
+#include "HTTPConnectionPool.h"
 #include "HTTPRequest.h"
 #include "HTTPResponse.h"
 
 namespace Network {
 
+	///@brief HTTP/1.1 client. The connections are borrowed from a HTTPConnectionPoolT and kept alive between the queries.
+	///			A client is used by one thread at a time, several clients (one per thread) can share the same pool.
 	template<typename T>
 	class HTTPClientT {
 	public:
-		HTTPClientT( const UrlT<T>& url, const Size bufferSize = Size( 8388608 ) );
-		HTTPClientT( typename UrlT<T>::Sheme type, const StringASCII& hostname, const Size bufferSize = Size( 8388608 ) );
+		HTTPClientT( const UrlT<T>& url, const Size bufferSize = Size( 8388608 ), HTTPConnectionPoolT<T>* connectionPool = NULL );
+		HTTPClientT( typename UrlT<T>::Sheme type, const StringASCII& hostname, const Size bufferSize = Size( 8388608 ), HTTPConnectionPoolT<T>* connectionPool = NULL );
 		~HTTPClientT();
 
 		HTTPParam* setHeaderParam( const StringASCII& paramName, const StringASCII& paramValue );
@@ -22,6 +25,13 @@ namespace Network {
 		HTTPResponseT<T>* query( const HTTPRequestT<T>& request, int verbose = 0 );
 		HTTPResponseT<T>* query( const HTTPRequestT<T>* request, int verbose = 0 );
 
+		///@brief Send several requests to the same host on one connection without waiting for the responses (HTTP/1.1 pipelining), then read the responses in order.
+		///@param requestVector Requests to be sent, all to the same host.
+		///@param responseVector Responses to be filled, one per request.
+		///@param verbose Verbosity.
+		///@return True if every response has been received, False otherwise.
+		bool queryPipelined( const Vector<const HTTPRequestT<T>*>& requestVector, const Vector<HTTPResponseT<T>*>& responseVector, int verbose = 0 );
+
 		HTTPResponseT<T>* GET( const StringASCII& path, const Vector<HTTPParam>& urlParamVector, int verbose = 0 );
 		HTTPResponseT<T>* POST( const StringASCII& path, const Vector<HTTPParam>& urlParamVector, typename HTTPQueryT<T>::ContentType contentType, const StringASCII& contentStr = StringASCII::null, int verbose = 0);
 		HTTPResponseT<T>* PUT( const StringASCII& path, const Vector<HTTPParam>& urlParamVector, typename HTTPQueryT<T>::ContentType contentType, const StringASCII& contentStr = StringASCII::null, int verbose = 0 );
@@ -30,14 +40,32 @@ namespace Network {
 
 		const HTTPResponseT<T>* getLastResponse() const;
 
+		///@brief Get the pool where the connections of this client are borrowed.
+		///@return Connection pool.
+		HTTPConnectionPoolT<T>* getConnectionPool() const;
+
 	private:
+		enum class ReceiveResult : unsigned char {
+			Success,
+			Closed,
+			Failure
+		};
+
 		HTTPResponseT<T>* _query( const typename HTTPRequestT<T>& request, int verbose = 0 );
 
+		///@brief Send the content of sendBuffer (nbResponses formatted requests) to the host of url and receive the responses.
+		///@param bIdempotent If every request is idempotent, they are then sent again once if a kept alive connection has been closed by the server.
+		bool _exchange( const UrlT<T>& url, HTTPResponseT<T>* const* responses, Size nbResponses, bool bIdempotent, int verbose = 0 );
+
+		///@brief Receive one response, keeping what is received after it inside the connection for the next one.
+		///			A response without Content-Length (chunked or delimited by the close) set bKeepAlive to false, it's connection can't be reused.
+		///@return Closed if the connection was closed before anything has been received.
+		ReceiveResult _receiveResponse( typename HTTPConnectionPoolT<T>::PooledConnection* connection, HTTPResponseT<T>* response, bool* bKeepAlive, int verbose = 0 );
+
 		HTTPRequestT<T> request;
 		HTTPResponseT<T> response;
 
-		TLSConnectionT<T> connection;
-		bool bWasConnected;
+		HTTPConnectionPoolT<T>* connectionPool;
 
 		StringASCII sendBuffer;
 		char* receiveBuffer{ NULL };
@@ -3,16 +3,16 @@ namespace Network {
 
 
 	template<typename T>
-	inline HTTPClientT<T>::HTTPClientT( typename UrlT<T>::Sheme sheme, const StringASCII& hostname, const Size bufferSize ) :
+	inline HTTPClientT<T>::HTTPClientT( typename UrlT<T>::Sheme sheme, const StringASCII& hostname, const Size bufferSize, HTTPConnectionPoolT<T>* connectionPool ) :
 		request( HTTPRequestT<T>::Verb::Unknown, sheme, hostname ),
-		bWasConnected( false ),
+		connectionPool( connectionPool ? connectionPool : &HTTPConnectionPoolT<T>::getDefault() ),
 		receiveBuffer( new char[ bufferSize ] ),
 		bufferSize( bufferSize ) { }
 
 	template<typename T>
-	inline HTTPClientT<T>::HTTPClientT( const UrlT<T>& url, const Size bufferSize ) :
+	inline HTTPClientT<T>::HTTPClientT( const UrlT<T>& url, const Size bufferSize, HTTPConnectionPoolT<T>* connectionPool ) :
 		request( HTTPRequestT<T>::Verb::Unknown, url ),
-		bWasConnected( false ),
+		connectionPool( connectionPool ? connectionPool : &HTTPConnectionPoolT<T>::getDefault() ),
 		receiveBuffer( new char[ bufferSize ] ),
 		bufferSize( bufferSize ) { }
 
@@ -53,6 +53,37 @@ namespace Network {
 		return _query( *request, verbose );
 	}
 
+	template<typename T>
+	inline bool HTTPClientT<T>::queryPipelined( const Vector<const HTTPRequestT<T>*>& requestVector, const Vector<HTTPResponseT<T>*>& responseVector, int verbose ) {
+		if ( requestVector.getSize() == Size( 0 ) || requestVector.getSize() != responseVector.getSize() ) {
+			return false;
+		}
+		const UrlT<T>& url( requestVector[ 0 ]->getUrl() );
+
+		if ( verbose > 0 ) { Log::startStep( "HTTPClient::queryPipelined", String::format( "Sending % queries to %...", requestVector.getSize(), url.getHostname() ) ); }
+
+		// Every request is sent at once, the responses are read in the same order.
+		this->sendBuffer.clear();
+		bool bIdempotent( true );
+		for ( Size i( 0 ); i < requestVector.getSize(); i++ ) {
+			const HTTPRequestT<T>* request( requestVector[ i ] );
+			if ( request->getUrl().getSheme() != url.getSheme() || request->getUrl().getHostname() != url.getHostname() ) {
+				if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::queryPipelined", "Every request has to be sent to the same host." ); }
+				return false;
+			}
+			request->formatQuery( &this->sendBuffer );
+			bIdempotent = bIdempotent && HTTPRequestT<T>::isIdempotent( request->getVerb() );
+		}
+
+		if ( !_exchange( url, responseVector.getData(), responseVector.getSize(), bIdempotent, verbose ) ) {
+			if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::queryPipelined", "Failed." ); }
+			return false;
+		}
+
+		if ( verbose > 0 ) { Log::endStepSuccess( "HTTPClient::queryPipelined", String::format( "Success." ) ); }
+		return true;
+	}
+
 	template<typename T>
 	inline HTTPResponseT<T>* HTTPClientT<T>::GET( const StringASCII& path, const Vector<HTTPParam>& urlParamVector, int verbose ) {
 		this->request.setVerb( HTTPRequestT<T>::Verb::GET );
@@ -100,105 +131,187 @@ namespace Network {
 		return &this->response;
 	}
 
+	template<typename T>
+	inline HTTPConnectionPoolT<T>* HTTPClientT<T>::getConnectionPool() const {
+		return this->connectionPool;
+	}
+
 	template<typename T>
 	inline HTTPResponseT<T>* HTTPClientT<T>::_query( const typename HTTPRequestT<T>& request, int verbose ) {
 
 		if ( verbose > 0 ) { Log::startStep( "HTTPClient::query", String::format( "Sending: %...", request.getUrl().formatWOParams()) ); }
 
-		if ( request.getUrl().getSheme() == UrlT<T>::Sheme::HTTPS ) {
+		if ( request.getUrl().getSheme() == UrlT<T>::Sheme::HTTPS || request.getUrl().getSheme() == UrlT<T>::Sheme::HTTP ) {
 
 			this->sendBuffer.clear();
 			request.formatQuery( &this->sendBuffer );
 
-			// Try sending directly as we are in keep alive.
-			if ( !this->bWasConnected ) {
-				if ( !this->connection.connect( request.getUrl().getHostname(), unsigned short( 443 ), Network::SockType::TCP ) ) {
-					if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Failed to connect to %.", request.getUrl().getHostname() ) ); }
-					return NULL;
-				}
-				this->bWasConnected = true;
-			} else {
-				if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Already connected to %, skipping connection.", request.getUrl().getHostname() ) ); }
+			HTTPResponseT<T>* response( &this->response );
+			if ( !_exchange( request.getUrl(), &response, Size( 1 ), HTTPRequestT<T>::isIdempotent( request.getVerb() ), verbose ) ) {
+				if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", "Failed." ); }
+				return NULL;
 			}
 
-			if ( !this->connection.isConnected() || !this->connection.send( this->sendBuffer.toCString(), int( this->sendBuffer.getSize() ) ) ) {
-				if ( !this->connection.reconnect() ) {
-					if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Failed to reconnect to %.", request.getUrl().getHostname() ) ); }
-					return NULL;
-				}
-				if ( !this->connection.send( this->sendBuffer.toCString(), int( this->sendBuffer.getSize() ) ) ) {
-					if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Failed to send to %.", request.getUrl().getHostname() ) ); }
-					return NULL;
+			if ( verbose > 0 ) { Log::endStepSuccess( "HTTPClient::query", String::format( "Success." ) ); }
+
+			return &this->response;
+		} else {
+			if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Unsuported query type %.", UrlT<T>::getShemeStr( request.getUrl().getSheme() ) ) ); }
+			return NULL;
+		}
+
+
+	}
+
+	template<typename T>
+	inline bool HTTPClientT<T>::_exchange( const UrlT<T>& url, HTTPResponseT<T>* const* responses, Size nbResponses, bool bIdempotent, int verbose ) {
+		typename HTTPConnectionPoolT<T>::PooledConnection* connection( this->connectionPool->acquire( url.getSheme(), url.getHostname(), 0, verbose - 1 ) );
+		if ( !connection ) {
+			if ( verbose > 0 ) { Log::displayLog( "HTTPClient::query", String::format( "Failed to connect to %.", url.getHostname() ) ); }
+			return false;
+		}
+
+		bool bKeepAlive( true );
+		bool bSuccess( false );
+
+		// A kept alive connection may have been closed by the server meanwhile, it is then reconnected once.
+		// Only if the requests can be sent twice : the server may have processed them before closing.
+		bool bCanRetry( bIdempotent && connection->getNbQueries() > Size( 0 ) );
+		while ( true ) {
+			if ( !connection->send( this->sendBuffer.toCString(), int( this->sendBuffer.getSize() ) ) ) {
+				if ( bCanRetry && connection->connect() ) {
+					if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Keep-alive connection to % closed, reconnected.", url.getHostname() ) ); }
+					bCanRetry = false;
+					continue;
 				}
+				if ( verbose > 0 ) { Log::displayLog( "HTTPClient::query", String::format( "Failed to send to %.", url.getHostname() ) ); }
+				break;
 			}
 
-			int maxSizeReceive( int( this->bufferSize ) );
-			const StringASCII::ElemType* parseIt( this->receiveBuffer );
-			int totalReceivedLength( connection.receive( this->receiveBuffer, maxSizeReceive ) );
-
-			if ( totalReceivedLength <= int( 0 ) ) {
-				if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Received nothing." ) ); }
-				return NULL;
+			Size responseI( 0 );
+			ReceiveResult result( ReceiveResult::Success );
+			for ( ; responseI < nbResponses; responseI++ ) {
+				result = _receiveResponse( connection, responses[ responseI ], &bKeepAlive, verbose );
+				if ( result != ReceiveResult::Success ) {
+					break;
+				}
+				// Nothing can be read after a response which is not kept alive.
+				if ( !bKeepAlive && responseI + Size( 1 ) < nbResponses ) {
+					if ( verbose > 0 ) { Log::displayLog( "HTTPClient::query", String::format( "Response without Content-Length or closing the connection, the following ones can't be read." ) ); }
+					result = ReceiveResult::Failure;
+					break;
+				}
 			}
 
-			// We receive something, let's try parse the title and the header.
-			if ( !this->response.parseQueryTitle( &parseIt, StringASCII::IsEndIterator( this->receiveBuffer + totalReceivedLength ), verbose - 1 ) ) {
-				if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Failed to parse the title." ) ); }
-				return NULL;
+			if ( responseI == nbResponses ) {
+				connection->addNbQueries( nbResponses );
+				bSuccess = true;
+				break;
 			}
-			if ( !this->response.parseQueryHeader( &parseIt, StringASCII::IsEndIterator( this->receiveBuffer + totalReceivedLength ), verbose - 1 ) ) {
-				if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Failed to parse the header." ) ); }
-				return NULL;
+			if ( result == ReceiveResult::Closed && responseI == Size( 0 ) && bCanRetry && connection->connect() ) {
+				if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Keep-alive connection to % closed, reconnected.", url.getHostname() ) ); }
+				bCanRetry = false;
+				continue;
 			}
+			break;
+		}
 
-			// Now we have the title and the header. Let's check for the Content-Length.
-			static const StringASCII contentLengthParamName( "Content-Length" );
-			HTTPParam* contentSizeParam( this->response.getHeaderParam( contentLengthParamName ) );
+		this->connectionPool->release( connection, bSuccess && bKeepAlive );
+		return bSuccess;
+	}
 
+	template<typename T>
+	inline typename HTTPClientT<T>::ReceiveResult HTTPClientT<T>::_receiveResponse( typename HTTPConnectionPoolT<T>::PooledConnection* connection, HTTPResponseT<T>* response, bool* bKeepAlive, int verbose ) {
+		// Start with what has been received after the previous response.
+		Size totalReceivedLength( connection->pendingData.getSize() );
+		Utility::copy( this->receiveBuffer, connection->pendingData.toCString(), totalReceivedLength );
+		connection->pendingData.clear();
+
+		// Receive until the end of the header.
+		Size headerEndI( 0 );
+		while ( true ) {
+			for ( ; headerEndI + Size( 3 ) < totalReceivedLength; headerEndI++ ) {
+				if ( this->receiveBuffer[ headerEndI ] == '\r' && this->receiveBuffer[ headerEndI + 1 ] == '\n' && this->receiveBuffer[ headerEndI + 2 ] == '\r' && this->receiveBuffer[ headerEndI + 3 ] == '\n' ) {
+					break;
+				}
+			}
+			if ( headerEndI + Size( 3 ) < totalReceivedLength ) {
+				break;
+			}
+			if ( totalReceivedLength >= this->bufferSize ) {
+				if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Buffer overflow. The header is bigger than %.", this->bufferSize ) ); }
+				return ReceiveResult::Failure;
+			}
 
-			int contentLength;
-			if ( contentSizeParam ) {
-				contentLength = contentSizeParam->getValue().toInt();
-			} else {
-				contentLength = Size( 0 );
+			int receivedLength( connection->receive( this->receiveBuffer + totalReceivedLength, int( this->bufferSize - totalReceivedLength ) ) );
+			if ( receivedLength <= int( 0 ) ) {
+				if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Received nothing." ) ); }
+				return ( totalReceivedLength == Size( 0 ) ) ? ReceiveResult::Closed : ReceiveResult::Failure;
 			}
+			totalReceivedLength += Size( receivedLength );
+		}
 
-			if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Content-Length: %", contentLength ) ); }
+		// We receive the header, let's try parse the title and the header.
+		const StringASCII::ElemType* parseIt( this->receiveBuffer );
+		if ( !response->parseQueryTitle( &parseIt, StringASCII::IsEndIterator( this->receiveBuffer + totalReceivedLength ), verbose - 1 ) ) {
+			if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Failed to parse the title." ) ); }
+			return ReceiveResult::Failure;
+		}
+		if ( !response->parseQueryHeader( &parseIt, StringASCII::IsEndIterator( this->receiveBuffer + totalReceivedLength ), verbose - 1 ) ) {
+			if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Failed to parse the header." ) ); }
+			return ReceiveResult::Failure;
+		}
 
-			if ( contentLength > this->bufferSize ) {
-				if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Buffer overflow. Received % bytes but can store only %.", contentLength, this->bufferSize ) ); }
-				return NULL;
-			}
+		// Now we have the title and the header. Let's check for the Content-Length.
+		static const StringASCII contentLengthParamName( "Content-Length" );
+		static const StringASCII connectionParamName( "Connection" );
+		static const StringASCII connectionCloseStr( "close" );
+		HTTPParam* contentSizeParam( response->getHeaderParam( contentLengthParamName ) );
+		HTTPParam* connectionParam( response->getHeaderParam( connectionParamName ) );
 
-			maxSizeReceive = contentLength + static_cast< int >( parseIt - this->receiveBuffer );
+		if ( connectionParam && connectionParam->getValue() == connectionCloseStr ) {
+			*bKeepAlive = false;
+		}
 
-			while ( totalReceivedLength < maxSizeReceive ) {
-				int receivedLength( connection.receive( this->receiveBuffer + totalReceivedLength, maxSizeReceive - totalReceivedLength ) );
+		Size contentLength;
+		if ( contentSizeParam ) {
+			contentLength = Size( contentSizeParam->getValue().toULongLong() );
+		} else {
+			// Chunked or delimited by the close : the end of the body is unknown, whatever follows can't be the next response.
+			contentLength = Size( 0 );
+			*bKeepAlive = false;
+		}
 
-				if ( receivedLength <= int( 0 ) ) {
-					if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Received nothing." ) ); }
-					return NULL;
-				}
+		if ( verbose > 2 ) { Log::displayLog( "HTTPClient::query", String::format( "Content-Length: %", contentLength ) ); }
 
-				totalReceivedLength += receivedLength;
-			}
+		const Size responseEnd( Size( parseIt - this->receiveBuffer ) + contentLength );
+		if ( responseEnd > this->bufferSize ) {
+			if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Buffer overflow. Received % bytes but can store only %.", contentLength, this->bufferSize ) ); }
+			return ReceiveResult::Failure;
+		}
 
-			DEBUG_SPP( *( this->receiveBuffer + totalReceivedLength ) = StringASCII::ElemType( '\n' ) );
+		while ( totalReceivedLength < responseEnd ) {
+			int receivedLength( connection->receive( this->receiveBuffer + totalReceivedLength, int( this->bufferSize - totalReceivedLength ) ) );
 
-			if ( !this->response.parseQueryContent( &parseIt, StringASCII::IsEndIterator( this->receiveBuffer + totalReceivedLength ), verbose - 1 ) ) {
-				if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Failed to parse the content." ) ); }
-				return NULL;
+			if ( receivedLength <= int( 0 ) ) {
+				if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Received nothing." ) ); }
+				return ReceiveResult::Failure;
 			}
 
-			if ( verbose > 0 ) { Log::endStepSuccess( "HTTPClient::query", String::format( "Success." ) ); }
+			totalReceivedLength += Size( receivedLength );
+		}
 
-			return &this->response;
-		} else {
-			if ( verbose > 0 ) { Log::endStepFailure( "HTTPClient::query", String::format( "Unsuported query type %.", UrlT<T>::getShemeStr( request.getUrl().getSheme() ) ) ); }
-			return NULL;
+		if ( !response->parseQueryContent( &parseIt, StringASCII::IsEndIterator( this->receiveBuffer + responseEnd ), verbose - 1 ) ) {
+			if ( verbose > 1 ) { Log::displayLog( "HTTPClient::query", String::format( "Failed to parse the content." ) ); }
+			return ReceiveResult::Failure;
 		}
 
+		// Keep the beginning of the next pipelined response.
+		if ( *bKeepAlive && totalReceivedLength > responseEnd ) {
+			connection->pendingData = StringASCII( this->receiveBuffer + responseEnd, totalReceivedLength - responseEnd );
+		}
 
+		return ReceiveResult::Success;
 	}
 
 }
\ No newline at end of file
@@ -14,14 +14,16 @@
 namespace Network {
 
 	///@brief	Async version of the Client
+	///			The queries are handled by up to nbWorkers threads, each one with it's own HTTPClient sharing the same connection pool,
+	///			so the queries to the same host are sent concurrently on different keep-alive connections.
 	template<typename T>
-	class HTTPClientAsyncT : public Thread {
+	class HTTPClientAsyncT {
 	public:
-		HTTPClientAsyncT( typename UrlT<T>::Sheme type, const StringASCII & hostname, int verbose = 0 );
+		HTTPClientAsyncT( typename UrlT<T>::Sheme type, const StringASCII & hostname, int verbose = 0, Size nbWorkers = Size( 4 ), HTTPConnectionPoolT<T> * connectionPool = NULL );
 		~HTTPClientAsyncT();
 
 		///@brief	Add a new query to the stack to be handled.
-		///			The client will be automaticaly started to handle the query stack and stopped when needed.
+		///			The workers will be automaticaly started to handle the query stack and stopped when needed.
 		void addQuery( BasicQuery * query );
 
 		///@brief	If the client is running or in the process of starting.
@@ -30,29 +32,49 @@ namespace Network {
 		///@brief	Clear the whole qeue.
 		void clearQueue();
 
-		///@brief	Set a header param to the underlying HTTPClient.
+		///@brief	Set a header param to the underlying HTTPClients.
 		HTTPParam* setHeaderParam( const StringASCII & paramName, const StringASCII & paramValue );
 
 		///@brief	Wait the client to handle all the current stack.
 		void waitAllQueries();
 
+		///@brief	Get the number of threads handling the queries.
+		Size getNbWorkers() const;
+
 	protected:
-		virtual void run() override;
+		///@brief	Thread handling the queries with it's own HTTPClient.
+		class Worker : public Thread {
+		public:
+			Worker( HTTPClientAsyncT<T> * clientAsync, typename UrlT<T>::Sheme type, const StringASCII & hostname, HTTPConnectionPoolT<T> * connectionPool );
+
+			virtual void run() override;
+
+			HTTPClient httpClient;
+			///@brief	Lock the HTTPClient while a query is sent, only shared with setHeaderParam().
+			Mutex httpClientMutex;
+			///@brief	If the worker has been started and has not found the stack empty yet, guarded by queryMutex.
+			bool bActive;
+
+		private:
+			HTTPClientAsyncT<T> * clientAsync;
+		};
 
+		///@brief	Lock the header params while they are set on every worker.
 		Mutex httpClientMutex;
-		HTTPClient httpClient;
+		Vector<Worker *> workerVector;
 
 	private:
-		bool handleQueryList();
-		typename HTTPError sendQuery( BasicQuery * query, int verbose = 0 );
+		bool handleQueryList( Worker * worker );
+		typename HTTPError sendQuery( Worker * worker, BasicQuery * query, int verbose = 0 );
 
 		Time::Duration<Time::MilliSecond> errorWaitTime{ 1000 };
 
 		List<BasicQuery*> queryStack;
 
 		Mutex handlersMutex;
-		Mutex queryMutex;
+		mutable Mutex queryMutex;
 
+		Size nbActiveWorkers{ 0 };
 		bool bShouldStopMainLoop{ false };
 
 		int verbose{ 0 };
@@ -61,9 +83,30 @@ namespace Network {
 	using HTTPClientAsync = HTTPClientAsyncT<int>;
 
 	template<typename T>
-	inline HTTPClientAsyncT<T>::HTTPClientAsyncT( typename UrlT<T>::Sheme type, const StringASCII& hostname, int verbose ) :
-		httpClient( type, hostname ),
-		verbose( verbose ) { }
+	inline HTTPClientAsyncT<T>::Worker::Worker( HTTPClientAsyncT<T> * clientAsync, typename UrlT<T>::Sheme type, const StringASCII & hostname, HTTPConnectionPoolT<T> * connectionPool ) :
+		httpClient( type, hostname, Size( 8388608 ), connectionPool ),
+		bActive( false ),
+		clientAsync( clientAsync ) { }
+
+	template<typename T>
+	inline void HTTPClientAsyncT<T>::Worker::run() {
+		// If ended for any reason with remaning queries. Stop them.
+		if ( !this->clientAsync->handleQueryList( this ) ) {
+			this->clientAsync->clearQueue();
+		}
+	}
+
+	template<typename T>
+	inline HTTPClientAsyncT<T>::HTTPClientAsyncT( typename UrlT<T>::Sheme type, const StringASCII& hostname, int verbose, Size nbWorkers, HTTPConnectionPoolT<T> * connectionPool ) :
+		verbose( verbose ) {
+		nbWorkers = Math::max( nbWorkers, Size( 1 ) );
+		if ( !connectionPool ) {
+			connectionPool = &HTTPConnectionPoolT<T>::getDefault();
+		}
+		for ( Size i( 0 ); i < nbWorkers; i++ ) {
+			this->workerVector.push( new Worker( this, type, hostname, connectionPool ) );
+		}
+	}
 
 	template<typename T>
 	inline HTTPClientAsyncT<T>::~HTTPClientAsyncT() {
@@ -74,24 +117,42 @@ namespace Network {
 		}
 		this->queryMutex.unlock();
 
-		join();
+		for ( Size i( 0 ); i < this->workerVector.getSize(); i++ ) {
+			this->workerVector[ i ]->join();
+		}
 
 		clearQueue();
+
+		for ( Size i( 0 ); i < this->workerVector.getSize(); i++ ) {
+			delete this->workerVector[ i ];
+		}
 	}
 
 	template<typename T>
 	inline void HTTPClientAsyncT<T>::addQuery( BasicQuery* query ) {
-		bool bRunning( false );
+		Worker * workerToStart( NULL );
 		this->queryMutex.lock();
 		{
-			bRunning = this->queryStack.getSize() != Size( 0 );
 			this->queryStack.push( query );
+
+			// Start one more worker if there are more queries waiting than workers running.
+			if ( this->queryStack.getSize() > this->nbActiveWorkers && this->nbActiveWorkers < this->workerVector.getSize() ) {
+				for ( Size i( 0 ); i < this->workerVector.getSize(); i++ ) {
+					if ( !this->workerVector[ i ]->bActive ) {
+						workerToStart = this->workerVector[ i ];
+						workerToStart->bActive = true;
+						this->nbActiveWorkers++;
+						break;
+					}
+				}
+			}
 		}
 		this->queryMutex.unlock();
 
-		if ( !bRunning ) {
-			join();
-			start();
+		if ( workerToStart ) {
+			// The previous run of this worker may still be returning.
+			workerToStart->join();
+			workerToStart->start();
 		}
 	}
 
@@ -100,7 +161,7 @@ namespace Network {
 		bool bRunning( false );
 		this->queryMutex.lock();
 		{
-			bRunning = this->queryStack.getSize() != Size( 0 );
+			bRunning = this->queryStack.getSize() != Size( 0 ) || this->nbActiveWorkers != Size( 0 );
 		}
 		this->queryMutex.unlock();
 
@@ -124,7 +185,12 @@ namespace Network {
 		HTTPParam* httpParam( NULL );
 		this->httpClientMutex.lock();
 		{
-			httpParam = this->httpClient.setHeaderParam( paramName, paramValue );
+			for ( Size i( 0 ); i < this->workerVector.getSize(); i++ ) {
+				Worker * worker( this->workerVector[ i ] );
+				worker->httpClientMutex.lock();
+				httpParam = worker->httpClient.setHeaderParam( paramName, paramValue );
+				worker->httpClientMutex.unlock();
+			}
 		}
 		this->httpClientMutex.unlock();
 		return httpParam;
@@ -132,25 +198,26 @@ namespace Network {
 
 	template<typename T>
 	inline void HTTPClientAsyncT<T>::waitAllQueries() {
-		join();
+		for ( Size i( 0 ); i < this->workerVector.getSize(); i++ ) {
+			this->workerVector[ i ]->join();
+		}
 	}
 
 	template<typename T>
-	inline void HTTPClientAsyncT<T>::run() {
-		handleQueryList();
-
-		// If ended for any reason with remaning queries. Stop them.
-		clearQueue();
+	inline Size HTTPClientAsyncT<T>::getNbWorkers() const {
+		return this->workerVector.getSize();
 	}
 
 	template<typename T>
-	inline bool HTTPClientAsyncT<T>::handleQueryList() {
+	inline bool HTTPClientAsyncT<T>::handleQueryList( Worker * worker ) {
+		// For each message in the stack.
 		while ( true ) {
+			BasicQuery* query( NULL );
 			this->queryMutex.lock();
 			{
-
-				// If should stop.
 				if ( this->bShouldStopMainLoop ) {
+					worker->bActive = false;
+					this->nbActiveWorkers--;
 					this->queryMutex.unlock();
 					return false;
 				}
@@ -158,78 +225,69 @@ namespace Network {
 				if ( this->queryStack.getSize() == Size( 0 ) ) {
 
 					// If there are no queries to handle, exit.
+					worker->bActive = false;
+					this->nbActiveWorkers--;
 					this->queryMutex.unlock();
 					return true;
-				} else {
-					this->queryMutex.unlock();
 				}
+
+				query = this->queryStack.popBegin();
 			}
+			this->queryMutex.unlock();
 
-			// For each message in the stack.
-			while ( true ) {
-				BasicQuery* query( NULL );
-				this->queryMutex.lock();
-				{
+			HTTPError error( sendQuery( worker, query, this->verbose ) );
 
-					if ( this->bShouldStopMainLoop ) {
-						this->queryMutex.unlock();
-						break;
-					}
+			// If the query has failed.
+			if ( error != HTTPError::None ) {
 
-					if ( this->queryStack.getSize() == Size( 0 ) ) {
-						this->queryMutex.unlock();
-						break;
+				// If the query is set to auto retry on network error.
+				if ( ( error == HTTPError::NetworkException && query->isNetworkExceptionAutoRetry() ) || ( error == HTTPError::UnexpectedResponseException && query->isUnexpectedExceptionAutoRetry() ) ) {
+					// Push back the failed query to retry.
+					this->queryMutex.lock();
+					{
+						this->queryStack.pushBegin( query );
 					}
-
-					query = this->queryStack.popBegin();
 					this->queryMutex.unlock();
-				}
-
-				HTTPError error( sendQuery( query, this->verbose ) );
 
-				// If the query has failed.
-				if ( error != HTTPError::None ) {
+					// We had an error, wait for a bit before trying again.
+					Time::sleep( this->errorWaitTime );
 
-					// If the query is set to auto retry on network error.
-					if ( ( error == HTTPError::NetworkException && query->isNetworkExceptionAutoRetry() ) || ( error == HTTPError::UnexpectedResponseException && query->isUnexpectedExceptionAutoRetry() ) ) {
-						// Push back the failed query to retry.
-						this->queryMutex.lock();
-						{
-							this->queryStack.pushBegin( query );
-						}
-						this->queryMutex.unlock();
-
-						// We had an error, wait for a bit before trying again.
-						Time::sleep( this->errorWaitTime );
-
-						break;
-					}
+					continue;
+				}
 
-					return true;
+				// Stop the remaining queries.
+				this->queryMutex.lock();
+				{
+					worker->bActive = false;
+					this->nbActiveWorkers--;
 				}
+				this->queryMutex.unlock();
+				return false;
 			}
 		}
 
 	}
 	template<typename T>
-	inline typename HTTPError HTTPClientAsyncT<T>::sendQuery( BasicQuery* query, int verbose ) {
+	inline typename HTTPError HTTPClientAsyncT<T>::sendQuery( Worker * worker, BasicQuery* query, int verbose ) {
 		if ( verbose > 0 ) { Log::startStep( __func__, String::format( "Sendind % => %", query->getQueryMessage()->getName(), query->getResponseMessage()->getName() ) ); }
 
-		HTTPRequestT<T> request;
-
-		this->httpClientMutex.lock();
+		// Only this worker client is locked, the other workers keep sending.
+		worker->httpClientMutex.lock();
 		query->setMessageSent();
-		HTTPResponseT<T>* httpResponse( query->send( &this->httpClient, verbose - 1 ) );
-		this->httpClientMutex.unlock();
+		HTTPResponseT<T>* httpResponse( query->send( &worker->httpClient, verbose - 1 ) );
 
 		// Create the request from the message.
 		if ( !httpResponse ) {
+			worker->httpClientMutex.unlock();
 			query->setError( HTTPError::NetworkException );
 			if ( verbose > 0 ) { Log::endStepFailure( __func__, "NetworkException" ); }
 			return query->getError();
 		}
 
-		if ( typename HTTPError e( query->getResponseMessage()->fromResponse( httpResponse, verbose - 1 ) ); e != HTTPError::None ) {
+		// The response belongs to the worker client, it is read before the client is unlocked.
+		typename HTTPError e( query->getResponseMessage()->fromResponse( httpResponse, verbose - 1 ) );
+		worker->httpClientMutex.unlock();
+		if ( e != HTTPError::None ) {
 			query->setError( e );
 			if ( verbose > 0 ) { Log::endStepFailure( __func__, "Failed" ); }
 			return query->getError();
@@ -241,5 +299,4 @@ namespace Network {
 
 		return query->getError();
 	}
-}
-
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+///@file Network/HTTPConnectionPool.h
+///@brief Declares a pool of keep-alive HTTP connections, shared by the HTTPClientT.
+#pragma once
+
+#include <mutex>
+#include <condition_variable>
+
+#include "../HashMap.h"
+#include "../Vector.h"
+#include "../Time/Time.h"
+#include "Url.h"
+#include "Connection.h"
+#include "TLSConnection.h"
+
+namespace Network {
+
+	///@brief Pool of keep-alive connections, grouped by host (sheme, hostname and port).
+	///			A connection is borrowed with acquire() for a query (or a pipeline of queries) and given back with release().
+	///			The number of connections borrowed at the same time from a host is limited, acquire() waiting for one to be released when reached.
+	///			An idle connection unused for longer than the idle timeout is closed instead of being reused.
+	///			The pool is thread safe, the connections themselves are only used by the thread which borrowed them.
+	template<typename T>
+	class HTTPConnectionPoolT {
+	public:
+		///@brief Connection to a host, plain for HTTP or TLS for HTTPS.
+		class PooledConnection {
+		public:
+			///@brief Create a connection, not connected yet.
+			///@param sheme HTTP or HTTPS.
+			///@param hostname Host to connect to.
+			///@param port Port to connect to.
+			PooledConnection( typename UrlT<T>::Sheme sheme, const StringASCII & hostname, unsigned short port );
+
+			///@brief Destructor, close the connection.
+			~PooledConnection();
+
+			///@brief Connect (or reconnect) to the host.
+			///@return True if success, False otherwise.
+			bool connect();
+
+			///@brief Check if the connection is connected.
+			///@return True if connected, False otherwise.
+			bool isConnected() const;
+
+			///@brief Send a buffer.
+			///@param buffer Buffer to be sent.
+			///@param size Size of the buffer.
+			///@return True if success, False otherwise.
+			bool send( const char * buffer, int size );
+
+			///@brief Receive into a buffer.
+			///@param buffer Buffer to be filled.
+			///@param maxSize Maximum number of bytes to receive.
+			///@return Number of bytes received, 0 or less if failed.
+			int receive( char * buffer, int maxSize );
+
+			///@brief Close the connection.
+			void close();
+
+			///@brief Get the number of queries already sent on this connection since it's connection.
+			///@return Number of queries.
+			Size getNbQueries() const;
+
+			///@brief Increment the number of queries sent on this connection.
+			///@param nbQueries Number of queries sent.
+			void addNbQueries( Size nbQueries );
+
+			///@brief Bytes already received after the end of the last response read (beginning of the next pipelined one).
+			StringASCII pendingData;
+
+		private:
+			friend class HTTPConnectionPoolT<T>;
+
+			typename UrlT<T>::Sheme sheme;
+			StringASCII hostname;
+			unsigned short port;
+
+			ConnectionT<T> connection;
+			TLSConnectionT<T> tlsConnection;
+			bool bConnected;
+			Size nbQueries;
+
+			Time::TimePointMS lastUsedTimePoint;
+		};
+
+		///@brief Constructor.
+		///@param maxConnectionsPerHost Maximum number of connections borrowed at the same time from a host.
+		///@param idleTimeout Duration after which an idle connection is closed instead of reused.
+		HTTPConnectionPoolT( Size maxConnectionsPerHost = Size( 8 ), const Time::Duration<Time::MilliSecond> & idleTimeout = Time::Duration<Time::MilliSecond>( 30000 ) );
+
+		///@brief Destructor, close every idle connection. Every connection has to be released before.
+		~HTTPConnectionPoolT();
+
+		///@brief Borrow a connected connection to a host, an idle one if any (waiting if the host limit is reached).
+		///@param sheme HTTP or HTTPS.
+		///@param hostname Host to connect to.
+		///@param port Port to connect to (0 for the default of the sheme).
+		///@param verbose Verbosity.
+		///@return Connection to be given back with release(), NULL if the connection failed.
+		PooledConnection * acquire( typename UrlT<T>::Sheme sheme, const StringASCII & hostname, unsigned short port = 0, int verbose = 0 );
+
+		///@brief Give back a connection borrowed with acquire().
+		///@param connection Connection to give back.
+		///@param bKeepAlive True to keep it for the next queries, False to close it.
+		void release( PooledConnection * connection, bool bKeepAlive );
+
+		///@brief Close every idle connection unused for longer than the idle timeout.
+		void closeIdle();
+
+		///@brief Close every idle connection.
+		void clear();
+
+		///@brief Set the maximum number of connections borrowed at the same time from a host.
+		///@param maxConnectionsPerHost Maximum number of connections (at least 1).
+		void setMaxConnectionsPerHost( Size maxConnectionsPerHost );
+
+		///@brief Get the maximum number of connections borrowed at the same time from a host.
+		///@return Maximum number of connections.
+		Size getMaxConnectionsPerHost() const;
+
+		///@brief Set the duration after which an idle connection is closed instead of reused.
+		///@param idleTimeout Idle timeout.
+		void setIdleTimeout( const Time::Duration<Time::MilliSecond> & idleTimeout );
+
+		///@brief Get the duration after which an idle connection is closed instead of reused.
+		///@return Idle timeout.
+		const Time::Duration<Time::MilliSecond> & getIdleTimeout() const;
+
+		///@brief Get the pool shared by every HTTPClientT created without one.
+		///@return Shared pool.
+		static HTTPConnectionPoolT<T> & getDefault();
+
+	private:
+		HTTPConnectionPoolT( const HTTPConnectionPoolT<T> & pool );
+		HTTPConnectionPoolT<T> & operator=( const HTTPConnectionPoolT<T> & pool );
+
+		///@brief Connections of one host.
+		struct HostPool {
+			///@brief Idle connections, the last released at the end.
+			Vector<PooledConnection *> idleVector;
+			///@brief Number of connections currently borrowed.
+			Size nbBorrowed;
+		};
+
+		///@brief Remove the idle connections of a host unused for longer than the idle timeout, mutex locked.
+		///@param expiredVector Vector where the removed connections are pushed, to be deleted (closed) once the mutex unlocked.
+		void _closeIdle( HostPool * hostPool, const Time::TimePointMS & timePointNow, Vector<PooledConnection *> * expiredVector );
+
+		///@brief Delete (close) connections removed from the pool, outside of the lock as a TLS close may have to talk to the server.
+		static void _deleteConnections( const Vector<PooledConnection *> & connectionVector );
+
+		static StringASCII _getHostKey( typename UrlT<T>::Sheme sheme, const StringASCII & hostname, unsigned short port );
+
+		std::mutex mutex;
+		std::condition_variable releaseCondition;
+
+		HashMap<StringASCII, HostPool *> hostMap;
+
+		Size maxConnectionsPerHost;
+		Time::Duration<Time::MilliSecond> idleTimeout;
+	};
+
+	using HTTPConnectionPool = HTTPConnectionPoolT<int>;
+
+}
+
+#include "HTTPConnectionPool.hpp"
@@ -0,0 +1,270 @@
+namespace Network {
+
+	template<typename T>
+	inline HTTPConnectionPoolT<T>::PooledConnection::PooledConnection( typename UrlT<T>::Sheme sheme, const StringASCII & hostname, unsigned short port ) :
+		sheme( sheme ),
+		hostname( hostname ),
+		port( port ),
+		bConnected( false ),
+		nbQueries( 0 ) { }
+
+	template<typename T>
+	inline HTTPConnectionPoolT<T>::PooledConnection::~PooledConnection() {
+		close();
+	}
+
+	template<typename T>
+	inline bool HTTPConnectionPoolT<T>::PooledConnection::connect() {
+		close();
+
+		if ( this->sheme == UrlT<T>::Sheme::HTTPS ) {
+			this->bConnected = this->tlsConnection.connect( this->hostname, this->port, Network::SockType::TCP );
+		} else {
+			this->bConnected = this->connection.connect( this->hostname, this->port, Network::SockType::TCP );
+		}
+		return this->bConnected;
+	}
+
+	template<typename T>
+	inline bool HTTPConnectionPoolT<T>::PooledConnection::isConnected() const {
+		if ( !this->bConnected ) {
+			return false;
+		}
+		if ( this->sheme == UrlT<T>::Sheme::HTTPS ) {
+			return this->tlsConnection.isConnected();
+		} else {
+			return this->connection.isConnected();
+		}
+	}
+
+	template<typename T>
+	inline bool HTTPConnectionPoolT<T>::PooledConnection::send( const char * buffer, int size ) {
+		if ( this->sheme == UrlT<T>::Sheme::HTTPS ) {
+			return this->tlsConnection.send( buffer, size );
+		} else {
+			return this->connection.send( buffer, size );
+		}
+	}
+
+	template<typename T>
+	inline int HTTPConnectionPoolT<T>::PooledConnection::receive( char * buffer, int maxSize ) {
+		if ( this->sheme == UrlT<T>::Sheme::HTTPS ) {
+			return this->tlsConnection.receive( buffer, maxSize );
+		} else {
+			return this->connection.receive( buffer, maxSize );
+		}
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::PooledConnection::close() {
+		if ( this->bConnected ) {
+			if ( this->sheme == UrlT<T>::Sheme::HTTPS ) {
+				this->tlsConnection.close();
+			} else {
+				this->connection.close();
+			}
+			this->bConnected = false;
+		}
+		this->nbQueries = Size( 0 );
+		this->pendingData.clear();
+	}
+
+	template<typename T>
+	inline Size HTTPConnectionPoolT<T>::PooledConnection::getNbQueries() const {
+		return this->nbQueries;
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::PooledConnection::addNbQueries( Size nbQueries ) {
+		this->nbQueries += nbQueries;
+	}
+
+	template<typename T>
+	inline HTTPConnectionPoolT<T>::HTTPConnectionPoolT( Size maxConnectionsPerHost, const Time::Duration<Time::MilliSecond> & idleTimeout ) :
+		maxConnectionsPerHost( Math::max( maxConnectionsPerHost, Size( 1 ) ) ),
+		idleTimeout( idleTimeout ) { }
+
+	template<typename T>
+	inline HTTPConnectionPoolT<T>::~HTTPConnectionPoolT() {
+		clear();
+		for ( auto it( this->hostMap.getBegin() ); it != this->hostMap.getEnd(); this->hostMap.iterate( &it ) ) {
+			delete this->hostMap.getValueIt( it );
+		}
+	}
+
+	template<typename T>
+	inline typename HTTPConnectionPoolT<T>::PooledConnection * HTTPConnectionPoolT<T>::acquire( typename UrlT<T>::Sheme sheme, const StringASCII & hostname, unsigned short port, int verbose ) {
+		if ( port == 0 ) {
+			port = ( sheme == UrlT<T>::Sheme::HTTPS ) ? 443 : 80;
+		}
+		const StringASCII hostKey( _getHostKey( sheme, hostname, port ) );
+
+		PooledConnection * pooledConnection( NULL );
+		HostPool * hostPool;
+		Vector<PooledConnection *> expiredVector;
+		{
+			std::unique_lock<std::mutex> lock( this->mutex );
+
+			HostPool ** hostPoolP( this->hostMap[ hostKey ] );
+			if ( hostPoolP ) {
+				hostPool = *hostPoolP;
+			} else {
+				hostPool = new HostPool();
+				hostPool->nbBorrowed = Size( 0 );
+				this->hostMap.insert( hostKey, hostPool );
+			}
+
+			// Wait for a connection to be released if the host limit is reached.
+			while ( hostPool->nbBorrowed >= this->maxConnectionsPerHost ) {
+				this->releaseCondition.wait( lock );
+			}
+			hostPool->nbBorrowed++;
+
+			_closeIdle( hostPool, Time::getTime<Time::MilliSecond>(), &expiredVector );
+
+			// Reuse the last released, the most likely to be still open on the server side.
+			if ( hostPool->idleVector.getSize() ) {
+				pooledConnection = hostPool->idleVector.pop();
+			}
+		}
+		_deleteConnections( expiredVector );
+
+		if ( pooledConnection ) {
+			if ( verbose > 0 ) { Log::displayLog( "HTTPConnectionPool::acquire", String::format( "Reusing a keep-alive connection to % after % queries.", hostKey, pooledConnection->getNbQueries() ) ); }
+			return pooledConnection;
+		}
+
+		// Connect outside of the lock, the other hosts don't have to wait for it.
+		pooledConnection = new PooledConnection( sheme, hostname, port );
+		if ( !pooledConnection->connect() ) {
+			if ( verbose > 0 ) { Log::displayLog( "HTTPConnectionPool::acquire", String::format( "Failed to connect to %.", hostKey ) ); }
+			release( pooledConnection, false );
+			return NULL;
+		}
+		if ( verbose > 0 ) { Log::displayLog( "HTTPConnectionPool::acquire", String::format( "New connection to %.", hostKey ) ); }
+		return pooledConnection;
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::release( PooledConnection * pooledConnection, bool bKeepAlive ) {
+		const StringASCII hostKey( _getHostKey( pooledConnection->sheme, pooledConnection->hostname, pooledConnection->port ) );
+
+		if ( !bKeepAlive || !pooledConnection->isConnected() ) {
+			delete pooledConnection;
+			pooledConnection = NULL;
+		} else {
+			pooledConnection->lastUsedTimePoint = Time::getTime<Time::MilliSecond>();
+		}
+
+		{
+			std::unique_lock<std::mutex> lock( this->mutex );
+
+			HostPool * hostPool( *( this->hostMap[ hostKey ] ) );
+			hostPool->nbBorrowed--;
+			if ( pooledConnection ) {
+				hostPool->idleVector.push( pooledConnection );
+			}
+		}
+		this->releaseCondition.notify_all();
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::closeIdle() {
+		Vector<PooledConnection *> expiredVector;
+		{
+			std::unique_lock<std::mutex> lock( this->mutex );
+
+			const Time::TimePointMS timePointNow( Time::getTime<Time::MilliSecond>() );
+			for ( auto it( this->hostMap.getBegin() ); it != this->hostMap.getEnd(); this->hostMap.iterate( &it ) ) {
+				_closeIdle( this->hostMap.getValueIt( it ), timePointNow, &expiredVector );
+			}
+		}
+		_deleteConnections( expiredVector );
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::clear() {
+		Vector<PooledConnection *> idleVector;
+		{
+			std::unique_lock<std::mutex> lock( this->mutex );
+
+			for ( auto it( this->hostMap.getBegin() ); it != this->hostMap.getEnd(); this->hostMap.iterate( &it ) ) {
+				HostPool * hostPool( this->hostMap.getValueIt( it ) );
+				for ( Size i( 0 ); i < hostPool->idleVector.getSize(); i++ ) {
+					idleVector.push( hostPool->idleVector[ i ] );
+				}
+				hostPool->idleVector.clear();
+			}
+		}
+		_deleteConnections( idleVector );
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::setMaxConnectionsPerHost( Size maxConnectionsPerHost ) {
+		{
+			std::unique_lock<std::mutex> lock( this->mutex );
+			this->maxConnectionsPerHost = Math::max( maxConnectionsPerHost, Size( 1 ) );
+		}
+		this->releaseCondition.notify_all();
+	}
+
+	template<typename T>
+	inline Size HTTPConnectionPoolT<T>::getMaxConnectionsPerHost() const {
+		return this->maxConnectionsPerHost;
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::setIdleTimeout( const Time::Duration<Time::MilliSecond> & idleTimeout ) {
+		std::unique_lock<std::mutex> lock( this->mutex );
+		this->idleTimeout = idleTimeout;
+	}
+
+	template<typename T>
+	inline const Time::Duration<Time::MilliSecond> & HTTPConnectionPoolT<T>::getIdleTimeout() const {
+		return this->idleTimeout;
+	}
+
+	template<typename T>
+	inline HTTPConnectionPoolT<T> & HTTPConnectionPoolT<T>::getDefault() {
+		static HTTPConnectionPoolT<T> defaultPool;
+		return defaultPool;
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::_closeIdle( HostPool * hostPool, const Time::TimePointMS & timePointNow, Vector<PooledConnection *> * expiredVector ) {
+		// The idle connections are sorted by release time, the oldest first.
+		Size nbExpired( 0 );
+		while ( nbExpired < hostPool->idleVector.getSize() ) {
+			const Time::Duration<Time::MilliSecond> idleDuration( timePointNow - hostPool->idleVector[ nbExpired ]->lastUsedTimePoint );
+			if ( !( idleDuration > this->idleTimeout ) ) {
+				break;
+			}
+			expiredVector->push( hostPool->idleVector[ nbExpired ] );
+			nbExpired++;
+		}
+		if ( nbExpired ) {
+			for ( Size i( nbExpired ); i < hostPool->idleVector.getSize(); i++ ) {
+				hostPool->idleVector[ i - nbExpired ] = hostPool->idleVector[ i ];
+			}
+			hostPool->idleVector.resize( hostPool->idleVector.getSize() - nbExpired );
+		}
+	}
+
+	template<typename T>
+	inline void HTTPConnectionPoolT<T>::_deleteConnections( const Vector<PooledConnection *> & connectionVector ) {
+		for ( Size i( 0 ); i < connectionVector.getSize(); i++ ) {
+			delete connectionVector[ i ];
+		}
+	}
+
+	template<typename T>
+	inline StringASCII HTTPConnectionPoolT<T>::_getHostKey( typename UrlT<T>::Sheme sheme, const StringASCII & hostname, unsigned short port ) {
+		StringASCII hostKey( UrlT<T>::getShemeStr( sheme ) );
+		hostKey << StringASCII::ElemType( ':' );
+		hostKey << hostname;
+		hostKey << StringASCII::ElemType( ':' );
+		hostKey << port;
+		return hostKey;
+	}
+
+}
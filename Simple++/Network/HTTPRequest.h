@@ -55,6 +55,11 @@ namespace Network {
 		static const StringASCII& getVerbStr( typename HTTPRequestT<T>::Verb verb );
 		static typename HTTPRequestT<T>::Verb getVerb( const StringASCII& verbStr );
 
+		///@brief Check if sending a request twice has the same effect than sending it once (it can then be retried).
+		///@param verb Verb of the request.
+		///@return True if idempotent, False otherwise.
+		static bool isIdempotent( typename HTTPRequestT<T>::Verb verb );
+
 		static const StringASCII verbStrTable[];
 
 	protected:
@@ -219,6 +219,11 @@ namespace Network {
 		return HTTPRequestT<T>::Verb::Unknown;
 	}
 
+	template<typename T>
+	inline bool HTTPRequestT<T>::isIdempotent( typename HTTPRequestT<T>::Verb verb ) {
+		return verb == Verb::GET || verb == Verb::PUT || verb == Verb::DEL;
+	}
+
 	template<typename T>
 	inline void HTTPRequestT<T>::formatQueryTitle( StringASCII* outputStr ) const {
 		StringASCII& str( *outputStr );
@@ -12,15 +12,28 @@
 #include "BasicNetwork.h"
 #include "Connection.h"
 #include "../Vector.h"
+#include "../HashMap.h"
 #include "../Math/Math.h"
+#include "../Time/TimePoint.h"
 
  /** @brief	. */
 namespace Network {
 
-	/** @brief	Represent a listening server who can handle multiple protocol or ip family */
+	/**
+	 * @brief	Represent a listening server who can handle multiple protocol or ip family.
+	 * 			Two ways of using it :
+	 * 				- Blocking : accept() or receive() one client/message at a time.
+	 * 				- Reactor : poll() accept the clients itself, keep them and call back when they are readable/writable.
+	 * 			On linux the reactor is backed by epoll (edge-triggered for the clients), with a select() fallback elsewhere.
+	 */
 	template<typename T>
 	class ServerT {
 	public:
+		/** @brief	Maximum number of events retrieved by one call to the system. */
+		static constexpr int EventBufferSize = 256;
+		/** @brief	Time during which the listeners are not watched after an accept() failing for lack of resources (EMFILE...), in milliseconds. */
+		static constexpr int AcceptBackOffMs = 100;
+
 		/** @brief	Create a new ServerT<T>. */
 		ServerT();
 
@@ -116,7 +129,82 @@ namespace Network {
 		 */
 		int receive( char * buffer, int maxSize, Address * addressFrom );
 
+		/**
+		 * @brief 	Wait for events on the listening connections and the clients and dispatch them.
+		 * 			New TCP clients are accepted without blocking, set non-blocking and kept by the server.
+		 * 			The clients are watched edge-triggered : a callback is only called again once new data/space arrived,
+		 * 			so the readFunc has to receive() until isWouldBlock() and the writeFunc has to send() until full.
+		 * 			The bytes queued by a send() on a full client are flushed when it become writable again, the writeFunc being only called once nothing is left queued.
+		 * 			When a functor return false, the client is closed and deleted at the end of the call (do not use the pointer afterward).
+		 *
+		 * @param [in,out]	acceptFunc	Functor called for each new client : bool operator()( Connection * client );
+		 * @param [in,out]	readFunc  	Functor called when a client (or an UDP connection) is readable : bool operator()( Connection * client );
+		 * @param [in,out]	writeFunc 	Functor called when a client is writable : bool operator()( Connection * client );
+		 * 							  	(Only with epoll, the select() fallback only watch the readability.)
+		 * @param 		  	timeoutMs 	(Optional) Maximum time to wait in milliseconds, -1 to wait indefinitely.
+		 *
+		 * @returns	Number of events dispatched, -1 on error.
+		 */
+		template<typename AcceptFunc, typename ReadFunc, typename WriteFunc>
+		int poll( AcceptFunc & acceptFunc, ReadFunc & readFunc, WriteFunc & writeFunc, int timeoutMs = -1 );
+
+		/**
+		 * @brief 	Close and delete a client accepted by poll().
+		 * 			When called from a callback of poll(), the deletion is delayed until the end of the poll() (the other events of the batch for this client are skipped).
+		 *
+		 * @param [in,out]	client	Client to be closed.
+		 *
+		 * @returns	true if the client was owned by this server else false.
+		 */
+		bool closeClient( Connection * client );
+
+		/**
+		 * @brief 	get the number of clients accepted by poll() and still opened.
+		 *
+		 * @returns	Number of clients.
+		 */
+		Size getNumClients() const;
+
 	private:
+		/** @brief	Create the reactor if needed and register the listening connection into it */
+		bool _registerListener( Connection * connection );
+
+		/**
+		 * @brief 	Register a new client into the reactor.
+		 *
+		 * @param [in,out]	client	Client to register (the server take the ownership).
+		 *
+		 * @returns	True if it succeeds, false if it fails.
+		 */
+		bool _registerClient( Connection * client );
+
+		/**
+		 * @brief 	Accept every pending client of a listening connection.
+		 *
+		 * @param [in,out]	listener  	Listening connection.
+		 * @param [in,out]	acceptFunc	Functor called for each new client.
+		 */
+		template<typename AcceptFunc>
+		void _acceptAll( Connection * listener, AcceptFunc & acceptFunc );
+
+		/**
+		 * @brief 	Stop watching the listeners for AcceptBackOffMs, their pending clients can not be accepted for now
+		 * 			and they would be reported again at once (level-triggered), making poll() spin.
+		 */
+		void _pauseListeners();
+
+		/** @brief	Watch the listeners again if they were paused */
+		void _resumeListeners();
+
+		/** @brief	Retrieve if a connection is one of the listening/binded ones */
+		bool _isListener( const Connection * connection ) const;
+
+		/** @brief	Retrieve if a connection is a client still opened (not closed by a callback of the current poll()) */
+		bool _isClient( const Connection * connection ) const;
+
+		/** @brief	Delete the clients closed while poll() was dispatching its events */
+		void _deleteClosedClients();
+
 		/** @brief	Updates the fd set */
 		void updateFdSet();
 
@@ -175,8 +263,29 @@ namespace Network {
 		/** @brief	The socket vector */
 		Vector<Connection * > mSocketVector;
 
+		/** @brief	Clients accepted by poll(), indexed by their socket */
+		HashMap<SOCKET, Connection * > mClientMap;
+
+		/** @brief	True while poll() is calling back, the closed clients are then only deleted at the end */
+		bool mIsDispatching;
+		/** @brief	Clients closed while poll() was dispatching, deleted at the end of it */
+		Vector<Connection * > mClosedClientVector;
+
+		/** @brief	True while the listeners are paused by _pauseListeners() */
+		bool mIsAcceptPaused;
+		/** @brief	Time until which the listeners are paused */
+		Time::TimePointMS mAcceptResumeTime;
+
+	#if defined (linux)
+		/** @brief	epoll instance with the listeners (level-triggered) and the clients (edge-triggered), used by poll() */
+		int mEpoll;
+		/** @brief	epoll instance with only the listeners, used by the blocking accept() and receive() */
+		int mSelectEpoll;
+		epoll_event mEventTable[ EventBufferSize ];
+	#else
 		fd_set mFdSet;
 		fd_set mFdSetTmp;
+	#endif
 	};
 
 	using Server = ServerT<int>;
@@ -2,7 +2,15 @@ namespace Network {
 
 	template<typename T>
 	ServerT<T>::ServerT() :
-		mIsBinded( false ) {
+		mIsBinded( false ),
+		mIsDispatching( false ),
+		mIsAcceptPaused( false )
+	#if defined (linux)
+		,
+		mEpoll( -1 ),
+		mSelectEpoll( -1 )
+	#endif
+	{
 
 	}
 
@@ -78,10 +86,12 @@ namespace Network {
 			AddrInfo * addrInfo = ( AddrInfo * ) AI;
 			addrInfoVector.push( addrInfo );
 
+		#if !defined (linux)
 			if ( this -> mSocketVector.getSize() >= FD_SETSIZE ) {
 				WARNING_SPP( "getaddrinfo returned more addresses than we could use.\n" );
 				break;
 			}
+		#endif
 
 			result = _tryListen( addrInfo, maxClients ) || result;
 
@@ -110,14 +120,19 @@ namespace Network {
 
 	template<typename T>
 	bool ServerT<T>::_tryListen( Connection * socket, int maxClients ) {
+	#if !defined (linux)
 		if ( this -> mSocketVector.getSize() >= FD_SETSIZE ) {
 			WARNING_SPP( "getaddrinfo returned more addresses than we could use.\n" );
 			return false;
 		}
+	#endif
 
 		if ( socket -> listen( maxClients ) ) {
-			this -> mSocketVector.push( socket );
-			return true;
+			if ( _registerListener( socket ) ) {
+				this -> mSocketVector.push( socket );
+				return true;
+			}
+			socket -> close();
 		}
 		delete socket;
 		return false;
@@ -128,6 +143,26 @@ namespace Network {
 
 	template<typename T>
 	bool ServerT<T>::close() {
+		for ( auto it( this -> mClientMap.getBegin() ); it != this -> mClientMap.getEnd(); this -> mClientMap.iterate( &it ) ) {
+			Connection * client( this -> mClientMap.getValueIt( it ) );
+			client -> close();
+			delete client;
+		}
+		this -> mClientMap.clear();
+		_deleteClosedClients();
+		this -> mIsAcceptPaused = false;
+
+	#if defined (linux)
+		if ( this -> mEpoll != -1 ) {
+			::close( this -> mEpoll );
+			this -> mEpoll = -1;
+		}
+		if ( this -> mSelectEpoll != -1 ) {
+			::close( this -> mSelectEpoll );
+			this -> mSelectEpoll = -1;
+		}
+	#endif
+
 		if ( !this -> mIsBinded ) return false;
 
 		for ( unsigned int i = 0; i < this -> mSocketVector.getSize(); i++ ) {
@@ -143,6 +178,18 @@ namespace Network {
 
 	template<typename T>
 	bool ServerT<T>::accept( Connection * clientSocket ) {
+	#if defined (linux)
+		// The listeners are non-blocking : wait for one to be ready, another thread may have taken the client in the meantime.
+		while ( true ) {
+			Connection * selectedSocket = _select();
+			if ( !selectedSocket )
+				return false;
+			if ( selectedSocket -> accept( clientSocket ) )
+				return true;
+			if ( !Connection::isWouldBlock() )
+				return false;
+		}
+	#else
 		if ( getNumConnections() == 1 )
 			return this -> mSocketVector[ 0 ] -> accept( clientSocket );
 
@@ -151,16 +198,18 @@ namespace Network {
 			return selectedSocket -> accept( clientSocket );
 		else
 			return false;
-
+	#endif
 	}
 
 
 	template<typename T>
 	void ServerT<T>::updateFdSet() {
+	#if !defined (linux)
 		this -> mFdSet.fd_count = ( u_int ) Math::min<Size>( this -> mSocketVector.getSize(), FD_SETSIZE );
 		for ( unsigned int i = 0; i < this -> mFdSet.fd_count; i++ ) {
 			this -> mFdSet.fd_array[ i ] = this -> mSocketVector[ i ] -> getSocket();
 		}
+	#endif
 	}
 
 	template<typename T>
@@ -170,11 +219,34 @@ namespace Network {
 
 	template<typename T>
 	size_t ServerT<T>::getMaximumNbConnections() {
+	#if defined (linux)
+		rlimit limit;
+		if ( ::getrlimit( RLIMIT_NOFILE, &limit ) == 0 && limit.rlim_cur != RLIM_INFINITY )
+			return size_t( limit.rlim_cur );
+		return size_t( -1 );
+	#else
 		return FD_SETSIZE;
+	#endif
 	}
 
 	template<typename T>
 	Connection * ServerT<T>::_select() {
+	#if defined (linux)
+		if ( this -> mSelectEpoll == -1 )
+			return NULL;
+
+		epoll_event event;
+		int nbEvents;
+		do {
+			nbEvents = ::epoll_wait( this -> mSelectEpoll, &event, 1, -1 );
+		} while ( nbEvents == -1 && errno == EINTR );
+
+		if ( nbEvents <= 0 ) {
+			ERROR_SPP( "epoll_wait failed !" );
+			return NULL;
+		}
+		return ( Connection * ) event.data.ptr;
+	#else
 		if ( this -> mFdSet.fd_count > 0 ) {
 			memcpy( &this -> mFdSetTmp, &this -> mFdSet, sizeof( fd_set ) );
 			if ( ::select( ( int ) getNumConnections(), &this -> mFdSetTmp, 0, 0, 0 ) == SOCKET_ERROR ) {
@@ -194,6 +266,7 @@ namespace Network {
 			}
 		}
 		return NULL;
+	#endif
 	}
 
 	template<typename T>
@@ -205,6 +278,310 @@ namespace Network {
 			return 0;
 	}
 
+	template<typename T>
+	template<typename AcceptFunc, typename ReadFunc, typename WriteFunc>
+	int ServerT<T>::poll( AcceptFunc & acceptFunc, ReadFunc & readFunc, WriteFunc & writeFunc, int timeoutMs ) {
+		// The paused listeners are watched again at the end of the back off, the wait not lasting longer.
+		if ( this -> mIsAcceptPaused ) {
+			const Time::TimeT remainingMs( this -> mAcceptResumeTime.getValue() - Time::getTime<Time::MilliSecond>().getValue() );
+			if ( remainingMs <= Time::TimeT( 0 ) )
+				_resumeListeners();
+			else if ( timeoutMs < 0 || Time::TimeT( timeoutMs ) > remainingMs )
+				timeoutMs = int( remainingMs );
+		}
+
+	#if defined (linux)
+		if ( this -> mEpoll == -1 ) {
+			ERROR_SPP( "The server is not listening." );
+			return -1;
+		}
+
+		int nbEvents( ::epoll_wait( this -> mEpoll, this -> mEventTable, EventBufferSize, timeoutMs ) );
+		if ( nbEvents == -1 ) {
+			if ( errno == EINTR )
+				return 0;
+			ERROR_SPP( "epoll_wait failed !" );
+			return -1;
+		}
+
+		this -> mIsDispatching = true;
+		for ( int i( 0 ); i < nbEvents; i++ ) {
+			const epoll_event & event( this -> mEventTable[ i ] );
+			// O(1) lookup : the event directly hold the connection.
+			Connection * connection( ( Connection * ) event.data.ptr );
+
+			if ( _isListener( connection ) ) {
+				if ( connection -> isListening() )
+					_acceptAll( connection, acceptFunc );
+				else
+					readFunc( connection );
+				continue;
+			}
+
+			// A previous callback of this batch may have closed it (it is only deleted at the end).
+			if ( !_isClient( connection ) )
+				continue;
+
+			if ( event.events & ( EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR ) ) {
+				if ( !readFunc( connection ) ) {
+					closeClient( connection );
+					continue;
+				}
+			}
+			if ( ( event.events & EPOLLOUT ) && _isClient( connection ) ) {
+				// Send what was queued first, the writeFunc is called only once everything is gone.
+				if ( !connection -> flush() ) {
+					closeClient( connection );
+					continue;
+				}
+				if ( connection -> getPendingOutputSize() == Size( 0 ) && !writeFunc( connection ) ) {
+					closeClient( connection );
+					continue;
+				}
+			}
+			// Nothing will ever come again from a dead socket.
+			if ( event.events & ( EPOLLHUP | EPOLLERR ) )
+				closeClient( connection );
+		}
+		this -> mIsDispatching = false;
+		_deleteClosedClients();
+		return nbEvents;
+	#else
+		fd_set readSet;
+		FD_ZERO( &readSet );
+		fd_set writeSet;
+		FD_ZERO( &writeSet );
+
+		SOCKET maxSocket( 0 );
+		Size nbSockets( 0 );
+		for ( auto it( this -> mSocketVector.begin() ); !this -> mIsAcceptPaused && it != this -> mSocketVector.end() && nbSockets < FD_SETSIZE; it++, nbSockets++ ) {
+			FD_SET( ( *it ) -> getSocket(), &readSet );
+			maxSocket = Math::max( maxSocket, ( *it ) -> getSocket() );
+		}
+		for ( auto it( this -> mClientMap.getBegin() ); it != this -> mClientMap.getEnd() && nbSockets < FD_SETSIZE; this -> mClientMap.iterate( &it ), nbSockets++ ) {
+			FD_SET( this -> mClientMap.getIndexIt( it ), &readSet );
+			// Only the clients with queued bytes are watched for writability.
+			if ( this -> mClientMap.getValueIt( it ) -> getPendingOutputSize() > Size( 0 ) )
+				FD_SET( this -> mClientMap.getIndexIt( it ), &writeSet );
+			maxSocket = Math::max( maxSocket, this -> mClientMap.getIndexIt( it ) );
+		}
+		if ( nbSockets == 0 ) {
+			if ( this -> mIsAcceptPaused ) {
+				// Only paused listeners, nothing can happen before the end of the back off.
+				::Sleep( DWORD( timeoutMs ) );
+				return 0;
+			}
+			ERROR_SPP( "The server is not listening." );
+			return -1;
+		}
+
+		timeval timeout;
+		timeout.tv_sec = timeoutMs / 1000;
+		timeout.tv_usec = ( timeoutMs % 1000 ) * 1000;
+		int nbEvents( ::select( ( int ) maxSocket + 1, &readSet, &writeSet, NULL, timeoutMs < 0 ? NULL : &timeout ) );
+		if ( nbEvents == SOCKET_ERROR ) {
+			ERROR_SPP( "Select failed !" );
+			return -1;
+		}
+
+		// Retrieve the ready clients first as the callbacks may close them (and then modify the map).
+		Vector<Connection *> readyVector;
+		Vector<Connection *> writableVector;
+		for ( auto it( this -> mClientMap.getBegin() ); it != this -> mClientMap.getEnd(); this -> mClientMap.iterate( &it ) ) {
+			if ( FD_ISSET( this -> mClientMap.getIndexIt( it ), &readSet ) )
+				readyVector.push( this -> mClientMap.getValueIt( it ) );
+			if ( FD_ISSET( this -> mClientMap.getIndexIt( it ), &writeSet ) )
+				writableVector.push( this -> mClientMap.getValueIt( it ) );
+		}
+		this -> mIsDispatching = true;
+		for ( auto it( this -> mSocketVector.begin() ); it != this -> mSocketVector.end(); it++ ) {
+			if ( FD_ISSET( ( *it ) -> getSocket(), &readSet ) ) {
+				if ( ( *it ) -> isListening() )
+					_acceptAll( *it, acceptFunc );
+				else
+					readFunc( *it );
+			}
+		}
+		for ( auto it( readyVector.begin() ); it != readyVector.end(); it++ ) {
+			if ( _isClient( *it ) && !readFunc( *it ) )
+				closeClient( *it );
+		}
+		for ( auto it( writableVector.begin() ); it != writableVector.end(); it++ ) {
+			if ( _isClient( *it ) && !( *it ) -> flush() )
+				closeClient( *it );
+		}
+		this -> mIsDispatching = false;
+		_deleteClosedClients();
+		return nbEvents;
+	#endif
+	}
+
+	template<typename T>
+	bool ServerT<T>::closeClient( Connection * client ) {
+		Connection ** clientFound( this -> mClientMap.getValueI( client -> getSocket() ) );
+		if ( clientFound == NULL || *clientFound != client )
+			return false;
+
+	#if defined (linux)
+		::epoll_ctl( this -> mEpoll, EPOLL_CTL_DEL, client -> getSocket(), NULL );
+	#endif
+		this -> mClientMap.eraseI( client -> getSocket() );
+		client -> close();
+		// A descriptor has been freed, the pending clients may be accepted again.
+		_resumeListeners();
+		// The events of the current batch may still point to it.
+		if ( this -> mIsDispatching )
+			this -> mClosedClientVector.push( client );
+		else
+			delete client;
+		return true;
+	}
+
+	template<typename T>
+	Size ServerT<T>::getNumClients() const {
+		return this -> mClientMap.getSize();
+	}
+
+	template<typename T>
+	bool ServerT<T>::_registerListener( Connection * connection ) {
+	#if defined (linux)
+		if ( this -> mEpoll == -1 ) {
+			this -> mEpoll = ::epoll_create1( EPOLL_CLOEXEC );
+			this -> mSelectEpoll = ::epoll_create1( EPOLL_CLOEXEC );
+			if ( this -> mEpoll == -1 || this -> mSelectEpoll == -1 ) {
+				ERROR_SPP( "Unable to create the epoll instance." );
+				return false;
+			}
+		}
+
+		// The listeners stay level-triggered : a pending client is reported until accepted.
+		if ( !connection -> setBlocking( false ) )
+			return false;
+
+		epoll_event event;
+		event.events = EPOLLIN;
+		event.data.ptr = connection;
+		if ( ::epoll_ctl( this -> mEpoll, EPOLL_CTL_ADD, connection -> getSocket(), &event ) == -1 ||
+			 ::epoll_ctl( this -> mSelectEpoll, EPOLL_CTL_ADD, connection -> getSocket(), &event ) == -1 ) {
+			ERROR_SPP( "Unable to register the listening socket into epoll." );
+			::epoll_ctl( this -> mEpoll, EPOLL_CTL_DEL, connection -> getSocket(), NULL );
+			return false;
+		}
+	#endif
+		return true;
+	}
+
+	template<typename T>
+	bool ServerT<T>::_registerClient( Connection * client ) {
+		if ( this -> mClientMap.insert( client -> getSocket(), client ) == NULL ) {
+			ERROR_SPP( "Client already registered." );
+			return false;
+		}
+
+	#if defined (linux)
+		epoll_event event;
+		event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+		event.data.ptr = client;
+		if ( ::epoll_ctl( this -> mEpoll, EPOLL_CTL_ADD, client -> getSocket(), &event ) == -1 ) {
+			ERROR_SPP( "Unable to register the client into epoll." );
+			this -> mClientMap.eraseI( client -> getSocket() );
+			return false;
+		}
+	#endif
+		return true;
+	}
+
+	template<typename T>
+	template<typename AcceptFunc>
+	void ServerT<T>::_acceptAll( Connection * listener, AcceptFunc & acceptFunc ) {
+	#if defined (linux)
+		// Non-blocking listener : take every pending client until it would block.
+		while ( true ) {
+	#endif
+			Connection * client( new Connection() );
+			if ( !listener -> accept( client ) ) {
+				const bool bWouldBlock( Connection::isWouldBlock() );
+	#if defined (linux)
+				// The client gave up before being accepted, the next ones are still pending.
+				const bool bAborted( errno == ECONNABORTED || errno == EINTR );
+	#endif
+				delete client;
+	#if defined (linux)
+				if ( bAborted )
+					continue;
+	#endif
+				// Out of descriptors or memory (EMFILE, ENFILE, ENOBUFS...) : the client is still pending.
+				if ( !bWouldBlock )
+					_pauseListeners();
+				return;
+			}
+			if ( !client -> setBlocking( false ) || !_registerClient( client ) ) {
+				delete client;
+			} else if ( !acceptFunc( client ) ) {
+				closeClient( client );
+			}
+	#if defined (linux)
+		}
+	#endif
+	}
+
+	template<typename T>
+	void ServerT<T>::_pauseListeners() {
+		if ( this -> mIsAcceptPaused )
+			return;
+		ERROR_SPP( "Unable to accept a new client, the listeners are paused." );
+		this -> mIsAcceptPaused = true;
+		this -> mAcceptResumeTime = Time::getTime<Time::MilliSecond>() + Time::TimeT( AcceptBackOffMs );
+	#if defined (linux)
+		// Still registered, but without any event.
+		for ( auto it( this -> mSocketVector.begin() ); it != this -> mSocketVector.end(); it++ ) {
+			epoll_event event;
+			event.events = 0;
+			event.data.ptr = *it;
+			::epoll_ctl( this -> mEpoll, EPOLL_CTL_MOD, ( *it ) -> getSocket(), &event );
+		}
+	#endif
+	}
+
+	template<typename T>
+	void ServerT<T>::_resumeListeners() {
+		if ( !this -> mIsAcceptPaused )
+			return;
+		this -> mIsAcceptPaused = false;
+	#if defined (linux)
+		for ( auto it( this -> mSocketVector.begin() ); it != this -> mSocketVector.end(); it++ ) {
+			epoll_event event;
+			event.events = EPOLLIN;
+			event.data.ptr = *it;
+			::epoll_ctl( this -> mEpoll, EPOLL_CTL_MOD, ( *it ) -> getSocket(), &event );
+		}
+	#endif
+	}
+
+	template<typename T>
+	bool ServerT<T>::_isListener( const Connection * connection ) const {
+		for ( auto it( this -> mSocketVector.begin() ); it != this -> mSocketVector.end(); it++ ) {
+			if ( ( *it ) == connection )
+				return true;
+		}
+		return false;
+	}
+
+	template<typename T>
+	bool ServerT<T>::_isClient( const Connection * connection ) const {
+		// A closed client has lost its socket, the one of a newer client can not be mistaken for it.
+		Connection * const * clientFound( this -> mClientMap.getValueI( connection -> getSocket() ) );
+		return clientFound != NULL && *clientFound == connection;
+	}
+
+	template<typename T>
+	void ServerT<T>::_deleteClosedClients() {
+		for ( auto it( this -> mClosedClientVector.begin() ); it != this -> mClosedClientVector.end(); it++ ) {
+			delete ( *it );
+		}
+		this -> mClosedClientVector.clear();
+	}
+
 
 
 
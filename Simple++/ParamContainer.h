@@ -3,6 +3,7 @@
 #include "Vector.h"
 #include "Map.h"
 #include "Param.h"
+#include "StringPool.h"
 
 template<typename I, typename V>
 class ParamContainerT : public IO::BasicIO {
@@ -51,5 +52,7 @@ protected:
 };
 
 using ParamContainer = ParamContainerT<StringASCII, StringASCII>;
+///@brief Container with interned parameter names, comparing two names in O(1) when searching a parameter (the names are kept inside the default StringPool).
+using InternedParamContainer = ParamContainerT<InternedString, StringASCII>;
 
 #include "ParamContainer.hpp"
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "Vector.h"
 #include "String.h"
 
@@ -25,6 +27,257 @@ namespace Regex {
 	bool match( const BasicString<T> & str, const BasicString<T> & regExp );
 
 
+	/**
+	 * @brief	Result of a Pattern search : offsets (in elements from the beginning of the searched string) of the whole match and of every capture group.
+	 * 			Can be reused between calls, it's buffer will only be allocated once.
+	 */
+	class Match {
+	public:
+		template<typename T>
+		friend class Pattern;
+
+		/** @brief	Default constructor */
+		Match();
+
+		/**
+		 * @brief	Get the number of groups (The group 0 is the whole match).
+		 *
+		 * @returns	Number of groups.
+		 */
+		Size getNbGroups() const;
+
+		/**
+		 * @brief	Get if a group has participated to the match.
+		 *
+		 * @param	groupI	Index of the group.
+		 *
+		 * @returns	True if the group has been matched, false otherwise.
+		 */
+		bool isMatched( const Size groupI = Size( 0 ) ) const;
+
+		/**
+		 * @brief	Get the offset of the first element of a group.
+		 *
+		 * @param	groupI	Index of the group.
+		 *
+		 * @returns	Offset of the beginning of the group.
+		 */
+		Size getBegin( const Size groupI = Size( 0 ) ) const;
+
+		/**
+		 * @brief	Get the offset after the last element of a group.
+		 *
+		 * @param	groupI	Index of the group.
+		 *
+		 * @returns	Offset of the end of the group.
+		 */
+		Size getEnd( const Size groupI = Size( 0 ) ) const;
+
+		/**
+		 * @brief	Extract a group from the string that has been searched.
+		 *
+		 * @param	str   	String used for the search.
+		 * @param	groupI	Index of the group.
+		 *
+		 * @returns	The sub string of the group (empty if the group has not been matched).
+		 */
+		template<typename T>
+		BasicString<T> getGroup( const BasicString<T> & str, const Size groupI = Size( 0 ) ) const;
+
+		/** @brief	Offset used for a group not matched. */
+		static constexpr Size overflow = Size( -1 );
+
+	private:
+		Vector<Size> slotVector;
+	};
+
+
+	/**
+	 * @brief	Regex compiled once into a Thompson NFA and executed by a Pike VM (Linear time with the size of the string, no backtracking).
+	 * 			Supported syntax : literals, '.', '[...]' / '[^...]' with ranges, '\d' '\w' '\s' (and uppercase negations),
+	 * 			'(...)' capture groups, '(?:...)' non capturing groups, '|', greedy '*' '+' '?' and their lazy versions '*?' '+?' '??', '^' and '$' anchors.
+	 * 			Every buffer needed for the execution is allocated when compiling and reused by each call, the execution methods are thus not const and a Pattern is NOT thread safe : each thread has to use it's own copy.
+	 *
+	 * @tparam	T	Type of the characters.
+	 */
+	template<typename T>
+	class Pattern {
+	public:
+		/** @brief	Default constructor (Not compiled) */
+		Pattern();
+
+		/**
+		 * @brief	Constructor compiling a regex.
+		 *
+		 * @param	regExp	The regex string.
+		 */
+		Pattern( const BasicString<T> & regExp );
+
+		/**
+		 * @brief	Compile a regex, replacing the previous one.
+		 *
+		 * @param	regExp	The regex string.
+		 *
+		 * @returns	True if the regex is valid, false otherwise.
+		 */
+		bool compile( const BasicString<T> & regExp );
+
+		/**
+		 * @brief	Get if this pattern has been successfully compiled.
+		 *
+		 * @returns	True if compiled, false otherwise.
+		 */
+		bool isCompiled() const;
+
+		/**
+		 * @brief	Get the number of capture groups (including the group 0, the whole match).
+		 *
+		 * @returns	Number of groups.
+		 */
+		Size getNbGroups() const;
+
+		/**
+		 * @brief	Check if the whole string is matching the pattern.
+		 *
+		 * @param	str	The string to test.
+		 * @param	m  	(Optional) Match to be filled with the capture groups.
+		 *
+		 * @returns	True if it succeeds, false if it fails.
+		 */
+		bool match( const BasicString<T> & str, Match * m = NULL );
+
+		/**
+		 * @brief	Search the first (leftmost) sub string matching the pattern.
+		 *
+		 * @param	str	The string to search in.
+		 * @param	m  	(Optional) Match to be filled with the capture groups.
+		 *
+		 * @returns	True if founded, false otherwise.
+		 */
+		bool search( const BasicString<T> & str, Match * m = NULL );
+
+		/**
+		 * @brief	Search the first (leftmost) sub string matching the pattern starting at a specific offset.
+		 *
+		 * @param	str   	The string to search in.
+		 * @param	offset	Offset where to start the search ('^' still refer to the beginning of the string).
+		 * @param	m	  	(Optional) Match to be filled with the capture groups.
+		 *
+		 * @returns	True if founded, false otherwise.
+		 */
+		bool search( const BasicString<T> & str, const Size offset, Match * m = NULL );
+
+		/**
+		 * @brief	Search every non overlapping sub strings matching the pattern.
+		 *
+		 * @param		  	str		   	The string to search in.
+		 * @param [in,out]	matchVector	Vector where to push the matches.
+		 *
+		 * @returns	Number of matches founded.
+		 */
+		Size findAll( const BasicString<T> & str, Vector<Match> * matchVector );
+
+	private:
+		enum class OpCode : unsigned char {
+			Char,
+			Any,
+			Class,
+			Split,
+			Jump,
+			Save,
+			Begin,
+			End,
+			Match
+		};
+
+		struct Instruction {
+			OpCode opCode;
+			T c;
+			/** @brief	Jump destination / Class index / Save slot. */
+			Size x;
+			/** @brief	Second Split destination (lowest priority). */
+			Size y;
+		};
+
+		struct ClassRange {
+			T first;
+			T last;
+		};
+
+		struct CharClass {
+			Size rangeBegin;
+			Size rangeEnd;
+			bool bNegated;
+		};
+
+		enum class NodeType : unsigned char {
+			Empty,
+			Char,
+			Any,
+			Class,
+			Concat,
+			Alternate,
+			Star,
+			Plus,
+			Quest,
+			Group,
+			Begin,
+			End
+		};
+
+		struct Node {
+			NodeType type;
+			T c;
+			Size left;
+			Size right;
+			Size x;
+			bool bGreedy;
+		};
+
+		/** @brief	List of threads of the Pike VM (sparse set of program counters + their capture slots). */
+		struct ThreadList {
+			Vector<Size> denseVector;
+			Vector<Size> sparseVector;
+			Vector<Size> slotVector;
+			Size size;
+		};
+
+		struct Parser {
+			const T * it;
+			const T * endIt;
+			bool bError;
+		};
+
+		Size _parseAlternate( Parser & parser );
+		Size _parseConcat( Parser & parser );
+		Size _parseRepeat( Parser & parser );
+		Size _parseAtom( Parser & parser );
+		Size _parseClass( Parser & parser );
+		bool _parseEscapeClass( const T c, Vector<ClassRange> & rangeVector, bool * bNegated );
+		Size _pushNode( NodeType type, Size left = Size( 0 ), Size right = Size( 0 ), Size x = Size( 0 ), T c = T( 0 ) );
+
+		void _emit( const Size nodeI );
+		Size _emitInstruction( OpCode opCode, Size x = Size( 0 ), Size y = Size( 0 ), T c = T( 0 ) );
+
+		bool _matchClass( const CharClass & charClass, const T c ) const;
+		void _addThread( ThreadList & list, const Size pc, const T * sp, const T * beginIt, const T * endIt, Size * slotTable ) const;
+		bool _execute( const T * beginIt, const T * searchIt, const T * endIt, bool bFullMatch, Match * m );
+
+		Vector<Instruction> programVector;
+		Vector<ClassRange> rangeVector;
+		Vector<CharClass> classVector;
+		Vector<Node> nodeVector;
+		Size nbGroups;
+		bool bAnchoredBegin;
+		bool bCompiled;
+
+		/** @brief	Execution buffers, sized when compiling and reused by every call. */
+		ThreadList threadLists[ 2 ];
+		Vector<Size> workSlotVector;
+		Vector<Size> matchSlotVector;
+	};
+
+
 };
 
 #include "Regex.hpp"
@@ -341,3 +341,597 @@ noMatchBracket:
 		return false;
 	}
 }
+
+
+
+namespace Regex {
+
+	inline Match::Match() {
+
+	}
+
+	inline Size Match::getNbGroups() const {
+		return this -> slotVector.getSize() / Size( 2 );
+	}
+
+	inline bool Match::isMatched( const Size groupI ) const {
+		return groupI < getNbGroups() && this -> slotVector[ groupI * Size( 2 ) ] != overflow && this -> slotVector[ groupI * Size( 2 ) + Size( 1 ) ] != overflow;
+	}
+
+	inline Size Match::getBegin( const Size groupI ) const {
+		return this -> slotVector[ groupI * Size( 2 ) ];
+	}
+
+	inline Size Match::getEnd( const Size groupI ) const {
+		return this -> slotVector[ groupI * Size( 2 ) + Size( 1 ) ];
+	}
+
+	template<typename T>
+	BasicString<T> Match::getGroup( const BasicString<T> & str, const Size groupI ) const {
+		if ( !isMatched( groupI ) )
+			return BasicString<T>();
+		return str.getSubStr( getBegin( groupI ), getEnd( groupI ) - getBegin( groupI ) );
+	}
+
+
+
+	template<typename T>
+	Pattern<T>::Pattern() :
+		nbGroups( 0 ),
+		bAnchoredBegin( false ),
+		bCompiled( false ) {
+
+	}
+
+	template<typename T>
+	Pattern<T>::Pattern( const BasicString<T> & regExp ) :
+		nbGroups( 0 ),
+		bAnchoredBegin( false ),
+		bCompiled( false ) {
+		compile( regExp );
+	}
+
+	template<typename T>
+	bool Pattern<T>::compile( const BasicString<T> & regExp ) {
+		this -> programVector.clear();
+		this -> rangeVector.clear();
+		this -> classVector.clear();
+		this -> nodeVector.clear();
+		this -> nodeVector.reserve( regExp.getSize() * Size( 2 ) + Size( 4 ) );
+		this -> nbGroups = Size( 1 );
+		this -> bCompiled = false;
+
+		Parser parser = { regExp.getData(), regExp.getData() + regExp.getSize(), false };
+
+		// The whole regex is the group 0.
+		Size rootNodeI( _parseAlternate( parser ) );
+		if ( parser.bError || parser.it != parser.endIt ) {
+			this -> nodeVector.clear();
+			return false;
+		}
+		rootNodeI = _pushNode( NodeType::Group, rootNodeI, Size( 0 ), Size( 0 ) );
+
+		this -> programVector.reserve( this -> nodeVector.getSize() * Size( 2 ) + Size( 1 ) );
+		_emit( rootNodeI );
+		_emitInstruction( OpCode::Match );
+		this -> nodeVector.clear();
+
+		this -> bAnchoredBegin = this -> programVector.getSize() > Size( 1 ) && this -> programVector[ Size( 1 ) ].opCode == OpCode::Begin;
+
+		// Allocate everything needed for the execution right now.
+		const Size programSize( this -> programVector.getSize() );
+		const Size nbSlots( this -> nbGroups * Size( 2 ) );
+		for ( Size i( 0 ); i < Size( 2 ); i++ ) {
+			this -> threadLists[ i ].denseVector.resize( programSize );
+			this -> threadLists[ i ].sparseVector.resize( programSize );
+			this -> threadLists[ i ].slotVector.resize( programSize * nbSlots );
+			this -> threadLists[ i ].size = Size( 0 );
+		}
+		this -> workSlotVector.resize( nbSlots );
+		this -> matchSlotVector.resize( nbSlots );
+
+		this -> bCompiled = true;
+		return true;
+	}
+
+	template<typename T>
+	bool Pattern<T>::isCompiled() const {
+		return this -> bCompiled;
+	}
+
+	template<typename T>
+	Size Pattern<T>::getNbGroups() const {
+		return this -> nbGroups;
+	}
+
+	template<typename T>
+	Size Pattern<T>::_pushNode( NodeType type, Size left, Size right, Size x, T c ) {
+		Node node;
+		node.type = type;
+		node.c = c;
+		node.left = left;
+		node.right = right;
+		node.x = x;
+		node.bGreedy = true;
+		this -> nodeVector.push( node );
+		return this -> nodeVector.getSize() - Size( 1 );
+	}
+
+	template<typename T>
+	Size Pattern<T>::_parseAlternate( Parser & parser ) {
+		Size nodeI( _parseConcat( parser ) );
+		while ( !parser.bError && parser.it != parser.endIt && *parser.it == T( '|' ) ) {
+			parser.it++;
+			Size rightI( _parseConcat( parser ) );
+			nodeI = _pushNode( NodeType::Alternate, nodeI, rightI );
+		}
+		return nodeI;
+	}
+
+	template<typename T>
+	Size Pattern<T>::_parseConcat( Parser & parser ) {
+		Size nodeI( _pushNode( NodeType::Empty ) );
+		while ( !parser.bError && parser.it != parser.endIt && *parser.it != T( '|' ) && *parser.it != T( ')' ) ) {
+			Size rightI( _parseRepeat( parser ) );
+			if ( this -> nodeVector[ nodeI ].type == NodeType::Empty )
+				nodeI = rightI;
+			else
+				nodeI = _pushNode( NodeType::Concat, nodeI, rightI );
+		}
+		return nodeI;
+	}
+
+	template<typename T>
+	Size Pattern<T>::_parseRepeat( Parser & parser ) {
+		Size nodeI( _parseAtom( parser ) );
+		while ( !parser.bError && parser.it != parser.endIt ) {
+			NodeType type;
+			if ( *parser.it == T( '*' ) )
+				type = NodeType::Star;
+			else if ( *parser.it == T( '+' ) )
+				type = NodeType::Plus;
+			else if ( *parser.it == T( '?' ) )
+				type = NodeType::Quest;
+			else
+				break;
+			parser.it++;
+
+			nodeI = _pushNode( type, nodeI );
+			if ( parser.it != parser.endIt && *parser.it == T( '?' ) ) {
+				this -> nodeVector[ nodeI ].bGreedy = false;
+				parser.it++;
+			}
+		}
+		return nodeI;
+	}
+
+	template<typename T>
+	Size Pattern<T>::_parseAtom( Parser & parser ) {
+		const T c( *parser.it );
+		parser.it++;
+
+		switch ( c ) {
+			case T( '(' ):
+				{
+					bool bCapture( true );
+					if ( parser.endIt - parser.it >= 2 && parser.it[ 0 ] == T( '?' ) && parser.it[ 1 ] == T( ':' ) ) {
+						bCapture = false;
+						parser.it += 2;
+					}
+					const Size groupI( bCapture ? this -> nbGroups++ : Size( 0 ) );
+					Size nodeI( _parseAlternate( parser ) );
+					if ( parser.it == parser.endIt || *parser.it != T( ')' ) ) {
+						parser.bError = true;
+						return nodeI;
+					}
+					parser.it++;
+					if ( bCapture )
+						return _pushNode( NodeType::Group, nodeI, Size( 0 ), groupI );
+					return nodeI;
+				}
+			case T( '[' ):
+				return _parseClass( parser );
+			case T( '.' ):
+				return _pushNode( NodeType::Any );
+			case T( '^' ):
+				return _pushNode( NodeType::Begin );
+			case T( '$' ):
+				return _pushNode( NodeType::End );
+			case T( '*' ):
+			case T( '+' ):
+			case T( '?' ):
+				// Nothing to repeat.
+				parser.bError = true;
+				return Size( 0 );
+			case T( '\\' ):
+				{
+					if ( parser.it == parser.endIt ) {
+						parser.bError = true;
+						return Size( 0 );
+					}
+					const T escapedC( *parser.it );
+					parser.it++;
+
+					Vector<ClassRange> escapeRangeVector;
+					bool bNegated;
+					if ( _parseEscapeClass( escapedC, escapeRangeVector, &bNegated ) ) {
+						CharClass charClass;
+						charClass.rangeBegin = this -> rangeVector.getSize();
+						for ( Size i( 0 ); i < escapeRangeVector.getSize(); i++ )
+							this -> rangeVector.push( escapeRangeVector[ i ] );
+						charClass.rangeEnd = this -> rangeVector.getSize();
+						charClass.bNegated = bNegated;
+						this -> classVector.push( charClass );
+						return _pushNode( NodeType::Class, Size( 0 ), Size( 0 ), this -> classVector.getSize() - Size( 1 ) );
+					}
+					switch ( escapedC ) {
+						case T( 'n' ): return _pushNode( NodeType::Char, Size( 0 ), Size( 0 ), Size( 0 ), T( '\n' ) );
+						case T( 'r' ): return _pushNode( NodeType::Char, Size( 0 ), Size( 0 ), Size( 0 ), T( '\r' ) );
+						case T( 't' ): return _pushNode( NodeType::Char, Size( 0 ), Size( 0 ), Size( 0 ), T( '\t' ) );
+						default: return _pushNode( NodeType::Char, Size( 0 ), Size( 0 ), Size( 0 ), escapedC );
+					}
+				}
+			default:
+				return _pushNode( NodeType::Char, Size( 0 ), Size( 0 ), Size( 0 ), c );
+		}
+	}
+
+	template<typename T>
+	bool Pattern<T>::_parseEscapeClass( const T c, Vector<ClassRange> & rangeVector, bool * bNegated ) {
+		switch ( c ) {
+			case T( 'd' ):
+			case T( 'D' ):
+				rangeVector.push( { T( '0' ), T( '9' ) } );
+				break;
+			case T( 'w' ):
+			case T( 'W' ):
+				rangeVector.push( { T( '0' ), T( '9' ) } );
+				rangeVector.push( { T( 'A' ), T( 'Z' ) } );
+				rangeVector.push( { T( '_' ), T( '_' ) } );
+				rangeVector.push( { T( 'a' ), T( 'z' ) } );
+				break;
+			case T( 's' ):
+			case T( 'S' ):
+				rangeVector.push( { T( '\t' ), T( '\r' ) } );
+				rangeVector.push( { T( ' ' ), T( ' ' ) } );
+				break;
+			default:
+				return false;
+		}
+		*bNegated = ( c == T( 'D' ) || c == T( 'W' ) || c == T( 'S' ) );
+		return true;
+	}
+
+	template<typename T>
+	Size Pattern<T>::_parseClass( Parser & parser ) {
+		CharClass charClass;
+		charClass.rangeBegin = this -> rangeVector.getSize();
+		charClass.bNegated = false;
+
+		if ( parser.it != parser.endIt && *parser.it == T( '^' ) ) {
+			charClass.bNegated = true;
+			parser.it++;
+		}
+
+		bool bFirst( true );
+		while ( true ) {
+			if ( parser.it == parser.endIt ) {
+				parser.bError = true;
+				return Size( 0 );
+			}
+			T first( *parser.it );
+			parser.it++;
+
+			// A ']' right after the opening is a literal.
+			if ( first == T( ']' ) && !bFirst )
+				break;
+			bFirst = false;
+
+			if ( first == T( '\\' ) ) {
+				if ( parser.it == parser.endIt ) {
+					parser.bError = true;
+					return Size( 0 );
+				}
+				first = *parser.it;
+				parser.it++;
+
+				Vector<ClassRange> escapeRangeVector;
+				bool bNegated;
+				if ( _parseEscapeClass( first, escapeRangeVector, &bNegated ) ) {
+					if ( bNegated ) {
+						// Negated escape inside a class : add the complement ranges.
+						T nextC( std::numeric_limits<T>::min() );
+						for ( Size i( 0 ); i < escapeRangeVector.getSize(); i++ ) {
+							if ( escapeRangeVector[ i ].first > nextC )
+								this -> rangeVector.push( { nextC, T( escapeRangeVector[ i ].first - T( 1 ) ) } );
+							nextC = T( escapeRangeVector[ i ].last + T( 1 ) );
+						}
+						this -> rangeVector.push( { nextC, std::numeric_limits<T>::max() } );
+					} else {
+						for ( Size i( 0 ); i < escapeRangeVector.getSize(); i++ )
+							this -> rangeVector.push( escapeRangeVector[ i ] );
+					}
+					continue;
+				}
+				if ( first == T( 'n' ) ) first = T( '\n' );
+				else if ( first == T( 'r' ) ) first = T( '\r' );
+				else if ( first == T( 't' ) ) first = T( '\t' );
+			}
+
+			T last( first );
+			if ( parser.endIt - parser.it >= 2 && *parser.it == T( '-' ) && parser.it[ 1 ] != T( ']' ) ) {
+				last = parser.it[ 1 ];
+				parser.it += 2;
+				if ( last == T( '\\' ) ) {
+					if ( parser.it == parser.endIt ) {
+						parser.bError = true;
+						return Size( 0 );
+					}
+					last = *parser.it;
+					parser.it++;
+				}
+				if ( last < first ) {
+					parser.bError = true;
+					return Size( 0 );
+				}
+			}
+			this -> rangeVector.push( { first, last } );
+		}
+
+		charClass.rangeEnd = this -> rangeVector.getSize();
+		this -> classVector.push( charClass );
+		return _pushNode( NodeType::Class, Size( 0 ), Size( 0 ), this -> classVector.getSize() - Size( 1 ) );
+	}
+
+	template<typename T>
+	Size Pattern<T>::_emitInstruction( OpCode opCode, Size x, Size y, T c ) {
+		Instruction instruction;
+		instruction.opCode = opCode;
+		instruction.c = c;
+		instruction.x = x;
+		instruction.y = y;
+		this -> programVector.push( instruction );
+		return this -> programVector.getSize() - Size( 1 );
+	}
+
+	template<typename T>
+	void Pattern<T>::_emit( const Size nodeI ) {
+		// Copy, nodeVector is not modified here but programVector references may be invalidated.
+		const Node node( this -> nodeVector[ nodeI ] );
+
+		switch ( node.type ) {
+			case NodeType::Empty:
+				break;
+			case NodeType::Char:
+				_emitInstruction( OpCode::Char, Size( 0 ), Size( 0 ), node.c );
+				break;
+			case NodeType::Any:
+				_emitInstruction( OpCode::Any );
+				break;
+			case NodeType::Class:
+				_emitInstruction( OpCode::Class, node.x );
+				break;
+			case NodeType::Begin:
+				_emitInstruction( OpCode::Begin );
+				break;
+			case NodeType::End:
+				_emitInstruction( OpCode::End );
+				break;
+			case NodeType::Concat:
+				_emit( node.left );
+				_emit( node.right );
+				break;
+			case NodeType::Group:
+				_emitInstruction( OpCode::Save, node.x * Size( 2 ) );
+				_emit( node.left );
+				_emitInstruction( OpCode::Save, node.x * Size( 2 ) + Size( 1 ) );
+				break;
+			case NodeType::Alternate:
+				{
+					// split L1, L2 / L1: left / jump L3 / L2: right / L3:
+					const Size splitI( _emitInstruction( OpCode::Split ) );
+					this -> programVector[ splitI ].x = this -> programVector.getSize();
+					_emit( node.left );
+					const Size jumpI( _emitInstruction( OpCode::Jump ) );
+					this -> programVector[ splitI ].y = this -> programVector.getSize();
+					_emit( node.right );
+					this -> programVector[ jumpI ].x = this -> programVector.getSize();
+					break;
+				}
+			case NodeType::Star:
+				{
+					// L1: split L2, L3 / L2: left / jump L1 / L3:
+					const Size splitI( _emitInstruction( OpCode::Split ) );
+					const Size bodyI( this -> programVector.getSize() );
+					_emit( node.left );
+					_emitInstruction( OpCode::Jump, splitI );
+					const Size outI( this -> programVector.getSize() );
+					this -> programVector[ splitI ].x = node.bGreedy ? bodyI : outI;
+					this -> programVector[ splitI ].y = node.bGreedy ? outI : bodyI;
+					break;
+				}
+			case NodeType::Plus:
+				{
+					// L1: left / split L1, L3 / L3:
+					const Size bodyI( this -> programVector.getSize() );
+					_emit( node.left );
+					const Size splitI( _emitInstruction( OpCode::Split ) );
+					const Size outI( this -> programVector.getSize() );
+					this -> programVector[ splitI ].x = node.bGreedy ? bodyI : outI;
+					this -> programVector[ splitI ].y = node.bGreedy ? outI : bodyI;
+					break;
+				}
+			case NodeType::Quest:
+				{
+					// split L1, L2 / L1: left / L2:
+					const Size splitI( _emitInstruction( OpCode::Split ) );
+					const Size bodyI( this -> programVector.getSize() );
+					_emit( node.left );
+					const Size outI( this -> programVector.getSize() );
+					this -> programVector[ splitI ].x = node.bGreedy ? bodyI : outI;
+					this -> programVector[ splitI ].y = node.bGreedy ? outI : bodyI;
+					break;
+				}
+		}
+	}
+
+	template<typename T>
+	bool Pattern<T>::_matchClass( const CharClass & charClass, const T c ) const {
+		for ( Size i( charClass.rangeBegin ); i < charClass.rangeEnd; i++ ) {
+			const ClassRange & range( this -> rangeVector[ i ] );
+			if ( c >= range.first && c <= range.last )
+				return !charClass.bNegated;
+		}
+		return charClass.bNegated;
+	}
+
+	template<typename T>
+	void Pattern<T>::_addThread( ThreadList & list, const Size pc, const T * sp, const T * beginIt, const T * endIt, Size * slotTable ) const {
+		// Sparse set membership, the first thread reaching a pc has the highest priority.
+		const Size denseI( list.sparseVector[ pc ] );
+		if ( denseI < list.size && list.denseVector[ denseI ] == pc )
+			return;
+		list.sparseVector[ pc ] = list.size;
+		list.denseVector[ list.size ] = pc;
+		list.size++;
+
+		const Instruction & instruction( this -> programVector[ pc ] );
+		switch ( instruction.opCode ) {
+			case OpCode::Jump:
+				_addThread( list, instruction.x, sp, beginIt, endIt, slotTable );
+				break;
+			case OpCode::Split:
+				_addThread( list, instruction.x, sp, beginIt, endIt, slotTable );
+				_addThread( list, instruction.y, sp, beginIt, endIt, slotTable );
+				break;
+			case OpCode::Save:
+				{
+					const Size oldValue( slotTable[ instruction.x ] );
+					slotTable[ instruction.x ] = Size( sp - beginIt );
+					_addThread( list, pc + Size( 1 ), sp, beginIt, endIt, slotTable );
+					slotTable[ instruction.x ] = oldValue;
+					break;
+				}
+			case OpCode::Begin:
+				if ( sp == beginIt )
+					_addThread( list, pc + Size( 1 ), sp, beginIt, endIt, slotTable );
+				break;
+			case OpCode::End:
+				if ( sp == endIt )
+					_addThread( list, pc + Size( 1 ), sp, beginIt, endIt, slotTable );
+				break;
+			default:
+				{
+					// Consuming instruction or Match : the thread stops here until the next step, save it's slots.
+					const Size nbSlots( this -> nbGroups * Size( 2 ) );
+					Utility::copy( list.slotVector.getData() + pc * nbSlots, slotTable, nbSlots );
+					break;
+				}
+		}
+	}
+
+	template<typename T>
+	bool Pattern<T>::_execute( const T * beginIt, const T * searchIt, const T * endIt, bool bFullMatch, Match * m ) {
+		if ( !this -> bCompiled )
+			return false;
+
+		const Size nbSlots( this -> nbGroups * Size( 2 ) );
+		ThreadList * currentList( &this -> threadLists[ 0 ] );
+		ThreadList * nextList( &this -> threadLists[ 1 ] );
+		currentList -> size = Size( 0 );
+
+		Size * workSlotTable( this -> workSlotVector.getData() );
+		bool bMatched( false );
+		const bool bAnchored( bFullMatch || this -> bAnchoredBegin );
+
+		for ( const T * sp( searchIt ); ; sp++ ) {
+			// Start a new thread at this position, with the lowest priority (leftmost match first).
+			if ( !bMatched && ( !bAnchored || sp == searchIt ) ) {
+				for ( Size i( 0 ); i < nbSlots; i++ )
+					workSlotTable[ i ] = Match::overflow;
+				_addThread( *currentList, Size( 0 ), sp, beginIt, endIt, workSlotTable );
+			}
+			if ( currentList -> size == Size( 0 ) )
+				break;
+
+			nextList -> size = Size( 0 );
+			for ( Size i( 0 ); i < currentList -> size; i++ ) {
+				const Size pc( currentList -> denseVector[ i ] );
+				const Instruction & instruction( this -> programVector[ pc ] );
+				const Size * threadSlotTable( currentList -> slotVector.getData() + pc * nbSlots );
+
+				bool bStep( false );
+				switch ( instruction.opCode ) {
+					case OpCode::Char:
+						bStep = ( sp != endIt && *sp == instruction.c );
+						break;
+					case OpCode::Any:
+						bStep = ( sp != endIt );
+						break;
+					case OpCode::Class:
+						bStep = ( sp != endIt && _matchClass( this -> classVector[ instruction.x ], *sp ) );
+						break;
+					case OpCode::Match:
+						if ( bFullMatch && sp != endIt )
+							break;
+						bMatched = true;
+						Utility::copy( this -> matchSlotVector.getData(), threadSlotTable, nbSlots );
+						// Every thread after this one has a lower priority, cut them.
+						i = currentList -> size;
+						break;
+					default:
+						break;
+				}
+				if ( bStep ) {
+					Utility::copy( workSlotTable, threadSlotTable, nbSlots );
+					_addThread( *nextList, pc + Size( 1 ), sp + 1, beginIt, endIt, workSlotTable );
+				}
+			}
+
+			ThreadList * tmpList( currentList );
+			currentList = nextList;
+			nextList = tmpList;
+
+			if ( sp == endIt )
+				break;
+		}
+
+		if ( bMatched && m ) {
+			m -> slotVector.resize( nbSlots );
+			Utility::copy( m -> slotVector.getData(), this -> matchSlotVector.getData(), nbSlots );
+		}
+		return bMatched;
+	}
+
+	template<typename T>
+	bool Pattern<T>::match( const BasicString<T> & str, Match * m ) {
+		return _execute( str.getData(), str.getData(), str.getData() + str.getSize(), true, m );
+	}
+
+	template<typename T>
+	bool Pattern<T>::search( const BasicString<T> & str, Match * m ) {
+		return _execute( str.getData(), str.getData(), str.getData() + str.getSize(), false, m );
+	}
+
+	template<typename T>
+	bool Pattern<T>::search( const BasicString<T> & str, const Size offset, Match * m ) {
+		if ( offset > str.getSize() )
+			return false;
+		return _execute( str.getData(), str.getData() + offset, str.getData() + str.getSize(), false, m );
+	}
+
+	template<typename T>
+	Size Pattern<T>::findAll( const BasicString<T> & str, Vector<Match> * matchVector ) {
+		Size nbMatches( 0 );
+		Size offset( 0 );
+		Match m;
+		while ( offset <= str.getSize() && search( str, offset, &m ) ) {
+			matchVector -> push( m );
+			nbMatches++;
+			// An empty match has to advance of one element to avoid an infinite loop.
+			offset = ( m.getEnd() > m.getBegin() ) ? m.getEnd() : m.getEnd() + Size( 1 );
+		}
+		return nbMatches;
+	}
+
+}
@@ -7,6 +7,7 @@
  */
 
  //#define SPEEDTEST_MATH
+ //#define SPEEDTEST_MAT
  //#define SPEEDTEST_DRAWLINE
  //#define SPEEDTEST_DRAWLINE_FLOAT
  //#define SPEEDTEST_GRAPH
@@ -20,15 +21,22 @@
  //#define SPEEDTEST_ARRAYACCESS
  //#define SPEEDTEST_LOGICAL
  //#define SPEEDTEST_BLENDING
+ //#define SPEEDTEST_LOG
  //#define SPEEDTEST_DATE
  //#define SPEEDTEST_DATE_PARSE
  //#define SPEEDTEST_STRING_CONCAT_STRING
  //#define SPEEDTEST_STRING_CONCAT_NUMBER
+ //#define SPEEDTEST_STRING_SSO
  //#define SPEEDTEST_STRING_FORMAT
  //#define SPEEDTEST_STRING_CAST
  //#define SPEEDTEST_REGEX
  //#define SPEEDTEST_VECTOR
  //#define SPEEDTEST_MAP
+ //#define SPEEDTEST_HASHMAP
+ //#define SPEEDTEST_STRING_POOL
+ //#define SPEEDTEST_DOM_ARENA
+ //#define SPEEDTEST_JSON_PARSE
+ //#define SPEEDTEST_XML_READER
  //#define SPEEDTEST_CAST
  //#define SPEEDTEST_ARITHMETIC
  //#define SPEEDTEST_PATH
@@ -38,6 +46,7 @@
 
  //#define DEBUG_UTILITY
  //#define DEBUG_GRAPHIC
+ //#define DEBUG_BLENDING
  //#define DEBUG_XML
 #define DEBUG_JSON
  //#define DEBUG_LIST
@@ -51,6 +60,8 @@
  //#define DEBUG_BASE64
  //#define DEBUG_HEXADECIMAL
  //#define DEBUG_STRING
+ //#define DEBUG_STRING_POOL
+ //#define DEBUG_REGEX
  //#define DEBUG_TIME
  //#define DEBUG_DATE
  //#define DEBUG_PATH
@@ -89,6 +100,8 @@
 #include "UTF8String.h"
 #include "List.h"
 #include "Map.h"
+#include "HashMap.h"
+#include "StringPool.h"
 #include "Application.h"
 #include "FreeImage.h"
 #include "Graphic.h"
@@ -295,6 +308,156 @@ public:
 };
 
 
+/**
+ * @brief		Reference of a Composite blending mode, computed in double with the W3C Compositing and Blending formulas.
+ *
+ * @param	modeI	Mode (0-4 : Over In Out Atop Xor, 5-12 : Multiply Screen Overlay Add Subtract Darken Lighten Difference).
+ * @param	dest 	Normalized RGBA destination.
+ * @param	src  	Normalized RGBA source.
+ * @param	out  	Normalized RGBA result.
+ */
+void compositeReference( const Size modeI, const double* dest, const double* src, double* out ) {
+	const double alphaSrc( src[ 3 ] );
+	const double alphaDest( dest[ 3 ] );
+	double fa( 1.0 );
+	double fb( 1.0 - alphaSrc );
+	switch ( modeI ) {
+		case 1: fa = alphaDest; fb = 0.0; break;
+		case 2: fa = 1.0 - alphaDest; fb = 0.0; break;
+		case 3: fa = alphaDest; break;
+		case 4: fa = 1.0 - alphaDest; break;
+		default: break;
+	}
+	const double alphaOut( alphaSrc * fa + alphaDest * fb );
+	for ( Size c( 0 ); c < Size( 3 ); c++ ) {
+		const double cs( src[ c ] );
+		const double cb( dest[ c ] );
+		double mixed( cs );
+		if ( modeI >= Size( 5 ) ) {
+			double b;
+			switch ( modeI ) {
+				case 5: b = cb * cs; break;
+				case 6: b = cb + cs - cb * cs; break;
+				case 7: b = ( cb <= 0.5 ) ? cs * ( 2.0 * cb ) : cs + ( 2.0 * cb - 1.0 ) - cs * ( 2.0 * cb - 1.0 ); break;
+				case 8: b = ( cb + cs < 1.0 ) ? cb + cs : 1.0; break;
+				case 9: b = ( cb - cs > 0.0 ) ? cb - cs : 0.0; break;
+				case 10: b = ( cb < cs ) ? cb : cs; break;
+				case 11: b = ( cb > cs ) ? cb : cs; break;
+				default: b = ( cb > cs ) ? cb - cs : cs - cb; break;
+			}
+			mixed = ( 1.0 - alphaDest ) * cs + alphaDest * b;
+		}
+		out[ c ] = ( alphaOut == 0.0 ) ? 0.0 : ( alphaSrc * fa * mixed + alphaDest * fb * cb ) / alphaOut;
+	}
+	out[ 3 ] = alphaOut;
+}
+
+/**
+ * @brief		Check a Composite blending functor against compositeReference(), every combination of the alphas 0, 1, 128 and 255 being tested with and without a mask.
+ * 				blendColor() has to be within one unit of the reference, blendSpan() has to give exactly the blendColor() results with every supported instruction set.
+ *
+ * @tparam	BlendFunc	Composite functor.
+ * @param	modeI	Mode of the functor for compositeReference().
+ *
+ * @returns	Number of wrong components.
+ */
+template<typename BlendFunc>
+Size checkCompositeBlending( const Size modeI ) {
+	const unsigned char alphaTable[ 4 ] = { 0, 1, 128, 255 };
+	const unsigned char colorTable[ 4 ] = { 0, 64, 200, 255 };
+	const unsigned char maskTable[ 3 ] = { 255, 128, 0 };
+
+	Vector<Graphic::ColorRGBA<unsigned char>> destVector;
+	Vector<Graphic::ColorRGBA<unsigned char>> srcVector;
+	for ( Size i( 0 ); i < Size( 4 ); i++ ) {
+		for ( Size j( 0 ); j < Size( 4 ); j++ ) {
+			for ( Size k( 0 ); k < Size( 4 ); k++ ) {
+				for ( Size l( 0 ); l < Size( 4 ); l++ ) {
+					destVector.push( Graphic::ColorRGBA<unsigned char>( colorTable[ i ], colorTable[ ( i + 1 ) % 4 ], colorTable[ ( i + 2 ) % 4 ], alphaTable[ j ] ) );
+					srcVector.push( Graphic::ColorRGBA<unsigned char>( colorTable[ k ], colorTable[ ( k + 3 ) % 4 ], colorTable[ ( k + 2 ) % 4 ], alphaTable[ l ] ) );
+				}
+			}
+		}
+	}
+	const Size nbPixels( destVector.getSize() );
+
+	Size nbErrors( 0 );
+	for ( Size maskI( 0 ); maskI < Size( 3 ); maskI++ ) {
+		const unsigned char mask( maskTable[ maskI ] );
+
+		Vector<Graphic::ColorRGBA<unsigned char>> colorVector( destVector );
+		Vector<Graphic::ColorRGBA<float>> colorFloatVector;
+		for ( Size i( 0 ); i < nbPixels; i++ ) {
+			const Graphic::ColorRGBA<unsigned char>& dest( destVector[ i ] );
+			const Graphic::ColorRGBA<unsigned char>& src( srcVector[ i ] );
+			const double destTable[ 4 ] = { dest.r / 255.0, dest.g / 255.0, dest.b / 255.0, dest.a / 255.0 };
+			const double srcTable[ 4 ] = { src.r / 255.0, src.g / 255.0, src.b / 255.0, src.a / 255.0 * ( mask / 255.0 ) };
+			double outTable[ 4 ];
+			compositeReference( modeI, destTable, srcTable, outTable );
+
+			BlendFunc::blendColor( colorVector[ i ], src, mask );
+			const unsigned char outColor[ 4 ] = { colorVector[ i ].r, colorVector[ i ].g, colorVector[ i ].b, colorVector[ i ].a };
+
+			Graphic::ColorRGBA<float> colorFloat( float( destTable[ 0 ] ), float( destTable[ 1 ] ), float( destTable[ 2 ] ), float( destTable[ 3 ] ) );
+			const Graphic::ColorRGBA<float> srcFloat( float( src.r / 255.0 ), float( src.g / 255.0 ), float( src.b / 255.0 ), float( src.a / 255.0 ) );
+			BlendFunc::blendColor( colorFloat, srcFloat, float( mask / 255.0 ) );
+			colorFloatVector.push( colorFloat );
+			const float outColorFloat[ 4 ] = { colorFloat.r, colorFloat.g, colorFloat.b, colorFloat.a };
+
+			for ( Size c( 0 ); c < Size( 4 ); c++ ) {
+				const double expected( ( outTable[ c ] < 0.0 ) ? 0.0 : ( ( outTable[ c ] > 1.0 ) ? 1.0 : outTable[ c ] ) );
+				const double errorInt( double( outColor[ c ] ) - expected * 255.0 );
+				if ( errorInt > 1.0 || errorInt < -1.0 ) {
+					nbErrors++;
+				}
+				const double errorFloat( double( outColorFloat[ c ] ) - outTable[ c ] );
+				if ( errorFloat > 1e-5 || errorFloat < -1e-5 ) {
+					nbErrors++;
+				}
+			}
+		}
+
+		// The spans have to give the same pixels as blendColor(), whatever the instruction set.
+		const CPU::Isa isaTable[ 4 ] = { CPU::Isa::Scalar, CPU::Isa::SSE2, CPU::Isa::AVX2, CPU::Isa::NEON };
+		for ( Size isaI( 0 ); isaI < Size( 4 ); isaI++ ) {
+			CPU::setIsa( isaTable[ isaI ] );
+			if ( CPU::getIsa() != isaTable[ isaI ] ) {
+				continue;
+			}
+			Vector<Graphic::ColorRGBA<unsigned char>> spanVector( destVector );
+			Vector<unsigned char> maskVector( nbPixels );
+			Vector<float> maskFloatVector( nbPixels );
+			for ( Size i( 0 ); i < nbPixels; i++ ) {
+				maskVector[ i ] = mask;
+				maskFloatVector[ i ] = float( mask / 255.0 );
+			}
+			BlendFunc::blendSpan( spanVector.getData(), srcVector.getData(), maskVector.getData(), Size( 1 ), nbPixels );
+
+			Vector<Graphic::ColorRGBA<float>> spanFloatVector;
+			Vector<Graphic::ColorRGBA<float>> srcFloatVector;
+			for ( Size i( 0 ); i < nbPixels; i++ ) {
+				const Graphic::ColorRGBA<unsigned char>& dest( destVector[ i ] );
+				const Graphic::ColorRGBA<unsigned char>& src( srcVector[ i ] );
+				spanFloatVector.push( Graphic::ColorRGBA<float>( float( dest.r / 255.0 ), float( dest.g / 255.0 ), float( dest.b / 255.0 ), float( dest.a / 255.0 ) ) );
+				srcFloatVector.push( Graphic::ColorRGBA<float>( float( src.r / 255.0 ), float( src.g / 255.0 ), float( src.b / 255.0 ), float( src.a / 255.0 ) ) );
+			}
+			BlendFunc::blendSpan( spanFloatVector.getData(), srcFloatVector.getData(), maskFloatVector.getData(), Size( 1 ), nbPixels );
+
+			for ( Size i( 0 ); i < nbPixels; i++ ) {
+				if ( memcmp( &spanVector[ i ], &colorVector[ i ], sizeof( Graphic::ColorRGBA<unsigned char> ) ) != 0 ) {
+					nbErrors++;
+				}
+				if ( memcmp( &spanFloatVector[ i ], &colorFloatVector[ i ], sizeof( Graphic::ColorRGBA<float> ) ) != 0 ) {
+					nbErrors++;
+				}
+			}
+		}
+		CPU::setIsa( CPU::Isa::Auto );
+	}
+	return nbErrors;
+}
+
+
 // In case of Size error : (typename )?(Size
 
 
@@ -373,6 +536,52 @@ int main( int argc, char* argv[] ) {
 			ASSERT( IO::read( OS::Path( "v.test" ), &vec2TableOut ) );
 			ASSERT( vec2TableIn[ 0 ] == vec2TableOut[ 0 ] );
 
+			// Mapped files, growing while written then read without copy.
+			{
+				IO::MappedFileStream mappedStream( OS::Path( "v.test" ), IO::OpenMode::Write );
+				ASSERT( mappedStream.isOpen() );
+				for ( Size i( 0 ); i < Size( 10000 ); i++ ) {
+					ASSERT( IO::write( &mappedStream, &vIn ) );
+				}
+				ASSERT( mappedStream.getSize() == Size( 10000 ) * sizeof( double ) * Size( 2 ) );
+			}
+			{
+				IO::MappedFileStream mappedStream( OS::Path( "v.test" ), IO::OpenMode::Read );
+				ASSERT( mappedStream.getSize() == Size( 10000 ) * sizeof( double ) * Size( 2 ) );
+				ASSERT( IO::read( &mappedStream, &vOut ) );
+				ASSERT( vIn == vOut );
+				const Math::Vec2<double>* vMapped( reinterpret_cast< const Math::Vec2<double> * >( mappedStream.readData( sizeof( Math::Vec2<double> ) ) ) );
+				ASSERT( vMapped && *vMapped == vIn );
+				ASSERT( !mappedStream.write( "a", Size( 1 ) ) );
+			}
+			// IO::readMapped() has to read the same bytes than IO::read().
+			{
+				Vector<double> vectorIn;
+				for ( Size i( 0 ); i < Size( 10000 ); i++ ) {
+					vectorIn.push( double( i ) * 0.5 );
+				}
+				ASSERT( IO::write( OS::Path( "v.test" ), &vectorIn ) );
+
+				Vector<double> vectorRead;
+				Vector<double> vectorMapped;
+				ASSERT( IO::read( OS::Path( "v.test" ), &vectorRead ) );
+				ASSERT( IO::readMapped( OS::Path( "v.test" ), &vectorMapped ) );
+				ASSERT( vectorRead.getSize() == vectorIn.getSize() && vectorMapped.getSize() == vectorIn.getSize() );
+				ASSERT( memcmp( vectorMapped.getData(), vectorRead.getData(), vectorIn.getSize() * sizeof( double ) ) == 0 );
+				ASSERT( memcmp( vectorMapped.getData(), vectorIn.getData(), vectorIn.getSize() * sizeof( double ) ) == 0 );
+				ASSERT( !IO::readMapped( OS::Path( "missing.test" ), &vectorMapped ) );
+
+				// A moved stream keeps the mapping, the source being left closed.
+				IO::MappedFileStream mappedStream( OS::Path( "v.test" ), IO::OpenMode::Read );
+				IO::MappedFileStream movedStream( Utility::toRValue( mappedStream ) );
+				ASSERT( !mappedStream.isOpen() && movedStream.isOpen() );
+				Vector<double> vectorMoved;
+				ASSERT( IO::read( &movedStream, &vectorMoved ) );
+				ASSERT( memcmp( vectorMoved.getData(), vectorIn.getData(), vectorIn.getSize() * sizeof( double ) ) == 0 );
+				mappedStream = Utility::toRValue( movedStream );
+				ASSERT( mappedStream.isOpen() && !movedStream.isOpen() );
+			}
+
 
 			displayInfo( "Every IO Tests passed." );
 		}
@@ -462,6 +671,28 @@ int main( int argc, char* argv[] ) {
 	/* XML PART																*/
 	/************************************************************************/
 #ifdef DEBUG_XML
+	{
+		// A moved document has to keep using it's arena once the source is destroyed.
+		XML::Document movedDocument;
+		{
+			XML::Document parsedDocument;
+			ASSERT( parsedDocument.readXML( UTF8String( "<root><a param=\"1\">A</a><b>B</b></root>" ) ) );
+			movedDocument = Utility::toRValue( parsedDocument );
+		}
+		XML::Document document( Utility::toRValue( movedDocument ) );
+
+		XML::Node * rootNode( document.getRoot() -> getChild( 0 ) );
+		ASSERT( rootNode -> getName() == UTF8String( "root" ) );
+		ASSERT( rootNode -> appendXML( UTF8String( "<c param=\"2\">C</c><d/>" ) ) );
+		ASSERT( rootNode -> getNbChildren() == Size( 4 ) );
+		ASSERT( rootNode -> getChild( 2 ) -> getParam( UTF8String( "param" ) ) -> getValue() == UTF8String( "2" ) );
+		ASSERT( rootNode -> getChild( 0 ) -> deleteParam( Size( 0 ) ) );
+		ASSERT( rootNode -> deleteChild( Size( 0 ) ) );
+		ASSERT( rootNode -> deleteChild( Size( 1 ) ) );
+		ASSERT( rootNode -> getNbChildren() == Size( 2 ) );
+		ASSERT( rootNode -> getChild( 0 ) -> getValue() == UTF8String( "B" ) );
+		ASSERT( rootNode -> getChild( 1 ) -> getName() == UTF8String( "d" ) );
+	}
 	{
 		UTF8String testStr( "Hello world" );
 		UTF8String testDocumentStr( "<?xml version=\"1.0\" encoding=\"UTF - 8\"?><class testParam=\"xD\">test</class>" );
@@ -566,6 +797,25 @@ int main( int argc, char* argv[] ) {
 
 			Log::displayLog( nodeArray.toString() );
 		}
+		{
+			const UTF8String jsonStr( "{ \"test\": { \"test2\" : \"Hello World !\" }, \"xD\":42, \"empty\":{}, \"null\": null, \"array\" : [ \"Hello\" , 42, [{\"object\":10}] ] }" );
+
+			// Nothing but the root is created until accessed.
+			JSON::LazyDocument lazyDocument( jsonStr );
+			ASSERT( lazyDocument.isLazy() );
+
+			int xD( 0 );
+			ASSERT( JSON::fromJSON( lazyDocument.getRoot(), UTF8String( "xD" ), &xD ) );
+			ASSERT( xD == 42 );
+
+			Vector<int> intVector;
+			ASSERT( !JSON::fromJSON( lazyDocument.getRoot(), UTF8String( "null" ), &intVector ) );
+
+			// The lazy tree is the parsed one.
+			JSON::Document document( jsonStr );
+			ASSERT( lazyDocument.toString() == document.toString() );
+			Log::displayLog( lazyDocument.toString() );
+		}
 	}
 #endif
 #ifdef DEBUG_LIST
@@ -680,6 +930,39 @@ int main( int argc, char* argv[] ) {
 			displayError( "Index 42 not founded." );
 		}
 
+		{
+			// Testing the HashMap against the Map.
+			HashMap<unsigned long int, unsigned long int> testHashMap;
+			Map<unsigned long int, unsigned long int> testRefMap;
+			for ( unsigned long int i( 0 ); i < 10000; i++ ) {
+				unsigned long int index( Math::random( 0, 1000 ) );
+				if ( Math::random( 0, 2 ) ) {
+					ASSERT( ( testHashMap.insert( index, i ) != NULL ) == ( testRefMap.insert( index, i ) != NULL ) );
+				} else {
+					ASSERT( testHashMap.eraseI( index ) == testRefMap.eraseI( index ) );
+				}
+			}
+			for ( unsigned long int i( 0 ); i < 1000; i++ ) {
+				const unsigned long int * v1( testHashMap[ i ] );
+				const unsigned long int * v2( testRefMap[ i ] );
+				ASSERT( ( v1 != NULL ) == ( v2 != NULL ) );
+				ASSERT( v1 == NULL || *v1 == *v2 );
+			}
+
+			ASSERT( IO::write( WString( "myHashMap.cmap" ), &testHashMap ) );
+			HashMap<unsigned long int, unsigned long int> hashMapLoaded;
+			ASSERT( IO::read( WString( "myHashMap.cmap" ), &hashMapLoaded ) );
+			ASSERT( hashMapLoaded.getSize() == testHashMap.getSize() );
+
+			HashMap<UTF8String, String> hashMapString;
+			hashMapString.insert( UTF8String( "Hello" ), String( "World !" ) );
+			displayInfo( StringASCII( hashMapString ) );
+
+			HashMap<OS::Path, int> hashMapPath;
+			hashMapPath.insert( OS::Path( "sanctum.ctexture" ), 42 );
+			ASSERT( hashMapPath[ OS::Path( "sanctum.ctexture" ) ] != NULL );
+		}
+
 	}
 #endif
 
@@ -699,6 +982,41 @@ int main( int argc, char* argv[] ) {
 		Log::displayLog( Utility::removePointer( iP ) );
 	}
 #endif
+#ifdef DEBUG_BLENDING
+	{
+		// Every Composite mode against the W3C Compositing and Blending formulas, with the alphas 0 and 255 on both sides.
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Over>( Size( 0 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::In>( Size( 1 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Out>( Size( 2 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Atop>( Size( 3 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Xor>( Size( 4 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Multiply>( Size( 5 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Screen>( Size( 6 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Overlay>( Size( 7 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Add>( Size( 8 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Subtract>( Size( 9 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Darken>( Size( 10 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Lighten>( Size( 11 ) ) == Size( 0 ) );
+		ASSERT( checkCompositeBlending<Graphic::BlendingFunc::Difference>( Size( 12 ) ) == Size( 0 ) );
+
+		// Values of the spec computed by hand.
+		Graphic::ColorRGBA<unsigned char> colorMultiply( 255, 0, 0, 255 );
+		Graphic::BlendingFunc::Multiply::blendColor( colorMultiply, Graphic::ColorRGBA<unsigned char>( 128, 128, 128, 255 ) );
+		ASSERT( colorMultiply.r == 128 && colorMultiply.g == 0 && colorMultiply.b == 0 && colorMultiply.a == 255 );
+
+		Graphic::ColorRGBA<unsigned char> colorIn( 10, 20, 30, 0 );
+		Graphic::BlendingFunc::In::blendColor( colorIn, Graphic::ColorRGBA<unsigned char>( 255, 255, 255, 255 ) );
+		ASSERT( colorIn.r == 0 && colorIn.g == 0 && colorIn.b == 0 && colorIn.a == 0 );
+
+		Graphic::ColorRGBA<unsigned char> colorXor( 0, 0, 255, 255 );
+		Graphic::BlendingFunc::Xor::blendColor( colorXor, Graphic::ColorRGBA<unsigned char>( 255, 0, 0, 255 ) );
+		ASSERT( colorXor.a == 0 );
+
+		Graphic::ColorRGBA<unsigned char> colorOver( 0, 0, 255, 255 );
+		Graphic::BlendingFunc::Over::blendColor( colorOver, Graphic::ColorRGBA<unsigned char>( 255, 0, 0, 0 ) );
+		ASSERT( colorOver.r == 0 && colorOver.g == 0 && colorOver.b == 255 && colorOver.a == 255 );
+	}
+#endif
 
 
 #ifdef DEBUG_GRAPHIC
@@ -1218,7 +1536,7 @@ int main( int argc, char* argv[] ) {
 	// DEBUG : Network									//
 	{
 		int result;
-		std::cout << "0 : Client, 1 : Server, Google Test : 2" << std::endl;
+		std::cout << "0 : Client, 1 : Server, Google Test : 2, Reactor Echo Server : 3" << std::endl;
 		scanf_s( "%d", &result );
 
 		char messageToSend[] = "Hello World !\xE2\x9C\xAD";
@@ -1264,6 +1582,43 @@ int main( int argc, char* argv[] ) {
 				clientConnection.send( messageToSend, sizeof( messageToSend ) );
 				*/
 			}
+		} else if ( result == 3 ) {
+			//REACTOR ECHO SERVER
+			struct AcceptFunc {
+				bool operator()( Network::Connection * client ) {
+					Log::displayLog( StringASCII( "New client " ) << client -> getIp() );
+					return true;
+				}
+			};
+			struct ReadFunc {
+				bool operator()( Network::Connection * client ) {
+					char buffer[ 4096 ];
+					while ( true ) {
+						int amountRead( client -> receive( buffer, sizeof( buffer ) ) );
+						if ( amountRead > 0 ) {
+							client -> send( buffer, amountRead );
+						} else {
+							// Edge-triggered : read until the socket is drained, 0 means the client left.
+							return amountRead < 0 && Network::Connection::isWouldBlock();
+						}
+					}
+				}
+			};
+			struct WriteFunc {
+				bool operator()( Network::Connection * client ) {
+					return true;
+				}
+			};
+
+			Network::Server myTCPServer;
+			myTCPServer.listen( 5001, Network::SockType::TCP, Network::IpFamily::Undefined );
+
+			AcceptFunc acceptFunc;
+			ReadFunc readFunc;
+			WriteFunc writeFunc;
+			while ( myTCPServer.poll( acceptFunc, readFunc, writeFunc ) >= 0 ) {
+				Log::displayLog( StringASCII( "Clients : " ) << myTCPServer.getNumClients() );
+			}
 		} else {
 			/////GOOGLE TEST
 			Network::Connection myTCPConnection;
@@ -1341,6 +1696,28 @@ int main( int argc, char* argv[] ) {
 			Log::displayLog( response1->getContent() );
 		}
 
+		// Same queries pipelined on one keep-alive connection of the pool.
+		{
+			Network::HTTPRequest request( Network::HTTPRequest::Verb::GET, Network::HTTPRequest::Sheme::HTTPS, StringASCII( "fapi.binance.com" ) );
+			request.setPath( StringASCII( "/fapi/v1/premiumIndex" ) );
+			request.setUrlParams( paramVector );
+
+			Vector<const Network::HTTPRequest*> requestVector;
+			Vector<Network::HTTPResponse*> responseVector;
+			for ( Size i( 0 ); i < Size( 10 ); i++ ) {
+				requestVector.push( &request );
+				responseVector.push( new Network::HTTPResponse() );
+			}
+			if ( client.queryPipelined( requestVector, responseVector, 1 ) ) {
+				Log::displayLog( responseVector[ Size( 9 ) ]->getContent() );
+			} else {
+				Log::displayError( "Pipelined queries failed." );
+			}
+			for ( Size i( 0 ); i < responseVector.getSize(); i++ ) {
+				delete responseVector[ i ];
+			}
+		}
+
 		Log::displaySuccess( "Success." );
 	}
 #endif
@@ -1493,6 +1870,289 @@ int main( int argc, char* argv[] ) {
 		Log::displayLog( parsedValue );
 		Log::displayLog( StringASCII::toInt( iterable ) );
 
+		// Small string optimization : crossing the boundary between the small table and the heap both ways.
+		{
+			class IsSmall {
+			public:
+				bool operator()( const StringASCII& str ) const {
+					return ( const char* ) str.getData() >= ( const char* ) &str && ( const char* ) str.getData() < ( const char* ) ( &str + 1 );
+				}
+			};
+			IsSmall isSmall;
+			const StringASCII longChars( "0123456789abcdefghijklmnopqrstuvwxyz" );
+
+			// Grow past the capacity of the small table.
+			StringASCII strGrow( "Hello" );
+			ASSERT( isSmall( strGrow ) );
+			strGrow += StringASCII( " World !" );
+			ASSERT( isSmall( strGrow ) );
+			strGrow += longChars;
+			ASSERT( !isSmall( strGrow ) );
+			ASSERT( strGrow == StringASCII( "Hello World !0123456789abcdefghijklmnopqrstuvwxyz" ) );
+			ASSERT( strGrow.getData()[ strGrow.getSize() ] == '\0' );
+
+			// Shrink, a short copy of a heap string going back in the small table.
+			strGrow.resize( StringASCII::Size( 5 ) );
+			ASSERT( strGrow == StringASCII( "Hello" ) );
+			ASSERT( strGrow.getData()[ 5 ] == '\0' );
+			const StringASCII strShrunk( strGrow );
+			ASSERT( isSmall( strShrunk ) );
+			ASSERT( strShrunk == StringASCII( "Hello" ) );
+			ASSERT( strShrunk.getSize() == StringASCII::Size( 5 ) );
+			ASSERT( strShrunk.getData()[ 5 ] == '\0' );
+
+			// Move a small string, its characters are copied and the result has its sentinel.
+			StringASCII strSmall( "Small" );
+			StringASCII strSmallMoved( Utility::toRValue( strSmall ) );
+			ASSERT( isSmall( strSmallMoved ) );
+			ASSERT( strSmallMoved == StringASCII( "Small" ) );
+			ASSERT( strSmallMoved.getData()[ strSmallMoved.getSize() ] == '\0' );
+
+			// Move a heap string, its table is taken.
+			StringASCII strHeap( longChars );
+			const char* heapData( strHeap.getData() );
+			StringASCII strHeapMoved( Utility::toRValue( strHeap ) );
+			ASSERT( strHeapMoved.getData() == heapData );
+			ASSERT( strHeapMoved == longChars );
+
+			// Move assign a small string into a heap one and a heap string into a small one.
+			StringASCII strHeapToSmall( longChars );
+			strHeapToSmall = StringASCII( "Tiny" );
+			ASSERT( strHeapToSmall == StringASCII( "Tiny" ) );
+			ASSERT( strHeapToSmall.getData()[ 4 ] == '\0' );
+			StringASCII strSmallToHeap( "Tiny" );
+			strSmallToHeap = StringASCII( longChars );
+			ASSERT( !isSmall( strSmallToHeap ) );
+			ASSERT( strSmallToHeap == longChars );
+
+			// Swap a small string with a heap one.
+			StringASCII strSwap1( "Tiny" );
+			StringASCII strSwap2( longChars );
+			Utility::swap( strSwap1, strSwap2 );
+			ASSERT( strSwap1 == longChars );
+			ASSERT( strSwap2 == StringASCII( "Tiny" ) );
+			Utility::swap( strSwap1, strSwap2 );
+			ASSERT( strSwap1 == StringASCII( "Tiny" ) );
+			ASSERT( strSwap2 == longChars );
+
+			// Self assignment, small and heap.
+			StringASCII strSelfSmall( "Tiny" );
+			StringASCII strSelfHeap( longChars );
+			StringASCII& strSelfSmallRef( strSelfSmall );
+			StringASCII& strSelfHeapRef( strSelfHeap );
+			strSelfSmall = strSelfSmallRef;
+			strSelfHeap = strSelfHeapRef;
+			ASSERT( strSelfSmall == StringASCII( "Tiny" ) );
+			ASSERT( strSelfHeap == longChars );
+			strSelfSmall = Utility::toRValue( strSelfSmallRef );
+			strSelfHeap = Utility::toRValue( strSelfHeapRef );
+			ASSERT( strSelfSmall == StringASCII( "Tiny" ) );
+			ASSERT( strSelfHeap == longChars );
+		}
+
+		// Format : '%' escaped with a backslash, the number of values of a constexpr Format checked at compile time.
+		{
+			static constexpr auto escapeFormat( StringASCII::makeFormat( "% \\% of %" ) );
+			ASSERT( escapeFormat.getNbArgs() == StringASCII::Size( 2 ) );
+			ASSERT( StringASCII::format<escapeFormat>( 50, StringASCII( "users" ) ) == StringASCII( "50 % of users" ) );
+			ASSERT( StringASCII::format( "% \\% of %", 50, StringASCII( "users" ) ) == StringASCII( "50 % of users" ) );
+			ASSERT( StringASCII::format( "\\%%", 50 ) == StringASCII( "%50" ) );
+		}
+
+		// Float to String : the shortest output reads back to the same value, the fixed one is rounded the same way for every magnitude.
+		{
+			const double roundTripTable[] = { 0.1, 0.2, 0.3, 1.0 / 3.0, 2.675, 123456.789, 1e22, 1e23, 9007199254740993.0, 1.7976931348623157e308, 2.2250738585072014e-308, 2.2250738585072009e-308, 4.9406564584124654e-324, 1.5e-323, -2.5, -1e-300 };
+			for ( Size i( 0 ); i < sizeof( roundTripTable ) / sizeof( double ); i++ ) {
+				const StringASCII str( roundTripTable[ i ], StringASCII::ShortestPrecision );
+				ASSERT( StringASCII::toDouble( str.getData() ) == roundTripTable[ i ] );
+			}
+			const float roundTripFloatTable[] = { 0.1f, 1.0f / 3.0f, 16777217.0f, 3.4028235e38f, 1.17549435e-38f, 1.4e-45f, -7.5f };
+			for ( Size i( 0 ); i < sizeof( roundTripFloatTable ) / sizeof( float ); i++ ) {
+				const StringASCII str( roundTripFloatTable[ i ], StringASCII::ShortestPrecision );
+				ASSERT( StringASCII::toFloat( str.getData() ) == roundTripFloatTable[ i ] );
+			}
+
+			ASSERT( StringASCII( 0.1, StringASCII::ShortestPrecision ) == StringASCII( "0.1" ) );
+			ASSERT( StringASCII( 1e23, StringASCII::ShortestPrecision ) == StringASCII( "1E23" ) );
+			ASSERT( StringASCII( 4.9406564584124654e-324, StringASCII::ShortestPrecision ) == StringASCII( "5E-324" ) );
+
+			// -0 keeps its sign.
+			const StringASCII strNegativeZero( -0.0, StringASCII::ShortestPrecision );
+			ASSERT( strNegativeZero == StringASCII( "-0" ) );
+			ASSERT( StringASCII::toDouble( strNegativeZero.getData() ) == 0.0 && std::signbit( StringASCII::toDouble( strNegativeZero.getData() ) ) );
+			ASSERT( StringASCII( 0.0, StringASCII::ShortestPrecision ) == StringASCII( "0" ) );
+
+			// Fixed precision, rounded half up from the shortest decimal, below and above 1e9.
+			ASSERT( StringASCII( 2.675, 2 ) == StringASCII( "2.68" ) );
+			ASSERT( StringASCII( 9.995, 2 ) == StringASCII( "10.00" ) );
+			ASSERT( StringASCII( 0.0004, 2 ) == StringASCII( "0.00" ) );
+			ASSERT( StringASCII( 999999999.6, 0 ) == StringASCII( "1000000000." ) );
+			ASSERT( StringASCII( 0.1, 20 ) == StringASCII( "0.10000000000000000000" ) );
+			ASSERT( StringASCII( 123456789012.0, 5 ) == StringASCII( "1.2346E11" ) );
+			ASSERT( StringASCII( 9.9999e9, 3 ) == StringASCII( "1.00E10" ) );
+			ASSERT( StringASCII( 1e23, 5 ) == StringASCII( "1.0000E23" ) );
+			ASSERT( StringASCII( -1e23, 5 ) == StringASCII( "-1.0000E23" ) );
+		}
+
+		// String to float : exponents, halfway values, 8 digits at once and more than 19 digits (slow path).
+		{
+			ASSERT( StringASCII::toDouble( "1e5" ) == 1e5 );
+			ASSERT( StringASCII::toDouble( "1E5" ) == 1e5 );
+			ASSERT( StringASCII::toDouble( "1.5e-3" ) == 1.5e-3 );
+			ASSERT( StringASCII::toDouble( "2.5E+3" ) == 2.5e3 );
+			ASSERT( StringASCII::toDouble( "7E-0" ) == 7.0 );
+			ASSERT( StringASCII::toDouble( "3.e2" ) == 300.0 );
+			ASSERT( StringASCII::toDouble( "-1e-310" ) == -1e-310 );
+			ASSERT( Utility::isInf<double>( StringASCII::toDouble( "1e400" ) ) );
+			ASSERT( StringASCII::toDouble( "1e-400" ) == 0.0 );
+			// An exponent without digits is not read.
+			ASSERT( StringASCII::toDouble( "1e" ) == 1.0 );
+			ASSERT( StringASCII::toDouble( "1e+" ) == 1.0 );
+
+			// 8 digits at once, then one at a time.
+			ASSERT( StringASCII::toDouble( "12345678.9" ) == 12345678.9 );
+			ASSERT( StringASCII::toDouble( "1234567812345678" ) == 1234567812345678.0 );
+			ASSERT( StringASCII::toDouble( "0.1234567812345678" ) == 0.1234567812345678 );
+			ASSERT( StringASCII::toDouble( "12345678123456781234" ) == 12345678123456781234.0 );
+
+			// Halfway between two doubles, ties to even.
+			ASSERT( StringASCII::toDouble( "9007199254740993" ) == 9007199254740992.0 );
+			ASSERT( StringASCII::toDouble( "9007199254740995" ) == 9007199254740996.0 );
+			ASSERT( StringASCII::toDouble( "2.4703282292062327e-324" ) == 0.0 );
+			ASSERT( StringASCII::toDouble( "2.4703282292062328e-324" ) == 4.9406564584124654e-324 );
+
+			// More than 19 digits, the truncated ones deciding the rounding.
+			ASSERT( StringASCII::toDouble( "1.00000000000000011102230246251565404236316680908203124" ) == 1.0 );
+			ASSERT( StringASCII::toDouble( "1.00000000000000011102230246251565404236316680908203125" ) == 1.0 );
+			ASSERT( StringASCII::toDouble( "1.00000000000000011102230246251565404236316680908203126" ) == 1.0000000000000002 );
+			ASSERT( StringASCII::toDouble( "9007199254740993.000000000000000000001" ) == 9007199254740994.0 );
+			ASSERT( StringASCII::toDouble( "9007199254740992.9999999999999999" ) == 9007199254740992.0 );
+			ASSERT( StringASCII::toDouble( "123456789012345678901234567890" ) == 123456789012345678901234567890.0 );
+			ASSERT( StringASCII::toDouble( "0.000000000000000000000000000001234567890123456789012" ) == 1.234567890123456789012e-30 );
+			ASSERT( WString::toDouble( L"1.00000000000000011102230246251565404236316680908203126" ) == 1.0000000000000002 );
+
+			ASSERT( StringASCII::toFloat( "16777217" ) == 16777216.0f );
+			ASSERT( StringASCII::toFloat( "16777217.000000001" ) == 16777218.0f );
+			ASSERT( StringASCII::toFloat( "0.1" ) == 0.1f );
+			ASSERT( StringASCII::toFloat( "3.4028235e38" ) == 3.4028235e38f );
+			ASSERT( StringASCII::toFloat( "1.4e-45" ) == 1.4e-45f );
+		}
+	}
+#endif
+#ifdef DEBUG_STRING_POOL
+	//////////////////////////////////////////////////////////////////////////
+	// DEBUG : String Pool										//
+	{
+		StringPoolT<StringASCII> pool;
+
+		// The same characters give the same entry, stored inside the pool.
+		const StringASCII nameStr( "name" );
+		InternedStringT<StringASCII> name( nameStr, pool );
+		ASSERT( name == InternedStringT<StringASCII>( "name", pool ) );
+		ASSERT( name != InternedStringT<StringASCII>( "value", pool ) );
+		ASSERT( name.toCString() != nameStr.toCString() );
+		ASSERT( name.getSize() == Size( 4 ) && name.getString() == nameStr );
+		ASSERT( name.getHash() == Math::Hash::hash( nameStr ) );
+		ASSERT( pool.getNbStrings() == Size( 2 ) );
+
+		// The empty string is never inserted and shared by every pool.
+		ASSERT( InternedStringT<StringASCII>( "", pool ) == InternedStringT<StringASCII>() );
+		ASSERT( InternedStringT<StringASCII>().getSize() == Size( 0 ) && InternedStringT<StringASCII>().toCString()[ 0 ] == '\0' );
+		ASSERT( pool.getNbStrings() == Size( 2 ) );
+
+		// Past 48 entries the table is grown, the entries keeping their address.
+		Vector<InternedStringT<StringASCII>> internedVector;
+		for ( Size i( 0 ); i < Size( 1000 ); i++ ) {
+			internedVector.push( InternedStringT<StringASCII>( StringASCII( "key" ) << i, pool ) );
+		}
+		ASSERT( pool.getNbStrings() == Size( 1002 ) );
+		for ( Size i( 0 ); i < Size( 1000 ); i++ ) {
+			ASSERT( internedVector[ i ] == InternedStringT<StringASCII>( StringASCII( "key" ) << i, pool ) );
+		}
+		ASSERT( name == InternedStringT<StringASCII>( "name", pool ) );
+
+		// The order is the one of the hashes, then of the characters.
+		ASSERT( ( name < InternedStringT<StringASCII>( "value", pool ) ) == ( name.getHash() < InternedStringT<StringASCII>( "value", pool ).getHash() ) );
+		ASSERT( !( name < name ) && !( name > name ) );
+
+		// Interning from several threads at once.
+		ThreadPool threadPool( Size( 4 ) );
+		Vector<InternedStringT<StringASCII>> threadVector( Size( 4000 ) );
+		auto internFunc( [ &pool, &threadVector ] ( const Size taskI ) {
+			threadVector[ taskI ] = InternedStringT<StringASCII>( StringASCII( "thread" ) << ( taskI % Size( 1000 ) ), pool );
+		} );
+		threadPool.run( Size( 4000 ), internFunc );
+		ASSERT( pool.getNbStrings() == Size( 2002 ) );
+		for ( Size i( 0 ); i < Size( 4000 ); i++ ) {
+			ASSERT( threadVector[ i ] == threadVector[ i % Size( 1000 ) ] );
+			ASSERT( threadVector[ i ].getString() == StringASCII( "thread" ) << ( i % Size( 1000 ) ) );
+		}
+	}
+#endif
+#ifdef DEBUG_REGEX
+	//////////////////////////////////////////////////////////////////////////
+	// DEBUG : Regex Pattern									//
+	{
+		Regex::Match m;
+		Vector<Regex::Match> matchVector;
+
+		// Capture groups.
+		Regex::Pattern<char> datePattern( StringASCII( "(\\d+)-(\\d+)-(\\d+)" ) );
+		ASSERT( datePattern.isCompiled() && datePattern.getNbGroups() == Size( 4 ) );
+		const StringASCII dateStr( "Date : 2024-10-17." );
+		ASSERT( datePattern.search( dateStr, &m ) );
+		ASSERT( m.getBegin() == Size( 7 ) && m.getEnd() == Size( 17 ) );
+		ASSERT( m.getGroup( dateStr ) == StringASCII( "2024-10-17" ) );
+		ASSERT( m.getGroup( dateStr, Size( 1 ) ) == StringASCII( "2024" ) );
+		ASSERT( m.getGroup( dateStr, Size( 2 ) ) == StringASCII( "10" ) );
+		ASSERT( m.getGroup( dateStr, Size( 3 ) ) == StringASCII( "17" ) );
+		ASSERT( !datePattern.match( dateStr ) );
+		ASSERT( datePattern.match( StringASCII( "1-2-3" ) ) );
+
+		// A group not taking part to the match.
+		Regex::Pattern<char> optionalPattern( StringASCII( "a(b)?(?:c|d)" ) );
+		ASSERT( optionalPattern.getNbGroups() == Size( 2 ) );
+		ASSERT( optionalPattern.match( StringASCII( "ad" ), &m ) );
+		ASSERT( m.isMatched() && !m.isMatched( Size( 1 ) ) );
+		ASSERT( optionalPattern.match( StringASCII( "abc" ), &m ) && m.isMatched( Size( 1 ) ) );
+
+		// Alternation, the leftmost alternative having the priority.
+		Regex::Pattern<char> alternatePattern( StringASCII( "(cat|category|dog)" ) );
+		const StringASCII animalStr( "category dog" );
+		ASSERT( alternatePattern.search( animalStr, &m ) && m.getGroup( animalStr, Size( 1 ) ) == StringASCII( "cat" ) );
+		ASSERT( alternatePattern.match( StringASCII( "category" ), &m ) && m.getEnd() == Size( 8 ) );
+		ASSERT( alternatePattern.findAll( animalStr, &matchVector ) == Size( 2 ) );
+		ASSERT( matchVector[ 1 ].getGroup( animalStr ) == StringASCII( "dog" ) );
+
+		// Lazy and greedy repetitions.
+		const StringASCII tagStr( "<a><b>" );
+		ASSERT( Regex::Pattern<char>( StringASCII( "<.+>" ) ).search( tagStr, &m ) && m.getEnd() == Size( 6 ) );
+		ASSERT( Regex::Pattern<char>( StringASCII( "<.+?>" ) ).search( tagStr, &m ) && m.getEnd() == Size( 3 ) );
+
+		// Anchors, '^' still refering to the beginning of the string when searching from an offset.
+		Regex::Pattern<char> anchoredPattern( StringASCII( "^ab+$" ) );
+		ASSERT( anchoredPattern.search( StringASCII( "abbb" ) ) );
+		ASSERT( !anchoredPattern.search( StringASCII( "xabbb" ) ) );
+		ASSERT( !anchoredPattern.search( StringASCII( "abbbx" ) ) );
+		ASSERT( !anchoredPattern.search( StringASCII( "xab" ), Size( 1 ) ) );
+
+		// No match.
+		Regex::Pattern<char> wordPattern( StringASCII( "[a-z]+\\d" ) );
+		ASSERT( !wordPattern.search( StringASCII( "ABC 123 abc" ), &m ) );
+		matchVector.clear();
+		ASSERT( wordPattern.findAll( StringASCII( "ABC" ), &matchVector ) == Size( 0 ) && matchVector.getSize() == Size( 0 ) );
+
+		// Empty pattern, matching the empty string at every position.
+		Regex::Pattern<char> emptyPattern( StringASCII( "" ) );
+		ASSERT( emptyPattern.isCompiled() );
+		ASSERT( emptyPattern.match( StringASCII( "" ) ) );
+		ASSERT( !emptyPattern.match( StringASCII( "a" ) ) );
+		ASSERT( emptyPattern.search( StringASCII( "abc" ), &m ) && m.getBegin() == Size( 0 ) && m.getEnd() == Size( 0 ) );
+		ASSERT( emptyPattern.findAll( StringASCII( "ab" ), &matchVector ) == Size( 3 ) );
+
+		// Invalid regex.
+		ASSERT( !Regex::Pattern<char>( StringASCII( "(ab" ) ).isCompiled() );
+		ASSERT( !Regex::Pattern<char>( StringASCII( "(ab" ) ).search( StringASCII( "ab" ) ) );
 	}
 #endif
 #ifdef DEBUG_TIME
@@ -1653,6 +2313,36 @@ int main( int argc, char* argv[] ) {
 
 		displayInfo( Math::sum( m7 ) );
 
+		{
+			// Testing the blocked product against the naive one, transposed operands included.
+			Math::Mat<float> a( Size( 131 ), Size( 67 ) );
+			Math::Mat<float> b( Size( 67 ), Size( 45 ) );
+			a.randomF();
+			b.randomF();
+			Math::Mat<float> aT( a );
+			Math::Mat<float> bT( b );
+			aT.transpose();
+			bT.transpose();
+
+			Math::Mat<float> r( a.getSizeM(), b.getSizeN() );
+			Math::Gemm::multiplyNaive( a.getSizeM(), b.getSizeN(), a.getSizeN(), a.getData(), a.getSizeN(), Math::Gemm::Op::None, b.getData(), b.getSizeN(), Math::Gemm::Op::None, r.getData(), r.getSizeN() );
+
+			Math::Mat<float> c;
+			ASSERT( c.setMul( a, b ) == r );
+			ASSERT( c.setMul( aT, b, Math::Gemm::Op::Transpose ) == r );
+			ASSERT( c.setMul( a, bT, Math::Gemm::Op::None, Math::Gemm::Op::Transpose ) == r );
+			ASSERT( c.setMul( aT, bT, Math::Gemm::Op::Transpose, Math::Gemm::Op::Transpose ) == r );
+			ASSERT( a * b == r );
+
+			c.zeros();
+			c.addMul( a, b );
+			ASSERT( c == r );
+			Math::Mat<float> r2( r );
+			r2 *= Math::Mat<float>( Size( 45 ), Size( 45 ) ).identity();
+			ASSERT( r2 == r );
+
+			displayInfo( "Blocked Mat product OK." );
+		}
 	}
 #endif
 #ifdef DEBUG_TENSOR
@@ -1861,6 +2551,63 @@ int main( int argc, char* argv[] ) {
 		}
 	}
 #endif
+#ifdef SPEEDTEST_MAT
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// SPEED TEST : Mat product								//
+		const CPU::Isa isaTable[ 3 ] = { CPU::Isa::Scalar, CPU::Isa::SSE2, CPU::Isa::AVX };
+		const char * isaNameTable[ 3 ] = { "Scalar", "SSE2", "AVX" };
+		const Size sizeTable[ 3 ] = { Size( 64 ), Size( 256 ), Size( 1024 ) };
+
+		for ( Size sizeI( 0 ); sizeI < Size( 3 ); sizeI++ ) {
+			const Size size( sizeTable[ sizeI ] );
+			Math::Mat<float> a( size, size );
+			Math::Mat<float> b( size, size );
+			Math::Mat<float> c( size, size );
+			a.randomF();
+			b.randomF();
+
+			Log::startChrono();
+			Math::Gemm::multiplyNaive( size, size, size, a.getData(), size, Math::Gemm::Op::None, b.getData(), size, Math::Gemm::Op::None, c.getData(), size );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "Mat<float> %x% product Naive", size, size ) );
+
+			for ( Size isaI( 0 ); isaI < Size( 3 ); isaI++ ) {
+				CPU::setIsa( isaTable[ isaI ] );
+				if ( CPU::getIsa() != isaTable[ isaI ] ) {
+					continue;
+				}
+				Log::startChrono();
+				c.setMul( a, b );
+				Log::stopChrono();
+				Log::displayChrono( String::format( "Mat<float> %x% product %", size, size, isaNameTable[ isaI ] ) );
+			}
+			CPU::setIsa( CPU::Isa::Auto );
+
+			Log::startChrono();
+			c.addMul( a, b, Math::Gemm::Op::Transpose, Math::Gemm::Op::Transpose );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "Mat<float> %x% C += At * Bt", size, size ) );
+		}
+		{
+			Math::Mat<double> a( Size( 512 ), Size( 512 ) );
+			Math::Mat<double> b( Size( 512 ), Size( 512 ) );
+			Math::Mat<double> c( Size( 512 ), Size( 512 ) );
+			a.randomF();
+			b.randomF();
+
+			Log::startChrono();
+			Math::Gemm::multiplyNaive( Size( 512 ), Size( 512 ), Size( 512 ), a.getData(), Size( 512 ), Math::Gemm::Op::None, b.getData(), Size( 512 ), Math::Gemm::Op::None, c.getData(), Size( 512 ) );
+			Log::stopChrono();
+			Log::displayChrono( "Mat<double> 512x512 product Naive" );
+
+			Log::startChrono();
+			c.setMul( a, b );
+			Log::stopChrono();
+			Log::displayChrono( "Mat<double> 512x512 product Blocked" );
+		}
+	}
+#endif
 #ifdef SPEEDTEST_DRAWLINE
 	{
 		//////////////////////////////////////////////////////////////////////////
@@ -2012,6 +2759,15 @@ int main( int argc, char* argv[] ) {
 		Log::stopChrono();
 		Log::displayChrono( "DRAW \"Hello World\" (Last Result: 1.629s for M1)" );
 
+		// Chart labels, the same few strings drawn over and over (laid out once, then taken from the text run cache).
+		UTF8String labels[] = { "0.00", "0.25", "0.50", "0.75", "1.00", "Latency (ms)", "Requests / s" };
+		Log::startChrono();
+		for ( size_t i = 0; i < M1; i++ ) {
+			Graphic::drawText( &image, font, Graphic::Point( 20 + int( i % 400 ), 300 ), labels[ i % 7 ], Graphic::ColorRGB<unsigned char>( 20, 20, 20 ), Math::Vec2<bool>( false, true ) );
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "DRAW LABELS (Atlas of " ) << font.getGlyphAtlas().getNbGlyphs() << " glyphs)" );
+
 
 		Graphic::FreeImage freeImage;
 		freeImage.loadFromDatas( ( unsigned char* ) image.getDatas(), image.getSize(), Graphic::FreeImage::Format::RGB );
@@ -2073,6 +2829,32 @@ int main( int argc, char* argv[] ) {
 		Log::stopChrono();
 		Log::displayChrono( "RESAMPLE FreeImage LINEAR RGB (Last Result: 1900ms for K1)" );
 
+		{
+			// Thumbnails on the calling thread only, then split by bands of rows across a thread pool (the images have to be bit-identical).
+			ThreadPool threadPool;
+			const Graphic::Image::ResamplingMode resamplingModeTable[ 5 ] = { Graphic::Image::ResamplingMode::Nearest, Graphic::Image::ResamplingMode::Bilinear, Graphic::Image::ResamplingMode::Lanczos, Graphic::Image::ResamplingMode::Bicubic, Graphic::Image::ResamplingMode::Area };
+			const char * resamplingModeNameTable[ 5 ] = { "NEAREST", "LINEAR", "LANCZOS", "BICUBIC", "AREA" };
+			for ( Size i( 0 ); i < Size( 5 ); i++ ) {
+				Graphic::ImageT<unsigned char> imageResultTable[ 2 ];
+				for ( Size j( 0 ); j < Size( 2 ); j++ ) {
+					Graphic::setThreadPool( j ? &threadPool : NULL );
+					Log::startChrono();
+					for ( size_t k = 0; k < K1; k++ ) {
+						imageResultTable[ j ] = imageOriginal.resample( Math::Vec2<Graphic::Size>( 200, 150 ), resamplingModeTable[ i ] );
+					}
+					Log::stopChrono();
+					Log::displayChrono( String::format( "RESAMPLE % RGB THUMBNAIL with % threads", resamplingModeNameTable[ i ], j ? threadPool.getNbThreads() : Size( 1 ) ) );
+				}
+				Graphic::setThreadPool( NULL );
+
+				Size nbDifferences( 0 );
+				for ( size_t k = 0; k < imageResultTable[ 0 ].getNbPixels() * imageResultTable[ 0 ].getNbComponents(); k++ ) {
+					if ( imageResultTable[ 0 ].getDatas()[ k ] != imageResultTable[ 1 ].getDatas()[ k ] ) nbDifferences++;
+				}
+				Log::displayLog( String::format( "RESAMPLE % : % differences between the serial and the parallel results.", resamplingModeNameTable[ i ], nbDifferences ) );
+			}
+		}
+
 
 		Graphic::FreeImage freeImageOut;
 		freeImageOut.loadFromDatas( ( unsigned char* ) image.getDatas(), image.getSize(), Graphic::FreeImage::Format::RGB );
@@ -2104,6 +2886,34 @@ int main( int argc, char* argv[] ) {
 		freeImage.loadFromDatas( ( unsigned char* ) image.getDatas(), image.getSize(), Graphic::FreeImage::Format::R );
 		freeImage.saveToFile( "polygon.png", Graphic::FreeImage::CompressedFormat::PNG );
 	}
+
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// SPEED TEST : Rasterizer (a whole chart in one pass)					//
+
+		Graphic::ImageT<unsigned char> image( Math::Vec2<Graphic::Size>( 500 ), Graphic::Format::R );
+
+		// 200 bars, each one a polygon, all drawn with a single rasterization.
+		Graphic::Rasterizer rasterizer;
+		for ( size_t i = 0; i < 200; i++ ) {
+			const float left( 50.0f + float( i ) * 2.0f );
+			const float top( 50.0f + float( ( i * 37 ) % 400 ) + 0.5f );
+			Math::Vec2<float> bar[] = { Math::Vec2<float>( left + 0.25f, 50.0f ), Math::Vec2<float>( left + 1.75f, 50.0f ), Math::Vec2<float>( left + 1.75f, top ), Math::Vec2<float>( left + 0.25f, top ) };
+			rasterizer.addPolygon( bar, 4 );
+		}
+		Graphic::ColorFunc::SimpleColor<Graphic::ColorR<unsigned char>> colorFunc( Graphic::ColorR<unsigned char>( 128 ) );
+
+		Log::startChrono();
+		for ( size_t i = 0; i < K1; i++ ) {
+			image.drawRasterizerFunctor( rasterizer, Graphic::Rectangle( image.getSize() ), colorFunc );
+		}
+		Log::stopChrono();
+		Log::displayChrono( "DRAW RASTERIZER 200 POLYGONS R -> R" );
+
+		Graphic::FreeImage freeImage;
+		freeImage.loadFromDatas( ( unsigned char* ) image.getDatas(), image.getSize(), Graphic::FreeImage::Format::R );
+		freeImage.saveToFile( "rasterizer.png", Graphic::FreeImage::CompressedFormat::PNG );
+	}
 #endif
 
 #ifdef SPEEDTEST_FILTER
@@ -2133,6 +2943,65 @@ int main( int argc, char* argv[] ) {
 		Log::stopChrono();
 		Log::displayChrono( "FILTER RGB FLOAT (Last Result: 15.1s for K1)" );
 
+		{
+			// Same filters split by bands of rows across a thread pool (the images have to be bit-identical).
+			ThreadPool threadPool;
+			Graphic::setThreadPool( &threadPool );
+
+			Graphic::ImageT<unsigned char> imageMT( freeImageIn.getDatas(), Math::Vec2<Graphic::Size>( 500 ), Graphic::LoadingFormat::BGR, false );
+			Graphic::ImageT<float> imagefMT( imageMT );
+
+			Log::startChrono();
+			for ( size_t i = 0; i < K1; i++ ) {
+				imageMT = imageMT.applyGaussianBlur( 5, Graphic::Image::ConvolutionMode::NormalSize, Graphic::ColorRGBA<unsigned char>( 0, 0, 0, 0 ) );
+			}
+			Log::stopChrono();
+			Log::displayChrono( String::format( "FILTER RGB UCHAR with % threads", threadPool.getNbThreads() ) );
+
+			Log::startChrono();
+			for ( size_t i = 0; i < K1; i++ ) {
+				imagefMT = imagefMT.applyGaussianBlur( 5, Graphic::ImageT<float>::ConvolutionMode::NormalSize, Graphic::ColorRGBA<float>( 0, 0, 0, 0 ) );
+			}
+			Log::stopChrono();
+			Log::displayChrono( String::format( "FILTER RGB FLOAT with % threads", threadPool.getNbThreads() ) );
+
+			Graphic::setThreadPool( NULL );
+
+			Size nbDifferences( 0 );
+			for ( size_t i = 0; i < image.getNbPixels() * image.getNbComponents(); i++ ) {
+				if ( image.getDatas()[ i ] != imageMT.getDatas()[ i ] ) nbDifferences++;
+				if ( imagef.getDatas()[ i ] != imagefMT.getDatas()[ i ] ) nbDifferences++;
+			}
+			Log::displayLog( String::format( "FILTER : % differences between the serial and the parallel results.", nbDifferences ) );
+		}
+
+		{
+			// Large radius : exact kernel against the three box filters approximation.
+			Graphic::ImageT<unsigned char> imageLarge( freeImageIn.getDatas(), Math::Vec2<Graphic::Size>( 500 ), Graphic::LoadingFormat::BGR, false );
+			Graphic::ImageT<unsigned char> imageKernel;
+			Graphic::ImageT<unsigned char> imageBox;
+
+			Log::startChrono();
+			for ( size_t i = 0; i < 10; i++ ) {
+				imageKernel = imageLarge.applyGaussianBlur( 50, Graphic::Image::ConvolutionMode::ExtendedSize, Graphic::ColorRGBA<unsigned char>( 0, 0, 0, 0 ), Graphic::Image::BlurMode::Kernel );
+			}
+			Log::stopChrono();
+			Log::displayChrono( "FILTER RGB UCHAR RADIUS 50 KERNEL" );
+
+			Log::startChrono();
+			for ( size_t i = 0; i < 10; i++ ) {
+				imageBox = imageLarge.applyGaussianBlur( 50, Graphic::Image::ConvolutionMode::ExtendedSize, Graphic::ColorRGBA<unsigned char>( 0, 0, 0, 0 ), Graphic::Image::BlurMode::Box );
+			}
+			Log::stopChrono();
+			Log::displayChrono( "FILTER RGB UCHAR RADIUS 50 BOX" );
+
+			int maxDifference( 0 );
+			for ( size_t i = 0; i < imageKernel.getNbPixels() * imageKernel.getNbComponents(); i++ ) {
+				maxDifference = Math::max( maxDifference, Math::abs( int( imageKernel.getDatas()[ i ] ) - int( imageBox.getDatas()[ i ] ) ) );
+			}
+			Log::displayLog( String::format( "FILTER RADIUS 50 : % maximum difference between the kernel and the box filters.", maxDifference ) );
+		}
+
 
 		Graphic::FreeImage freeImageOut;
 		freeImageOut.loadFromDatas( ( unsigned char* ) image.getDatas(), image.getSize(), Graphic::FreeImage::Format::RGB );
@@ -2290,6 +3159,97 @@ int main( int argc, char* argv[] ) {
 		Log::stopChrono();
 		Log::displayChrono( "FLOAT BLENDING FUNCTOR RGBA -> RGB (last 206ms)" );
 
+		// Span blending over an opaque destination, for each instruction set.
+		{
+			Graphic::Image testSpanDst( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+			Graphic::Image testSpanSrc( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+			Graphic::ImageT<float> testSpanDstFloat( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+			Graphic::ImageT<float> testSpanSrcFloat( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+
+			const CPU::Isa isaTable[ 4 ] = { CPU::Isa::Scalar, CPU::Isa::SSE2, CPU::Isa::AVX2, CPU::Isa::NEON };
+			const char * isaNameTable[ 4 ] = { "Scalar", "SSE2", "AVX2", "NEON" };
+			const Size nbIterations( 100 );
+			const double nbMegaPixels( double( testSpanDst.getSize().x * testSpanDst.getSize().y ) * double( nbIterations ) / 1e6 );
+
+			Graphic::Image resultScalar;
+			for ( Size isaI( 0 ); isaI < Size( 4 ); isaI++ ) {
+				CPU::setIsa( isaTable[ isaI ] );
+				if ( CPU::getIsa() != isaTable[ isaI ] ) {
+					continue;
+				}
+				testSpanDst.fillImage( Graphic::ColorRGBA<unsigned char>( 0, 0, 255, 255 ) );
+				testSpanSrc.fillImage( Graphic::ColorRGBA<unsigned char>( 255, 0, 0, 100 ) );
+				testSpanDstFloat.fillImage( Graphic::ColorRGBA<float>( 0.0f, 0.0f, 1.0f, 1.0f ) );
+				testSpanSrcFloat.fillImage( Graphic::ColorRGBA<float>( 1.0f, 0.0f, 0.0f, 0.4f ) );
+
+				const Time::TimeT beginTime( Time::getTime<Time::MilliSecond>().getValue() );
+				for ( Size i( 0 ); i < nbIterations; i++ ) {
+					testSpanDst.drawImage( Graphic::Point( 0, 0 ), testSpanSrc );
+				}
+				const Time::TimeT middleTime( Time::getTime<Time::MilliSecond>().getValue() );
+				for ( Size i( 0 ); i < nbIterations; i++ ) {
+					testSpanDstFloat.drawImage( Graphic::Point( 0, 0 ), testSpanSrcFloat );
+				}
+				const Time::TimeT endTime( Time::getTime<Time::MilliSecond>().getValue() );
+
+				Log::displayLog( String::format( "Span blending % : INT % MPixels/s, FLOAT % MPixels/s.", isaNameTable[ isaI ], nbMegaPixels / ( double( middleTime - beginTime ) / 1000.0 ), nbMegaPixels / ( double( endTime - middleTime ) / 1000.0 ) ) );
+
+				// Every instruction set has to give the same pixels.
+				if ( isaI == Size( 0 ) ) {
+					resultScalar = testSpanDst;
+				} else {
+					Size nbDifferences( 0 );
+					for ( Size k( 0 ); k < resultScalar.getNbPixels() * Size( 4 ); k++ ) {
+						if ( resultScalar.getDatas()[ k ] != testSpanDst.getDatas()[ k ] ) nbDifferences++;
+					}
+					Log::displayLog( String::format( "Span blending % : % differences with the scalar result.", isaNameTable[ isaI ], nbDifferences ) );
+				}
+			}
+			CPU::setIsa( CPU::Isa::Auto );
+		}
+
+		// Span blending of the Composite functors with a half transparent destination, the slow path of the formulas.
+		{
+			Graphic::Image testCompositeDst( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+			Graphic::Image testCompositeSrc( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+			Graphic::ImageT<float> testCompositeDstFloat( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+			Graphic::ImageT<float> testCompositeSrcFloat( Math::Vec2<Graphic::Size>( 1024, 1024 ), Graphic::Format::RGBA );
+			Graphic::Rectangle compositeRectangle( testCompositeDst.getSize() );
+
+			testCompositeDst.fillImage( Graphic::ColorRGBA<unsigned char>( 0, 128, 255, 128 ) );
+			testCompositeSrc.fillImage( Graphic::ColorRGBA<unsigned char>( 255, 64, 0, 100 ) );
+			testCompositeDstFloat.fillImage( Graphic::ColorRGBA<float>( 0.0f, 0.5f, 1.0f, 0.5f ) );
+			testCompositeSrcFloat.fillImage( Graphic::ColorRGBA<float>( 1.0f, 0.25f, 0.0f, 0.4f ) );
+
+			Log::startChrono();
+			for ( size_t i = 0; i < 100; i++ ) {
+				testCompositeDst.drawImage( Graphic::Point( 0, 0 ), testCompositeSrc, compositeRectangle, Graphic::BlendingFunc::Xor() );
+			}
+			Log::stopChrono();
+			Log::displayChrono( "INT BLENDING XOR RGBA -> RGBA" );
+
+			Log::startChrono();
+			for ( size_t i = 0; i < 100; i++ ) {
+				testCompositeDst.drawImage( Graphic::Point( 0, 0 ), testCompositeSrc, compositeRectangle, Graphic::BlendingFunc::Overlay() );
+			}
+			Log::stopChrono();
+			Log::displayChrono( "INT BLENDING OVERLAY RGBA -> RGBA" );
+
+			Log::startChrono();
+			for ( size_t i = 0; i < 100; i++ ) {
+				testCompositeDstFloat.drawImage( Graphic::Point( 0, 0 ), testCompositeSrcFloat, compositeRectangle, Graphic::BlendingFunc::Xor() );
+			}
+			Log::stopChrono();
+			Log::displayChrono( "FLOAT BLENDING XOR RGBA -> RGBA" );
+
+			Log::startChrono();
+			for ( size_t i = 0; i < 100; i++ ) {
+				testCompositeDstFloat.drawImage( Graphic::Point( 0, 0 ), testCompositeSrcFloat, compositeRectangle, Graphic::BlendingFunc::Overlay() );
+			}
+			Log::stopChrono();
+			Log::displayChrono( "FLOAT BLENDING OVERLAY RGBA -> RGBA" );
+		}
+
 		Graphic::Image testblendCasted( testBlendRGBAFloat2 );
 
 		Graphic::FreeImage freeImage;
@@ -2298,6 +3258,46 @@ int main( int argc, char* argv[] ) {
 	}
 #endif
 
+#ifdef SPEEDTEST_LOG
+	//////////////////////////////////////////////////////////////////////////
+	// SPEED TEST : Log handlers									//
+	{
+		StringASCII logTitle( "TEST" );
+		StringASCII logMessage( "The quick brown fox jumps over the lazy dog." );
+
+		{
+			LogDefaultHandler logHandler;
+			logHandler.setFileOut( true );
+			logHandler.setOutFilePath( OS::Path( "speedtest_default.log" ) );
+
+			Log::startChrono();
+			for ( unsigned long int i = 0; i < K100; i++ ) {
+				logHandler.message( logTitle, logMessage, SimpleLog::MessageSeverity::Info, SimpleLog::MessageColor::White );
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII() << "Log Default Handler" );
+		}
+
+		{
+			LogAsyncHandler logHandler( Size( 1 ) << Size( 17 ), LogAsyncHandler::OverflowPolicy::Block );
+			logHandler.setFileOut( true );
+			logHandler.setOutFilePath( OS::Path( "speedtest_async.log" ) );
+
+			Log::startChrono();
+			for ( unsigned long int i = 0; i < K100; i++ ) {
+				logHandler.message( logTitle, logMessage, SimpleLog::MessageSeverity::Info, SimpleLog::MessageColor::White );
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII() << "Log Async Handler (enqueue only)" );
+
+			Log::startChrono();
+			logHandler.flush();
+			Log::stopChrono();
+			Log::displayChrono( StringASCII() << "Log Async Handler (flush)" );
+		}
+	}
+#endif
+
 #ifdef SPEEDTEST_DATE
 	//////////////////////////////////////////////////////////////////////////
 	// SPEED TEST : Dates									//
@@ -2387,6 +3387,22 @@ int main( int argc, char* argv[] ) {
 		Log::stopChrono();
 		Log::displayChrono( StringASCII( "Simple++ concat float." ) << testMyStr1.getSubStr( StringASCII::Size( 0 ), StringASCII::Size( 30 ) ) );
 
+		StringASCII testMyStr3( "STRING 3 : " );
+		Log::startChrono();
+		for ( size_t i = 0; i < M10; i++ ) {
+			testMyStr3.concat( numberFloat, 7 );
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "Simple++ concat float fixed." ) << testMyStr3.getSubStr( StringASCII::Size( 0 ), StringASCII::Size( 30 ) ) );
+
+		StringASCII testMyStr4( "STRING 4 : " );
+		Log::startChrono();
+		for ( size_t i = 0; i < M10; i++ ) {
+			testMyStr4.concat( numberFloat * double( i ), StringASCII::ShortestPrecision );
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "Simple++ concat float shortest." ) << testMyStr4.getSubStr( StringASCII::Size( 0 ), StringASCII::Size( 30 ) ) );
+
 		Log::startChrono();
 		for ( size_t i = 0; i < M10; i++ ) {
 			testMyStr2.concat( numberInt, 2 );
@@ -2400,6 +3416,70 @@ int main( int argc, char* argv[] ) {
 		}
 		Log::stopChrono();
 		Log::displayChrono( ( std::string( "std concat float." ) + testStdStr1.substr( 0, 30 ).c_str() ).data() );
+
+		std::string testStdStr2( "STRING 4 : " );
+		char charBuffer[ 32 ];
+		Log::startChrono();
+		for ( size_t i = 0; i < M10; i++ ) {
+			snprintf( charBuffer, sizeof( charBuffer ), "%.17g", numberFloat * double( i ) );
+			testStdStr2 += charBuffer;
+		}
+		Log::stopChrono();
+		Log::displayChrono( ( std::string( "snprintf concat float round-trip." ) + testStdStr2.substr( 0, 30 ).c_str() ).data() );
+	}
+#endif
+
+#ifdef SPEEDTEST_STRING_SSO
+	//////////////////////////////////////////////////////////////////////////
+	// SPEED TEST : Small Strings (created, copied and concatenated without allocation)	//
+	{
+		Vector<StringASCII> strVector;
+		strVector.reserve( K100 );
+		for ( size_t i = 0; i < K100; i++ ) {
+			strVector.push( StringASCII( "key_" ) << i );
+		}
+
+		// A small string keeps its characters inside the object itself.
+		Size nbInline( 0 );
+		for ( size_t i = 0; i < strVector.getSize(); i++ ) {
+			const char * strP( reinterpret_cast< const char * >( &strVector[ i ] ) );
+			const char * dataP( reinterpret_cast< const char * >( strVector[ i ].getData() ) );
+			if ( dataP >= strP && dataP < strP + sizeof( StringASCII ) ) {
+				nbInline++;
+			}
+		}
+		Log::displayLog( StringASCII( "Allocations avoided : " ) << nbInline << StringASCII( " / " ) << strVector.getSize() );
+
+		Size tmpSize( 0 );
+		Log::startChrono();
+		for ( size_t i = 0; i < M10; i++ ) {
+			StringASCII str( strVector[ i % K100 ] );
+			str << "_v";
+			tmpSize += str.getSize();
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "Simple++ small string copy + concat : " ) << tmpSize );
+
+		std::string stdStr( "key_0" );
+		tmpSize = 0;
+		Log::startChrono();
+		for ( size_t i = 0; i < M10; i++ ) {
+			std::string str( stdStr );
+			str += "_v";
+			tmpSize += str.size();
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "std small string copy + concat : " ) << tmpSize );
+
+		tmpSize = 0;
+		Log::startChrono();
+		for ( size_t i = 0; i < M10; i++ ) {
+			StringASCII str( ( unsigned long int ) i );
+			StringASCII strMoved( Utility::toRValue( str ) );
+			tmpSize += strMoved.getSize();
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "Simple++ small string from number + move : " ) << tmpSize );
 	}
 #endif
 
@@ -2416,6 +3496,24 @@ int main( int argc, char* argv[] ) {
 		}
 		Log::stopChrono();
 		Log::displayChrono( testStr.getSubStr( StringASCII::Size( 0 ), StringASCII::Size( 30 ) ) );
+
+		// Log line with numbers, the reference string parsed at each call or at compile time.
+		StringASCII pathStr( "/api/v1/users/42/profile" );
+		StringASCII resultStr;
+		Log::startChrono();
+		for ( size_t i = 0; i < M1; i++ ) {
+			resultStr = StringASCII::format( "GET % : % bytes in % ms (\\%% cached)", pathStr, i, double( i ) * 0.001, int( i % 100 ) );
+		}
+		Log::stopChrono();
+		Log::displayChrono( "Runtime format : " + resultStr );
+
+		static constexpr auto logFormat( StringASCII::makeFormat( "GET % : % bytes in % ms (\\%% cached)" ) );
+		Log::startChrono();
+		for ( size_t i = 0; i < M1; i++ ) {
+			resultStr = StringASCII::format<logFormat>( pathStr, i, double( i ) * 0.001, int( i % 100 ) );
+		}
+		Log::stopChrono();
+		Log::displayChrono( "Compile time format : " + resultStr );
 	}
 #endif
 
@@ -2440,6 +3538,49 @@ int main( int argc, char* argv[] ) {
 		}
 		Log::stopChrono();
 		Log::displayChrono( "toFloat : " + StringASCII( sum ) );
+
+		// Numbers as written by a JSON export, all the significant digits of a double.
+		Vector<StringASCII> numberVector;
+		numberVector.reserve( K100 );
+		for ( size_t i = 0; i < K100; i++ ) {
+			numberVector.push( StringASCII::toString( Math::randomF<double>() * 1e6 / double( i + 1 ), StringASCII::ShortestPrecision ) );
+		}
+
+		double sumDouble = 0.0;
+		Log::startChrono();
+		for ( size_t j = 0; j < 100; j++ ) {
+			for ( size_t i = 0; i < numberVector.getSize(); i++ ) {
+				sumDouble += strtod( numberVector[ i ].toCString(), NULL );
+			}
+		}
+		Log::stopChrono();
+		Log::displayChrono( "strtod shortest : " + StringASCII( sumDouble ) );
+
+		sumDouble = 0.0;
+		Log::startChrono();
+		for ( size_t j = 0; j < 100; j++ ) {
+			for ( size_t i = 0; i < numberVector.getSize(); i++ ) {
+				sumDouble += numberVector[ i ].toDouble();
+			}
+		}
+		Log::stopChrono();
+		Log::displayChrono( "toDouble shortest : " + StringASCII( sumDouble ) );
+
+		unsigned long long int sumInt = 0;
+		Log::startChrono();
+		for ( unsigned long int i = 0; i < 10000000; i++ ) {
+			sumInt += strtoull( "1234567890123456", NULL, 10 );
+		}
+		Log::stopChrono();
+		Log::displayChrono( "strtoull : " + StringASCII( sumInt ) );
+
+		sumInt = 0;
+		Log::startChrono();
+		for ( unsigned long int i = 0; i < 10000000; i++ ) {
+			sumInt += StringASCII::toULongLong( "1234567890123456" );
+		}
+		Log::stopChrono();
+		Log::displayChrono( "toULongLong : " + StringASCII( sumInt ) );
 	}
 #endif
 
@@ -2478,6 +3619,17 @@ int main( int argc, char* argv[] ) {
 		}
 		Log::stopChrono();
 		Log::displayChrono( "Vector .regex_match(); Mine : " + StringASCII( mineResult ) );
+
+		bool compiledResult = true;
+		Regex::Pattern<char> minePattern( mineRegex );
+		Regex::Match mineMatch;
+
+		Log::startChrono();
+		for ( unsigned long int i = 0; i < M1; i++ ) {
+			compiledResult &= minePattern.search( mineString, &mineMatch );
+		}
+		Log::stopChrono();
+		Log::displayChrono( "Regex::Pattern .search(); Mine compiled : " + StringASCII( compiledResult ) + " [" + mineMatch.getGroup( mineString ) + "]" );
 	}
 #endif
 
@@ -2556,6 +3708,345 @@ int main( int argc, char* argv[] ) {
 
 	}
 #endif
+#ifdef SPEEDTEST_HASHMAP
+	//////////////////////////////////////////////////////////////////////////
+	// SPEED TEST : HashMap vs Map							//
+	{
+		{
+			Map<unsigned long int, unsigned long int> mapRedBlackTree;
+			HashMap<unsigned long int, unsigned long int> hashMap;
+
+			Log::startChrono();
+			for ( unsigned long int i = 0; i < M1; i++ ) {
+				mapRedBlackTree.insert( Math::random( 0, 1000000 ), i );
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII( "Map Red Black Tree .insert(); Mine " ) );
+
+			Log::startChrono();
+			for ( unsigned long int i = 0; i < M1; i++ ) {
+				hashMap.insert( Math::random( 0, 1000000 ), i );
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII( "HashMap .insert(); Mine " ) );
+		}
+		{
+			Map<unsigned long int, unsigned long int> mapRedBlackTree;
+			HashMap<unsigned long int, unsigned long int> hashMap;
+
+			for ( unsigned long int i = 0; i < M1; i++ ) {
+				mapRedBlackTree.insert( i, i );
+				hashMap.insert( i, i );
+			}
+			volatile unsigned long int tmp( 0 );
+			Log::startChrono();
+			for ( unsigned long int i = 0; i < M1; i++ ) {
+				tmp += *( mapRedBlackTree[ i ] );
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII( "Map Red Black Tree .operator[] Mine " ) );
+
+			Log::startChrono();
+			for ( unsigned long int i = 0; i < M1; i++ ) {
+				tmp += *( hashMap[ i ] );
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII( "HashMap .operator[] Mine " ) );
+		}
+		{
+			Map<StringASCII, unsigned long int> mapRedBlackTree;
+			HashMap<StringASCII, unsigned long int> hashMap;
+			Vector<StringASCII> keyVector;
+			keyVector.reserve( K100 );
+
+			for ( unsigned long int i = 0; i < K100; i++ ) {
+				keyVector.push( StringASCII( "X-Header-" ) << StringASCII( i ) );
+				mapRedBlackTree.insert( keyVector[ i ], i );
+				hashMap.insert( keyVector[ i ], i );
+			}
+			volatile unsigned long int tmp( 0 );
+			Log::startChrono();
+			for ( unsigned long int j = 0; j < 10; j++ ) {
+				for ( unsigned long int i = 0; i < K100; i++ ) {
+					tmp += *( mapRedBlackTree[ keyVector[ i ] ] );
+				}
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII( "Map Red Black Tree String .operator[] Mine " ) );
+
+			Log::startChrono();
+			for ( unsigned long int j = 0; j < 10; j++ ) {
+				for ( unsigned long int i = 0; i < K100; i++ ) {
+					tmp += *( hashMap[ keyVector[ i ] ] );
+				}
+			}
+			Log::stopChrono();
+			Log::displayChrono( StringASCII( "HashMap String .operator[] Mine " ) );
+		}
+	}
+#endif
+#ifdef SPEEDTEST_STRING_POOL
+	//////////////////////////////////////////////////////////////////////////
+	// SPEED TEST : Map of Strings vs Map of interned Strings		//
+	{
+		Vector<StringASCII> keyVector;
+		keyVector.reserve( K100 );
+		for ( unsigned long int i = 0; i < K100; i++ ) {
+			keyVector.push( StringASCII( "X-Header-" ) << StringASCII( i ) );
+		}
+
+		Map<StringASCII, unsigned long int> stringMap;
+		Map<InternedString, unsigned long int> internedMap;
+		Vector<InternedString> internedVector;
+		internedVector.reserve( K100 );
+		for ( unsigned long int i = 0; i < K100; i++ ) {
+			internedVector.push( InternedString( keyVector[ i ] ) );
+			stringMap.insert( keyVector[ i ], i );
+			internedMap.insert( internedVector[ i ], i );
+		}
+
+		volatile unsigned long int tmp( 0 );
+		Log::startChrono();
+		for ( unsigned long int j = 0; j < 10; j++ ) {
+			for ( unsigned long int i = 0; i < K100; i++ ) {
+				tmp += *( stringMap[ keyVector[ i ] ] );
+			}
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "Map String .operator[] " ) );
+
+		Log::startChrono();
+		for ( unsigned long int j = 0; j < 10; j++ ) {
+			for ( unsigned long int i = 0; i < K100; i++ ) {
+				tmp += *( internedMap[ internedVector[ i ] ] );
+			}
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "Map InternedString .operator[] " ) );
+
+		// Interning again a name already known : one hash and one compare, no allocation.
+		Log::startChrono();
+		for ( unsigned long int j = 0; j < 10; j++ ) {
+			for ( unsigned long int i = 0; i < K100; i++ ) {
+				tmp += *( internedMap[ InternedString( keyVector[ i ] ) ] );
+			}
+		}
+		Log::stopChrono();
+		Log::displayChrono( StringASCII( "Map InternedString intern + .operator[] " ) + StringPool::getDefault().getNbStrings() );
+	}
+#endif
+
+
+
+#ifdef SPEEDTEST_DOM_ARENA
+	//////////////////////////////////////////////////////////////////////////
+	// SPEED TEST : JSON/XML DOM, heap nodes vs document arena			//
+	{
+		{
+			UTF8String jsonFileStr;
+			ASSERT( IO::readToString( OS::Path( "test.json" ), &jsonFileStr ) != Size( -1 ) );
+
+			// Scale test.json up to an array of 20000 copies.
+			UTF8String jsonStr;
+			jsonStr.reserve( ( jsonFileStr.getSize() + Size( 1 ) ) * Size( 20000 ) + Size( 2 ) );
+			jsonStr << "[";
+			for ( Size i( 0 ); i < Size( 20000 ); i++ ) {
+				if ( i ) {
+					jsonStr << ",";
+				}
+				jsonStr << jsonFileStr;
+			}
+			jsonStr << "]";
+
+			Log::startChrono();
+			JSON::Node * heapNode( JSON::parseT<UTF8String>( jsonStr.toCString() ) );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "JSON parse % bytes, heap nodes", jsonStr.getSize() ) );
+
+			Log::startChrono();
+			delete heapNode;
+			Log::stopChrono();
+			Log::displayChrono( "JSON release, heap nodes" );
+
+			JSON::Document * document( new JSON::Document() );
+			Log::startChrono();
+			document -> readJSON( jsonStr );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "JSON parse % bytes, document arena", jsonStr.getSize() ) );
+			Log::displayLog( String::format( "JSON arena : % node allocations served from % chunks.", document -> getArena().getNbAllocations(), document -> getArena().getNbChunks() ) );
+
+			Log::startChrono();
+			delete document;
+			Log::stopChrono();
+			Log::displayChrono( "JSON release, document arena" );
+		}
+		{
+			UTF8String xmlFileStr;
+			ASSERT( IO::readToString( OS::Path( "test.xml" ), &xmlFileStr ) != Size( -1 ) );
+
+			// Scale test.xml up to 10000 copies of it's content (without the header).
+			const Size contentI( xmlFileStr.getFirst( UTF8String( "?>" ) ) + Size( 2 ) );
+			const UTF8String xmlContentStr( xmlFileStr.getSubStr( contentI, xmlFileStr.getSize() - contentI ) );
+			UTF8String xmlStr;
+			xmlStr.reserve( xmlContentStr.getSize() * Size( 10000 ) + Size( 64 ) );
+			xmlStr << "<?xml version=\"1.0\" encoding=\"UTF-8\"?><menus>";
+			for ( Size i( 0 ); i < Size( 10000 ); i++ ) {
+				xmlStr << xmlContentStr;
+			}
+			xmlStr << "</menus>";
+
+			XML::Node * heapNode( new XML::Node( "#document", XML::Node::Type::Document ) );
+			const UTF8String::ElemType * xmlIt( xmlStr.toCString() + xmlStr.getFirst( UTF8String( "<menus>" ) ) );
+			Log::startChrono();
+			heapNode -> appendXML( &xmlIt );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "XML parse % bytes, heap nodes", xmlStr.getSize() ) );
+
+			Log::startChrono();
+			delete heapNode;
+			Log::stopChrono();
+			Log::displayChrono( "XML release, heap nodes" );
+
+			XML::Document * document( new XML::Document() );
+			Log::startChrono();
+			document -> readXML( xmlStr );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "XML parse % bytes, document arena", xmlStr.getSize() ) );
+			Log::displayLog( String::format( "XML arena : % node allocations served from % chunks.", document -> getArena().getNbAllocations(), document -> getArena().getNbChunks() ) );
+
+			Log::startChrono();
+			delete document;
+			Log::stopChrono();
+			Log::displayChrono( "XML release, document arena" );
+		}
+	}
+#endif
+#ifdef SPEEDTEST_JSON_PARSE
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// SPEED TEST : JSON parse, structural index vs byte by byte	//
+		UTF8String jsonFileStr;
+		ASSERT( IO::readToString( OS::Path( "test.json" ), &jsonFileStr ) != Size( -1 ) );
+
+		// Scale test.json up to an array of 20000 copies, with some numbers, booleans and nulls.
+		UTF8String jsonStr;
+		jsonStr.reserve( ( jsonFileStr.getSize() + Size( 64 ) ) * Size( 20000 ) + Size( 2 ) );
+		jsonStr << "[";
+		for ( Size i( 0 ); i < Size( 20000 ); i++ ) {
+			if ( i ) {
+				jsonStr << ",";
+			}
+			jsonStr << jsonFileStr;
+			jsonStr << ", [";
+			jsonStr << i;
+			jsonStr << ", -0.5e3, true, null, \"str\"]";
+		}
+		jsonStr << "]";
+
+		const double nbGigaBytes( double( jsonStr.getSize() ) / 1e9 );
+		const Size nbIterations( 10 );
+
+		// Stage 1 alone, for each instruction set.
+		const CPU::Isa isaTable[ 3 ] = { CPU::Isa::Scalar, CPU::Isa::SSE2, CPU::Isa::AVX2 };
+		const char * isaNameTable[ 3 ] = { "Scalar", "SSE2", "AVX2" };
+		JSON::StructuralIndex structuralIndex;
+		for ( Size isaI( 0 ); isaI < Size( 3 ); isaI++ ) {
+			CPU::setIsa( isaTable[ isaI ] );
+			if ( CPU::getIsa() != isaTable[ isaI ] ) {
+				continue;
+			}
+			const Time::TimeT beginTime( Time::getTime<Time::MilliSecond>().getValue() );
+			for ( Size i( 0 ); i < nbIterations; i++ ) {
+				ASSERT( structuralIndex.build( jsonStr.toCString(), jsonStr.getSize() ) );
+			}
+			const Time::TimeT endTime( Time::getTime<Time::MilliSecond>().getValue() );
+			const double nbSeconds( double( endTime - beginTime ) / 1000.0 / double( nbIterations ) );
+			Log::displayLog( String::format( "JSON structural index % : % positions, % GB/s.", isaNameTable[ isaI ], structuralIndex.getSize(), nbGigaBytes / nbSeconds ) );
+		}
+		CPU::setIsa( CPU::Isa::Auto );
+
+		// Full parse, byte by byte then with the structural index.
+		UTF8String classicStr;
+		{
+			const Time::TimeT beginTime( Time::getTime<Time::MilliSecond>().getValue() );
+			for ( Size i( 0 ); i < nbIterations; i++ ) {
+				const UTF8String::ElemType * it( jsonStr.toCString() );
+				JSON::Node * node( JSON::_parseT<UTF8String>( &it, UTF8String::IS_END_SENTINEL, NULL ) );
+				if ( i == Size( 0 ) ) {
+					classicStr = node -> toString();
+				}
+				delete node;
+			}
+			const Time::TimeT endTime( Time::getTime<Time::MilliSecond>().getValue() );
+			const double nbSeconds( double( endTime - beginTime ) / 1000.0 / double( nbIterations ) );
+			Log::displayLog( String::format( "JSON parse byte by byte : % GB/s.", nbGigaBytes / nbSeconds ) );
+		}
+		{
+			const Time::TimeT beginTime( Time::getTime<Time::MilliSecond>().getValue() );
+			for ( Size i( 0 ); i < nbIterations; i++ ) {
+				JSON::Node * node( JSON::parseT<UTF8String>( jsonStr.toCString() ) );
+				if ( i == Size( 0 ) ) {
+					ASSERT( node -> toString() == classicStr );
+				}
+				delete node;
+			}
+			const Time::TimeT endTime( Time::getTime<Time::MilliSecond>().getValue() );
+			const double nbSeconds( double( endTime - beginTime ) / 1000.0 / double( nbIterations ) );
+			Log::displayLog( String::format( "JSON parse structural index : % GB/s.", nbGigaBytes / nbSeconds ) );
+		}
+	}
+#endif
+#ifdef SPEEDTEST_XML_READER
+	//////////////////////////////////////////////////////////////////////////
+	// SPEED TEST : XML streaming reader vs DOM								//
+	{
+		UTF8String xmlFileStr;
+		ASSERT( IO::readToString( OS::Path( "test.xml" ), &xmlFileStr ) != Size( -1 ) );
+
+		// Write test.xml scaled up to 100000 copies of it's content (without the header).
+		const Size contentI( xmlFileStr.getFirst( UTF8String( "?>" ) ) + Size( 2 ) );
+		const UTF8String xmlContentStr( xmlFileStr.getSubStr( contentI, xmlFileStr.getSize() - contentI ) );
+		{
+			IO::FileStream stream( OS::Path( "testBig.xml" ), IO::OpenMode::Write );
+			ASSERT( stream.isOpen() );
+			stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?><menus>";
+			for ( Size i( 0 ); i < Size( 100000 ); i++ ) {
+				stream.write( xmlContentStr.toCString(), xmlContentStr.getSize() );
+			}
+			stream << "</menus>";
+		}
+
+		{
+			Size nbElements( 0 );
+			Size nbAttributes( 0 );
+			Size nbTexts( 0 );
+			XML::Reader reader( OS::Path( "testBig.xml" ) );
+			Log::startChrono();
+			while ( true ) {
+				const XML::Reader::Event event( reader.next() );
+				if ( event == XML::Reader::Event::StartElement ) {
+					nbElements++;
+				} else if ( event == XML::Reader::Event::Attribute ) {
+					nbAttributes++;
+				} else if ( event == XML::Reader::Event::Text ) {
+					nbTexts++;
+				} else if ( event != XML::Reader::Event::EndElement ) {
+					ASSERT( event == XML::Reader::Event::EndDocument );
+					break;
+				}
+			}
+			Log::stopChrono();
+			Log::displayChrono( String::format( "XML streaming reader, % bytes, 64 KiB buffer", reader.getPosition() ) );
+			Log::displayLog( String::format( "XML streaming reader : % elements, % attributes, % texts.", nbElements, nbAttributes, nbTexts ) );
+		}
+		{
+			XML::Document document;
+			Log::startChrono();
+			ASSERT( document.readFileXML( OS::Path( "testBig.xml" ) ) );
+			Log::stopChrono();
+			Log::displayChrono( "XML DOM built from the streaming reader" );
+		}
+	}
 #ifdef SPEEDTEST_ARITHMETIC 
 	//////////////////////////////////////////////////////////////////////////
 	// SPEED TEST : Arithmetic												//
@@ -2736,8 +4227,37 @@ int main( int argc, char* argv[] ) {
 			deepNeuralNetwork.normalizeFeature();
 		}
 
+		{
+			// Save and load of the whole network with its data set, the tables of features being written by chunks.
+			Log::startChrono();
+			deepNeuralNetwork.saveToFile( OS::Path( "speedtest.dnn" ), 0 );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "Deep Neural Network save with % data", deepNeuralNetwork.getNbData() ) );
+
+			Math::ML::DeepNeuralNetwork<F, Math::ML::MyModel> deepNeuralNetworkLoaded( optimizerFunc );
+			Log::startChrono();
+			deepNeuralNetworkLoaded.loadFromFile( OS::Path( "speedtest.dnn" ), 0 );
+			Log::stopChrono();
+			Log::displayChrono( String::format( "Deep Neural Network load with % data", deepNeuralNetworkLoaded.getNbData() ) );
+		}
+
 		// Log::displayLog(String::format("Current cost : %.", deepNeuralNetwork.computeCost()));
 
+		{
+			// Stochastic gradients on the calling thread only, then with the persistent pool.
+			const Vector<Math::Interval<Size>> trainIntervalVector( Math::ML::DeepNeuralNetwork<F, Math::ML::MyModel>::createDataIntervalVector( Math::Interval<Size>( Size( 0 ), deepNeuralNetwork.getNbData() ) ) );
+			const Size nbThreadsTable[ 2 ] = { Size( 1 ), ThreadPool::getDefaultNbThreads() };
+			for ( Size i( 0 ); i < Size( 2 ); i++ ) {
+				deepNeuralNetwork.setNbThreads( nbThreadsTable[ i ] );
+				Log::startChrono();
+				for ( Size j( 0 ); j < trainIntervalVector.getSize(); j++ ) {
+					deepNeuralNetwork.computeGradS( trainIntervalVector.getValueI( j ).getBegin() );
+				}
+				Log::stopChrono();
+				Log::displayChrono( String::format( "Deep Neural Network computeGradS with % threads", nbThreadsTable[ i ] ) );
+			}
+		}
+
 		Log::startChrono();
 		// deepNeuralNetwork.optimizeCluster(Math::Interval<Size>(0, dataVector.getSize()), Size(100), Size(16), Time::Duration<Time::MilliSecond>(2500));
 		// deepNeuralNetwork.optimizeStochastic(Math::Interval<Size>(0, dataVector.getSize()), Size(100), Time::Duration<Time::MilliSecond>(100));
@@ -265,3 +265,98 @@ template<typename T, Size N>
 inline StaticTable<T, N>::StaticTable(const StaticTable<T, N>& t) {
 	Utility::copy(this->dataTable, t.getData(), N);
 }
+
+namespace IO {
+
+	///@brief The buffers of StaticTable of raw values are written and read by chunks with a single stream call each, every table keeping its size before its values.
+	template<typename T, Size N>
+	struct BufferSerializer<StaticTable<T, N>> {
+		template<typename Stream>
+		static bool write( Stream* stream, const StaticTable<T, N>* buffer, Size size );
+
+		template<typename Stream>
+		static bool read( Stream* stream, StaticTable<T, N>* buffer, Size size, int verbose );
+
+		///@brief Number of bytes of a table once written.
+		static constexpr Size elementSize = sizeof( Size ) + sizeof( T ) * N;
+		///@brief Number of tables written or read by stream call.
+		static constexpr Size chunkSize = ( elementSize < Size( 65536 ) ) ? Size( 65536 ) / elementSize : Size( 1 );
+	};
+
+	template<typename T, Size N>
+	template<typename Stream>
+	bool BufferSerializer<StaticTable<T, N>>::write( Stream* stream, const StaticTable<T, N>* buffer, Size size ) {
+		if constexpr ( !IsRawSerializable<T>::value ) {
+			for ( Size i( 0 ); i < size; i++ ) {
+				if ( !buffer[ i ].write( stream ) )
+					return false;
+			}
+			return true;
+		} else {
+			if ( size == Size( 0 ) ) {
+				return true;
+			}
+
+			const Size tableSize( N );
+			char* chunkBuffer( new char[ ( ( size < chunkSize ) ? size : chunkSize ) * elementSize ] );
+			for ( Size i( 0 ); i < size; i += chunkSize ) {
+				const Size nbTables( ( size - i < chunkSize ) ? size - i : chunkSize );
+				char* chunkIt( chunkBuffer );
+				for ( Size j( 0 ); j < nbTables; j++ ) {
+					Utility::copy( chunkIt, reinterpret_cast< const char* >( &tableSize ), sizeof( Size ) );
+					chunkIt += sizeof( Size );
+					Utility::copy( chunkIt, reinterpret_cast< const char* >( buffer[ i + j ].getData() ), sizeof( T ) * N );
+					chunkIt += sizeof( T ) * N;
+				}
+				if ( !stream->write( chunkBuffer, nbTables * elementSize ) ) {
+					delete[] chunkBuffer;
+					return false;
+				}
+			}
+			delete[] chunkBuffer;
+			return true;
+		}
+	}
+
+	template<typename T, Size N>
+	template<typename Stream>
+	bool BufferSerializer<StaticTable<T, N>>::read( Stream* stream, StaticTable<T, N>* buffer, Size size, int verbose ) {
+		if constexpr ( !IsRawSerializable<T>::value ) {
+			for ( Size i( 0 ); i < size; i++ ) {
+				if ( !buffer[ i ].read( stream, verbose ) )
+					return false;
+			}
+			return true;
+		} else {
+			if ( size == Size( 0 ) ) {
+				return true;
+			}
+
+			bool bWrongSize( false );
+			char* chunkBuffer( new char[ ( ( size < chunkSize ) ? size : chunkSize ) * elementSize ] );
+			for ( Size i( 0 ); i < size; i += chunkSize ) {
+				const Size nbTables( ( size - i < chunkSize ) ? size - i : chunkSize );
+				if ( !stream->read( chunkBuffer, nbTables * elementSize ) ) {
+					delete[] chunkBuffer;
+					return false;
+				}
+				const char* chunkIt( chunkBuffer );
+				for ( Size j( 0 ); j < nbTables; j++ ) {
+					Size readSize;
+					Utility::copy( reinterpret_cast< char* >( &readSize ), chunkIt, sizeof( Size ) );
+					chunkIt += sizeof( Size );
+					bWrongSize |= ( readSize != N );
+					Utility::copy( reinterpret_cast< char* >( buffer[ i + j ].getData() ), chunkIt, sizeof( T ) * N );
+					chunkIt += sizeof( T ) * N;
+				}
+			}
+			delete[] chunkBuffer;
+
+			if ( bWrongSize ) {
+				SimpleLog::callErrorHandler( TEXT( "Trying to load a StaticTable of the wrong size." ), SimpleLog::MessageSeverity::Warning, SimpleLog::MessageColor::Red );
+			}
+			return true;
+		}
+	}
+
+}
@@ -10,6 +10,7 @@
 #include <cmath>
 #include "SimpleLog.h"
 #include "Math/BasicComparable.h"
+#include "Math/FloatDecimal.h"
 #include "Vector.h"
 #include "Optional.h"
 
@@ -36,12 +37,64 @@ public:
 	public:
 		IsEndIterator( const T * endIt );
 		bool operator()( const T * it ) const;
+		const T * getEndIt() const;
 	private:
 		const T * endIt;
 	};
 
+	///@brief Format String parsed at compile time, the literal parts and the placeholders being found once for all.
+	///			To be declared constexpr, e.g. static constexpr auto logFormat( StringASCII::makeFormat( "Request % in % ms" ) );
+	///@template N Size of the literal (with the \0).
+	template<size_t N>
+	class Format {
+	public:
+		///@brief Parse a literal. To place a variable use the character '%'. To place a '%' escape it with a backslash ("\\%" in a C++ literal).
+		///@param str Literal, has to outlive this object.
+		constexpr Format( const T( &str )[ N ] );
+
+		///@brief Get the number of variables.
+		///@return Number of '%' placeholders.
+		constexpr Size getNbArgs() const;
+
+		///@brief Get the number of characters outside of the placeholders.
+		///@return Size of the literal parts.
+		constexpr Size getLiteralSize() const;
+
+		///@brief Get the number of literal parts (an escaped '%' splitting them too).
+		///@return Number of parts.
+		constexpr Size getNbParts() const;
+
+		///@brief Get a literal part.
+		///@param i Index of the part.
+		///@return Pointer to the first character of the part.
+		constexpr const T * getPart( Size i ) const;
+
+		///@brief Get the size of a literal part.
+		///@param i Index of the part.
+		///@return Number of characters.
+		constexpr Size getPartSize( Size i ) const;
+
+		///@brief Check if a literal part is followed by a placeholder.
+		///@param i Index of the part.
+		///@return True if a variable has to be written after, False otherwise.
+		constexpr bool isArgAfterPart( Size i ) const;
+
+	private:
+		constexpr void _addPart( Size beginI, Size endI, bool bArgAfter );
+
+		const T * str;
+		Size partBeginTable[ N ];
+		Size partSizeTable[ N ];
+		bool bArgAfterTable[ N ];
+		Size nbParts;
+		Size nbArgs;
+		Size literalSize;
+	};
+
 	static constexpr Size DefaultPrecisionDouble = 5;
 	static constexpr Size DefaultPrecisionFloat = 3;
+	///@brief Precision giving the shortest base 10 String reading back to the same float (DefaultPrecisionDouble in the other bases).
+	static constexpr unsigned int ShortestPrecision = 0xFFFFFFFF;
 
 
 	using Vector<T>::ElemType;
@@ -515,7 +568,7 @@ public:
 	///@brief			Converts a Number to a String.
 	///@param 		  	number	Number to be converted.
 	///@param [in,out]	buffer	Buffer to be filled with the converted value.
-	///@param			precision	The number of decimals.
+	///@param			precision	The number of decimals (rounded), or ShortestPrecision.
 	///@param 		  	base  	The base.
 	///@returns			Number of characters written.
 	static Size toCString( double number, T * buffer, unsigned int precision = DefaultPrecisionDouble, unsigned int base = 10 );
@@ -1357,7 +1410,7 @@ public:
 	///@returns	A Vector<BasicString<T>>
 	static Vector<BasicString<T>> split( const BasicString<T> & s, const T & delimiter );
 
-	///@brief		Format a reference String with values. To place a variable use the character '%'. To place a '%' use the '/''%' characters.
+	///@brief		Format a reference String with values. To place a variable use the character '%'. To place a '%' escape it with a backslash ("\\%" in a C++ literal).
 	///@tparam	T1   	First element type.
 	///@tparam	Types	Others elements.
 	///@param	referenceString	The reference string.
@@ -1368,7 +1421,7 @@ public:
 	static BasicString<T> format( const BasicString<T> & referenceString, const T1 & arg1, Types ... args );
 	static BasicString<T> format( const BasicString<T> & referenceString );
 
-	///@brief		Format a reference String with values. To place a variable use the character '%'. To place a '%' use the '/''%' characters.
+	///@brief		Format a reference String with values. To place a variable use the character '%'. To place a '%' escape it with a backslash ("\\%" in a C++ literal).
 	///@tparam	C		Reference string type.
 	///@tparam	T1   	First element type.
 	///@tparam	Types	Others elements.
@@ -1381,7 +1434,7 @@ public:
 	template<typename C>
 	static BasicString<T> format( C* const& str);
 
-	///@brief		Format a reference String with values. To place a variable use the character '%'. To place a '%' use the '/''%' characters.
+	///@brief		Format a reference String with values. To place a variable use the character '%'. To place a '%' escape it with a backslash ("\\%" in a C++ literal).
 	///@tparam	C		Reference string type.
 	///@tparam	N		Refernce string size.
 	///@tparam	T1   	First element type.
@@ -1395,6 +1448,31 @@ public:
 	template<typename C, size_t N>
 	static BasicString<T> format( const C( &str )[ N ] );
 
+	///@brief		Format a String parsed at compile time with values, written in a single allocation sized from the types of the values.
+	///				A number of values different from the number of placeholders is reported as an error (in every build), the extra values being ignored and the missing ones left empty.
+	///@tparam	N		Reference string size.
+	///@tparam	Types	Elements types.
+	///@param	format	The parsed reference string, with as many placeholders as values.
+	///@param	args	Values to be written.
+	///@returns	The formatted String.
+	template<size_t N, typename... Types>
+	static BasicString<T> format( const Format<N> & format, const Types & ... args );
+
+	///@brief		Format a String parsed at compile time with values, the number of values being checked at compile time.
+	///				e.g. static constexpr auto logFormat( StringASCII::makeFormat( "Request % in % ms" ) ); StringASCII::format<logFormat>( path, time );
+	///@tparam	F		The parsed reference string, a constexpr Format with static storage.
+	///@tparam	Types	Elements types, as many as the placeholders of F.
+	///@param	args	Values to be written.
+	///@returns	The formatted String.
+	template<const auto & F, typename... Types>
+	static BasicString<T> format( const Types & ... args );
+
+	///@brief		Parse a format literal, to be used in a constexpr.
+	///@param	str	Literal.
+	///@returns	The parsed Format.
+	template<size_t N>
+	static constexpr Format<N> makeFormat( const T( &str )[ N ] );
+
 
 	///@brief		Gets a first
 	///@param	buffer	  	The buffer.
@@ -1682,6 +1760,40 @@ private:
 	template<typename C>
 	static void __format( const C * referenceStringBegin, const C * referenceStringEnd, BasicString<T> * newString );
 
+	///@brief		Write the literal parts of a Format from a given one, and the values in its placeholders.
+	///@param 		  	format		The parsed reference string.
+	///@param 		  	partI		Index of the first part to be written.
+	///@param [in,out]	newString	String to be completed, with enough space.
+	///@param 		  	arg1		The value of the next placeholder.
+	///@param 		  	args		The others values.
+	template<size_t N, typename T1, typename... Types>
+	static void _formatFromPart( const Format<N> & format, Size partI, BasicString<T> * newString, const T1 & arg1, const Types & ... args );
+	template<size_t N>
+	static void _formatFromPart( const Format<N> & format, Size partI, BasicString<T> * newString );
+
+	///@brief		Get the maximum number of characters written by the concatenation of a value (its size for the strings, what _concatWOS() reserves otherwise).
+	///@param	v	Value.
+	///@returns	Number of characters (0 if unknown, the concatenation growing the String itself).
+	template<typename C>
+	static Size _getConcatMaxSize( const C & v );
+	template<typename C>
+	static Size _getConcatMaxSize( const BasicString<C> & str );
+	template<typename C>
+	static Size _getConcatMaxSize( C * const & buffer );
+	template<typename C, size_t N>
+	static Size _getConcatMaxSize( const C( &str )[ N ] );
+	static Size _getConcatMaxSize( const bool & b );
+	static Size _getConcatMaxSize( const char & c );
+	static Size _getConcatMaxSize( const wchar_t & c );
+	static Size _getConcatMaxSize( const int & i );
+	static Size _getConcatMaxSize( const unsigned int & ui );
+	static Size _getConcatMaxSize( const long int & l );
+	static Size _getConcatMaxSize( const unsigned long int & ul );
+	static Size _getConcatMaxSize( const long long int & ll );
+	static Size _getConcatMaxSize( const unsigned long long int & ull );
+	static Size _getConcatMaxSize( const double & d );
+	static Size _getConcatMaxSize( const float & f );
+
 	///@brief		Concatenate integer
 	///@tparam	Type	Type of the type.
 	///@tparam	Base	Type of the base.
@@ -1841,6 +1953,50 @@ private:
 	template<typename EndFunc = BasicString<T>::IsEndSentinel>
 	static bool _toBool(const T** itP, const EndFunc& endFunc = IS_END_SENTINEL);
 
+	///@brief		Read base 10 decimal digits into a significand of at most 19 digits, the following ones being only counted.
+	///@param [in,out]	itP	Iterator, moved after the digits.
+	///@param [in,out]	significand	Significand to be completed.
+	///@param [in,out]	nbDigits	Number of digits in the significand.
+	///@param [in,out]	bTruncated	Set to true if a non zero digit did not fit in the significand.
+	///@param	endFunc	Functor to detect end.
+	///@returns	Number of digits read.
+	template<typename EndFunc>
+	static int _readDecimalDigits( const T ** itP, unsigned long long int * significand, int * nbDigits, bool * bTruncated, const EndFunc & endFunc );
+
+	///@brief		Convert the decimal digits of a float with more than 19 significant digits, when the first 19 ones were not enough to round it.
+	///@param	it	Beginning of the digits (point included).
+	///@param	endIt	End of the digits.
+	///@param	exponent	Base 10 exponent of the last digit.
+	///@returns	Closest float.
+	template<typename Type>
+	static Type _toFloatSlow( const T * it, const T * endIt, int exponent );
+
+	///@brief		Get the float closest to significand * 10^exponent (Type being float or double).
+	static double _decimalToFloat( unsigned long long int significand, int exponent, const double * );
+	static float _decimalToFloat( unsigned long long int significand, int exponent, const float * );
+	///@brief		Get the float closest to a decimal number "ddddE-x" (Correctly rounded by the C library).
+	static double _decimalToFloat( const char * buffer, const double * );
+	static float _decimalToFloat( const char * buffer, const float * );
+
+	///@brief		Read 8 base 10 digits at once (SWAR, only for the characters of one byte).
+	///@param [in,out]	itP	Iterator, moved after the digits if read.
+	///@param [out]	digits	Value of the 8 digits.
+	///@param	endFunc	Functor to detect end.
+	///@returns	True if 8 digits were read, False otherwise (nothing read).
+	template<typename EndFunc>
+	static bool _readEightDigits( const T ** itP, unsigned int * digits, const EndFunc & endFunc );
+
+	///@brief		Check if at least 8 characters are left before the end, never reading after it.
+	template<typename EndFunc>
+	static bool _isEightCharsLeft( const T * it, const EndFunc & endFunc );
+	static bool _isEightCharsLeft( const T * it, const IsEndIterator & endFunc );
+
+	///@brief		Check if 8 characters loaded in an integer (little endian) are all decimal digits.
+	static bool _isEightDigits( unsigned long long int chars );
+
+	///@brief		Parse 8 decimal digits loaded in an integer (little endian).
+	static unsigned int _parseEightDigits( unsigned long long int chars );
+
 
 
 	///@brief		Convert i 2 string
@@ -1964,6 +2120,22 @@ private:
 	template<typename Type>
 	static void __convertFloat2StringWOS( Type number, T ** buffer, unsigned int precision = DefaultPrecisionFloat, unsigned int base = 10 );
 
+	///@brief		Convert a positive float to the shortest base 10 String reading back to the same value whithout \0.
+	///				Fixed notation with at least one decimal from 1e-4 to 1e16, scientific one (d.dddE-x) otherwise.
+	///@param 		  	number   	Finite and strictly positive number.
+	///@param [in,out]	buffer   	Buffer to be filled, at least 24 characters.
+	template<typename Type>
+	static void __convertFloat2StringShortestWOS( Type number, T ** buffer );
+
+	///@brief		Convert a positive float to a base 10 String with a fixed number of decimals whithout \0, using integers only.
+	///				The shortest decimal reading back to number is rounded half up, the same way for every magnitude and precision (2.675 -> 2.68).
+	///				Scientific notation (d.dddEx, precision digits) from 1e9.
+	///@param 		  	number   	Finite and strictly positive number.
+	///@param [in,out]	buffer   	Buffer to be filled, at least 12 + precision characters.
+	///@param 		  	precision	Number of decimals.
+	template<typename Type>
+	static void __convertFloat2StringFixedWOS( Type number, T ** buffer, unsigned int precision );
+
 
 	///@brief			Converts a Number to a String without adding the sentinel and filling for AT LEAST the fillNb number of characters.
 	///@template		Number Type.
@@ -2005,7 +2177,8 @@ private:
 	template<typename Type>
 	static Size _getUILength( Type i, unsigned int base );
 
-	
+	///@brief Table used instead of the heap by the small strings (sentinel included), the characters being in dataTable either way.
+	T smallTable[ Vector<T>::_getInlineMaxSize() ];
 };
 
 
@@ -47,9 +47,10 @@ template<typename T>
 template<typename C>
 BasicString<T>::BasicString( C* const& str ) :
 	Vector( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> size = BasicString<C>::getSize( str );
 	this -> maxSize = this -> size + 1;
-	this -> dataTable = new T[ this -> maxSize ];
+	this -> dataTable = this -> _newTable( this -> maxSize );
 	Vector<T>::_updateIterators();
 	copy( str, Vector<T>::getMaxSize() );
 }
@@ -72,31 +73,49 @@ Vector<T>(ctor::null)
 template<typename T>
 template<typename C>
 BasicString<T>::BasicString( const C* str, Size size ) :
-	Vector( str, size, size + 1 ) {
+	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
+	this -> size = size;
+	this -> maxSize = size + 1;
+	this -> dataTable = this -> _newTable( this -> maxSize );
+	Utility::copy( this -> dataTable, str, this -> size );
 	this -> dataTable[ this -> size ] = T( '\0' );
+	Vector<T>::_updateIterators();
 }
 
 template<typename T>
 template<typename C>
 BasicString<T>::BasicString( const typename RandomAccessIterator<C> beginIt, const typename RandomAccessIterator<C> endIt ) :
-	Vector<T>( beginIt, Size( endIt - beginIt ), Size( endIt - beginIt + 1 ) ) {
+	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
+	this -> size = Size( endIt - beginIt );
+	this -> maxSize = this -> size + 1;
+	this -> dataTable = this -> _newTable( this -> maxSize );
+	Utility::copy( this -> dataTable, beginIt, this -> size );
 	this -> dataTable[ this -> size ] = T( '\0' );
+	Vector<T>::_updateIterators();
 }
 
 
 
 template<typename T>
 BasicString<T>::BasicString() :
-	Vector<T>( Size( 0 ), Size( 1 ) ) {
+	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
+	this -> size = Size( 0 );
+	this -> maxSize = Size( 1 );
+	this -> dataTable = this -> _newTable( this -> maxSize );
 	this -> dataTable[ 0 ] = T( '\0' );
+	Vector<T>::_updateIterators();
 }
 
 
 template<typename T>
 BasicString<T>::BasicString( const unsigned char& ui, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 5;
-	this -> dataTable = new T[ 5 ];
+	this -> dataTable = this -> _newTable( 5 );
 	this -> size = toCString( ui, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -105,8 +124,9 @@ BasicString<T>::BasicString( const unsigned char& ui, unsigned int base ) :
 template<typename T>
 BasicString<T>::BasicString( const unsigned short& ui, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 7;
-	this -> dataTable = new T[ 7 ];
+	this -> dataTable = this -> _newTable( 7 );
 	this -> size = toCString( ui, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -115,8 +135,9 @@ BasicString<T>::BasicString( const unsigned short& ui, unsigned int base ) :
 template<typename T>
 BasicString<T>::BasicString( const int& i, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 12;
-	this -> dataTable = new T[ 12 ];
+	this -> dataTable = this -> _newTable( 12 );
 	this -> size = toCString( i, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -124,8 +145,9 @@ BasicString<T>::BasicString( const int& i, unsigned int base ) :
 template<typename T>
 BasicString<T>::BasicString( const unsigned int& ui, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 11;
-	this -> dataTable = new T[ 11 ];
+	this -> dataTable = this -> _newTable( 11 );
 	this -> size = toCString( ui, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -133,8 +155,9 @@ BasicString<T>::BasicString( const unsigned int& ui, unsigned int base ) :
 template<typename T>
 BasicString<T>::BasicString( const long int& l, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 21;
-	this -> dataTable = new T[ 21 ];
+	this -> dataTable = this -> _newTable( 21 );
 	this -> size = toCString( l, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -142,8 +165,9 @@ BasicString<T>::BasicString( const long int& l, unsigned int base ) :
 template<typename T>
 BasicString<T>::BasicString( const unsigned long int& ul, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 21;
-	this -> dataTable = new T[ 21 ];
+	this -> dataTable = this -> _newTable( 21 );
 	this -> size = toCString( ul, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -151,8 +175,9 @@ BasicString<T>::BasicString( const unsigned long int& ul, unsigned int base ) :
 template<typename T>
 BasicString<T>::BasicString( const long long int& ll, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 21;
-	this -> dataTable = new T[ 21 ];
+	this -> dataTable = this -> _newTable( 21 );
 	this -> size = toCString( ll, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -160,8 +185,9 @@ BasicString<T>::BasicString( const long long int& ll, unsigned int base ) :
 template<typename T>
 BasicString<T>::BasicString( const unsigned long long int& ull, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 21;
-	this -> dataTable = new T[ 21 ];
+	this -> dataTable = this -> _newTable( 21 );
 	this -> size = toCString( ull, this -> dataTable, base );
 	Vector<T>::_updateIterators();
 }
@@ -169,8 +195,9 @@ BasicString<T>::BasicString( const unsigned long long int& ull, unsigned int bas
 template<typename T>
 BasicString<T>::BasicString( const double& d, unsigned int precision, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 50;
-	this -> dataTable = new T[ 50 ];
+	this -> dataTable = this -> _newTable( 50 );
 	this -> size = toCString( d, this -> dataTable, precision, base );
 	Vector<T>::_updateIterators();
 }
@@ -178,8 +205,9 @@ BasicString<T>::BasicString( const double& d, unsigned int precision, unsigned i
 template<typename T>
 BasicString<T>::BasicString( const float& f, unsigned int precision, unsigned int base ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 30;
-	this -> dataTable = new T[ 30 ];
+	this -> dataTable = this -> _newTable( 30 );
 	this -> size = toCString( f, this -> dataTable, precision, base );
 	Vector<T>::_updateIterators();
 }
@@ -187,15 +215,21 @@ BasicString<T>::BasicString( const float& f, unsigned int precision, unsigned in
 template<typename T>
 BasicString<T>::BasicString( const bool& b ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this -> maxSize = 6;
-	this -> dataTable = new T[ 6 ];
+	this -> dataTable = this -> _newTable( 6 );
 	this -> size = toCString( b, this -> dataTable );
 	Vector<T>::_updateIterators();
 }
 
 template<typename T>
 BasicString<T>::BasicString( const T& c ) :
-	Vector<T>( 1, 2 ) {
+	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
+	this -> size = Size( 1 );
+	this -> maxSize = Size( 2 );
+	this -> dataTable = this -> _newTable( this -> maxSize );
+	Vector<T>::_updateIterators();
 	this -> dataTable[ 0 ] = T( c );
 	this -> dataTable[ 1 ] = T( '\0' );
 }
@@ -205,47 +239,64 @@ BasicString<T>::BasicString( const T& c ) :
 template<typename T>
 template<typename C, size_t N>
 BasicString<T>::BasicString( const C( &str )[ N ] ) :
-	Vector<T>( N - 1, N ) {
+	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
+	this -> size = N - 1;
+	this -> maxSize = N;
+	this -> dataTable = this -> _newTable( this -> maxSize );
+	Vector<T>::_updateIterators();
 	Utility::copy( this -> dataTable, str, N );
 }
 
 template<typename T>
 template<typename C>
 BasicString<T>::BasicString( const BasicString<C>& str ) :
-	Vector<T>( str.getSize(), str.getSize() + 1 ) {
+	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
+	this -> size = str.getSize();
+	this -> maxSize = str.getSize() + 1;
+	this -> dataTable = this -> _newTable( this -> maxSize );
+	Vector<T>::_updateIterators();
 	Utility::copy( this -> dataTable, str.getData(), Vector<T>::getMaxSize() );
 }
 
 template<typename T>
 BasicString<T>::BasicString( const BasicString<T>& str ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	if ( str.getSize() > Size( 0 ) ) {
 		this->size = str.getSize();
-		this->maxSize = str.getMaxSize();
-		this->dataTable = new T[ this->maxSize ];
-		Utility::copy( this -> dataTable, str.dataTable, Vector<T>::getMaxSize() );
+		// A short copy fits in the small table whatever the capacity of str.
+		this->maxSize = ( this->size < Vector<T>::_getInlineMaxSize() ) ? Vector<T>::_getInlineMaxSize() : str.getMaxSize();
+		this->dataTable = this->_newTable( this->maxSize );
+		Utility::copy( this -> dataTable, str.dataTable, this->size + Size( 1 ) );
 	} else {
 		this->size = Size( 0 );
 		this->maxSize = Size( 1 );
-		this->dataTable = new T[ this->maxSize ];
+		this->dataTable = this->_newTable( this->maxSize );
 		this->dataTable[ 0 ] = T( '\0' );
 	}
+	Vector<T>::_updateIterators();
 }
 
 template<typename T>
 BasicString<T>::BasicString( BasicString<T>&& str ) :
-	Vector<T>( Utility::toRValue( str ) ) { }
+	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
+	Vector<T>::_moveTable( str );
+}
 
 template<typename T>
 BasicString<T>::BasicString( typename BasicString<T>::protectedCtor ) : Vector<T>( Vector<T>::protectedCtor::null ) {
-
+	this -> inlineTable = this -> smallTable;
 }
 
 template<typename T>
 inline BasicString<T>::BasicString( const typename Math::Compare::Value& compareValue ) :
 	Vector<T>( Vector<T>::protectedCtor::null ) {
+	this -> inlineTable = this -> smallTable;
 	this->maxSize = 8;
-	this->dataTable = new T[ 8 ];
+	this->dataTable = this->_newTable( 8 );
 	this->size = toCString( compareValue, this->dataTable );
 	_updateIterators();
 
@@ -1436,6 +1487,10 @@ typename void BasicString<T>::__convertFloat2StringWOS( Type number, T** bufferP
 	}
 
 	if ( number == Type( 0 ) ) {
+		// Keep the sign of -0 so it reads back the same.
+		if ( std::signbit( number ) ) {
+			( *buffer++ ) = T( '-' );
+		}
 		( *buffer ) = T( '0' );
 		buffer++;
 		return;
@@ -1447,6 +1502,17 @@ typename void BasicString<T>::__convertFloat2StringWOS( Type number, T** bufferP
 		number = -number;
 	}
 
+	if ( base == 10 ) {
+		if ( precision == ShortestPrecision ) {
+			__convertFloat2StringShortestWOS( number, &buffer );
+			return;
+		}
+		__convertFloat2StringFixedWOS( number, &buffer, precision );
+		return;
+	} else if ( precision == ShortestPrecision ) {
+		precision = DefaultPrecisionDouble;
+	}
+
 	int comma = 1;
 	while ( number >= Type( base ) ) {
 		number /= Type( base );
@@ -1494,6 +1560,145 @@ typename void BasicString<T>::__convertFloat2StringWOS( Type number, T** bufferP
 	}
 }
 
+template<typename T>
+template<typename Type>
+void BasicString<T>::__convertFloat2StringShortestWOS( Type number, T** bufferP ) {
+	T*& buffer( *bufferP );
+
+	const Math::FloatDecimal::Decimal decimal( Math::FloatDecimal::toDecimal( number ) );
+
+	// Digits from the least significant one.
+	T digits[ 20 ];
+	int nbDigits( 0 );
+	for ( unsigned long long int significand( decimal.significand ); significand; significand /= 10ULL ) {
+		digits[ nbDigits++ ] = BasicString<T>::numbers[ significand % 10ULL ];
+	}
+
+	// Number of digits before the point.
+	const int pointI( nbDigits + decimal.exponent );
+
+	if ( pointI < -3 || pointI > 16 ) {
+		( *buffer++ ) = digits[ nbDigits - 1 ];
+		if ( nbDigits > 1 ) {
+			( *buffer++ ) = T( '.' );
+			for ( int i( nbDigits - 2 ); i >= 0; i-- ) {
+				( *buffer++ ) = digits[ i ];
+			}
+		}
+		( *buffer++ ) = T( 'E' );
+		const int exponent( pointI - 1 );
+		if ( exponent < 0 ) {
+			( *buffer++ ) = T( '-' );
+			__convertUI2StringWOS<unsigned int>( static_cast< unsigned int >( -exponent ), &buffer, 10 );
+		} else {
+			__convertUI2StringWOS<unsigned int>( static_cast< unsigned int >( exponent ), &buffer, 10 );
+		}
+	} else if ( pointI <= 0 ) {
+		( *buffer++ ) = T( '0' );
+		( *buffer++ ) = T( '.' );
+		for ( int i( pointI ); i < 0; i++ ) {
+			( *buffer++ ) = T( '0' );
+		}
+		for ( int i( nbDigits - 1 ); i >= 0; i-- ) {
+			( *buffer++ ) = digits[ i ];
+		}
+	} else if ( pointI >= nbDigits ) {
+		for ( int i( nbDigits - 1 ); i >= 0; i-- ) {
+			( *buffer++ ) = digits[ i ];
+		}
+		for ( int i( nbDigits ); i < pointI; i++ ) {
+			( *buffer++ ) = T( '0' );
+		}
+		( *buffer++ ) = T( '.' );
+		( *buffer++ ) = T( '0' );
+	} else {
+		int i( nbDigits - 1 );
+		for ( ; i >= nbDigits - pointI; i-- ) {
+			( *buffer++ ) = digits[ i ];
+		}
+		( *buffer++ ) = T( '.' );
+		for ( ; i >= 0; i-- ) {
+			( *buffer++ ) = digits[ i ];
+		}
+	}
+}
+
+template<typename T>
+template<typename Type>
+void BasicString<T>::__convertFloat2StringFixedWOS( Type number, T** bufferP, unsigned int precision ) {
+	T*& buffer( *bufferP );
+
+	// The rounding is done on the shortest decimal reading back to number, the same way for every magnitude.
+	const Math::FloatDecimal::Decimal decimal( Math::FloatDecimal::toDecimal( number ) );
+
+	// Digits from the most significant one.
+	unsigned char digits[ 20 ];
+	int nbDigits( 0 );
+	for ( unsigned long long int significand( decimal.significand ); significand; significand /= 10ULL ) {
+		digits[ nbDigits++ ] = static_cast< unsigned char >( significand % 10ULL );
+	}
+	for ( int i( 0 ); i < nbDigits / 2; i++ ) {
+		const unsigned char tmp( digits[ i ] );
+		digits[ i ] = digits[ nbDigits - 1 - i ];
+		digits[ nbDigits - 1 - i ] = tmp;
+	}
+
+	// Number of digits before the point.
+	int pointI( nbDigits + decimal.exponent );
+
+	// From 10 digits before the point, one digit is kept before the point and precision - 1 after it (d.dddEx).
+	const bool bScientific( pointI > 9 );
+	const int nbKept( bScientific ? ( ( precision > 0 ) ? int( precision ) : 1 ) : pointI + int( precision ) );
+
+	// Round half up.
+	if ( nbKept < 0 ) {
+		nbDigits = 0;
+	} else if ( nbKept < nbDigits ) {
+		const bool bRoundUp( digits[ nbKept ] >= 5 );
+		nbDigits = nbKept;
+		if ( bRoundUp ) {
+			int i( nbKept - 1 );
+			for ( ; i >= 0 && digits[ i ] == 9; i-- ) {
+				digits[ i ] = 0;
+			}
+			if ( i >= 0 ) {
+				digits[ i ]++;
+			} else {
+				// Carry out of the most significant digit (9.99 -> 10.0).
+				digits[ 0 ] = 1;
+				for ( int j( 1 ); j <= nbKept; j++ ) {
+					digits[ j ] = 0;
+				}
+				nbDigits = nbKept + 1;
+				pointI++;
+			}
+		}
+	}
+
+	const int precisionI( static_cast< int >( precision ) );
+	if ( bScientific ) {
+		( *buffer++ ) = BasicString<T>::numbers[ digits[ 0 ] ];
+		( *buffer++ ) = T( '.' );
+		for ( int i( 1 ); i < precisionI; i++ ) {
+			( *buffer++ ) = BasicString<T>::numbers[ ( i < nbDigits ) ? digits[ i ] : 0 ];
+		}
+		( *buffer++ ) = T( 'E' );
+		__convertUI2StringWOS<unsigned int>( static_cast< unsigned int >( pointI - 1 ), &buffer, 10 );
+	} else {
+		if ( pointI <= 0 ) {
+			( *buffer++ ) = T( '0' );
+		} else {
+			for ( int i( 0 ); i < pointI; i++ ) {
+				( *buffer++ ) = BasicString<T>::numbers[ ( i < nbDigits ) ? digits[ i ] : 0 ];
+			}
+		}
+		( *buffer++ ) = T( '.' );
+		for ( int i( pointI ); i < pointI + precisionI; i++ ) {
+			( *buffer++ ) = BasicString<T>::numbers[ ( i >= 0 && i < nbDigits ) ? digits[ i ] : 0 ];
+		}
+	}
+}
+
 template<typename T>
 template<typename Type>
 static Size BasicString<T>::_convertI2StringWOSFill( Type number, T** bufferP, const Size& fillNb, const T& fillChar, unsigned int base ) {
@@ -2381,12 +2586,20 @@ static Type BasicString<T>::_toSignedInteger( const T** itP, unsigned int base,
 		return 0;
 
 	Type result;
+	unsigned int eightDigits;
 	if ( *it == T( '-' ) ) {			//Check the sign
 		it++;
 		if ( !endFunc( it ) ) {
 			result = -( *it - 48 );
 			it++;
 
+			if constexpr ( sizeof( Type ) >= sizeof( int ) ) {
+				if ( base == 10 ) {
+					while ( _readEightDigits( &it, &eightDigits, endFunc ) ) {
+						result = result * Type( 100000000 ) - Type( eightDigits );
+					}
+				}
+			}
 			for ( ; !endFunc( it ); it++ ) {	//Start the computation
 				result = result * base - ( *it - T( '0' ) );
 			}
@@ -2398,6 +2611,13 @@ static Type BasicString<T>::_toSignedInteger( const T** itP, unsigned int base,
 			result = *it - 48;
 			it++;
 
+			if constexpr ( sizeof( Type ) >= sizeof( int ) ) {
+				if ( base == 10 ) {
+					while ( _readEightDigits( &it, &eightDigits, endFunc ) ) {
+						result = result * Type( 100000000 ) + Type( eightDigits );
+					}
+				}
+			}
 			for ( ; !endFunc( it ); it++ ) {	//Start the computation
 				result = result * base + ( *it - T( '0' ) );
 			}
@@ -2428,6 +2648,16 @@ static Type BasicString<T>::_toUnsignedInteger( const T** itP, unsigned int base
 	} else
 		return 0;
 
+	// 8 digits at once while possible.
+	if constexpr ( sizeof( Type ) >= sizeof( int ) ) {
+		if ( base == 10 ) {
+			unsigned int eightDigits;
+			while ( _readEightDigits( &it, &eightDigits, endFunc ) ) {
+				result = result * Type( 100000000 ) + Type( eightDigits );
+			}
+		}
+	}
+
 	for ( ; !endFunc( it ); it++ ) {	// Start the computation
 		result = result * base + ( *it - T( '0' ) );
 	}
@@ -2477,6 +2707,74 @@ static Type BasicString<T>::_toFloat( const T** itP, unsigned int base, const En
 		negative = false;
 	}
 
+	if ( base == 10 ) {
+		// Up to 19 significant digits in an integer, the following ones only moving the exponent.
+		const T* digitsBeginIt( it );
+		unsigned long long int significand( 0 );
+		int nbDigits( 0 );
+		int exponent( 0 );
+		bool bTruncated( false );
+
+		for ( ; !endFunc( it ) && *it == T( '0' ); it++ );
+		int nbDigitsBefore( nbDigits );
+		exponent += _readDecimalDigits( &it, &significand, &nbDigits, &bTruncated, endFunc ) - ( nbDigits - nbDigitsBefore );
+
+		int nbDecimals( 0 );
+		if ( !endFunc( it ) && *it == T( '.' ) ) {
+			it++;
+			const T* decimalsBeginIt( it );
+			if ( significand == 0ULL ) {
+				for ( ; !endFunc( it ) && *it == T( '0' ); it++ );
+				exponent -= int( it - decimalsBeginIt );
+			}
+			nbDigitsBefore = nbDigits;
+			_readDecimalDigits( &it, &significand, &nbDigits, &bTruncated, endFunc );
+			exponent -= nbDigits - nbDigitsBefore;
+			nbDecimals = int( it - decimalsBeginIt );
+		}
+		const T* digitsEndIt( it );
+
+		int exponentRead( 0 );
+		if ( !endFunc( it ) && ( *it == T( 'e' ) || *it == T( 'E' ) ) ) {
+			const T* exponentBeginIt( it );
+			it++;
+			bool bExponentNegative( false );
+			if ( !endFunc( it ) && ( *it == T( '-' ) || *it == T( '+' ) ) ) {
+				bExponentNegative = ( *it == T( '-' ) );
+				it++;
+			}
+			if ( !endFunc( it ) && *it >= T( '0' ) && *it <= T( '9' ) ) {
+				for ( ; !endFunc( it ) && *it >= T( '0' ) && *it <= T( '9' ); it++ ) {
+					// Already out of any float range.
+					if ( exponentRead < 100000 ) {
+						exponentRead = exponentRead * 10 + int( *it - T( '0' ) );
+					}
+				}
+				if ( bExponentNegative ) {
+					exponentRead = -exponentRead;
+				}
+			} else {
+				it = exponentBeginIt;
+			}
+		}
+		exponent += exponentRead;
+
+		if ( !bTruncated ) {
+			result = _decimalToFloat( significand, exponent, reinterpret_cast< const Type* >( NULL ) );
+		} else {
+			// The truncated digits may only change the rounding if the next significand gives another float.
+			result = _decimalToFloat( significand, exponent, reinterpret_cast< const Type* >( NULL ) );
+			if ( result != _decimalToFloat( significand + 1ULL, exponent, reinterpret_cast< const Type* >( NULL ) ) ) {
+				result = _toFloatSlow<Type>( digitsBeginIt, digitsEndIt, exponentRead - nbDecimals );
+			}
+		}
+
+		if ( negative )
+			result = -result;
+
+		return result;
+	}
+
 	const Type baseType( static_cast< Type >( base ) );
 	for ( ; !endFunc( it ) && *it != T( '.' ); it++ ) {			// Start the computation
 		result *= baseType;
@@ -2499,6 +2797,148 @@ static Type BasicString<T>::_toFloat( const T** itP, unsigned int base, const En
 	return result;
 }
 
+template<typename T>
+template<typename EndFunc>
+int BasicString<T>::_readDecimalDigits( const T** itP, unsigned long long int* significand, int* nbDigits, bool* bTruncated, const EndFunc& endFunc ) {
+	const T*& it( *itP );
+	const T* beginIt( it );
+
+	unsigned int eightDigits;
+	while ( *nbDigits <= 11 && _readEightDigits( &it, &eightDigits, endFunc ) ) {
+		*significand = *significand * 100000000ULL + eightDigits;
+		*nbDigits += 8;
+	}
+
+	for ( ; !endFunc( it ) && *it >= T( '0' ) && *it <= T( '9' ); it++ ) {
+		if ( *nbDigits < 19 ) {
+			*significand = *significand * 10ULL + static_cast< unsigned long long int >( *it - T( '0' ) );
+			( *nbDigits )++;
+		} else if ( *it != T( '0' ) ) {
+			*bTruncated = true;
+		}
+	}
+
+	return int( it - beginIt );
+}
+
+template<typename T>
+template<typename Type>
+Type BasicString<T>::_toFloatSlow( const T* it, const T* endIt, int exponent ) {
+	// 768 digits are enough to round any double, the following ones only matter by being non zero.
+	constexpr int maxDigits( 780 );
+	char buffer[ maxDigits + 16 ];
+	int nbDigits( 0 );
+	bool bSticky( false );
+	for ( ; it < endIt; it++ ) {
+		if ( *it == T( '.' ) || ( nbDigits == 0 && *it == T( '0' ) ) ) {
+			continue;
+		}
+		if ( nbDigits < maxDigits ) {
+			buffer[ nbDigits++ ] = char( *it );
+		} else {
+			exponent++;
+			if ( *it != T( '0' ) ) {
+				bSticky = true;
+			}
+		}
+	}
+	if ( bSticky ) {
+		buffer[ nbDigits++ ] = '1';
+		exponent--;
+	}
+
+	// No decimal point, not depending on the locale.
+	buffer[ nbDigits++ ] = 'E';
+	if ( exponent < 0 ) {
+		buffer[ nbDigits++ ] = '-';
+		exponent = -exponent;
+	}
+	char exponentDigits[ 12 ];
+	int nbExponentDigits( 0 );
+	do {
+		exponentDigits[ nbExponentDigits++ ] = char( '0' + exponent % 10 );
+		exponent /= 10;
+	} while ( exponent );
+	while ( nbExponentDigits ) {
+		buffer[ nbDigits++ ] = exponentDigits[ --nbExponentDigits ];
+	}
+	buffer[ nbDigits ] = '\0';
+
+	return _decimalToFloat( buffer, reinterpret_cast< const Type* >( NULL ) );
+}
+
+template<typename T>
+inline double BasicString<T>::_decimalToFloat( unsigned long long int significand, int exponent, const double* ) {
+	return Math::FloatDecimal::toDouble( significand, exponent );
+}
+
+template<typename T>
+inline float BasicString<T>::_decimalToFloat( unsigned long long int significand, int exponent, const float* ) {
+	return Math::FloatDecimal::toFloat( significand, exponent );
+}
+
+template<typename T>
+inline double BasicString<T>::_decimalToFloat( const char* buffer, const double* ) {
+	return strtod( buffer, NULL );
+}
+
+template<typename T>
+inline float BasicString<T>::_decimalToFloat( const char* buffer, const float* ) {
+	return strtof( buffer, NULL );
+}
+
+template<typename T>
+template<typename EndFunc>
+inline bool BasicString<T>::_readEightDigits( const T** itP, unsigned int* digits, const EndFunc& endFunc ) {
+	if constexpr ( sizeof( T ) == sizeof( char ) ) {
+		const T*& it( *itP );
+		if ( !_isEightCharsLeft( it, endFunc ) ) {
+			return false;
+		}
+		unsigned long long int chars;
+		memcpy( &chars, it, sizeof( chars ) );
+		if ( !_isEightDigits( chars ) ) {
+			return false;
+		}
+		*digits = _parseEightDigits( chars );
+		it += 8;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+template<typename T>
+template<typename EndFunc>
+inline bool BasicString<T>::_isEightCharsLeft( const T* it, const EndFunc& endFunc ) {
+	for ( int i( 0 ); i < 8; i++ ) {
+		if ( endFunc( it + i ) ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename T>
+inline bool BasicString<T>::_isEightCharsLeft( const T* it, const IsEndIterator& endFunc ) {
+	return endFunc.getEndIt() - it >= 8;
+}
+
+template<typename T>
+inline bool BasicString<T>::_isEightDigits( unsigned long long int chars ) {
+	// A byte outside of ['0', '9'] has its high bit set either after + 0x46 or after - 0x30.
+	return ( ( ( chars + 0x4646464646464646ULL ) | ( chars - 0x3030303030303030ULL ) ) & 0x8080808080808080ULL ) == 0ULL;
+}
+
+template<typename T>
+inline unsigned int BasicString<T>::_parseEightDigits( unsigned long long int chars ) {
+	// Combine the digits by pairs, then by 4, then by 8.
+	chars -= 0x3030303030303030ULL;
+	chars = ( chars * 10ULL ) + ( chars >> 8 );
+	chars = ( ( ( chars & 0x000000FF000000FFULL ) * 0x000F424000000064ULL ) + ( ( ( chars >> 16 ) & 0x000000FF000000FFULL ) * 0x0000271000000001ULL ) ) >> 32;
+	return static_cast< unsigned int >( chars );
+}
+
 
 /*
 template<typename T>
@@ -3403,7 +3843,7 @@ BasicString<T> BasicString<T>::toString( long int number, unsigned int base ) {
 template<typename T>
 BasicString<T> BasicString<T>::toString( double number, unsigned int precision, unsigned int base ) {
 	BasicString<T> newStr( Vector<T>::protectedCtor::null );
-	newStr._allocateNoNullDelete( sizeof( double ) * 8 + precision );
+	newStr._allocateNoNullDelete( sizeof( double ) * 8 + ( ( precision == ShortestPrecision ) ? 0 : precision ) );
 	newStr.size = toCString( number, newStr.dataTable, precision, base );
 	newStr._updateIterators();
 	return newStr;
@@ -3412,7 +3852,7 @@ BasicString<T> BasicString<T>::toString( double number, unsigned int precision,
 template<typename T>
 BasicString<T> BasicString<T>::toString( float number, unsigned int precision, unsigned int base ) {
 	BasicString<T> newStr( Vector<T>::protectedCtor::null );
-	newStr._allocateNoNullDelete( sizeof( float ) * 8 + precision );
+	newStr._allocateNoNullDelete( sizeof( float ) * 8 + ( ( precision == ShortestPrecision ) ? 0 : precision ) );
 	newStr.size = toCString( number, newStr.dataTable, precision, base );
 	newStr._updateIterators();
 	return newStr;
@@ -3632,6 +4072,9 @@ BasicString<T>& BasicString<T>::operator=( const BasicString<C>& str ) {
 
 template<typename T>
 BasicString<T>& BasicString<T>::operator=( const BasicString<T>& str ) {
+	if ( this == &str ) {
+		return *this;
+	}
 	return operator=<T>( str );
 }
 
@@ -4979,7 +5422,7 @@ void BasicString<T>::__format( const C* referenceStringBegin, const C* reference
 			}
 
 			it++;
-			itBegin = it;
+			itBegin = it + 1;
 
 			newString -> _concatWOS( T( '%' ) );
 			continue;
@@ -4993,6 +5436,11 @@ void BasicString<T>::__format( const C* referenceStringBegin, const C* reference
 			return __format( it + 1, referenceStringEnd, newString, args... );
 		}
 	}
+
+	// No placeholder left for the values.
+	if ( referenceStringEnd - itBegin > 0 ) {
+		newString -> _concatWOS( itBegin, Size( referenceStringEnd - itBegin ) );
+	}
 }
 
 template<typename T>
@@ -5009,10 +5457,7 @@ BasicString<T> BasicString<T>::_format( const C* referenceStringBegin, const C*
 	Size referenceStringSize( referenceStringEnd - referenceStringBegin );
 
 	newString.size = 0;
-	if ( referenceStringSize == 0 )
-		newString._allocateNoNullDelete( 1 );
-	else
-		newString._allocateNoNullDelete( referenceStringSize * 2 );
+	newString._allocateNoNullDelete( referenceStringSize + _getConcatMaxSize( arg1 ) + ( Size( 0 ) + ... + _getConcatMaxSize( args ) ) + Size( 1 ) );
 
 	newString.iteratorEnd = newString.dataTable;
 
@@ -5052,6 +5497,216 @@ inline BasicString<T> BasicString<T>::format( const C( &str )[ N ] ) {
 	return BasicString<T>( str, Size( N - 1 ) );
 }
 
+template<typename T>
+template<size_t N, typename... Types>
+BasicString<T> BasicString<T>::format( const Format<N>& format, const Types& ... args ) {
+	if ( format.getNbArgs() != Size( sizeof...( Types ) ) ) {
+		SimpleLog::callErrorHandler( TEXT( "BasicString::format : the number of values is not the number of placeholders." ), SimpleLog::MessageSeverity::Error, SimpleLog::MessageColor::Red );
+	}
+
+	BasicString<T> newString( Vector<T>::protectedCtor::null );
+
+	// Every concatenation will find the space it reserves, + 1 for the \0.
+	newString._allocateNoNullDelete( format.getLiteralSize() + ( Size( 0 ) + ... + _getConcatMaxSize( args ) ) + Size( 1 ) );
+	newString.size = 0;
+	newString.iteratorEnd = newString.dataTable;
+
+	_formatFromPart( format, Size( 0 ), &newString, args... );
+	*( newString.dataTable + newString.size ) = T( '\0' );
+
+	return newString;
+}
+
+template<typename T>
+template<const auto& F, typename... Types>
+inline BasicString<T> BasicString<T>::format( const Types& ... args ) {
+	static_assert( F.getNbArgs() == Size( sizeof...( Types ) ), "BasicString::format : the number of values has to be the number of placeholders." );
+	return BasicString<T>::format( F, args... );
+}
+
+template<typename T>
+template<size_t N>
+inline constexpr typename BasicString<T>::template Format<N> BasicString<T>::makeFormat( const T( &str )[ N ] ) {
+	return Format<N>( str );
+}
+
+template<typename T>
+template<size_t N, typename T1, typename... Types>
+void BasicString<T>::_formatFromPart( const Format<N>& format, Size partI, BasicString<T>* newString, const T1& arg1, const Types& ... args ) {
+	for ( ; partI < format.getNbParts(); partI++ ) {
+		newString -> _concatWOS( format.getPart( partI ), format.getPartSize( partI ) );
+		if ( format.isArgAfterPart( partI ) ) {
+			newString -> _concatWOS( arg1 );
+			return _formatFromPart( format, partI + Size( 1 ), newString, args... );
+		}
+	}
+}
+
+template<typename T>
+template<size_t N>
+void BasicString<T>::_formatFromPart( const Format<N>& format, Size partI, BasicString<T>* newString ) {
+	for ( ; partI < format.getNbParts(); partI++ ) {
+		newString -> _concatWOS( format.getPart( partI ), format.getPartSize( partI ) );
+	}
+}
+
+template<typename T>
+template<typename C>
+inline Size BasicString<T>::_getConcatMaxSize( const C& v ) {
+	return Size( 0 );
+}
+
+template<typename T>
+template<typename C>
+inline Size BasicString<T>::_getConcatMaxSize( const BasicString<C>& str ) {
+	return str.getSize();
+}
+
+template<typename T>
+template<typename C>
+inline Size BasicString<T>::_getConcatMaxSize( C* const& buffer ) {
+	return BasicString<C>::getSize( buffer );
+}
+
+template<typename T>
+template<typename C, size_t N>
+inline Size BasicString<T>::_getConcatMaxSize( const C( &str )[ N ] ) {
+	return BasicString<C>::getSize( str );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const bool& b ) {
+	return Size( 6 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const char& c ) {
+	return Size( 1 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const wchar_t& c ) {
+	return Size( 1 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const int& i ) {
+	return Size( 21 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const unsigned int& ui ) {
+	return Size( 21 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const long int& l ) {
+	return Size( 21 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const unsigned long int& ul ) {
+	return Size( 21 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const long long int& ll ) {
+	return Size( 21 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const unsigned long long int& ull ) {
+	return Size( 21 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const double& d ) {
+	return Size( 50 );
+}
+
+template<typename T>
+inline Size BasicString<T>::_getConcatMaxSize( const float& f ) {
+	return Size( 50 );
+}
+
+template<typename T>
+template<size_t N>
+constexpr BasicString<T>::Format<N>::Format( const T( &str )[ N ] ) :
+	str( str ),
+	partBeginTable{},
+	partSizeTable{},
+	bArgAfterTable{},
+	nbParts( 0 ),
+	nbArgs( 0 ),
+	literalSize( 0 ) {
+	const Size endI( N - 1 );
+	Size beginI( 0 );
+	for ( Size i( 0 ); i < endI; i++ ) {
+		if ( str[ i ] == T( '\\' ) && i + 1 < endI && str[ i + 1 ] == T( '%' ) ) {
+			// The escaped '%' begins the next part.
+			_addPart( beginI, i, false );
+			i++;
+			beginI = i;
+		} else if ( str[ i ] == T( '%' ) ) {
+			_addPart( beginI, i, true );
+			beginI = i + 1;
+		}
+	}
+	_addPart( beginI, endI, false );
+}
+
+template<typename T>
+template<size_t N>
+constexpr void BasicString<T>::Format<N>::_addPart( Size beginI, Size endI, bool bArgAfter ) {
+	if ( beginI == endI && !bArgAfter ) {
+		return;
+	}
+	this -> partBeginTable[ this -> nbParts ] = beginI;
+	this -> partSizeTable[ this -> nbParts ] = endI - beginI;
+	this -> bArgAfterTable[ this -> nbParts ] = bArgAfter;
+	this -> nbParts++;
+	this -> literalSize += endI - beginI;
+	if ( bArgAfter ) {
+		this -> nbArgs++;
+	}
+}
+
+template<typename T>
+template<size_t N>
+inline constexpr Size BasicString<T>::Format<N>::getNbArgs() const {
+	return this -> nbArgs;
+}
+
+template<typename T>
+template<size_t N>
+inline constexpr Size BasicString<T>::Format<N>::getLiteralSize() const {
+	return this -> literalSize;
+}
+
+template<typename T>
+template<size_t N>
+inline constexpr Size BasicString<T>::Format<N>::getNbParts() const {
+	return this -> nbParts;
+}
+
+template<typename T>
+template<size_t N>
+inline constexpr const T* BasicString<T>::Format<N>::getPart( Size i ) const {
+	return this -> str + this -> partBeginTable[ i ];
+}
+
+template<typename T>
+template<size_t N>
+inline constexpr Size BasicString<T>::Format<N>::getPartSize( Size i ) const {
+	return this -> partSizeTable[ i ];
+}
+
+template<typename T>
+template<size_t N>
+inline constexpr bool BasicString<T>::Format<N>::isArgAfterPart( Size i ) const {
+	return this -> bArgAfterTable[ i ];
+}
+
 
 template<typename T>
 Math::Compare::Value BasicString<T>::compare( const BasicString<T>& x, const BasicString<T>& y ) {
@@ -5088,6 +5743,11 @@ bool BasicString<T>::IsEndIterator::operator()( const T* it ) const {
 	return ( it == this -> endIt );
 }
 
+template<typename T>
+inline const T* BasicString<T>::IsEndIterator::getEndIt() const {
+	return this -> endIt;
+}
+
 template<typename T>
 template<typename N, int nbChars, int base>
 N BasicString<T>::parseNumber( const T** c ) {
@@ -0,0 +1,155 @@
+///@file		StringPool.h.
+///@brief		Declares a pool of interned strings and the handle used to refer to them.
+#pragma once
+
+#include <cstring>
+#include <mutex>
+
+#include "SimpleLog.h"
+#include "Utility.h"
+#include "Mutex.h"
+#include "MemoryArena.h"
+#include "IO/IO.h"
+#include "Math/Hash.h"
+
+
+template<typename S>
+class InternedStringT;
+
+///@brief Pool where the characters of each different string are stored only once, inside an arena, with their hash computed when first inserted.
+///			Interning the same characters twice gives the same entry, two interned strings of a pool are then equal if and only if they are the same pointer.
+///			Used for the identifiers repeated a lot of times (parameter names, keys or tag names of a parsed document...).
+///			The entries are never removed and keep their address until the pool is destroyed. Thread safe.
+///@template S String type of the interned strings.
+template<typename S>
+class StringPoolT {
+public:
+	typedef typename S::ElemType C;
+
+	///@brief String stored inside the pool, the characters being null terminated inside the arena.
+	struct Entry {
+		Entry( Math::Hash::Value hash, const C * buffer, Size size );
+
+		Math::Hash::Value hash;
+		const C * buffer;
+		Size size;
+	};
+
+	///@brief Constructor
+	///@param chunkSize (Optional) Size in bytes of the chunks of the arena where the entries are placed.
+	StringPoolT( const Size chunkSize = Size( 65536 ) );
+
+	///@brief Destructor, every InternedStringT of this pool become invalid.
+	~StringPoolT();
+
+	///@brief Get the interned string with the same characters, inserting it if not already inside the pool.
+	///@param buffer Characters to be interned.
+	///@param size Number of characters.
+	///@return Interned string, valid until the pool is destroyed.
+	InternedStringT<S> intern( const C * buffer, Size size );
+
+	///@brief Get the interned string with the same characters, inserting it if not already inside the pool.
+	///@param str String to be interned.
+	///@return Interned string, valid until the pool is destroyed.
+	InternedStringT<S> intern( const S & str );
+
+	///@brief Get the number of different strings inside the pool (the empty one excluded), locking it.
+	///@return Number of strings.
+	Size getNbStrings() const;
+
+	///@brief Get the pool used when none is specified, living until the end of the program.
+	///@return Default pool.
+	static StringPoolT<S> & getDefault();
+
+	///@brief Get the entry of the empty string, shared by every pool.
+	///@return Empty entry.
+	static const Entry * getEmptyEntry();
+
+private:
+	StringPoolT( const StringPoolT<S> & pool );
+	StringPoolT<S> & operator=( const StringPoolT<S> & pool );
+
+	///@brief Find the slot of the table of the entry with these characters, or the empty one where it should be inserted (linear probing).
+	Size _findSlot( Math::Hash::Value hash, const C * buffer, Size size ) const;
+
+	///@brief Double the size of the table, the entries keeping their address.
+	void _grow();
+
+	mutable Mutex mutex;
+	MemoryArena arena;
+
+	///@brief Open addressing table of the entries, NULL for an empty slot (the size is a power of two).
+	Entry ** table;
+	Size tableSize;
+	Size nbStrings;
+};
+
+
+///@brief Handle to a string interned inside a StringPoolT, as small as a pointer.
+///			The comparisons and the hash are O(1) whatever the size of the string : two handles are equal if they point to the same entry.
+///			The order is the one of the hashes (the characters only when two hashes are equal), not the alphabetical one but the same from a run to another, usable as the key of a Map.
+///			Handles coming from different pools must not be compared with == and !=, the empty string being the only one shared.
+///@template S String type of the interned strings.
+template<typename S>
+class InternedStringT : public IO::BasicIO {
+public:
+	typedef typename S::ElemType C;
+
+	///@brief Create an empty string.
+	InternedStringT();
+
+	///@brief Intern a string.
+	///@param str String to be interned.
+	///@param pool (Optional) Pool where the string is interned.
+	InternedStringT( const S & str, StringPoolT<S> & pool = StringPoolT<S>::getDefault() );
+	InternedStringT( const C * str, StringPoolT<S> & pool = StringPoolT<S>::getDefault() );
+
+	///@brief Compare two interned strings of the same pool, O(1).
+	bool operator==( const InternedStringT<S> & str ) const;
+	bool operator!=( const InternedStringT<S> & str ) const;
+
+	///@brief Order two interned strings by hash then by characters, O(1) unless the hashes are equal.
+	bool operator<( const InternedStringT<S> & str ) const;
+	bool operator>( const InternedStringT<S> & str ) const;
+
+	///@brief Get a copy of the interned string (toCString() and getSize() give the characters without any copy).
+	///@return String with the characters stored inside the pool.
+	S getString() const;
+	operator S() const;
+
+	///@brief Get the characters of the interned string.
+	///@return Null terminated characters.
+	const C * toCString() const;
+
+	///@brief Get the number of characters of the interned string.
+	///@return Size.
+	Size getSize() const;
+
+	///@brief Get the hash of the string, computed when it was first interned.
+	///@return Hash value (the same than Math::Hash::hash() of the string).
+	Math::Hash::Value getHash() const;
+
+	///@brief read from a file stream, the string being interned inside the default pool.
+	///@param stream stream used to read load this object
+	///@return boolean to know if the operation is a success of not.
+	template<typename Stream>
+	bool read( Stream * stream, int verbose = 0 );
+
+	///@brief write this object as binary into a file stream, as the string itself.
+	///@param stream stream used to write this object
+	///@return boolean to know if the operation is a success of not.
+	template<typename Stream>
+	bool write( Stream * stream ) const;
+
+private:
+	friend class StringPoolT<S>;
+
+	InternedStringT( const typename StringPoolT<S>::Entry * entry );
+
+	const typename StringPoolT<S>::Entry * entry;
+};
+
+using StringPool = StringPoolT<String>;
+using InternedString = InternedStringT<String>;
+
+#include "StringPool.hpp"
@@ -0,0 +1,222 @@
+template<typename S>
+StringPoolT<S>::Entry::Entry( Math::Hash::Value hash, const C * buffer, Size size ) :
+	hash( hash ),
+	buffer( buffer ),
+	size( size ) {
+
+}
+
+template<typename S>
+StringPoolT<S>::StringPoolT( const Size chunkSize ) :
+	arena( chunkSize ),
+	table( NULL ),
+	tableSize( 0 ),
+	nbStrings( 0 ) {
+
+}
+
+template<typename S>
+StringPoolT<S>::~StringPoolT() {
+	// The entries and their characters are released with the arena.
+	delete[] this -> table;
+}
+
+template<typename S>
+InternedStringT<S> StringPoolT<S>::intern( const C * buffer, Size size ) {
+	if ( size == Size( 0 ) ) {
+		return InternedStringT<S>( getEmptyEntry() );
+	}
+	const Math::Hash::Value hash( Math::Hash::hashBytes( buffer, size * sizeof( C ) ) );
+
+	this -> mutex.lock();
+	Size slotI( this -> tableSize ? _findSlot( hash, buffer, size ) : Size( 0 ) );
+	if ( this -> tableSize && this -> table[ slotI ] ) {
+		const Entry * entry( this -> table[ slotI ] );
+		this -> mutex.unlock();
+		return InternedStringT<S>( entry );
+	}
+
+	// Keep the table at most 3/4 full for the probing sequences to stay short.
+	if ( ( this -> nbStrings + Size( 1 ) ) * Size( 4 ) > this -> tableSize * Size( 3 ) ) {
+		_grow();
+		slotI = _findSlot( hash, buffer, size );
+	}
+	C * entryBuffer( reinterpret_cast< C * >( this -> arena.allocate( ( size + Size( 1 ) ) * sizeof( C ), Size( alignof( C ) ) ) ) );
+	Utility::copy( entryBuffer, buffer, size );
+	entryBuffer[ size ] = C( 0 );
+	Entry * entry( this -> arena.template create<Entry>( hash, entryBuffer, size ) );
+	this -> table[ slotI ] = entry;
+	this -> nbStrings++;
+	this -> mutex.unlock();
+
+	return InternedStringT<S>( entry );
+}
+
+template<typename S>
+inline InternedStringT<S> StringPoolT<S>::intern( const S & str ) {
+	return intern( str.toCString(), str.getSize() );
+}
+
+template<typename S>
+inline Size StringPoolT<S>::getNbStrings() const {
+	this -> mutex.lock();
+	const Size nbStrings( this -> nbStrings );
+	this -> mutex.unlock();
+	return nbStrings;
+}
+
+template<typename S>
+StringPoolT<S> & StringPoolT<S>::getDefault() {
+	static StringPoolT<S> defaultPool;
+	return defaultPool;
+}
+
+template<typename S>
+const typename StringPoolT<S>::Entry * StringPoolT<S>::getEmptyEntry() {
+	static const C emptyBuffer[ 1 ] = { C( 0 ) };
+	static const Entry emptyEntry( Math::Hash::hashBytes( emptyBuffer, Size( 0 ) ), emptyBuffer, Size( 0 ) );
+	return &emptyEntry;
+}
+
+template<typename S>
+Size StringPoolT<S>::_findSlot( Math::Hash::Value hash, const C * buffer, Size size ) const {
+	const Size mask( this -> tableSize - Size( 1 ) );
+	Size slotI( Size( hash ) & mask );
+	while ( this -> table[ slotI ] ) {
+		const Entry * entry( this -> table[ slotI ] );
+		if ( entry -> hash == hash && entry -> size == size && memcmp( entry -> buffer, buffer, size * sizeof( C ) ) == 0 ) {
+			break;
+		}
+		slotI = ( slotI + Size( 1 ) ) & mask;
+	}
+	return slotI;
+}
+
+template<typename S>
+void StringPoolT<S>::_grow() {
+	Entry ** oldTable( this -> table );
+	const Size oldTableSize( this -> tableSize );
+
+	this -> tableSize = oldTableSize ? oldTableSize * Size( 2 ) : Size( 64 );
+	this -> table = new Entry * [ this -> tableSize ];
+	for ( Size i( 0 ); i < this -> tableSize; i++ ) {
+		this -> table[ i ] = NULL;
+	}
+
+	// Every entry is different, only an empty slot has to be found.
+	const Size mask( this -> tableSize - Size( 1 ) );
+	for ( Size i( 0 ); i < oldTableSize; i++ ) {
+		Entry * entry( oldTable[ i ] );
+		if ( entry ) {
+			Size slotI( Size( entry -> hash ) & mask );
+			while ( this -> table[ slotI ] ) {
+				slotI = ( slotI + Size( 1 ) ) & mask;
+			}
+			this -> table[ slotI ] = entry;
+		}
+	}
+	delete[] oldTable;
+}
+
+
+template<typename S>
+inline InternedStringT<S>::InternedStringT() :
+	entry( StringPoolT<S>::getEmptyEntry() ) {
+
+}
+
+template<typename S>
+inline InternedStringT<S>::InternedStringT( const S & str, StringPoolT<S> & pool ) :
+	entry( pool.intern( str ).entry ) {
+
+}
+
+template<typename S>
+inline InternedStringT<S>::InternedStringT( const C * str, StringPoolT<S> & pool ) :
+	entry( pool.intern( str, S::getSize( str ) ).entry ) {
+
+}
+
+template<typename S>
+inline InternedStringT<S>::InternedStringT( const typename StringPoolT<S>::Entry * entry ) :
+	entry( entry ) {
+
+}
+
+template<typename S>
+inline bool InternedStringT<S>::operator==( const InternedStringT<S> & str ) const {
+	return this -> entry == str.entry;
+}
+
+template<typename S>
+inline bool InternedStringT<S>::operator!=( const InternedStringT<S> & str ) const {
+	return this -> entry != str.entry;
+}
+
+template<typename S>
+inline bool InternedStringT<S>::operator<( const InternedStringT<S> & str ) const {
+	// By hash then by characters, the addresses of the entries would change from a run to another.
+	if ( this -> entry == str.entry ) {
+		return false;
+	}
+	if ( this -> entry -> hash != str.entry -> hash ) {
+		return this -> entry -> hash < str.entry -> hash;
+	}
+	const Size minSize( Math::min( this -> entry -> size, str.entry -> size ) );
+	for ( Size i( 0 ); i < minSize; i++ ) {
+		if ( this -> entry -> buffer[ i ] != str.entry -> buffer[ i ] ) {
+			return this -> entry -> buffer[ i ] < str.entry -> buffer[ i ];
+		}
+	}
+	return this -> entry -> size < str.entry -> size;
+}
+
+template<typename S>
+inline bool InternedStringT<S>::operator>( const InternedStringT<S> & str ) const {
+	return str < *this;
+}
+
+template<typename S>
+inline S InternedStringT<S>::getString() const {
+	return S( this -> entry -> buffer, this -> entry -> size );
+}
+
+template<typename S>
+inline InternedStringT<S>::operator S() const {
+	return getString();
+}
+
+template<typename S>
+inline const typename InternedStringT<S>::C * InternedStringT<S>::toCString() const {
+	return this -> entry -> buffer;
+}
+
+template<typename S>
+inline Size InternedStringT<S>::getSize() const {
+	return this -> entry -> size;
+}
+
+template<typename S>
+inline Math::Hash::Value InternedStringT<S>::getHash() const {
+	return this -> entry -> hash;
+}
+
+template<typename S>
+template<typename Stream>
+bool InternedStringT<S>::read( Stream * stream, int verbose ) {
+	S str;
+	if ( !IO::read( stream, &str, verbose ) ) {
+		this -> entry = StringPoolT<S>::getEmptyEntry();
+		return false;
+	}
+	this -> entry = StringPoolT<S>::getDefault().intern( str ).entry;
+	return true;
+}
+
+template<typename S>
+template<typename Stream>
+bool InternedStringT<S>::write( Stream * stream ) const {
+	// Written as S for the files to be read back into a non interned string as well.
+	const S str( getString() );
+	return IO::write( stream, &str );
+}
@@ -0,0 +1,127 @@
+///@file		ThreadPool.h.
+///@brief		Declares a persistent work-stealing thread pool.
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#include "SimpleLog.h"
+#include "Utility.h"
+#include "Vector.h"
+#include "Math/Math.h"
+#include "Math/Interval.h"
+
+
+///@brief Pool of worker threads started once and reused for every parallel job.
+///			Every thread owns a task queue : it pops the last pushed tasks of its own queue and, when empty, steals the oldest ones of the others.
+///			A job is a fork/join of N independent tasks, the calling thread works on the job too until all of it's tasks are done.
+///			The workers are only started by the first parallel job, so a pool with one thread never create any.
+template<typename T>
+class ThreadPoolT {
+public:
+	///@brief Constructor
+	///@param nbThreads (Optional) Number of threads working on a job (the calling one included).
+	ThreadPoolT( const Size nbThreads = getDefaultNbThreads() );
+
+	///@brief Destructor, stop and join the workers.
+	~ThreadPoolT();
+
+	///@brief Change the number of threads working on a job (the calling one included). The workers are restarted.
+	///@param nbThreads Number of threads, 0 or 1 make every job run on the calling thread.
+	void setNbThreads( const Size nbThreads );
+
+	///@brief Get the number of threads working on a job (the calling one included).
+	///@return Number of threads.
+	Size getNbThreads() const;
+
+	///@brief Get the default number of threads (the number of hardware threads).
+	///@return Number of threads.
+	static Size getDefaultNbThreads();
+
+	///@brief Call func( taskI ) for every taskI in [0;nbTasks[ across the threads and wait for all of them.
+	///@param nbTasks Number of tasks.
+	///@param func Functor with operator() overloaded with : void operator()( const Size taskI );
+	template<typename Func>
+	void run( const Size nbTasks, Func & func );
+
+	///@brief Split an interval into one chunk per thread and call func( chunkInterval ) on each of them, then wait for all of them.
+	///@param interval Interval to be split.
+	///@param func Functor with operator() overloaded with : void operator()( const Math::Interval<Size> & interval );
+	template<typename Func>
+	void runInterval( const Math::Interval<Size> & interval, Func & func );
+
+private:
+	///@brief Group of tasks sharing the same functor.
+	struct Job {
+		void ( *callFunc )( void * func, const Size taskI );
+		void * func;
+		std::atomic<Size> nbTasksLeft;
+	};
+
+	///@brief One call of a job functor.
+	struct Task {
+		Job * job;
+		Size taskI;
+	};
+
+	///@brief Ring buffer of tasks, the owner works on the back and the thieves on the front.
+	class WorkQueue {
+	public:
+		WorkQueue();
+		~WorkQueue();
+
+		void push( const Task & task );
+		bool popBack( Task * task );
+		bool popFront( Task * task );
+
+	private:
+		void _grow();
+
+		std::mutex mutex;
+		Task * taskTable;
+		Size capacity;
+		Size beginI;
+		Size size;
+	};
+
+	///@brief Forward an erased call to the real functor.
+	template<typename Func>
+	static void _callFunc( void * func, const Size taskI );
+
+	///@brief Call a task and mark it as done.
+	static void _execute( const Task & task );
+
+	///@brief Retrieve a task, first from the queue queueI then from the other ones.
+	bool _popTask( const Size queueI, Task * task );
+
+	///@brief Get the queue used by the calling thread (the workers use their own, the other threads the first one).
+	Size _getQueueI();
+
+	void _start();
+	void _stop();
+	void _workerLoop( const Size queueI );
+
+	Size nbThreads;
+	bool bIsStarted;
+	bool bStop;
+
+	Vector<std::thread *> threadVector;
+	WorkQueue * queueTable;
+
+	std::mutex startMutex;
+	std::mutex sleepMutex;
+	std::condition_variable sleepCondition;
+	std::atomic<Size> nbPendingTasks;
+	std::atomic<Size> nextQueueI;
+
+	///@brief Pool owning the calling thread (NULL if not a worker).
+	static thread_local const ThreadPoolT<T> * currentPool;
+	///@brief Queue of the calling thread inside currentPool.
+	static thread_local Size currentQueueI;
+};
+
+using ThreadPool = ThreadPoolT<int>;
+
+#include "ThreadPool.hpp"
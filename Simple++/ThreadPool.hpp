@@ -0,0 +1,274 @@
+template<typename T>
+thread_local const ThreadPoolT<T> * ThreadPoolT<T>::currentPool( NULL );
+
+template<typename T>
+thread_local Size ThreadPoolT<T>::currentQueueI( 0 );
+
+template<typename T>
+ThreadPoolT<T>::ThreadPoolT( const Size nbThreads ) :
+	nbThreads( Math::max( nbThreads, Size( 1 ) ) ),
+	bIsStarted( false ),
+	bStop( false ),
+	queueTable( NULL ),
+	nbPendingTasks( 0 ),
+	nextQueueI( 0 ) {
+
+}
+
+template<typename T>
+ThreadPoolT<T>::~ThreadPoolT() {
+	_stop();
+}
+
+template<typename T>
+void ThreadPoolT<T>::setNbThreads( const Size nbThreads ) {
+	_stop();
+	this -> nbThreads = Math::max( nbThreads, Size( 1 ) );
+}
+
+template<typename T>
+Size ThreadPoolT<T>::getNbThreads() const {
+	return this -> nbThreads;
+}
+
+template<typename T>
+Size ThreadPoolT<T>::getDefaultNbThreads() {
+	return Math::max( Size( std::thread::hardware_concurrency() ), Size( 1 ) );
+}
+
+template<typename T>
+template<typename Func>
+void ThreadPoolT<T>::run( const Size nbTasks, Func & func ) {
+	if ( this -> nbThreads <= Size( 1 ) || nbTasks <= Size( 1 ) ) {
+		for ( Size taskI( 0 ); taskI < nbTasks; taskI++ ) {
+			func( taskI );
+		}
+		return;
+	}
+
+	_start();
+
+	Job job;
+	job.callFunc = &ThreadPoolT<T>::_callFunc<Func>;
+	job.func = reinterpret_cast< void * >( &func );
+	job.nbTasksLeft.store( nbTasks, std::memory_order_relaxed );
+
+	// Announce the tasks first, a worker may steal one before we have finished pushing.
+	{
+		std::lock_guard<std::mutex> lock( this -> sleepMutex );
+		this -> nbPendingTasks.fetch_add( nbTasks );
+	}
+
+	// Spread the tasks over every queue (our own included).
+	const Size queueI( _getQueueI() );
+	for ( Size taskI( 0 ); taskI < nbTasks; taskI++ ) {
+		Task task;
+		task.job = &job;
+		task.taskI = taskI;
+		this -> queueTable[ ( queueI + taskI ) % this -> nbThreads ].push( task );
+	}
+	this -> sleepCondition.notify_all();
+
+	// Help until every task of this job is done (the job is on our stack).
+	while ( job.nbTasksLeft.load( std::memory_order_acquire ) > Size( 0 ) ) {
+		Task task;
+		if ( _popTask( queueI, &task ) ) {
+			_execute( task );
+		} else {
+			std::this_thread::yield();
+		}
+	}
+}
+
+template<typename T>
+template<typename Func>
+void ThreadPoolT<T>::runInterval( const Math::Interval<Size> & interval, Func & func ) {
+	class IntervalFunc {
+	public:
+		IntervalFunc( const Math::Interval<Size> & interval, const Size nbChunks, Func & func ) :
+			interval( interval ),
+			nbChunks( nbChunks ),
+			func( func ) {}
+
+		void operator()( const Size chunkI ) {
+			const Size size( this -> interval.getSize() );
+			const Math::Interval<Size> chunkInterval( this -> interval.getBegin() + size * chunkI / this -> nbChunks,
+													  this -> interval.getBegin() + size * ( chunkI + Size( 1 ) ) / this -> nbChunks );
+			this -> func( chunkInterval );
+		}
+
+	private:
+		const Math::Interval<Size> & interval;
+		const Size nbChunks;
+		Func & func;
+	};
+
+	const Size nbChunks( Math::min( this -> nbThreads, interval.getSize() ) );
+	if ( nbChunks <= Size( 1 ) ) {
+		if ( interval.getSize() ) {
+			func( interval );
+		}
+		return;
+	}
+
+	IntervalFunc intervalFunc( interval, nbChunks, func );
+	run( nbChunks, intervalFunc );
+}
+
+template<typename T>
+template<typename Func>
+void ThreadPoolT<T>::_callFunc( void * func, const Size taskI ) {
+	( *reinterpret_cast< Func * >( func ) )( taskI );
+}
+
+template<typename T>
+void ThreadPoolT<T>::_execute( const Task & task ) {
+	Job * job( task.job );
+	job -> callFunc( job -> func, task.taskI );
+	// The job may be destroyed as soon as the last task is marked as done.
+	job -> nbTasksLeft.fetch_sub( Size( 1 ), std::memory_order_release );
+}
+
+template<typename T>
+bool ThreadPoolT<T>::_popTask( const Size queueI, Task * task ) {
+	if ( this -> queueTable[ queueI ].popBack( task ) ) {
+		this -> nbPendingTasks.fetch_sub( Size( 1 ) );
+		return true;
+	}
+	for ( Size i( 1 ); i < this -> nbThreads; i++ ) {
+		if ( this -> queueTable[ ( queueI + i ) % this -> nbThreads ].popFront( task ) ) {
+			this -> nbPendingTasks.fetch_sub( Size( 1 ) );
+			return true;
+		}
+	}
+	return false;
+}
+
+template<typename T>
+Size ThreadPoolT<T>::_getQueueI() {
+	if ( ThreadPoolT<T>::currentPool == this ) {
+		return ThreadPoolT<T>::currentQueueI;
+	}
+	return this -> nextQueueI.fetch_add( Size( 1 ), std::memory_order_relaxed ) % this -> nbThreads;
+}
+
+template<typename T>
+void ThreadPoolT<T>::_start() {
+	std::lock_guard<std::mutex> lock( this -> startMutex );
+	if ( this -> bIsStarted ) {
+		return;
+	}
+
+	this -> bStop = false;
+	this -> queueTable = new WorkQueue[ this -> nbThreads ];
+	for ( Size queueI( 1 ); queueI < this -> nbThreads; queueI++ ) {
+		this -> threadVector.push( new std::thread( &ThreadPoolT<T>::_workerLoop, this, queueI ) );
+	}
+	this -> bIsStarted = true;
+}
+
+template<typename T>
+void ThreadPoolT<T>::_stop() {
+	std::lock_guard<std::mutex> lock( this -> startMutex );
+	if ( !this -> bIsStarted ) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> sleepLock( this -> sleepMutex );
+		this -> bStop = true;
+	}
+	this -> sleepCondition.notify_all();
+
+	for ( Size i( 0 ); i < this -> threadVector.getSize(); i++ ) {
+		this -> threadVector[ i ] -> join();
+		delete this -> threadVector[ i ];
+	}
+	this -> threadVector.clear();
+
+	delete[] this -> queueTable;
+	this -> queueTable = NULL;
+	this -> bIsStarted = false;
+}
+
+template<typename T>
+void ThreadPoolT<T>::_workerLoop( const Size queueI ) {
+	ThreadPoolT<T>::currentPool = this;
+	ThreadPoolT<T>::currentQueueI = queueI;
+
+	while ( true ) {
+		Task task;
+		if ( _popTask( queueI, &task ) ) {
+			_execute( task );
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock( this -> sleepMutex );
+		while ( !this -> bStop && this -> nbPendingTasks.load() == Size( 0 ) ) {
+			this -> sleepCondition.wait( lock );
+		}
+		if ( this -> bStop ) {
+			return;
+		}
+	}
+}
+
+template<typename T>
+ThreadPoolT<T>::WorkQueue::WorkQueue() :
+	taskTable( new Task[ 64 ] ),
+	capacity( 64 ),
+	beginI( 0 ),
+	size( 0 ) {
+
+}
+
+template<typename T>
+ThreadPoolT<T>::WorkQueue::~WorkQueue() {
+	delete[] this -> taskTable;
+}
+
+template<typename T>
+void ThreadPoolT<T>::WorkQueue::push( const Task & task ) {
+	std::lock_guard<std::mutex> lock( this -> mutex );
+	if ( this -> size == this -> capacity ) {
+		_grow();
+	}
+	this -> taskTable[ ( this -> beginI + this -> size ) & ( this -> capacity - Size( 1 ) ) ] = task;
+	this -> size++;
+}
+
+template<typename T>
+bool ThreadPoolT<T>::WorkQueue::popBack( Task * task ) {
+	std::lock_guard<std::mutex> lock( this -> mutex );
+	if ( this -> size == Size( 0 ) ) {
+		return false;
+	}
+	this -> size--;
+	*task = this -> taskTable[ ( this -> beginI + this -> size ) & ( this -> capacity - Size( 1 ) ) ];
+	return true;
+}
+
+template<typename T>
+bool ThreadPoolT<T>::WorkQueue::popFront( Task * task ) {
+	std::lock_guard<std::mutex> lock( this -> mutex );
+	if ( this -> size == Size( 0 ) ) {
+		return false;
+	}
+	*task = this -> taskTable[ this -> beginI ];
+	this -> beginI = ( this -> beginI + Size( 1 ) ) & ( this -> capacity - Size( 1 ) );
+	this -> size--;
+	return true;
+}
+
+template<typename T>
+void ThreadPoolT<T>::WorkQueue::_grow() {
+	const Size newCapacity( this -> capacity * Size( 2 ) );
+	Task * newTaskTable( new Task[ newCapacity ] );
+	for ( Size i( 0 ); i < this -> size; i++ ) {
+		newTaskTable[ i ] = this -> taskTable[ ( this -> beginI + i ) & ( this -> capacity - Size( 1 ) ) ];
+	}
+	delete[] this -> taskTable;
+	this -> taskTable = newTaskTable;
+	this -> capacity = newCapacity;
+	this -> beginI = 0;
+}
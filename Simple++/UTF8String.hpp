@@ -444,7 +444,8 @@ template<typename T>
 template<typename C>
 void UTF8StringT<T>::_contructorEQUAL( const C * str, const Size & bufferSize ) {
 	this -> maxSize = ( bufferSize + 1 ) * 4;
-	this -> dataTable = new char[this -> maxSize];
+	this -> _deleteTable( this -> dataTable );
+	this -> dataTable = this -> _newTable( this -> maxSize );
 
 	auto bufferTmp = this -> dataTable;
 	for ( Size j = 0; j < bufferSize; j++ )
@@ -481,9 +482,11 @@ void UTF8StringT<T>::_operatorCONCAT( const C * str, const Size & bufferSize ) {
 	if ( this -> maxSize < newSizeSentinel ) {
 		this -> maxSize = newSizeSentinel * 2;
 
-		char * newDatas = new char[this -> maxSize];
-		Vector::copy( newDatas, this -> dataTable, oldSize );
-		delete[] this -> dataTable;
+		char * newDatas = this -> _newTable( this -> maxSize );
+		if ( newDatas != this -> dataTable ) {
+			Vector::copy( newDatas, this -> dataTable, oldSize );
+			this -> _deleteTable( this -> dataTable );
+		}
 		this -> dataTable = newDatas;
 	}
 
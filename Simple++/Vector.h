@@ -484,6 +484,12 @@ protected:
 	 */
 	void _extendBuffer( const Size newSizeNeeded );
 
+	/**
+	 * @brief 	Take the buffer of an other vector, copying it instead if it is its inline table. The buffer of this one has to be already freed.
+	 * @param 	v	Vector to be moved, left empty.
+	 */
+	void _moveTable( Vector<T> & v );
+
 	/** @brief	Updates the iterators */
 	void _updateIterators();
 
@@ -9,7 +9,9 @@
 template<typename T>
 Vector<T>::Vector(typename Vector<T>::protectedCtor) :
 	BasicVector<T>(BasicVector<T>::protectedCtor::null)
-{}
+{
+	this->dataTable = NULL;
+}
 
 
 template<typename T>
@@ -49,9 +51,9 @@ Vector<T>::Vector(const Vector<T>& vector) :
 
 template<typename T>
 Vector<T>::Vector( Vector && v ) :
-	BasicVector<T>(Utility::toRValue(v)),
-	maxSize( Utility::toRValue( v.maxSize ) ) {
-	_updateIterators();
+	BasicVector<T>(BasicVector<T>::protectedCtor::null)
+{
+	_moveTable( v );
 }
 
 
@@ -246,8 +248,8 @@ bool Vector<T>::iterate(typename Vector<T>::Iterator* it, ElemType** e, TestFunc
 template<typename T>
 template<typename C>
 void Vector<T>::createFromData( const C * dataTable, const Size size ) {
-	delete[] this -> dataTable;
-	this -> dataTable = new T[ size ];
+	this -> _deleteTable( this -> dataTable );
+	this -> dataTable = this -> _newTable( size );
 
 	Utility::copy( this -> dataTable, dataTable, size );
 
@@ -559,10 +561,10 @@ inline typename Vector<T>::Iterator Vector<T>::getIterator(const Size i) const {
 /************************************************************************/
 template<typename T>
 Vector<T> & Vector<T>::operator=( Vector<T> && v ) {
-	BasicVector<T>::operator=(Utility::toRValue(v));
-
-	this -> maxSize = Utility::toRValue( v.maxSize );
-	_updateIterators();
+	if ( this != &v ) {
+		this -> _deleteTable( this -> dataTable );
+		_moveTable( v );
+	}
 
 	return *this;
 }
@@ -573,10 +575,8 @@ Vector<T> & Vector<T>::operator=( const Vector<C> & vector ) {
 	this -> maxSize = vector.getMaxSize();
 	this -> size = vector.getSize();
 
-	if ( this->dataTable ) {
-		delete[] this -> dataTable;
-	}
-	this -> dataTable = ( this -> maxSize ) ? new T[ this -> maxSize ] : NULL;
+	this -> _deleteTable( this -> dataTable );
+	this -> dataTable = ( this -> maxSize ) ? this -> _newTable( this -> maxSize ) : NULL;
 	Utility::copy( this -> dataTable, vector.dataTable, this -> size );
 	_updateIterators();
 
@@ -588,10 +588,8 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& vector) {
 	this -> maxSize = vector.getMaxSize();
 	this -> size = vector.getSize();
 
-	if ( this->dataTable ) {
-		delete[] this -> dataTable;
-	}
-	this -> dataTable = ( this -> maxSize ) ? new T[ this -> maxSize ] : NULL;
+	this -> _deleteTable( this -> dataTable );
+	this -> dataTable = ( this -> maxSize ) ? this -> _newTable( this -> maxSize ) : NULL;
 	Utility::copy(this -> dataTable, vector.dataTable, this -> size);
 	_updateIterators();
 
@@ -632,16 +630,16 @@ void Vector<T>::reserve( const Size newMax ) {
 		this -> size = newMax;
 
 	if ( newMax == Size(0) ) {
-		delete[] this -> dataTable;
+		this -> _deleteTable( this -> dataTable );
 		this -> dataTable = NULL;
 	} else {
-		T * newTable = new T[ newMax ];
+		T * newTable = this -> _newTable( newMax );
 
-		if ( this->maxSize > Size(0) ) {
+		if ( this->maxSize > Size(0) && newTable != this -> dataTable ) {
 			// Copy old data
 			Utility::copy(newTable, dataTable, this -> size);
 
-			delete[] this -> dataTable;
+			this -> _deleteTable( this -> dataTable );
 		}
 		this -> dataTable = newTable;
 	}
@@ -688,10 +686,10 @@ void Vector<T>::inserti( const Size i, const T & v ) {
 template<typename T>
 void Vector<T>::_extendBuffer( const Size newSizeNeeded ) {
 	this -> maxSize = newSizeNeeded * 2;
-	T * newBuffer = new T[ this -> maxSize ];
-	if ( this -> dataTable != NULL ) {
+	T * newBuffer = this -> _newTable( this -> maxSize );
+	if ( this -> dataTable != NULL && newBuffer != this -> dataTable ) {
 		Utility::copy( newBuffer, this -> dataTable, this -> size );
-		delete[] this -> dataTable;
+		this -> _deleteTable( this -> dataTable );
 	}
 	this -> dataTable = newBuffer;
 }
@@ -699,9 +697,9 @@ void Vector<T>::_extendBuffer( const Size newSizeNeeded ) {
 
 template<typename T>
 void Vector<T>::allocate( const Size newMax ) {
-	delete[] this -> dataTable;
+	this -> _deleteTable( this -> dataTable );
 	if ( newMax )
-		this -> dataTable = new T[ newMax ];
+		this -> dataTable = this -> _newTable( newMax );
 	else
 		this -> dataTable = NULL;
 
@@ -712,15 +710,15 @@ void Vector<T>::allocate( const Size newMax ) {
 
 template<typename T>
 void Vector<T>::_allocateNoNullDelete( const Size newMax ) {
-	this -> dataTable = new T[ newMax ];
+	this -> dataTable = this -> _newTable( newMax );
 	this -> maxSize = newMax;
 }
 
 
 template<typename T>
 void Vector<T>::_allocateNoNull( const Size newMax ) {
-	delete[] this -> dataTable;
-	this -> dataTable = new T[ newMax ];
+	this -> _deleteTable( this -> dataTable );
+	this -> dataTable = this -> _newTable( newMax );
 	this -> maxSize = newMax;
 }
 
@@ -827,7 +825,26 @@ template<typename T>
 void Vector<T>::_clear() {
 	this -> size = 0;
 	this -> maxSize = 0;
-	delete[] this -> dataTable;
+	this -> _deleteTable( this -> dataTable );
 	this -> dataTable = NULL;
 	_updateIterators();
 }
+
+template<typename T>
+void Vector<T>::_moveTable( Vector<T> & v ) {
+	this -> size = v.size;
+	this -> maxSize = v.maxSize;
+	if ( v.dataTable && v.dataTable == v.inlineTable ) {
+		// The inline table of v can't be taken, its content fits in the one of this vector if any.
+		// The whole table is copied, the sentinel of a string being after the size.
+		this -> dataTable = this -> _newTable( this -> maxSize );
+		Utility::copy( this -> dataTable, v.dataTable, this -> maxSize );
+	} else {
+		this -> dataTable = v.dataTable;
+		v.dataTable = NULL;
+		v.size = 0;
+		v.maxSize = 0;
+		v._updateIterators();
+	}
+	_updateIterators();
+}
@@ -9,7 +9,9 @@
 #include "../Vector.h"
 #include "../MultiMap.h"
 #include "../Math/Math.h"
+#include "../MemoryArena.h"
 #include "Param.h"
+#include "Reader.h"
 
 
 
@@ -244,6 +246,13 @@ namespace XML {
 		template<typename C, typename EndFunc = BasicString<C>::IsEndSentinel>
 		bool _readXML( const C ** buffer, const EndFunc & endFunc = BasicString<C>::IS_END_SENTINEL );
 
+		///@brief Append the nodes read by a reader to this node.
+		///@param reader Reader to read from.
+		///@param bElement True if the opening tag of this node has just been read by the reader (stop when it is closed), False to read until the end of the reader.
+		///@return bool True if success, False otherwise.
+		template<typename C>
+		bool _appendXML( ReaderT<S, C> * reader, bool bElement );
+
 		///@brief Write this node to an Object that support opperator '<<'.
 		///@param o Object to write to.
 		///@param tabs Number of tabulations to be added.
@@ -257,6 +266,33 @@ namespace XML {
 		template<typename C>
 		static bool _expectChar( const C ** buffer, const C & c );
 
+		///@brief Create a new node of type N, inside the arena if not NULL (the node and every child parsed into it will then use it).
+		///@param arena Arena where to place the node (NULL to use the heap).
+		///@param args Arguments forwarded to the constructor.
+		///@return Pointer to the new node, to be released with _deleteNode().
+		template<typename N, typename... Args>
+		static N * _newNode( MemoryArena * arena, Args && ... args );
+
+		///@brief Delete a node created by _newNode() (Text nodes included), only it's destructor is called if it lives inside an arena.
+		///@param node Node to be deleted (can be NULL).
+		static void _deleteNode( NodeT<S> * node );
+
+		///@brief Create a new param, inside the arena if not NULL.
+		///@param arena Arena where to place the param (NULL to use the heap).
+		///@param args Arguments forwarded to the constructor.
+		///@return Pointer to the new param, to be released with _deleteParam().
+		template<typename... Args>
+		static ParamT<S> * _newParam( MemoryArena * arena, Args && ... args );
+
+		///@brief Delete a param created by _newParam() or with new, only it's destructor is called if it lives inside an arena.
+		///@param param Param to be deleted.
+		static void _deleteParam( ParamT<S> * param );
+
+		///@brief Make every node and param of this sub tree living inside oldArena use newArena instead (the chunks of oldArena having been moved to newArena).
+		///@param oldArena Arena the chunks have been moved from.
+		///@param newArena Arena the chunks have been moved to.
+		void _moveArena( const MemoryArena * oldArena, MemoryArena * newArena );
+
 	protected:
 		void _clear();
 		void _unload();
@@ -268,9 +304,6 @@ namespace XML {
 		bool _setChildId( NodeT<S> * child, const S & id );
 		void _getElementsById( Vector < NodeT<S> * > * nodeVector, const S & id ) const;
 		void _getElementsByName( Vector < NodeT<S> * > * nodeVector, const S & name ) const;
-		
-		template<typename C, typename EndFunc = BasicString<C>::IsEndSentinel>
-		bool _parseParameter( const C ** buffer, const EndFunc & endFunc = BasicString<C>::IS_END_SENTINEL );
 
 		
 
@@ -281,6 +314,9 @@ namespace XML {
 
 		NodeT<S> * parent;
 
+		///@brief Arena owning the memory of this node, NULL if allocated on the heap.
+		MemoryArena * arena;
+
 		Map< S, ParamT<S> * > paramsMap;
 		MultiMap< S, NodeT<S> * > childrenMap;
 		Vector< ParamT<S> * > paramsVector;
@@ -300,6 +336,7 @@ namespace XML {
 		///@brief create node
 		///@param value value of the node
 		NodeTextT( const S & value );
+		NodeTextT( S && value );
 
 		///@brief Copy Constructor
 		///@param node NodeT<S> to be copied
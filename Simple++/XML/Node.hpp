@@ -3,7 +3,8 @@ namespace XML {
 	template<typename S>
 	NodeT<S>::NodeT() :
 		type( Type::Element ),
-		parent( NULL ) {
+		parent( NULL ),
+		arena( NULL ) {
 
 		// Ensure S is a derived of BasicString.
 		static_assert( Utility::isBase<BasicString<S::ElemType>, S>::value );
@@ -13,7 +14,8 @@ namespace XML {
 	NodeT<S>::NodeT( const S & name, Type type ) :
 		name( name ),
 		type( type ),
-		parent( NULL ) {
+		parent( NULL ),
+		arena( NULL ) {
 
 		// Ensure S is a derived of BasicString.
 		static_assert( Utility::isBase<BasicString<S::ElemType>, S>::value );
@@ -24,7 +26,8 @@ namespace XML {
 		name( node.name ),
 		id( node.id ),
 		type( node.type ),
-		parent( NULL ) {
+		parent( NULL ),
+		arena( NULL ) {
 
 		for ( auto it( node.childrenVector.getBegin() ); it != node.childrenVector.getEnd(); node.childrenVector.iterate( &it ) ) {
 			NodeT<S> * newNode( new NodeT<S>( *( node.childrenVector.getValueIt( it ) ) ) );
@@ -45,7 +48,8 @@ namespace XML {
 		paramsVector( Utility::toRValue( node.paramsVector ) ),
 		childrenMap( Utility::toRValue( node.childrenMap ) ),
 		childrenVector( Utility::toRValue( node.childrenVector ) ),
-		parent( Utility::toRValue( node.parent ) ) {
+		parent( Utility::toRValue( node.parent ) ),
+		arena( NULL ) {
 
 		node.childrenVector.clear();
 		node.paramsVector.clear();
@@ -213,7 +217,7 @@ namespace XML {
 	bool NodeT<S>::deleteParam( ParamT<S> * param ) {
 		if ( this -> paramsVector.eraseFirst( param ) ) {
 			this -> paramsMap.eraseI( param -> getName() );
-			delete param;
+			_deleteParam( param );
 			return true;
 		}
 		return false;
@@ -227,7 +231,7 @@ namespace XML {
 			ParamT<S> * param( this -> paramsVector[ i ] );
 			this -> paramsVector.eraseI( i );
 			this -> paramsMap.eraseI( param -> getName() );
-			delete param;
+			_deleteParam( param );
 			return true;
 		}
 	}
@@ -288,7 +292,7 @@ namespace XML {
 				NodeTextT<S> * nodeTextChild( child -> toText() );
 
 				nodeTextThis -> getValue().concat( nodeTextChild -> getValue() );
-				delete nodeTextChild;
+				_deleteNode( nodeTextChild );
 			} else {
 				if ( this -> parent ) {
 					this -> parent -> addChild( child );
@@ -323,26 +327,93 @@ namespace XML {
 	template<typename S>
 	void NodeT<S>::_unload() {
 		for ( auto it( this -> paramsVector.getBegin() ); it != this -> paramsVector.getEnd(); this -> paramsVector.iterate( &it ) ) {
-			delete this -> paramsVector.getValueIt( it );
+			_deleteParam( this -> paramsVector.getValueIt( it ) );
 		}
 		for ( auto it( this -> childrenVector.getBegin() ); it != this -> childrenVector.getEnd(); this -> childrenVector.iterate( &it ) ) {
 			NodeT<S> * node( this -> childrenVector.getValueIt( it ) );
-			switch ( node->getType() ) {
-				case NodeT<S>::Type::Text:
-				{
-					NodeTextT<S> * nodeText( ( NodeTextT<S> * ) node );
+			_deleteNode( node );
+		}
+	}
+
+	template<typename S>
+	template<typename N, typename... Args>
+	N * NodeT<S>::_newNode( MemoryArena * arena, Args && ... args ) {
+		if ( arena ) {
+			N * newNode( arena -> create<N>( std::forward<Args>( args )... ) );
+			static_cast< NodeT<S> * >( newNode ) -> arena = arena;
+			return newNode;
+		} else {
+			return new N( std::forward<Args>( args )... );
+		}
+	}
+
+	template<typename S>
+	void NodeT<S>::_deleteNode( NodeT<S> * node ) {
+		if ( !node ) {
+			return;
+		}
+		// The destructor is not virtual, Text nodes have to be deleted as such.
+		switch ( node->getType() ) {
+			case NodeT<S>::Type::Text:
+			{
+				NodeTextT<S> * nodeText( ( NodeTextT<S> * ) node );
+				if ( node -> arena ) {
+					MemoryArena::destroy( nodeText );
+				} else {
 					delete nodeText;
-					break;
 				}
-				default:
-				{
+				break;
+			}
+			default:
+			{
+				if ( node -> arena ) {
+					MemoryArena::destroy( node );
+				} else {
 					delete node;
-					break;
 				}
+				break;
 			}
 		}
 	}
 
+	template<typename S>
+	template<typename... Args>
+	ParamT<S> * NodeT<S>::_newParam( MemoryArena * arena, Args && ... args ) {
+		if ( arena ) {
+			ParamT<S> * newParam( arena -> create<ParamT<S>>( std::forward<Args>( args )... ) );
+			newParam -> arena = arena;
+			return newParam;
+		} else {
+			return new ParamT<S>( std::forward<Args>( args )... );
+		}
+	}
+
+	template<typename S>
+	void NodeT<S>::_deleteParam( ParamT<S> * param ) {
+		if ( param -> arena ) {
+			MemoryArena::destroy( param );
+		} else {
+			delete param;
+		}
+	}
+
+	template<typename S>
+	void NodeT<S>::_moveArena( const MemoryArena * oldArena, MemoryArena * newArena ) {
+		// Nodes added from the heap keep a NULL arena.
+		if ( this -> arena == oldArena ) {
+			this -> arena = newArena;
+		}
+		for ( auto it( this -> paramsVector.getBegin() ); it != this -> paramsVector.getEnd(); this -> paramsVector.iterate( &it ) ) {
+			ParamT<S> * param( this -> paramsVector.getValueIt( it ) );
+			if ( param -> arena == oldArena ) {
+				param -> arena = newArena;
+			}
+		}
+		for ( auto it( this -> childrenVector.getBegin() ); it != this -> childrenVector.getEnd(); this -> childrenVector.iterate( &it ) ) {
+			this -> childrenVector.getValueIt( it ) -> _moveArena( oldArena, newArena );
+		}
+	}
+
 	template<typename S>
 	const Vector< NodeT<S> * > NodeT<S>::getChild( const S & name ) const {
 		auto childP = this -> childrenMap[ name ];
@@ -375,7 +446,7 @@ namespace XML {
 	bool NodeT<S>::deleteChild( NodeT<S> * child ) {
 		NodeT<S> * childRemoved( removeChild( child ) );
 		if ( childRemoved ) {
-			delete childRemoved;
+			_deleteNode( childRemoved );
 			return true;
 		} else {
 			return false;
@@ -386,7 +457,7 @@ namespace XML {
 	bool NodeT<S>::deleteChild( Size i ) {
 		NodeT<S> * childRemoved( removeChild( i ) );
 		if ( childRemoved ) {
-			delete childRemoved;
+			_deleteNode( childRemoved );
 			return true;
 		} else {
 			return false;
@@ -441,150 +512,86 @@ namespace XML {
 	template<typename S>
 	template<typename C, typename EndFunc>
 	bool NodeT<S>::_readXML( const C ** buffer, const EndFunc & endFunc ) {
-		struct FunctorNodeName {
-			bool operator()( const C & c ) { return c != C( ' ' ) && c != C( '\t' ) && c != C( '>' ) && c != C( '/' ); }
-		};
-		struct FunctorContent {
-			bool operator()( const C & c ) { return c != C( '<' ); }
-		};
-		struct FunctorSpace {
-			bool operator()( const C & c ) { return c == C( '\n' ) || c == C( '\t' ) || c == C( ' ' ); }
-		};
-		struct FunctorNoSpace {
-			bool operator()( const C & c ) { return c != C( '<' ) && c != C( '\n' ) && c != C( '\t' ) && c != C( ' ' ); }
-		};
-		static FunctorNodeName functorNodeName;
-		static FunctorContent functorContent;
-		static FunctorSpace functorSpace;
-
 		const C *& it( *buffer );
 
-		{
-			while ( functorSpace( *it ) ) it++;
-
-			if ( !NodeT<S>::_expectChar( &it, C( '<' ) ) ) return false;
-
-			// We have an opening node or self closing
-			auto beginIt( it );
-			while ( true ) {
-				if ( endFunc( it ) ) {
-					ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-					return false;
-				}
-				if ( !functorNodeName( *it ) ) break;
-				it++;
-			}
-			// Call the constructor (pointer, size).
-			S nodeName( beginIt, Size( it - beginIt ) );
-
-			this -> setName( nodeName );
+		const C * endIt( it );
+		while ( !endFunc( endIt ) ) endIt++;
 
-			while ( _parseParameter( &it, endFunc ) );
-
-			if ( ( *it ) == C( '/' ) ) {
-				// Self closing node
-				it++;
-				while ( functorSpace( *it ) ) it++;
-
-				return NodeT<S>::_expectChar( &it, C( '>' ) );
-			} else {
-				while ( functorSpace( *it ) ) it++;
-				if ( ( *it ) != C( '>' ) ) {
-					ERROR_SPP( TEXT( "[XML ERROR] : Expecting '>'." ) );
-					return false;
-				}
-				it++;
-				// End of opening node.
+		ReaderT<S, C> reader( it, Size( endIt - it ) );
+		const typename ReaderT<S, C>::Event event( reader.next() );
+		if ( event != ReaderT<S, C>::Event::StartElement ) {
+			if ( event != ReaderT<S, C>::Event::Error ) {
+				ERROR_SPP( TEXT( "[XML ERROR] : Expected '<'." ) );
 			}
+			return false;
 		}
+		this -> setName( reader.getName() );
 
-		// Start of node content.
-
-		appendXML( &it, endFunc );
-
-		{
-			it++; // Skip the '/'
-			auto beginIt( it );
-			while ( true ) {
-				if ( endFunc( it ) ) {
-					ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-					return false;
-				}
-				if ( !functorNodeName( *it ) ) break;
-				it++;
-			}
-
-			// Call the constructor (pointer, size).
-			S nodeName( beginIt, Size( it - beginIt ) );
-
-			while ( functorSpace( *it ) ) it++;
-
-			if ( nodeName != this -> getName() ) {
-				ERROR_SPP( String::format( TEXT( "[XML ERROR] : Closing node do not match. \"%\" != \"%\"." ), this -> getName(), nodeName ) );
-				// SYNTAX ERROR
-				return false;
-			} else {
-				return NodeT<S>::_expectChar( &it, C( '>' ) );
-			}
-		}
+		const bool bResult( _appendXML( &reader, true ) );
+		it += reader.getPosition();
+		return bResult;
 	}
 
 	template<typename S>
 	template<typename C, typename EndFunc>
 	bool NodeT<S>::appendXML( const C ** buffer, const EndFunc & endFunc ) {
-		struct FunctorContent {
-			bool operator()( const C & c ) { return c != C( '<' ); }
-		};
-		struct FunctorSpace {
-			bool operator()( const C & c ) { return c == C( '\n' ) || c == C( '\t' ) || c == C( ' ' ); }
-		};
-		static FunctorContent functorContent;
-		static FunctorSpace functorSpace;
-
 		const C *& it( *buffer );
 
-		while ( true ) {
-			while ( functorSpace( *it ) ) it++;
-			const C * beginIt( it );
-			const C * endIt;
-			while ( functorContent( *it ) && !endFunc( it ) ) it++;
-
-			if ( it > beginIt ) {
-				// We probably found something.
-				endIt = it;
-				while ( functorSpace( *( endIt -1) ) ) endIt--;
-
-				if ( endIt != beginIt ) {
-					// We have content, so we gonna create a text node and add the content
-					// Call the constructor (pointer, size).
-					S textContent( beginIt, Size( endIt - beginIt ) );
-					NodeTextT<S> * nodeText( new NodeTextT<S>( textContent ) );
-
-					this -> addChild( nodeText );
-				}
-			}
+		const C * endIt( it );
+		while ( !endFunc( endIt ) ) endIt++;
 
-			if ( endFunc( it ) ) {
-				return true;
-			}
+		ReaderT<S, C> reader( it, Size( endIt - it ) );
+		const bool bResult( _appendXML( &reader, false ) );
+		it += reader.getPosition();
+		return bResult;
+	}
 
-			if ( ( *it ) == C( '<' ) ) {
-				const C * tmpIt( it );
-				tmpIt++;
-				while ( functorSpace( *tmpIt ) ) tmpIt++;
-				if ( ( *tmpIt ) == C( '/' ) ) {
-					it = tmpIt;
-					break;
-				} else {
-					NodeT<S> * newNode( new NodeT<S>() );
-					this -> addChild( newNode );
+	template<typename S>
+	template<typename C>
+	bool NodeT<S>::_appendXML( ReaderT<S, C> * reader, bool bElement ) {
+		NodeT<S> * currentNode( this );
+		Size depth( bElement ? Size( 1 ) : Size( 0 ) );
 
-					if ( !newNode -> _readXML( &it, endFunc ) )
+		while ( true ) {
+			switch ( reader -> next() ) {
+				case ReaderT<S, C>::Event::StartElement:
+				{
+					NodeT<S> * newNode( _newNode<NodeT<S>>( this -> arena, reader -> getName() ) );
+					currentNode -> addChild( newNode );
+					currentNode = newNode;
+					depth++;
+					break;
+				}
+				case ReaderT<S, C>::Event::Attribute:
+				{
+					currentNode -> addParam( _newParam( this -> arena, reader -> getName(), reader -> getValue() ) );
+					break;
+				}
+				case ReaderT<S, C>::Event::Text:
+				{
+					NodeTextT<S> * nodeText( _newNode<NodeTextT<S>>( this -> arena, reader -> getValue() ) );
+					currentNode -> addChild( nodeText );
+					break;
+				}
+				case ReaderT<S, C>::Event::EndElement:
+				{
+					depth--;
+					if ( bElement && depth == Size( 0 ) ) {
+						return true;
+					}
+					currentNode = currentNode -> getParent();
+					break;
+				}
+				case ReaderT<S, C>::Event::EndDocument:
+				{
+					if ( bElement ) {
+						ERROR_SPP( String::format( TEXT( "[XML ERROR] : Node \"%\" is not closed." ), this -> getName() ) );
 						return false;
+					}
+					return true;
 				}
-			} else {
-				ERROR_SPP( TEXT( "[XML ERROR] : Expected '<'." ) );
-				return false;
+				default:
+					return false;
 			}
 		}
 	}
@@ -602,85 +609,6 @@ namespace XML {
 	}
 
 
-	template<typename S>
-	template<typename C, typename EndFunc>
-	bool NodeT<S>::_parseParameter( const C ** buffer, const EndFunc & endFunc ) {
-		const C *& it( *buffer );
-
-		struct FunctorValue {
-			bool operator()( const C & c ) { return c != C( '"' ); }
-		};
-		struct FunctorSpace {
-			bool operator()( const C & c ) { return c == C( '\n' ) || c == C( '\t' ) || c == C( ' ' ); }
-		};
-		struct FunctorName {
-			bool operator()( const C & c ) { return c != C( '=' ) && c != C( '\t' ) && c != C( ' ' ) && c != C( '>' ) && c != C( '/' ); }
-		};
-		static FunctorName functorName;
-		static FunctorSpace functorSpace;
-		static FunctorValue functorValue;
-
-		// Now lets skip all the blanks
-		while ( functorSpace( *it ) ) it++;
-
-		// ? is a special char
-		if ( ( *it ) == C( '?' ) || ( *it ) == C( '/' ) || endFunc( it ) ) return false;
-		auto iteratorBegin( it );
-		while ( true ) {
-			if ( endFunc( it ) ) {
-				ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-				return false;
-			}
-			if ( !functorName( *it ) )
-				break;
-			it++;
-		}
-
-		if ( iteratorBegin != it ) {
-			ParamT<S> * newParam( new ParamT<S>() );
-
-			newParam -> setName( S( iteratorBegin, Size( it - iteratorBegin ) ) );
-
-			if ( ( *it ) == C( '=' ) ) {
-				( it )++; // Just to skip the equal sign
-
-				if ( ( *it ) == C( '"' ) ) {
-					( it )++; // Skip the quotes too
-
-					iteratorBegin = it;
-					while ( true ) {
-						if ( endFunc( it ) ) {
-							ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-							return false;
-						}
-						if ( !functorValue( *it ) )
-							break;
-						it++;
-					}
-					newParam -> setValue( S( iteratorBegin, Size( it - iteratorBegin ) ) );
-
-					if ( ( *it ) == C( '"' ) ) ( it )++; // Skip the quotes again
-				} else {
-					iteratorBegin = it;
-					while ( true ) {
-						if ( endFunc( it ) ) {
-							ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-							return false;
-						}
-						if ( !functorName( *it ) )
-							break;
-						it++;
-					}
-					newParam -> setValue( S( iteratorBegin, Size( it - iteratorBegin ) ) );
-				}
-
-			}
-			this -> addParam( newParam );
-			return true;
-		}
-		return false;
-	}
-
 	template<typename S>
 	template<typename S2>
 	S2 NodeT<S>::toString( unsigned int indent ) const {
@@ -728,9 +656,9 @@ namespace XML {
 		}
 		nbParams = Math::min( nbParams, Size( 1000 ) );
 		for ( Size i( 0 ); i < nbParams; i++ ) {
-			ParamT<S> * newParam( new ParamT<S>() );
+			ParamT<S> * newParam( _newParam( this -> arena ) );
 			if ( !IO::read( stream, newParam, verbose -1 ) ) {
-				delete newParam;
+				_deleteParam( newParam );
 				_clear();
 				return false;
 			}
@@ -751,20 +679,20 @@ namespace XML {
 				return false;
 			}
 			if ( newNodeType == Type::Text ) {
-				NodeTextT<S> * newNode( new NodeTextT<S>() );
+				NodeTextT<S> * newNode( _newNode<NodeTextT<S>>( this -> arena ) );
 				newNode -> parent = this;
 				if ( !IO::read( stream, newNode, verbose -1 ) ) {
-					delete newNode;
+					_deleteNode( newNode );
 					_clear();
 					return false;
 				}
 				this -> childrenVector.push( newNode );
 				this -> childrenMap.insert( newNode -> getName(), newNode );
 			} else {
-				NodeT<S> * newNode( new NodeT() );
+				NodeT<S> * newNode( _newNode<NodeT<S>>( this -> arena ) );
 				newNode -> parent = this;
 				if ( !IO::read( stream, newNode, verbose -1 ) ) {
-					delete newNode;
+					_deleteNode( newNode );
 					_clear();
 					return false;
 				}
@@ -1042,6 +970,12 @@ bool NodeTextT<S>::write( Stream * stream ) const {
 
 	}
 
+	template<typename S>
+	NodeTextT<S>::NodeTextT( S && value ) : NodeT<S>( S( "#text" ), NodeT<S>::Type::Text ),
+		value( Utility::toRValue( value ) ) {
+
+	}
+
 	template<typename S>
 	NodeTextT<S>::NodeTextT( const NodeTextT<S> & node ) : NodeT( node ),
 		value( node.value ) {
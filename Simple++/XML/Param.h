@@ -3,9 +3,13 @@
 #include "../IO/IO.h"
 #include "../Math/Math.h"
 #include "../Param.h"
+#include "../MemoryArena.h"
 
 namespace XML {
 
+	template<typename S>
+	class NodeT;
+
 	template<typename S>
 	class ParamT : public ::ParamT<S, S> {
 	public:
@@ -69,7 +73,12 @@ namespace XML {
 		template<typename C = S, typename Elem = C::ElemType>
 		void _writeXML( C & o ) const;
 	private:
+		friend class NodeT<S>;
+
 		void _clear();
+
+		///@brief Arena owning the memory of this param, NULL if allocated on the heap.
+		MemoryArena * arena;
 	};
 
 }
@@ -2,26 +2,30 @@ namespace XML {
 
 	template<typename S>
 	ParamT<S>::ParamT( const S & name, const S & value ) : 
-		::ParamT<S, S>(name, value)
+		::ParamT<S, S>(name, value),
+		arena( NULL )
 	{
 
 	}
 
 	template<typename S>
-	ParamT<S>::ParamT() {
+	ParamT<S>::ParamT() :
+		arena( NULL ) {
 
 	}
 
 	template<typename S>
 	ParamT<S>::ParamT( const ParamT<S> & param ) :
-		::ParamT<S, S>(param)
+		::ParamT<S, S>(param),
+		arena( NULL )
 	{
 
 	}
 
 	template<typename S>
 	ParamT<S>::ParamT( ParamT<S> && param ) :
-		::ParamT<S, S>(Utility::toRValue(param))
+		::ParamT<S, S>(Utility::toRValue(param)),
+		arena( NULL )
 	{
 
 	}
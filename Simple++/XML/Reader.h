@@ -0,0 +1,179 @@
+///@file XML/Reader.h
+///@brief Declares a streaming (pull) XML reader, emitting one event at a time from a fixed size buffer.
+#pragma once
+
+#include "../UTF8String.h"
+#include "../Vector.h"
+#include "../OS/Path.h"
+#include "../IO/FileStream.h"
+#include "../StringPool.h"
+
+namespace XML {
+
+	///@brief Pull reader of XML, the only tokenizer of the module (NodeT and DocumentT build their tree on top of it).
+	///			Each call to next() reads one event : the beginning of an element, one of it's attributes, a text or the end of an element.
+	///			When reading a stream, the characters are loaded inside a fixed size buffer which is refilled when exhausted,
+	///			the memory used is then the one of this buffer (only grown if a single token is bigger than it) plus the names of the opened elements, whatever the size of the file.
+	///			The names and values returned are pointing inside the buffer and are only valid until the next call to next().
+	///@template S String type of the names and values built by getName() and getValue().
+	///@template C Element type of the buffer.
+	template<typename S, typename C = typename S::ElemType>
+	class ReaderT {
+	public:
+		///@brief Events read by next().
+		enum class Event : unsigned char {
+			StartElement,	///< Beginning of an element, getName() is it's name, it's attributes will follow.
+			Attribute,		///< Attribute of the last started element, getName() and getValue() are set.
+			Text,			///< Text content of the current element, trimmed, getValue() is set.
+			EndElement,		///< End of an element (self closing included), getName() is it's name.
+			EndDocument,	///< End of the buffer, or closing tag of an element opened before the reader (not consumed).
+			Error			///< Syntax error, already logged.
+		};
+
+		///@brief Create a reader over a buffer, read in place without any copy.
+		///@param buffer Buffer to be read.
+		///@param size Number of elements of the buffer.
+		ReaderT( const C * buffer, Size size );
+
+		///@brief Create a reader over an opened stream, read by chunks of bufferSize elements.
+		///@param stream Stream to be read from it's current position, has to outlive the reader.
+		///@param bufferSize Size of the buffer.
+		ReaderT( IO::FileStream * stream, Size bufferSize = Size( 65536 ) );
+
+		///@brief Create a reader opening a file, read by chunks of bufferSize elements.
+		///@param filePath Path of the file to be read.
+		///@param bufferSize Size of the buffer.
+		ReaderT( const OS::Path & filePath, Size bufferSize = Size( 65536 ) );
+
+		///@brief Destructor.
+		~ReaderT();
+
+		///@brief Check if the source has been opened.
+		///@return True if opened, False otherwise.
+		bool isOpen() const;
+
+		///@brief Read the next event.
+		///@return Event read.
+		Event next();
+
+		///@brief Get the last event read.
+		///@return Last event read.
+		Event getEvent() const;
+
+		///@brief Get the name of the last element or attribute read, without copy.
+		///@return Pointer to the name, valid until the next call to next().
+		const C * getNameBuffer() const;
+
+		///@brief Get the size of the name of the last element or attribute read.
+		///@return Size of the name.
+		Size getNameSize() const;
+
+		///@brief Get the value of the last attribute or text read, without copy.
+		///@return Pointer to the value, valid until the next call to next().
+		const C * getValueBuffer() const;
+
+		///@brief Get the size of the value of the last attribute or text read.
+		///@return Size of the value.
+		Size getValueSize() const;
+
+		///@brief Get a copy of the name of the last element or attribute read.
+		///@return Name.
+		S getName() const;
+
+		///@brief Get the name of the last element or attribute read interned inside a pool, without any allocation once the name is known by it.
+		///			The tag names repeated all along a document can then be compared in O(1).
+		///@param pool (Optional) Pool where the name is interned.
+		///@return Interned name, valid until the pool is destroyed.
+		InternedStringT<S> getInternedName( StringPoolT<S> & pool = StringPoolT<S>::getDefault() ) const;
+
+		///@brief Get a copy of the value of the last attribute or text read.
+		///@return Value.
+		S getValue() const;
+
+		///@brief Get the number of opened elements.
+		///@return Depth.
+		Size getDepth() const;
+
+		///@brief Get the number of elements consumed from the beginning of the source.
+		///@return Position.
+		Size getPosition() const;
+
+		///@brief Get the version read from the XML declaration (0 if none).
+		///@return Version.
+		float getVersion() const;
+
+		///@brief Get the encoding read from the XML declaration (empty if none).
+		///@return Encoding.
+		const S & getEncoding() const;
+
+	private:
+		ReaderT( const ReaderT<S, C> & reader );
+		ReaderT<S, C> & operator=( const ReaderT<S, C> & reader );
+
+		enum class State : unsigned char {
+			Content,
+			Attributes,
+			End
+		};
+
+		///@brief Read the next event from the content of an element.
+		Event _readContent();
+
+		///@brief Read the next attribute or the end of an opening tag.
+		Event _readAttribute();
+
+		///@brief Read the XML declaration, the "<?" being consumed.
+		bool _readDeclaration();
+
+		///@brief Read a parameter (name and optional value) into nameI/nameSize and valueI/valueSize.
+		void _readParameter();
+
+		///@brief Check if the source is exhausted, refilling the buffer if needed.
+		bool _isEnd();
+
+		///@brief Load more elements from the stream, keeping the current token (from tokenI).
+		///@return True if something has been loaded, False otherwise.
+		bool _fill();
+
+		///@brief Skip the elements while functor return true.
+		template<typename Functor>
+		void _skip( const Functor & functor );
+
+		void _skipSpaces();
+
+		bool _expectChar( const C & c );
+
+		Event _error();
+
+		const C * buffer;
+		Size bufferSize;
+		Size bufferMaxSize;
+		///@brief Number of elements dropped from the beginning of the buffer.
+		Size bufferOffset;
+		C * ownedBuffer;
+
+		IO::FileStream * stream;
+		bool bOwnStream;
+
+		Size position;
+		///@brief Beginning of the current token, kept inside the buffer when refilling.
+		Size tokenI;
+		Size nameI;
+		Size nameSize;
+		Size valueI;
+		Size valueSize;
+
+		State state;
+		Event event;
+		bool bPopPending;
+		Vector<S> elementNames;
+
+		float version;
+		S encoding;
+	};
+
+	using Reader = ReaderT<UTF8String>;
+
+}
+
+#include "Reader.hpp"
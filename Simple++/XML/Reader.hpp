@@ -0,0 +1,458 @@
+namespace XML {
+
+	template<typename S, typename C>
+	ReaderT<S, C>::ReaderT( const C * buffer, Size size ) :
+		buffer( buffer ),
+		bufferSize( size ),
+		bufferMaxSize( size ),
+		bufferOffset( 0 ),
+		ownedBuffer( NULL ),
+		stream( NULL ),
+		bOwnStream( false ),
+		position( 0 ),
+		tokenI( 0 ),
+		nameI( 0 ),
+		nameSize( 0 ),
+		valueI( 0 ),
+		valueSize( 0 ),
+		state( State::Content ),
+		event( Event::EndDocument ),
+		bPopPending( false ),
+		version( 0.0f ) {
+
+	}
+
+	template<typename S, typename C>
+	ReaderT<S, C>::ReaderT( IO::FileStream * stream, Size bufferSize ) :
+		bufferSize( 0 ),
+		bufferMaxSize( bufferSize ),
+		bufferOffset( 0 ),
+		ownedBuffer( new C[ bufferSize ] ),
+		stream( stream ),
+		bOwnStream( false ),
+		position( 0 ),
+		tokenI( 0 ),
+		nameI( 0 ),
+		nameSize( 0 ),
+		valueI( 0 ),
+		valueSize( 0 ),
+		state( State::Content ),
+		event( Event::EndDocument ),
+		bPopPending( false ),
+		version( 0.0f ) {
+		this -> buffer = this -> ownedBuffer;
+	}
+
+	template<typename S, typename C>
+	ReaderT<S, C>::ReaderT( const OS::Path & filePath, Size bufferSize ) :
+		bufferSize( 0 ),
+		bufferMaxSize( bufferSize ),
+		bufferOffset( 0 ),
+		ownedBuffer( new C[ bufferSize ] ),
+		stream( new IO::FileStream( filePath, IO::OpenMode::Read ) ),
+		bOwnStream( true ),
+		position( 0 ),
+		tokenI( 0 ),
+		nameI( 0 ),
+		nameSize( 0 ),
+		valueI( 0 ),
+		valueSize( 0 ),
+		state( State::Content ),
+		event( Event::EndDocument ),
+		bPopPending( false ),
+		version( 0.0f ) {
+		this -> buffer = this -> ownedBuffer;
+	}
+
+	template<typename S, typename C>
+	ReaderT<S, C>::~ReaderT() {
+		delete[] this -> ownedBuffer;
+		if ( this -> bOwnStream ) {
+			delete this -> stream;
+		}
+	}
+
+	template<typename S, typename C>
+	bool ReaderT<S, C>::isOpen() const {
+		return !this -> stream || this -> stream -> isOpen();
+	}
+
+	template<typename S, typename C>
+	typename ReaderT<S, C>::Event ReaderT<S, C>::next() {
+		if ( this -> bPopPending ) {
+			this -> elementNames.pop();
+			this -> bPopPending = false;
+		}
+		this -> tokenI = this -> position;
+
+		switch ( this -> state ) {
+			case State::Attributes:
+				this -> event = _readAttribute();
+				break;
+			case State::Content:
+				this -> event = _readContent();
+				break;
+			default:
+				this -> event = Event::EndDocument;
+				break;
+		}
+		return this -> event;
+	}
+
+	template<typename S, typename C>
+	typename ReaderT<S, C>::Event ReaderT<S, C>::getEvent() const {
+		return this -> event;
+	}
+
+	template<typename S, typename C>
+	typename ReaderT<S, C>::Event ReaderT<S, C>::_readContent() {
+		struct FunctorContent {
+			bool operator()( const C & c ) const { return c != C( '<' ); }
+		};
+		struct FunctorNodeName {
+			bool operator()( const C & c ) const { return c != C( ' ' ) && c != C( '\t' ) && c != C( '\n' ) && c != C( '>' ) && c != C( '/' ); }
+		};
+		static FunctorContent functorContent;
+		static FunctorNodeName functorNodeName;
+
+		while ( true ) {
+			_skipSpaces();
+			this -> tokenI = this -> position;
+
+			if ( _isEnd() ) {
+				if ( this -> elementNames.getSize() ) {
+					ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
+					return _error();
+				}
+				this -> state = State::End;
+				return Event::EndDocument;
+			}
+
+			if ( this -> buffer[ this -> position ] != C( '<' ) ) {
+				// Text, trimmed from it's trailing blanks (the leading ones are already skipped).
+				this -> valueI = this -> position;
+				_skip( functorContent );
+				Size endI( this -> position );
+				while ( endI > this -> valueI && ( this -> buffer[ endI - 1 ] == C( ' ' ) || this -> buffer[ endI - 1 ] == C( '\t' ) || this -> buffer[ endI - 1 ] == C( '\n' ) || this -> buffer[ endI - 1 ] == C( '\r' ) ) ) endI--;
+				this -> valueSize = endI - this -> valueI;
+				return Event::Text;
+			}
+
+			this -> position++;
+			_skipSpaces();
+			if ( _isEnd() ) {
+				ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
+				return _error();
+			}
+
+			const C c( this -> buffer[ this -> position ] );
+			if ( c == C( '/' ) ) {
+				// Closing tag.
+				if ( !this -> elementNames.getSize() ) {
+					// Closing an element opened before this reader, leave it to the caller.
+					this -> position = this -> tokenI;
+					this -> state = State::End;
+					return Event::EndDocument;
+				}
+				this -> position++;
+				this -> nameI = this -> position;
+				_skip( functorNodeName );
+				this -> nameSize = this -> position - this -> nameI;
+
+				const S & openedName( this -> elementNames[ this -> elementNames.getSize() - Size( 1 ) ] );
+				bool bMatch( openedName.getSize() == this -> nameSize );
+				for ( Size i( 0 ); bMatch && i < this -> nameSize; i++ ) {
+					bMatch = openedName[ i ] == this -> buffer[ this -> nameI + i ];
+				}
+				if ( !bMatch ) {
+					ERROR_SPP( String::format( TEXT( "[XML ERROR] : Closing node do not match. \"%\" != \"%\"." ), openedName, S( this -> buffer + this -> nameI, this -> nameSize ) ) );
+					return _error();
+				}
+
+				_skipSpaces();
+				if ( !_expectChar( C( '>' ) ) ) {
+					return _error();
+				}
+				this -> bPopPending = true;
+				return Event::EndElement;
+			} else if ( c == C( '?' ) ) {
+				this -> position++;
+				if ( !_readDeclaration() ) {
+					return _error();
+				}
+			} else {
+				// Opening tag, the attributes will follow.
+				this -> nameI = this -> position;
+				_skip( functorNodeName );
+				if ( _isEnd() ) {
+					ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
+					return _error();
+				}
+				this -> nameSize = this -> position - this -> nameI;
+				this -> elementNames.push( S( this -> buffer + this -> nameI, this -> nameSize ) );
+				this -> state = State::Attributes;
+				return Event::StartElement;
+			}
+		}
+	}
+
+	template<typename S, typename C>
+	typename ReaderT<S, C>::Event ReaderT<S, C>::_readAttribute() {
+		_skipSpaces();
+		this -> tokenI = this -> position;
+
+		if ( _isEnd() ) {
+			ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
+			return _error();
+		}
+
+		const C c( this -> buffer[ this -> position ] );
+		if ( c == C( '/' ) ) {
+			// Self closing element.
+			this -> position++;
+			_skipSpaces();
+			if ( !_expectChar( C( '>' ) ) ) {
+				return _error();
+			}
+			this -> state = State::Content;
+			this -> bPopPending = true;
+			return Event::EndElement;
+		} else if ( c == C( '>' ) ) {
+			// End of the opening tag, continue with it's content.
+			this -> position++;
+			this -> state = State::Content;
+			return _readContent();
+		} else if ( c == C( '?' ) ) {
+			ERROR_SPP( TEXT( "[XML ERROR] : Expecting '>'." ) );
+			return _error();
+		}
+
+		_readParameter();
+		if ( _isEnd() ) {
+			ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
+			return _error();
+		}
+		return Event::Attribute;
+	}
+
+	template<typename S, typename C>
+	bool ReaderT<S, C>::_readDeclaration() {
+		static const C xmlFlag[] = { C( 'x' ), C( 'm' ), C( 'l' ) };
+		static const C encodingStr[] = { C( 'e' ), C( 'n' ), C( 'c' ), C( 'o' ), C( 'd' ), C( 'i' ), C( 'n' ), C( 'g' ) };
+		static const C versionStr[] = { C( 'v' ), C( 'e' ), C( 'r' ), C( 's' ), C( 'i' ), C( 'o' ), C( 'n' ) };
+
+		struct Functor {
+			static bool cmpStr( const C * b1, Size b1Size, const C * b2, Size b2Size ) {
+				if ( b1Size != b2Size ) return false;
+				for ( Size i( 0 ); i < b1Size; i++ ) {
+					if ( b1[ i ] != b2[ i ] ) return false;
+				}
+				return true;
+			}
+		};
+
+		for ( Size i( 0 ); i < Size( 3 ); i++ ) {
+			if ( _isEnd() || this -> buffer[ this -> position ] != xmlFlag[ i ] ) {
+				ERROR_SPP( TEXT( "[XML ERROR] : expecting \"<xml...\"." ) );
+				return false;
+			}
+			this -> position++;
+		}
+
+		while ( true ) {
+			_skipSpaces();
+			if ( _isEnd() ) {
+				ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
+				return false;
+			}
+			if ( this -> buffer[ this -> position ] == C( '?' ) ) {
+				break;
+			}
+			_readParameter();
+			if ( !this -> nameSize ) {
+				break;
+			}
+
+			if ( Functor::cmpStr( this -> buffer + this -> nameI, this -> nameSize, encodingStr, Size( 8 ) ) ) {
+				this -> encoding = getValue();
+			} else if ( Functor::cmpStr( this -> buffer + this -> nameI, this -> nameSize, versionStr, Size( 7 ) ) ) {
+				this -> version = getValue().toFloat();
+			}
+		}
+
+		return _expectChar( C( '?' ) ) && _expectChar( C( '>' ) );
+	}
+
+	template<typename S, typename C>
+	void ReaderT<S, C>::_readParameter() {
+		struct FunctorValue {
+			bool operator()( const C & c ) const { return c != C( '"' ); }
+		};
+		struct FunctorName {
+			bool operator()( const C & c ) const { return c != C( '=' ) && c != C( '\t' ) && c != C( '\n' ) && c != C( ' ' ) && c != C( '>' ) && c != C( '/' ); }
+		};
+		static FunctorName functorName;
+		static FunctorValue functorValue;
+
+		this -> nameI = this -> position;
+		_skip( functorName );
+		this -> nameSize = this -> position - this -> nameI;
+
+		this -> valueI = this -> position;
+		this -> valueSize = 0;
+
+		if ( _isEnd() || this -> buffer[ this -> position ] != C( '=' ) ) {
+			return;
+		}
+		this -> position++; // Just to skip the equal sign
+
+		if ( !_isEnd() && this -> buffer[ this -> position ] == C( '"' ) ) {
+			this -> position++; // Skip the quotes too
+			this -> valueI = this -> position;
+			_skip( functorValue );
+			this -> valueSize = this -> position - this -> valueI;
+			if ( !_isEnd() ) this -> position++; // Skip the quotes again
+		} else {
+			this -> valueI = this -> position;
+			_skip( functorName );
+			this -> valueSize = this -> position - this -> valueI;
+		}
+	}
+
+	template<typename S, typename C>
+	bool ReaderT<S, C>::_isEnd() {
+		return this -> position >= this -> bufferSize && !_fill();
+	}
+
+	template<typename S, typename C>
+	bool ReaderT<S, C>::_fill() {
+		if ( !this -> stream || !this -> stream -> isOpen() ) {
+			return false;
+		}
+
+		if ( this -> tokenI ) {
+			// Drop what is before the current token.
+			const Size shift( this -> tokenI );
+			// The areas may overlap, copy forward.
+			for ( Size i( shift ); i < this -> bufferSize; i++ ) {
+				this -> ownedBuffer[ i - shift ] = this -> ownedBuffer[ i ];
+			}
+			this -> bufferSize -= shift;
+			this -> bufferOffset += shift;
+			this -> position -= shift;
+			this -> nameI = ( this -> nameI > shift ) ? this -> nameI - shift : Size( 0 );
+			this -> valueI = ( this -> valueI > shift ) ? this -> valueI - shift : Size( 0 );
+			this -> tokenI = 0;
+		} else if ( this -> bufferSize == this -> bufferMaxSize ) {
+			// A single token is bigger than the buffer.
+			const Size newMaxSize( this -> bufferMaxSize * Size( 2 ) );
+			C * newBuffer( new C[ newMaxSize ] );
+			Utility::copy( newBuffer, this -> ownedBuffer, this -> bufferSize );
+			delete[] this -> ownedBuffer;
+			this -> ownedBuffer = newBuffer;
+			this -> buffer = newBuffer;
+			this -> bufferMaxSize = newMaxSize;
+		}
+
+		const Size nbRead( this -> stream -> readSome( reinterpret_cast< char * >( this -> ownedBuffer + this -> bufferSize ), ( this -> bufferMaxSize - this -> bufferSize ) * sizeof( C ) ) / sizeof( C ) );
+		this -> bufferSize += nbRead;
+
+		return nbRead > Size( 0 );
+	}
+
+	template<typename S, typename C>
+	template<typename Functor>
+	void ReaderT<S, C>::_skip( const Functor & functor ) {
+		while ( !_isEnd() && functor( this -> buffer[ this -> position ] ) ) this -> position++;
+	}
+
+	template<typename S, typename C>
+	void ReaderT<S, C>::_skipSpaces() {
+		struct FunctorSpace {
+			bool operator()( const C & c ) const { return c == C( '\n' ) || c == C( '\t' ) || c == C( ' ' ) || c == C( '\r' ); }
+		};
+		static FunctorSpace functorSpace;
+
+		_skip( functorSpace );
+	}
+
+	template<typename S, typename C>
+	bool ReaderT<S, C>::_expectChar( const C & c ) {
+		if ( !_isEnd() && this -> buffer[ this -> position ] == c ) {
+			this -> position++;
+			return true;
+		} else {
+			ERROR_SPP( String::format( TEXT( "[XML ERROR] : Expected '%'." ), c ) );
+			return false;
+		}
+	}
+
+	template<typename S, typename C>
+	typename ReaderT<S, C>::Event ReaderT<S, C>::_error() {
+		this -> state = State::End;
+		return Event::Error;
+	}
+
+	template<typename S, typename C>
+	const C * ReaderT<S, C>::getNameBuffer() const {
+		if ( this -> event == Event::EndElement ) {
+			// The closing tag may have been dropped from the buffer, use the opened one.
+			return this -> elementNames[ this -> elementNames.getSize() - Size( 1 ) ].toCString();
+		}
+		return this -> buffer + this -> nameI;
+	}
+
+	template<typename S, typename C>
+	Size ReaderT<S, C>::getNameSize() const {
+		if ( this -> event == Event::EndElement ) {
+			return this -> elementNames[ this -> elementNames.getSize() - Size( 1 ) ].getSize();
+		}
+		return this -> nameSize;
+	}
+
+	template<typename S, typename C>
+	const C * ReaderT<S, C>::getValueBuffer() const {
+		return this -> buffer + this -> valueI;
+	}
+
+	template<typename S, typename C>
+	Size ReaderT<S, C>::getValueSize() const {
+		return this -> valueSize;
+	}
+
+	template<typename S, typename C>
+	S ReaderT<S, C>::getName() const {
+		return S( getNameBuffer(), getNameSize() );
+	}
+
+	template<typename S, typename C>
+	InternedStringT<S> ReaderT<S, C>::getInternedName( StringPoolT<S> & pool ) const {
+		return pool.intern( getNameBuffer(), getNameSize() );
+	}
+
+	template<typename S, typename C>
+	S ReaderT<S, C>::getValue() const {
+		return S( getValueBuffer(), getValueSize() );
+	}
+
+	template<typename S, typename C>
+	Size ReaderT<S, C>::getDepth() const {
+		return this -> bPopPending ? this -> elementNames.getSize() - Size( 1 ) : this -> elementNames.getSize();
+	}
+
+	template<typename S, typename C>
+	Size ReaderT<S, C>::getPosition() const {
+		return this -> bufferOffset + this -> position;
+	}
+
+	template<typename S, typename C>
+	float ReaderT<S, C>::getVersion() const {
+		return this -> version;
+	}
+
+	template<typename S, typename C>
+	const S & ReaderT<S, C>::getEncoding() const {
+		return this -> encoding;
+	}
+
+}
@@ -32,7 +32,7 @@ namespace XML {
 		///@param document DocumentT<S> to be copied
 		DocumentT( const DocumentT<S> & document );
 
-		///@brief Move Constructor
+		///@brief Move Constructor, the arena is moved with the tree, every node being updated to use the one of this document.
 		///@param document DocumentT<S> to be moved
 		DocumentT( DocumentT<S> && document );
 
@@ -41,7 +41,7 @@ namespace XML {
 		///@return Reference to THIS
 		DocumentT<S> & operator=( const DocumentT<S> & document );
 
-		///@brief Move operator
+		///@brief Move operator, the arena is moved with the tree, every node being updated to use the one of this document.
 		///@param document DocumentT<S> to be moved
 		///@return Reference to THIS
 		DocumentT<S> & operator=( DocumentT<S> && document );
@@ -61,6 +61,10 @@ namespace XML {
 		///@return Pointer to the root document node (will never be NULL)
 		NodeT<S> * getRoot();
 
+		///@brief Get the arena where the parsed nodes of this document are placed
+		///@return Arena of this document
+		const MemoryArena & getArena() const;
+
 		///@brief Get the version of this document
 		///@return Version
 		float getVersion() const;
@@ -88,8 +92,8 @@ namespace XML {
 		template<typename Stream>
 		bool writeXML( Stream * stream ) const;
 
-		///@brief Read this object as an XML file
-		///@param filePath Where to write
+		///@brief Read this object as an XML file, streamed through a ReaderT.
+		///@param filePath Where to read
 		///@return True if success, False otherwise
 		bool readFileXML( const OS::Path & filePath );
 
@@ -134,20 +138,23 @@ namespace XML {
 		void _writeXML( C & o ) const;
 
 	private:
-		
-		template<typename C, typename EndFunc = BasicString<C>::IsEndSentinel>
-		bool _parseParameterSpecial( const C ** buffer, S * name, S * value, const EndFunc & endFunc = BasicString<C>::IS_END_SENTINEL );
+		///@brief Read the whole tree from a reader.
+		///@param reader Reader to read from.
+		///@return bool True if success, False otherwise.
+		template<typename C>
+		bool _readXML( ReaderT<S, C> * reader );
 
 		void _clear();
 		void _unload();
 		bool _readFileXML( const OS::Path & filePath );
 
-		template<typename C>
-		static bool cmpStr( const C * b1, const C * b2, int size );
-
 		float version;
 		StringASCII encoding;
 
+		///@brief Arena where the parsed nodes and their parameters are placed, their blocks released at once with the document.
+		///			The names, values and children containers still allocate on the heap (unless short enough to stay inside the strings), the tree is then still walked to destroy them.
+		MemoryArena arena;
+
 		NodeT<S> * rootNode;
 	};
 
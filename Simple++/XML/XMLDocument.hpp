@@ -16,12 +16,18 @@ namespace XML {
 	DocumentT<S>::DocumentT( DocumentT<S> && document ) :
 		version( Utility::toRValue( document.version ) ),
 		encoding( Utility::toRValue( document.encoding ) ),
+		arena( Utility::toRValue( document.arena ) ),
 		rootNode( Utility::toRValue( document.rootNode ) ) {
 		document.rootNode = NULL;
+		// The nodes still point to the arena of document.
+		if ( this -> rootNode ) {
+			this -> rootNode -> _moveArena( &document.arena, &this -> arena );
+		}
 	}
 
 	template<typename S>
-	DocumentT<S>::DocumentT( const OS::Path & filePath ) {
+	DocumentT<S>::DocumentT( const OS::Path & filePath ) :
+		rootNode( NULL ) {
 		_readFileXML( filePath );
 	}
 
@@ -50,8 +56,13 @@ namespace XML {
 
 		this -> version = Utility::toRValue( document.version );
 		this -> encoding = Utility::toRValue( document.encoding );
+		this -> arena = Utility::toRValue( document.arena );
 		this -> rootNode = Utility::toRValue( document.rootNode );
 		document.rootNode = NULL;
+		// The nodes still point to the arena of document.
+		if ( this -> rootNode ) {
+			this -> rootNode -> _moveArena( &document.arena, &this -> arena );
+		}
 
 		return *this;
 	}
@@ -67,86 +78,6 @@ namespace XML {
 		return readXML<S::ElemType>( &buffer );
 	}
 
-	template<typename S>
-	template<typename C, typename EndFunc>
-	bool DocumentT<S>::_parseParameterSpecial( const C ** buffer, S * nameP, S * valueP, const EndFunc & endFunc ) {
-		const C *& it( *buffer );
-
-		struct FunctorValue {
-			bool operator()( const C & c ) { return c != C( '"' ); }
-		};
-		struct FunctorSpace {
-			bool operator()( const C & c ) { return c == C( '\n' ) || c == C( '\t' ) || c == C( ' ' ); }
-		};
-		struct FunctorName {
-			bool operator()( const C & c ) { return c != C( '=' ) && c != C( '\t' ) && c != C( ' ' ) && c != C( '>' ) && c != C( '/' ); }
-		};
-		static FunctorName functorName;
-		static FunctorSpace functorSpace;
-		static FunctorValue functorValue;
-
-		// Now lets skip all the blanks
-		while ( functorSpace(*it) ) it++;
-
-		// ? is a special char
-		if ( ( *it ) == C( '?' ) || ( *it ) == C( '/' ) || endFunc(it) ) return false;
-		auto iteratorBegin( it );
-		while ( true ) {
-			if ( endFunc( it ) ) {
-				ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-				return false;
-			}
-			if ( !functorName( *it ) )
-				break;
-			it++;
-		}
-
-		if ( iteratorBegin != it ) {
-			S & name( *nameP );
-			S & value( *valueP );
-
-			name = S( iteratorBegin, Size( it - iteratorBegin ) );
-
-			if ( (*it) == C( '=' ) ) {
-				( it )++; // Just to skip the equal sign
-
-				if ( ( *it ) == C( '"' ) ) {
-					( it )++; // Skip the quotes too
-
-					iteratorBegin = it;
-					while ( true ) {
-						if ( endFunc( it ) ) {
-							ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-							return false;
-						}
-						if ( !functorValue( *it ) )
-							break;
-						it++;
-					}
-					value = S( iteratorBegin, Size( it - iteratorBegin ) );
-
-					if ( ( *it ) == C( '"' ) ) ( it )++; // Skip the quotes again
-				} else {
-					iteratorBegin = it;
-					while ( true ) {
-						if ( endFunc( it ) ) {
-							ERROR_SPP( TEXT( "[XML ERROR] : Unexpected buffer end." ) );
-							return false;
-						}
-						if ( !functorName( *it ) )
-							break;
-						it++;
-					}
-					value = S( iteratorBegin, Size( it - iteratorBegin ) );
-				}
-
-			}
-			return true;
-		}
-		return false;
-	}
-
-
 	template<typename S>
 	Vector< NodeT<S> * > DocumentT<S>::getElementsById( const S & id ) const {
 		return this -> rootNode -> getElementsById( id );
@@ -162,6 +93,11 @@ namespace XML {
 		return this -> rootNode;
 	}
 
+	template<typename S>
+	const MemoryArena & DocumentT<S>::getArena() const {
+		return this -> arena;
+	}
+
 	template<typename S>
 	float DocumentT<S>::getVersion() const {
 		return this -> version;
@@ -201,66 +137,38 @@ namespace XML {
 
 	template<typename S>
 	bool DocumentT<S>::readFileXML( const OS::Path & filePath ) {
-		_clear();
-
-		return _readXML( filePath );
+		return _readFileXML( filePath );
 	}
 
 	template<typename S>
 	template<typename C, typename EndFunc>
 	bool DocumentT<S>::readXML( const C ** buffer, const EndFunc & endFunc ) {
-		struct FunctorSpace {
-			bool operator()( const C & c ) { return c != C( '<' ) && c != C( '\n' ) && c != C( '\t' ) && c != C( ' ' ); }
-		};
-
-		static FunctorSpace functorSpace;
-
-		if ( this -> rootNode != NULL ) {
-			_clear();
-		}
-
 		const C *& it( *buffer );
 
-		S rootName( "#document" );
-		this -> rootNode = new NodeT<S>( rootName, NodeT<S>::Type::Document );
+		const C * endIt( it );
+		while ( !endFunc( endIt ) ) endIt++;
 
-		while ( functorSpace( *it ) ) it++;
-
-		if ( !NodeT<S>::_expectChar( &it, C( '<' ) ) ) return false;
-		if ( !NodeT<S>::_expectChar( &it, C( '?' ) ) ) {
-			// No special node. Directly parse the content.
-			it--; // Roll back to the '<'.
-			return this -> rootNode -> appendXML( &it, endFunc );
-		}
-
-
-		// We have a special node
-		static C xmlFlag[] = { C( 'x' ), C( 'm' ), C( 'l' ) };
-		static S encodingStr( "encoding" );
-		static S versionStr( "version" );
-
-		if ( DocumentT<S>::cmpStr( it, xmlFlag, 3 ) ) {
-			it += 3;
-			S paramName;
-			S paramValue;
+		ReaderT<S, C> reader( it, Size( endIt - it ) );
+		const bool bResult( _readXML( &reader ) );
+		it += reader.getPosition();
+		return bResult;
+	}
 
-			while ( _parseParameterSpecial( &it, &paramName, &paramValue, endFunc ) ) {
-				if ( paramName == encodingStr ) {
-					this -> encoding = paramValue;
-				} else if ( paramName == versionStr ) {
-					this -> version = paramValue.toFloat();
-				}
-			}
-		} else {
-			ERROR_SPP( TEXT( "[XML ERROR] : expecting \"<xml...\"." ) );
-			return false;
-		}
+	template<typename S>
+	template<typename C>
+	bool DocumentT<S>::_readXML( ReaderT<S, C> * reader ) {
+		// The previous tree has to be released before it's arena is reused.
+		_unload();
 
-		if ( !NodeT<S>::_expectChar( &it, C( '?' ) ) ) return false;
-		if ( !NodeT<S>::_expectChar( &it, C( '>' ) ) ) return false;
+		S rootName( "#document" );
+		this -> rootNode = NodeT<S>::template _newNode<NodeT<S>>( &this -> arena, rootName, NodeT<S>::Type::Document );
 
+		// The declaration is read by the reader before the first element.
+		const bool bResult( this -> rootNode -> _appendXML( reader, false ) );
+		this -> version = reader -> getVersion();
+		this -> encoding = reader -> getEncoding();
 
-		return this -> rootNode -> appendXML( &it, endFunc );
+		return bResult;
 	}
 
 	template<typename S>
@@ -269,15 +177,6 @@ namespace XML {
 		return readXML( &buffer, endFunc );
 	}
 
-	template<typename S>
-	template<typename C>
-	bool DocumentT<S>::cmpStr( const C * b1, const C * b2, int size ) {
-		for ( int i( 0 ); i < size; i++ ) {
-			if ( b1[i] != b2[i] ) return false;
-		}
-		return true;
-	}
-
 	template<typename S>
 	template<typename Stream>
 	bool DocumentT<S>::read( Stream * stream, int verbose ) {
@@ -292,7 +191,7 @@ namespace XML {
 			_clear();
 			return false;
 		}
-		this -> rootNode = new NodeT<S>( S( "#document" ), NodeT<S>::Type::Document );
+		this -> rootNode = NodeT<S>::template _newNode<NodeT<S>>( &this -> arena, S( "#document" ), NodeT<S>::Type::Document );
 		if ( !IO::read( stream, this -> rootNode , verbose - 1 ) ) {
 			_clear();
 			return false;
@@ -325,19 +224,18 @@ namespace XML {
 
 	template<typename S>
 	void DocumentT<S>::_unload() {
-		delete this -> rootNode;
+		NodeT<S>::_deleteNode( this -> rootNode );
+		this -> rootNode = NULL;
+		this -> arena.clear();
 	}
 
 	template<typename S>
 	bool DocumentT<S>::_readFileXML( const OS::Path & filePath ) {
-		_unload();
-		this -> rootNode = NULL;
-
-		S strOut;
-		if (IO::readToString(filePath, &strOut) != size_t(-1)) {
-			return readXML(strOut);
-		}
-		else {
+		// Streamed from the file through a fixed size buffer, never loaded as a whole.
+		ReaderT<S> reader( filePath );
+		if ( reader.isOpen() ) {
+			return _readXML( &reader );
+		} else {
 			_clear();
 			return false;
 		}